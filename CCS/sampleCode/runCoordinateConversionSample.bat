@@ -7,10 +7,20 @@ REM set library path and data path
 set PATH=..\win;%PATH%
 set MSPCCS_DATA=..\..\data
 
-REM run the test driver
+REM run the test driver, the approximation error check or the batch checks
+if "%1"=="approximation" goto approximation
+if "%1"=="batch" goto batch
 .\testCoordinateConversionSample.exe
 goto done
 
+:approximation
+.\testCoordinateConversionApproximation.exe
+goto done
+
+:batch
+.\testCoordinateSystemBatch.exe
+goto done
+
 :usage
 echo Usage:
 echo    testCoordinateConversionSample.bat
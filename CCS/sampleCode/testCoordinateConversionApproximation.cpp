@@ -0,0 +1,279 @@
+// Classification  : UNCLASSIFIED
+
+/******************************************************************************
+* Filename        : testCoordinateConversionApproximation.cpp
+*
+* MODIFICATION HISTORY:
+*
+* DATE        NAME              DR#               DESCRIPTION
+*
+* 10/19/26                                        Original Code
+*
+******************************************************************************/
+
+#include <math.h>
+#include <iostream>
+#include <vector>
+
+#include "CoordinateConversionService.h"
+#include "CoordinateConversionApproximation.h"
+#include "CoordinateSystemParameters.h"
+#include "GeodeticParameters.h"
+#include "MapProjection5Parameters.h"
+#include "MapProjection6Parameters.h"
+#include "CoordinateTuple.h"
+#include "GeodeticCoordinates.h"
+#include "MapProjectionCoordinates.h"
+#include "Accuracy.h"
+#include "CoordinateType.h"
+#include "HeightType.h"
+#include "SourceOrTarget.h"
+#include "CoordinateConversionException.h"
+
+/**
+ * Checks the error of CoordinateConversionApproximation between its sample
+ * points.
+ *
+ * The approximation checks its fit only at the sample points of each cell,
+ * so maxError() is the largest error found there.  This driver converts a
+ * grid of points much denser than the sample points, placed off the cell
+ * grid, with the approximation and with the exact service, and reports the
+ * largest error it finds.  It exits with status 1 if that error exceeds the
+ * error bound the approximation was asked for.
+ *
+ * |=============================|=============================|
+ * | Source                      | Target                      |
+ * |=============================+=============================|
+ * | Geodetic (Ellipsoid Height) | Transverse Mercator         |
+ * | Transverse Mercator         | Geodetic (Ellipsoid Height) |
+ * | Geodetic (Ellipsoid Height) | Lambert Conformal Conic     |
+ * |=============================|=============================|
+ *
+ **/
+
+namespace
+{
+   const double PI = 3.14159265358979323e0;
+   const double PI_OVER_180 = PI / 180.0;
+
+   // Metres per radian used to measure geodetic errors, as the
+   // approximation does
+   const double GEODETIC_SCALE = 6400000.0;
+
+   // Test points per side of the area; not a multiple of the cell grid
+   const long GRID_SIZE = 401;
+}
+
+
+/**
+ * Converts one point exactly with the service, in the direction the
+ * approximation converts.
+ **/
+void convertExactly(
+   MSP::CCS::CoordinateConversionService& service,
+   MSP::CCS::SourceOrTarget::Enum direction,
+   double x,
+   double y,
+   double& targetX,
+   double& targetY)
+{
+   MSP::CCS::Accuracy sourceAccuracy;
+   MSP::CCS::Accuracy targetAccuracy;
+
+   if( direction == MSP::CCS::SourceOrTarget::source )
+   {
+      MSP::CCS::GeodeticCoordinates sourceCoordinates(
+         MSP::CCS::CoordinateType::geodetic, x, y, 0.0);
+      MSP::CCS::MapProjectionCoordinates targetCoordinates(
+         service.getCoordinateSystem(
+            MSP::CCS::SourceOrTarget::target)->coordinateType());
+
+      service.convertSourceToTarget(
+         &sourceCoordinates,
+         &sourceAccuracy,
+         targetCoordinates,
+         targetAccuracy);
+
+      targetX = targetCoordinates.easting();
+      targetY = targetCoordinates.northing();
+   }
+   else
+   {
+      MSP::CCS::MapProjectionCoordinates sourceCoordinates(
+         service.getCoordinateSystem(
+            MSP::CCS::SourceOrTarget::target)->coordinateType(), x, y);
+      MSP::CCS::GeodeticCoordinates targetCoordinates;
+
+      service.convertTargetToSource(
+         &sourceCoordinates,
+         &sourceAccuracy,
+         targetCoordinates,
+         targetAccuracy);
+
+      targetX = targetCoordinates.longitude();
+      targetY = targetCoordinates.latitude();
+   }
+}
+
+
+/**
+ * Fits an approximation of the service over an area, converts a dense
+ * grid of test points with it and with the service, and returns true if
+ * no test point has an error larger than maxError metres.
+ **/
+bool checkApproximation(
+   const char* name,
+   MSP::CCS::CoordinateConversionService& service,
+   MSP::CCS::SourceOrTarget::Enum direction,
+   double minX,
+   double minY,
+   double maxX,
+   double maxY,
+   double maxError)
+{
+   MSP::CCS::CoordinateConversionApproximation approximation(
+      &service, minX, minY, maxX, maxY, maxError, 6, 8, direction);
+
+   long count = GRID_SIZE * GRID_SIZE;
+   std::vector<double> x( count );
+   std::vector<double> y( count );
+   std::vector<double> targetX( count );
+   std::vector<double> targetY( count );
+   std::vector<const char*> status( count );
+
+   // Offset by a fraction of a step so that the test points fall between
+   // the sample points of the cells
+   double stepX = ( maxX - minX ) / GRID_SIZE;
+   double stepY = ( maxY - minY ) / GRID_SIZE;
+   for( long i = 0; i < GRID_SIZE; i++ )
+   {
+      for( long j = 0; j < GRID_SIZE; j++ )
+      {
+         x[i * GRID_SIZE + j] = minX + ( j + 0.382 ) * stepX;
+         y[i * GRID_SIZE + j] = minY + ( i + 0.618 ) * stepY;
+      }
+   }
+
+   approximation.convert(
+      count, &x[0], &y[0], &targetX[0], &targetY[0], &status[0]);
+
+   double largestError = 0.0;
+   long failed = 0;
+   for( long k = 0; k < count; k++ )
+   {
+      if( status[k] )
+      {
+         failed++;
+         continue;
+      }
+
+      double exactX, exactY;
+      convertExactly( service, direction, x[k], y[k], exactX, exactY );
+
+      double dx = targetX[k] - exactX;
+      double dy = targetY[k] - exactY;
+      if( direction == MSP::CCS::SourceOrTarget::target )
+      {
+         dx *= GEODETIC_SCALE * cos( exactY );
+         dy *= GEODETIC_SCALE;
+      }
+
+      double error = sqrt( dx * dx + dy * dy );
+      // written so that a NaN error fails too
+      if( !( error <= largestError ) )
+         largestError = error;
+   }
+
+   bool passed = ( largestError <= maxError ) && ( failed == 0 );
+
+   std::cout << name << std::endl
+        << std::endl
+        << "Cells (exact): " << approximation.cells()
+        << " (" << approximation.exactCells() << ")" << std::endl
+        << "Exact conversions to fit: " << approximation.samples() << std::endl
+        << "Error bound (m): " << maxError << std::endl
+        << "Largest error at sample points (m): "
+        << approximation.maxError() << std::endl
+        << "Largest error at " << count << " test points (m): "
+        << largestError << std::endl
+        << "Test points not converted: " << failed << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+int main(int argc, char **argv)
+{
+   const char* WGE = "WGE";
+
+   // initialize status value to one, indicating an error condition
+   int status = 1;
+
+   std::cout << "Coordinate Conversion Approximation Test Driver" << std::endl;
+   std::cout << std::endl;
+
+   //
+   // Coordinate System Parameters
+   //
+   MSP::CCS::GeodeticParameters ellipsoidParameters(
+      MSP::CCS::CoordinateType::geodetic,
+      MSP::CCS::HeightType::ellipsoidHeight);
+
+   MSP::CCS::MapProjection5Parameters transverseMercatorParameters(
+      MSP::CCS::CoordinateType::transverseMercator,
+      9.0 * PI_OVER_180, 0.0, 0.9996, 500000.0, 0.0);
+
+   MSP::CCS::MapProjection6Parameters lambertParameters(
+      MSP::CCS::CoordinateType::lambertConformalConic2Parallels,
+      -96.0 * PI_OVER_180, 23.0 * PI_OVER_180,
+      29.5 * PI_OVER_180, 45.5 * PI_OVER_180, 0.0, 0.0);
+
+   try {
+
+      //
+      // Coordinate Conversion Services
+      //
+      MSP::CCS::CoordinateConversionService ccsGeodeticToTransverseMercator(
+         WGE, &ellipsoidParameters,
+         WGE, &transverseMercatorParameters);
+
+      MSP::CCS::CoordinateConversionService ccsGeodeticToLambert(
+         WGE, &ellipsoidParameters,
+         WGE, &lambertParameters);
+
+      bool passed = true;
+
+      passed &= checkApproximation(
+         "Geodetic to Transverse Mercator, 3 to 15 E, 40 to 52 N",
+         ccsGeodeticToTransverseMercator, MSP::CCS::SourceOrTarget::source,
+         3.0 * PI_OVER_180, 40.0 * PI_OVER_180,
+         15.0 * PI_OVER_180, 52.0 * PI_OVER_180, 0.00001);
+
+      passed &= checkApproximation(
+         "Transverse Mercator to Geodetic, 400 by 600 km",
+         ccsGeodeticToTransverseMercator, MSP::CCS::SourceOrTarget::target,
+         300000.0, 4500000.0, 700000.0, 5100000.0, 0.000001);
+
+      passed &= checkApproximation(
+         "Geodetic to Lambert Conformal Conic, 120 to 70 W, 25 to 50 N",
+         ccsGeodeticToLambert, MSP::CCS::SourceOrTarget::source,
+         -120.0 * PI_OVER_180, 25.0 * PI_OVER_180,
+         -70.0 * PI_OVER_180, 50.0 * PI_OVER_180, 0.001);
+
+      if( passed )
+         status = 0;
+   }
+   catch(MSP::CCS::CoordinateConversionException& e)
+   {
+      std::cout << "ERROR: Coordinate Conversion Service exception encountered: "
+                << e.getMessage()
+                << std::endl;
+   }
+
+   return status;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
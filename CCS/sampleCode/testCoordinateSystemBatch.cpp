@@ -0,0 +1,736 @@
+// Classification  : UNCLASSIFIED
+
+/******************************************************************************
+* Filename        : testCoordinateSystemBatch.cpp
+*
+* MODIFICATION HISTORY:
+*
+* DATE        NAME              DR#               DESCRIPTION
+*
+* 10/19/26                                        Original Code
+*
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <iostream>
+#include <vector>
+
+#include "AlbersEqualAreaConic.h"
+#include "BritishNationalGrid.h"
+#include "GARS.h"
+#include "GEOREF.h"
+#include "LambertConformalConic.h"
+#include "ObliqueMercator.h"
+#include "PolarStereographic.h"
+#include "Polyconic.h"
+#include "TransverseMercator.h"
+#include "UTM.h"
+#include "BNGCoordinates.h"
+#include "GeodeticCoordinates.h"
+#include "MapProjectionCoordinates.h"
+#include "CoordinateType.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+#include "CoordinateConversionService.h"
+#include "CollectionOrder.h"
+#include "GeodeticParameters.h"
+#include "UTMParameters.h"
+#include "UTMCoordinates.h"
+#include "Accuracy.h"
+
+/**
+ * Checks the batch conversions of the coordinate systems against their
+ * single point conversions.
+ *
+ * The warm-started batch inverses of the conic projections must give the
+ * results of convertToGeodetic for every point, whatever the order of the
+ * points.  Each is run on unordered points and on a track, and the
+ * latitude iterations it takes are reported against converting each point
+ * from the cold guess.
+ *
+ * The single precision batch conversions of a Transverse Mercator tile
+ * must stay within the error documented in CoordinateSystem, and UTM,
+ * which has no batch conversion of plain eastings and northings, must
+ * report every point as an error.
+ *
+ * GARS and GEOREF cell keys of the same point at each precision must name
+ * the same parent cells once their precision is cleared, and the keys of
+ * GEOREF strings must be those of the points they were written for.
+ *
+ * BNG strings of precisions above 5 must be the 1 meter strings of
+ * precision 5, which convertToGeodetic reads back.
+ *
+ * convertTargetToSourceCollection of a Coordinate Conversion Service must
+ * give the results of convertTargetToSource for every point, in input and
+ * in Hilbert collection order.
+ *
+ * Exits with status 1 if any check fails.
+ *
+ **/
+
+namespace
+{
+   const double PI = 3.14159265358979323e0;
+   const double PI_OVER_180 = PI / 180.0;
+
+   const double WGS84_SEMI_MAJOR_AXIS = 6378137.0;
+   const double WGS84_FLATTENING = 1 / 298.257223563;
+
+   // Points of each check
+   const long POINT_COUNT = 2000;
+
+   // Largest difference from the single point conversion, in radians
+   const double TOLERANCE = 1.0e-9;
+
+   // Largest rounding error of a float, relative to its magnitude
+   const double FLOAT_ROUNDING = 6.0e-8;
+}
+
+
+/**
+ * Returns a random number between minimum and maximum.
+ **/
+double randomBetween( double minimum, double maximum )
+{
+   return minimum + ( maximum - minimum ) * rand() / RAND_MAX;
+}
+
+
+/**
+ * Converts points spread over an area, unordered if track is false or
+ * along the diagonal of the area if it is true, to the projection, then
+ * back with the batch inverse and with convertToGeodetic.  Returns true if
+ * both give the same results for every point.
+ **/
+template< class Projection >
+bool checkBatchInverse(
+   const char* name,
+   Projection& projection,
+   MSP::CCS::CoordinateType::Enum coordinateType,
+   double minLongitude,
+   double minLatitude,
+   double maxLongitude,
+   double maxLatitude,
+   bool track )
+{
+   std::vector<double> x;
+   std::vector<double> y;
+
+   srand( 1 );
+   for( long i = 0; i < POINT_COUNT; i++ )
+   {
+      double longitude, latitude;
+      if( track )
+      {
+         longitude = minLongitude +
+            ( maxLongitude - minLongitude ) * i / POINT_COUNT;
+         latitude = minLatitude +
+            ( maxLatitude - minLatitude ) * i / POINT_COUNT;
+      }
+      else
+      {
+         longitude = randomBetween( minLongitude, maxLongitude );
+         latitude = randomBetween( minLatitude, maxLatitude );
+      }
+
+      try
+      {
+         MSP::CCS::GeodeticCoordinates geodeticCoordinates(
+            MSP::CCS::CoordinateType::geodetic, longitude, latitude );
+         MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates =
+            projection.convertFromGeodetic( &geodeticCoordinates );
+         x.push_back( mapProjectionCoordinates->easting() );
+         y.push_back( mapProjectionCoordinates->northing() );
+         delete mapProjectionCoordinates;
+      }
+      catch( MSP::CCS::CoordinateConversionException& )
+      {
+      }
+   }
+
+   long count = x.size();
+   std::vector<double> longitudes( count );
+   std::vector<double> latitudes( count );
+   std::vector<const char*> status( count );
+   std::vector<long> iterations( count );
+
+   projection.convertToGeodeticBatch( count, &x[0], &y[0], 0,
+      &longitudes[0], &latitudes[0], 0, &status[0], &iterations[0] );
+
+   long mismatched = 0;
+   long batchIterations = 0;
+   long coldIterations = 0;
+   for( long i = 0; i < count; i++ )
+   {
+      batchIterations += iterations[i];
+
+      // A batch of one point starts from the cold guess
+      double longitude, latitude;
+      const char* pointStatus;
+      long pointIterations;
+      projection.convertToGeodeticBatch( 1, &x[i], &y[i], 0,
+         &longitude, &latitude, 0, &pointStatus, &pointIterations );
+      coldIterations += pointIterations;
+
+      MSP::CCS::MapProjectionCoordinates mapProjectionCoordinates(
+         coordinateType, x[i], y[i] );
+      try
+      {
+         MSP::CCS::GeodeticCoordinates* geodeticCoordinates =
+            projection.convertToGeodetic( &mapProjectionCoordinates );
+         if( status[i] ||
+             !( fabs( geodeticCoordinates->longitude() - longitudes[i] )
+                <= TOLERANCE ) ||
+             !( fabs( geodeticCoordinates->latitude() - latitudes[i] )
+                <= TOLERANCE ) )
+            mismatched++;
+         delete geodeticCoordinates;
+      }
+      catch( MSP::CCS::CoordinateConversionException& )
+      {
+         if( !status[i] )
+            mismatched++;
+      }
+   }
+
+   bool passed = ( mismatched == 0 );
+
+   std::cout << name << ( track ? ", track" : ", unordered" ) << std::endl
+        << "Points: " << count << std::endl
+        << "Points differing from convertToGeodetic: " << mismatched
+        << std::endl
+        << "Iterations (cold): " << batchIterations
+        << " (" << coldIterations << ")" << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+/**
+ * Runs checkBatchInverse on unordered points and on a track.
+ **/
+template< class Projection >
+bool checkBatchInverse(
+   const char* name,
+   Projection& projection,
+   MSP::CCS::CoordinateType::Enum coordinateType,
+   double minLongitude,
+   double minLatitude,
+   double maxLongitude,
+   double maxLatitude )
+{
+   bool passed = checkBatchInverse( name, projection, coordinateType,
+      minLongitude, minLatitude, maxLongitude, maxLatitude, false );
+   passed &= checkBatchInverse( name, projection, coordinateType,
+      minLongitude, minLatitude, maxLongitude, maxLatitude, true );
+   return passed;
+}
+
+
+/**
+ * Converts random points of a square tile of the given size, held as
+ * float offsets from its center, to and from the projection with the
+ * single precision batch conversions.  Returns true if the errors against
+ * the double precision batch conversions are within the rounding to float
+ * of offsets the size of the tile, in meters, and every point converted.
+ **/
+bool checkFloatBatch(
+   const char* name,
+   MSP::CCS::CoordinateSystem& projection,
+   double originLongitude,
+   double originLatitude,
+   double tileSize )
+{
+   long count = POINT_COUNT;
+   std::vector<float> longitudeOffsets( count );
+   std::vector<float> latitudeOffsets( count );
+   std::vector<double> longitudes( count );
+   std::vector<double> latitudes( count );
+
+   // Angular half size of the tile, in radians
+   double halfSize = 0.5 * tileSize / WGS84_SEMI_MAJOR_AXIS;
+   double halfWidth = halfSize / cos( originLatitude );
+
+   srand( 1 );
+   for( long i = 0; i < count; i++ )
+   {
+      longitudeOffsets[i] = (float)randomBetween( -halfWidth, halfWidth );
+      latitudeOffsets[i] = (float)randomBetween( -halfSize, halfSize );
+      longitudes[i] = originLongitude + longitudeOffsets[i];
+      latitudes[i] = originLatitude + latitudeOffsets[i];
+   }
+
+   double originX, originY;
+   const char* originStatus;
+   projection.convertFromGeodeticBatch( 1, &originLongitude,
+      &originLatitude, 0, &originX, &originY, 0, &originStatus );
+
+   std::vector<double> x( count );
+   std::vector<double> y( count );
+   std::vector<const char*> status( count );
+   projection.convertFromGeodeticBatch( count, &longitudes[0], &latitudes[0],
+      0, &x[0], &y[0], 0, &status[0] );
+
+   std::vector<float> xOffsets( count );
+   std::vector<float> yOffsets( count );
+   std::vector<const char*> floatStatus( count );
+   projection.convertFromGeodeticFloatBatch( count,
+      originLongitude, originLatitude,
+      &longitudeOffsets[0], &latitudeOffsets[0], originX, originY,
+      &xOffsets[0], &yOffsets[0], &floatStatus[0] );
+
+   long failed = 0;
+   double forwardError = 0.0;
+   for( long i = 0; i < count; i++ )
+   {
+      if( originStatus || status[i] || floatStatus[i] )
+      {
+         failed++;
+         continue;
+      }
+
+      double dx = originX + xOffsets[i] - x[i];
+      double dy = originY + yOffsets[i] - y[i];
+      double error = sqrt( dx * dx + dy * dy );
+      if( !( error <= forwardError ) )
+         forwardError = error;
+   }
+
+   // The double precision results of the float offsets, back again
+   std::vector<float> inverseLongitudeOffsets( count );
+   std::vector<float> inverseLatitudeOffsets( count );
+   projection.convertToGeodeticFloatBatch( count, originX, originY,
+      &xOffsets[0], &yOffsets[0], originLongitude, originLatitude,
+      &inverseLongitudeOffsets[0], &inverseLatitudeOffsets[0],
+      &floatStatus[0] );
+
+   for( long i = 0; i < count; i++ )
+   {
+      x[i] = originX + xOffsets[i];
+      y[i] = originY + yOffsets[i];
+   }
+   projection.convertToGeodeticBatch( count, &x[0], &y[0], 0,
+      &longitudes[0], &latitudes[0], 0, &status[0] );
+
+   double inverseError = 0.0;
+   for( long i = 0; i < count; i++ )
+   {
+      if( status[i] || floatStatus[i] )
+      {
+         failed++;
+         continue;
+      }
+
+      double dx = ( originLongitude + inverseLongitudeOffsets[i] -
+         longitudes[i] ) * WGS84_SEMI_MAJOR_AXIS * cos( latitudes[i] );
+      double dy = ( originLatitude + inverseLatitudeOffsets[i] -
+         latitudes[i] ) * WGS84_SEMI_MAJOR_AXIS;
+      double error = sqrt( dx * dx + dy * dy );
+      if( !( error <= inverseError ) )
+         inverseError = error;
+   }
+
+   double maxError = FLOAT_ROUNDING * tileSize;
+   bool passed = ( failed == 0 ) &&
+      ( forwardError <= maxError ) && ( inverseError <= maxError );
+
+   std::cout << name << ", float tile of " << tileSize << " m" << std::endl
+        << "Points: " << count << std::endl
+        << "Points not converted: " << failed << std::endl
+        << "Error bound (m): " << maxError << std::endl
+        << "Largest error to, from the projection (m): " << forwardError
+        << ", " << inverseError << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+/**
+ * Returns true if the single precision batch conversions of a coordinate
+ * system without a batch conversion of plain eastings and northings report
+ * every point as ErrorMessages::batchConversion.
+ **/
+bool checkFloatBatchUnsupported(
+   const char* name,
+   MSP::CCS::CoordinateSystem& coordinateSystem )
+{
+   const long count = 3;
+   float longitudeOffsets[count] = { 0.0f, 0.001f, -0.001f };
+   float latitudeOffsets[count] = { 0.0f, 0.001f, -0.001f };
+   float x[count];
+   float y[count];
+   const char* status[count];
+   const char* inverseStatus[count];
+
+   coordinateSystem.convertFromGeodeticFloatBatch( count,
+      9.0 * PI_OVER_180, 48.0 * PI_OVER_180,
+      longitudeOffsets, latitudeOffsets, 500000.0, 5300000.0,
+      x, y, status );
+
+   x[0] = x[1] = x[2] = 0.0f;
+   y[0] = y[1] = y[2] = 0.0f;
+   coordinateSystem.convertToGeodeticFloatBatch( count,
+      500000.0, 5300000.0, x, y, 9.0 * PI_OVER_180, 48.0 * PI_OVER_180,
+      longitudeOffsets, latitudeOffsets, inverseStatus );
+
+   long reported = 0;
+   for( long i = 0; i < count; i++ )
+   {
+      if( status[i] == MSP::CCS::ErrorMessages::batchConversion )
+         reported++;
+      if( inverseStatus[i] == MSP::CCS::ErrorMessages::batchConversion )
+         reported++;
+   }
+
+   bool passed = ( reported == 2 * count );
+
+   std::cout << name << ", float batch" << std::endl
+        << "Points reported as not supported: " << reported << " of "
+        << 2 * count << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+/**
+ * Converts random points to GARS and GEOREF cell keys at every precision.
+ * Returns true if, for each point, the keys of all precisions name the
+ * same GARS 30 minute cell and GEOREF 1 degree square, and the key of the
+ * string of each GEOREF key is that key, except for precision 0 keys
+ * whose minutes round up, which are documented not to give it back.
+ **/
+bool checkCellKeys()
+{
+   MSP::CCS::GARS gars;
+   MSP::CCS::GEOREF georef;
+
+   long count = POINT_COUNT;
+   long parentMismatches = 0;
+   long stringMismatches = 0;
+
+   srand( 1 );
+   for( long i = 0; i < count; i++ )
+   {
+      MSP::CCS::GeodeticCoordinates geodeticCoordinates(
+         MSP::CCS::CoordinateType::geodetic,
+         randomBetween( -PI, PI ), randomBetween( -PI / 2, PI / 2 ) );
+
+      MSP::CCS::CellKey garsParent = MSP::CCS::cellKeyFields(
+         gars.convertFromGeodeticToCellKey( &geodeticCoordinates, 0 ) ) >> 6;
+      for( long precision = 1; precision <= 2; precision++ )
+      {
+         MSP::CCS::CellKey key =
+            gars.convertFromGeodeticToCellKey( &geodeticCoordinates, precision );
+         if( ( MSP::CCS::cellKeyFields( key ) >> 6 ) != garsParent )
+            parentMismatches++;
+      }
+
+      MSP::CCS::CellKey georefParent = MSP::CCS::cellKeyFields(
+         georef.convertFromGeodeticToCellKey( &geodeticCoordinates, 5 ) ) >> 34;
+      for( long precision = 0; precision <= 5; precision++ )
+      {
+         MSP::CCS::CellKey key =
+            georef.convertFromGeodeticToCellKey( &geodeticCoordinates, precision );
+         if( ( MSP::CCS::cellKeyFields( key ) >> 34 ) != georefParent )
+            parentMismatches++;
+
+         // the minutes of precision 0 keys are 0 unless they round up,
+         // which writes a digit that is not a valid string
+         if( ( precision == 0 ) &&
+             ( ( key & ( ( (MSP::CCS::CellKey)1 << 34 ) - 1 ) ) != 0 ) )
+            continue;
+
+         char georefString[GEOREF_STRING_SIZE];
+         georef.convertCellKeyToString( key, georefString );
+         if( georef.convertStringToCellKey( georefString ) != key )
+            stringMismatches++;
+      }
+   }
+
+   // A precision 1 string, whose minutes look like those of precision 2:
+   // 0 minutes east of 180 W, 60 minutes north of 89 N
+   MSP::CCS::GeodeticCoordinates geodeticCoordinates(
+      MSP::CCS::CoordinateType::geodetic,
+      -179.99 * PI_OVER_180, 89.95 * PI_OVER_180 );
+   if( georef.convertStringToCellKey( "AMAQ0060" ) !=
+       georef.convertFromGeodeticToCellKey( &geodeticCoordinates, 1 ) )
+      stringMismatches++;
+
+   bool passed = ( parentMismatches == 0 ) && ( stringMismatches == 0 );
+
+   std::cout << "GARS and GEOREF cell keys" << std::endl
+        << "Points: " << count << std::endl
+        << "Parent cells differing between precisions: " << parentMismatches
+        << std::endl
+        << "GEOREF string keys differing from point keys: "
+        << stringMismatches << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+/**
+ * Converts random points in Great Britain to BNG strings of precisions 5
+ * to 7.  Returns true if the strings of precisions 6 and 7 are those of
+ * precision 5, with 5 digits each of easting and northing, and they
+ * convert back to geodetic coordinates.
+ **/
+bool checkBNGPrecision()
+{
+   char ellipsoidCode[3] = "AA";
+   MSP::CCS::BritishNationalGrid bng( ellipsoidCode );
+
+   long count = POINT_COUNT;
+   long mismatches = 0;
+   char example[BNG_STRING_SIZE] = "";
+
+   srand( 1 );
+   for( long i = 0; i < count; i++ )
+   {
+      MSP::CCS::GeodeticCoordinates geodeticCoordinates(
+         MSP::CCS::CoordinateType::geodetic,
+         randomBetween( -5.0 * PI_OVER_180, 1.0 * PI_OVER_180 ),
+         randomBetween( 50.5 * PI_OVER_180, 57.0 * PI_OVER_180 ) );
+
+      MSP::CCS::BNGCoordinates* meters =
+         bng.convertFromGeodetic( &geodeticCoordinates, 5 );
+      for( long precision = 6; precision <= 7; precision++ )
+      {
+         MSP::CCS::BNGCoordinates* bngCoordinates =
+            bng.convertFromGeodetic( &geodeticCoordinates, precision );
+
+         if( strcmp( bngCoordinates->BNGString(), meters->BNGString() ) != 0 )
+            mismatches++;
+         else
+         {
+            // throws if the string cannot be read
+            delete bng.convertToGeodetic( bngCoordinates );
+            if( i == 0 )
+               strcpy( example, bngCoordinates->BNGString() );
+         }
+
+         delete bngCoordinates;
+      }
+
+      if( strlen( meters->BNGString() ) != 13 )
+         mismatches++;
+
+      delete meters;
+   }
+
+   bool passed = ( mismatches == 0 );
+
+   std::cout << "British National Grid, precisions above 5" << std::endl
+        << "Points: " << count << std::endl
+        << "Strings differing from those of precision 5: " << mismatches
+        << std::endl
+        << "Precision 6 string of the first point: " << example << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+/**
+ * Converts UTM points back to geodetic with the target to source
+ * collection conversion of a Geodetic to UTM service, in the given order,
+ * and counts the points whose results differ from those of
+ * convertTargetToSource.
+ **/
+long countTargetToSourceMismatches(
+   MSP::CCS::CoordinateConversionService&    ccs,
+   MSP::CCS::CollectionOrder::Enum           order,
+   const std::vector<MSP::CCS::CoordinateTuple*>& utmCoordinates,
+   const std::vector<MSP::CCS::Accuracy*>&   utmAccuracy )
+{
+   ccs.setCollectionOrder( order );
+
+   std::vector<MSP::CCS::CoordinateTuple*> geodeticCoordinates;
+   std::vector<MSP::CCS::Accuracy*> geodeticAccuracy;
+   ccs.convertTargetToSourceCollection(
+      utmCoordinates, utmAccuracy, geodeticCoordinates, geodeticAccuracy );
+
+   long mismatches = 0;
+   for( size_t i = 0; i < utmCoordinates.size(); i++ )
+   {
+      MSP::CCS::GeodeticCoordinates expected(
+         MSP::CCS::CoordinateType::geodetic );
+      MSP::CCS::Accuracy expectedAccuracy;
+      ccs.convertTargetToSource(
+         utmCoordinates[i], utmAccuracy[i], expected, expectedAccuracy );
+
+      if( i >= geodeticCoordinates.size() ||
+          geodeticCoordinates[i]->coordinateType() !=
+             MSP::CCS::CoordinateType::geodetic ||
+          strlen( geodeticCoordinates[i]->errorMessage() ) != 0 )
+      {
+         mismatches++;
+         continue;
+      }
+
+      MSP::CCS::GeodeticCoordinates* geodetic =
+         (MSP::CCS::GeodeticCoordinates*)geodeticCoordinates[i];
+      if( geodetic->longitude() != expected.longitude() ||
+          geodetic->latitude() != expected.latitude() )
+         mismatches++;
+   }
+
+   for( size_t i = 0; i < geodeticCoordinates.size(); i++ )
+      delete geodeticCoordinates[i];
+   for( size_t i = 0; i < geodeticAccuracy.size(); i++ )
+      delete geodeticAccuracy[i];
+
+   return mismatches;
+}
+
+
+bool checkTargetToSourceCollection()
+{
+   MSP::CCS::GeodeticParameters geodeticParameters(
+      MSP::CCS::CoordinateType::geodetic );
+   MSP::CCS::UTMParameters utmParameters(
+      MSP::CCS::CoordinateType::universalTransverseMercator, 0 );
+   MSP::CCS::CoordinateConversionService ccs(
+      "WGE", &geodeticParameters, "WGE", &utmParameters );
+
+   long count = POINT_COUNT;
+   std::vector<MSP::CCS::CoordinateTuple*> utmCoordinates( count );
+   std::vector<MSP::CCS::Accuracy*> utmAccuracy( count );
+
+   srand( 1 );
+   for( long i = 0; i < count; i++ )
+   {
+      MSP::CCS::GeodeticCoordinates geodetic(
+         MSP::CCS::CoordinateType::geodetic,
+         randomBetween( -20.0 * PI_OVER_180, 40.0 * PI_OVER_180 ),
+         randomBetween( -60.0 * PI_OVER_180, 70.0 * PI_OVER_180 ) );
+      MSP::CCS::Accuracy accuracy;
+
+      utmCoordinates[i] = new MSP::CCS::UTMCoordinates(
+         MSP::CCS::CoordinateType::universalTransverseMercator );
+      utmAccuracy[i] = new MSP::CCS::Accuracy();
+      ccs.convertSourceToTarget(
+         &geodetic, &accuracy, *utmCoordinates[i], *utmAccuracy[i] );
+   }
+
+   long inputMismatches = countTargetToSourceMismatches(
+      ccs, MSP::CCS::CollectionOrder::input, utmCoordinates, utmAccuracy );
+   long hilbertMismatches = countTargetToSourceMismatches(
+      ccs, MSP::CCS::CollectionOrder::hilbert, utmCoordinates, utmAccuracy );
+
+   for( long i = 0; i < count; i++ )
+   {
+      delete utmCoordinates[i];
+      delete utmAccuracy[i];
+   }
+
+   bool passed = ( inputMismatches == 0 && hilbertMismatches == 0 );
+
+   std::cout << "Coordinate Conversion Service, UTM to Geodetic collections"
+        << std::endl
+        << "Points: " << count << std::endl
+        << "Points differing from convertTargetToSource, input order: "
+        << inputMismatches << std::endl
+        << "Points differing from convertTargetToSource, Hilbert order: "
+        << hilbertMismatches << std::endl
+        << ( passed ? "PASSED" : "FAILED" ) << std::endl
+        << std::endl;
+
+   return passed;
+}
+
+
+int main(int argc, char **argv)
+{
+   const double a = WGS84_SEMI_MAJOR_AXIS;
+   const double f = WGS84_FLATTENING;
+
+   // initialize status value to one, indicating an error condition
+   int status = 1;
+
+   std::cout << "Coordinate System Batch Test Driver" << std::endl;
+   std::cout << std::endl;
+
+   try {
+
+      bool passed = true;
+
+      MSP::CCS::Polyconic polyconic( a, f, 0.0, 0.0, 0.0, 0.0 );
+      passed &= checkBatchInverse( "Polyconic", polyconic,
+         MSP::CCS::CoordinateType::polyconic,
+         -40.0 * PI_OVER_180, -80.0 * PI_OVER_180,
+         40.0 * PI_OVER_180, 80.0 * PI_OVER_180 );
+
+      MSP::CCS::LambertConformalConic lambert( a, f,
+         -96.0 * PI_OVER_180, 23.0 * PI_OVER_180,
+         29.5 * PI_OVER_180, 45.5 * PI_OVER_180, 0.0, 0.0 );
+      passed &= checkBatchInverse( "Lambert Conformal Conic", lambert,
+         MSP::CCS::CoordinateType::lambertConformalConic2Parallels,
+         -136.0 * PI_OVER_180, 5.0 * PI_OVER_180,
+         -56.0 * PI_OVER_180, 75.0 * PI_OVER_180 );
+
+      MSP::CCS::AlbersEqualAreaConic albers( a, f,
+         -96.0 * PI_OVER_180, 23.0 * PI_OVER_180,
+         29.5 * PI_OVER_180, 45.5 * PI_OVER_180, 0.0, 0.0 );
+      passed &= checkBatchInverse( "Albers Equal Area Conic", albers,
+         MSP::CCS::CoordinateType::albersEqualAreaConic,
+         -136.0 * PI_OVER_180, 5.0 * PI_OVER_180,
+         -56.0 * PI_OVER_180, 75.0 * PI_OVER_180 );
+
+      MSP::CCS::ObliqueMercator obliqueMercator( a, f, 45.0 * PI_OVER_180,
+         -10.0 * PI_OVER_180, 40.0 * PI_OVER_180,
+         10.0 * PI_OVER_180, 50.0 * PI_OVER_180, 0.0, 0.0, 1.0 );
+      passed &= checkBatchInverse( "Oblique Mercator", obliqueMercator,
+         MSP::CCS::CoordinateType::obliqueMercator,
+         -20.0 * PI_OVER_180, 25.0 * PI_OVER_180,
+         20.0 * PI_OVER_180, 65.0 * PI_OVER_180 );
+
+      MSP::CCS::PolarStereographic polarStereographic( a, f,
+         0.0, 90.0 * PI_OVER_180, 0.0, 0.0 );
+      passed &= checkBatchInverse( "Polar Stereographic", polarStereographic,
+         MSP::CCS::CoordinateType::polarStereographicStandardParallel,
+         -180.0 * PI_OVER_180, 60.0 * PI_OVER_180,
+         180.0 * PI_OVER_180, 89.0 * PI_OVER_180 );
+
+      char ellipsoidCode[3] = "WE";
+      MSP::CCS::TransverseMercator transverseMercator( a, f,
+         9.0 * PI_OVER_180, 0.0, 500000.0, 0.0, 0.9996, ellipsoidCode );
+      passed &= checkFloatBatch( "Transverse Mercator, UTM zone 32",
+         transverseMercator, 10.5 * PI_OVER_180, 48.0 * PI_OVER_180,
+         100000.0 );
+
+      MSP::CCS::UTM utm( a, f, ellipsoidCode );
+      passed &= checkFloatBatchUnsupported( "UTM", utm );
+
+      passed &= checkCellKeys();
+
+      passed &= checkBNGPrecision();
+
+      passed &= checkTargetToSourceCollection();
+
+      if( passed )
+         status = 0;
+   }
+   catch(MSP::CCS::CoordinateConversionException& e)
+   {
+      std::cout << "ERROR: Coordinate Conversion Service exception encountered: "
+                << e.getMessage()
+                << std::endl;
+   }
+
+   return status;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
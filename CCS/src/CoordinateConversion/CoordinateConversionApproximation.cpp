@@ -0,0 +1,433 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Approximation
+ *
+ * ABSTRACT
+ *
+ *    This component approximates the conversion of a Coordinate Conversion
+ *    Service over a rectangular area by piecewise Chebyshev polynomials
+ *    whose error is checked at sample points of each cell.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    Documented that the error is checked at sample points only
+ */
+
+
+#include <math.h>
+#include "CoordinateConversionApproximation.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+
+
+using namespace MSP::CCS;
+
+
+namespace
+{
+  const double PI = 3.14159265358979323e0;
+  const double TWO_PI = 2.0 * PI;
+  const int MAX_DEGREE = 12;
+}
+
+
+CoordinateConversionApproximation::CoordinateConversionApproximation(
+   CoordinateConversionService* service,
+   double                       minX,
+   double                       minY,
+   double                       maxX,
+   double                       maxY,
+   double                       maxError,
+   int                          _degree,
+   int                          _maxDepth,
+   SourceOrTarget::Enum         direction ) :
+   sampler( service, direction ),
+   areaMinX( minX ),
+   areaMinY( minY ),
+   areaMaxX( maxX ),
+   areaMaxY( maxY ),
+   _maxError( maxError ),
+   degree( _degree ),
+   maxDepth( _maxDepth ),
+   _exactCells( 0 ),
+   _verifiedError( 0 ),
+   _samples( 0 )
+{
+  // written so that NaN limits fail too
+  if( !( minX < maxX ) || !( minY < maxY ) || !( maxError > 0 ) ||
+      degree < 1 || degree > MAX_DEGREE || maxDepth < 0 )
+    throw CoordinateConversionException( ErrorMessages::approximation );
+
+  Cell root = { -1, -1 };
+  tree.push_back( root );
+
+  fit( 0, minX, minY, maxX, maxY, 0 );
+}
+
+
+CoordinateConversionApproximation::~CoordinateConversionApproximation()
+{
+}
+
+
+void CoordinateConversionApproximation::convert(
+   long          count,
+   const double* x,
+   const double* y,
+   double*       targetX,
+   double*       targetY,
+   const char**  status ) const
+{
+  std::vector<long>   exactIndex;
+  std::vector<double> exactX;
+  std::vector<double> exactY;
+
+  for( long i = 0; i < count; i++ )
+  {
+    double px = x[i];
+    double py = y[i];
+
+    // written so that NaN coordinates fail too
+    if( !( px >= areaMinX && px <= areaMaxX &&
+           py >= areaMinY && py <= areaMaxY ) )
+    {
+      status[i] = ErrorMessages::invalidArea;
+      continue;
+    }
+
+    double minX = areaMinX;
+    double minY = areaMinY;
+    double maxX = areaMaxX;
+    double maxY = areaMaxY;
+    long cell = 0;
+
+    while( tree[cell].children >= 0 )
+    {
+      double midX = 0.5 * ( minX + maxX );
+      double midY = 0.5 * ( minY + maxY );
+      long child = tree[cell].children;
+
+      if( px < midX )
+        maxX = midX;
+      else
+      {
+        minX = midX;
+        child += 1;
+      }
+      if( py < midY )
+        maxY = midY;
+      else
+      {
+        minY = midY;
+        child += 2;
+      }
+      cell = child;
+    }
+
+    if( tree[cell].coefficients < 0 )
+    {
+      exactIndex.push_back( i );
+      exactX.push_back( px );
+      exactY.push_back( py );
+      continue;
+    }
+
+    evaluate( tree[cell].coefficients,
+       ( 2.0 * px - ( minX + maxX ) ) / ( maxX - minX ),
+       ( 2.0 * py - ( minY + maxY ) ) / ( maxY - minY ),
+       targetX[i], targetY[i] );
+
+    if( sampler.geodeticTarget() )
+      targetX[i] = CoordinateConversionSampler::wrapLongitude( targetX[i] );
+
+    status[i] = 0;
+  }
+
+  long numExact = exactIndex.size();
+  if( numExact > 0 )
+  {
+    std::vector<double>      convertedX( numExact );
+    std::vector<double>      convertedY( numExact );
+    std::vector<const char*> exactStatus( numExact );
+
+    sampler.convert( numExact, &exactX[0], &exactY[0],
+       &convertedX[0], &convertedY[0], &exactStatus[0] );
+
+    for( long j = 0; j < numExact; j++ )
+    {
+      long i = exactIndex[j];
+      targetX[i] = convertedX[j];
+      targetY[i] = convertedY[j];
+      status[i] = exactStatus[j];
+    }
+  }
+}
+
+
+long CoordinateConversionApproximation::cells() const
+{
+  long leaves = 0;
+  for( unsigned int i = 0; i < tree.size(); i++ )
+  {
+    if( tree[i].children < 0 )
+      leaves++;
+  }
+
+  return leaves;
+}
+
+
+long CoordinateConversionApproximation::exactCells() const
+{
+  return _exactCells;
+}
+
+
+double CoordinateConversionApproximation::maxError() const
+{
+  return _verifiedError;
+}
+
+
+long CoordinateConversionApproximation::samples() const
+{
+  return _samples;
+}
+
+
+void CoordinateConversionApproximation::fit(
+   long   cell,
+   double minX,
+   double minY,
+   double maxX,
+   double maxY,
+   int    depth )
+{
+/*
+ *  The function fit interpolates the conversion over one cell at the
+ *  Chebyshev nodes, checks the interpolation on a uniform grid over the
+ *  cell, and splits the cell if the error is too large.
+ *
+ *  cell      : Index of the cell in tree                           (input)
+ *  minX, minY, maxX, maxY : Bounds of the cell                     (input)
+ *  depth     : Number of times the area was split to get the cell  (input)
+ */
+
+  int n = degree + 1;          // nodes per axis
+  int m = degree + 2;          // check points per axis
+  long numNodes = n * n;
+  long numPoints = numNodes + m * m;
+
+  double centerX = 0.5 * ( minX + maxX );
+  double centerY = 0.5 * ( minY + maxY );
+  double halfX = 0.5 * ( maxX - minX );
+  double halfY = 0.5 * ( maxY - minY );
+
+  std::vector<double> chebyshev( n * n );   // T_i(u_k) at [i * n + k]
+  std::vector<double> nodes( n );
+  int i, j, k, l;
+  for( k = 0; k < n; k++ )
+  {
+    double theta = PI * ( k + 0.5 ) / n;
+    nodes[k] = cos( theta );
+    for( i = 0; i < n; i++ )
+      chebyshev[i * n + k] = cos( i * theta );
+  }
+
+  std::vector<double> pointX( numPoints );
+  std::vector<double> pointY( numPoints );
+  for( k = 0; k < n; k++ )
+  {
+    for( l = 0; l < n; l++ )
+    {
+      pointX[k * n + l] = centerX + halfX * nodes[k];
+      pointY[k * n + l] = centerY + halfY * nodes[l];
+    }
+  }
+  for( k = 0; k < m; k++ )
+  {
+    for( l = 0; l < m; l++ )
+    {
+      // the last points are set to the bounds so they are exact
+      pointX[numNodes + k * m + l] =
+         ( k == m - 1 ) ? maxX : minX + ( maxX - minX ) * k / ( m - 1 );
+      pointY[numNodes + k * m + l] =
+         ( l == m - 1 ) ? maxY : minY + ( maxY - minY ) * l / ( m - 1 );
+    }
+  }
+
+  std::vector<double>      exactX( numPoints );
+  std::vector<double>      exactY( numPoints );
+  std::vector<const char*> status( numPoints );
+
+  sampler.convert( numPoints, &pointX[0], &pointY[0],
+     &exactX[0], &exactY[0], &status[0] );
+  _samples += numPoints;
+
+  long failed = 0;
+  for( k = 0; k < numPoints; k++ )
+  {
+    if( status[k] )
+      failed++;
+  }
+
+  bool split = false;
+  if( failed == 0 )
+  {
+    if( sampler.geodeticTarget() )
+    { /* keep the longitudes continuous across 180 degrees */
+      for( k = 1; k < numPoints; k++ )
+      {
+        double offset = exactX[k] - exactX[0];
+        if( offset > PI )
+          exactX[k] -= TWO_PI;
+        else if( offset < -PI )
+          exactX[k] += TWO_PI;
+      }
+    }
+
+    long coefficients = coefficientTable.size();
+    coefficientTable.resize( coefficients + 2 * numNodes, 0.0 );
+    double* cx = &coefficientTable[coefficients];
+    double* cy = cx + numNodes;
+
+    // c_ij = (2 - d_i0)(2 - d_j0) / n^2 * sum_kl f(u_k, u_l) T_i(u_k) T_j(u_l),
+    // summed over k first
+    std::vector<double> partialX( numNodes );
+    std::vector<double> partialY( numNodes );
+    for( i = 0; i < n; i++ )
+    {
+      for( l = 0; l < n; l++ )
+      {
+        double sumX = 0.0;
+        double sumY = 0.0;
+        for( k = 0; k < n; k++ )
+        {
+          sumX += exactX[k * n + l] * chebyshev[i * n + k];
+          sumY += exactY[k * n + l] * chebyshev[i * n + k];
+        }
+        partialX[i * n + l] = sumX;
+        partialY[i * n + l] = sumY;
+      }
+    }
+    for( i = 0; i < n; i++ )
+    {
+      for( j = 0; j < n; j++ )
+      {
+        double sumX = 0.0;
+        double sumY = 0.0;
+        for( l = 0; l < n; l++ )
+        {
+          sumX += partialX[i * n + l] * chebyshev[j * n + l];
+          sumY += partialY[i * n + l] * chebyshev[j * n + l];
+        }
+        double scale = ( ( i == 0 ) ? 1.0 : 2.0 ) *
+           ( ( j == 0 ) ? 1.0 : 2.0 ) / numNodes;
+        cx[i * n + j] = sumX * scale;
+        cy[i * n + j] = sumY * scale;
+      }
+    }
+
+    double cellError = 0.0;
+    for( k = numNodes; k < numPoints; k++ )
+    {
+      double approximateX, approximateY;
+      evaluate( coefficients,
+         ( pointX[k] - centerX ) / halfX, ( pointY[k] - centerY ) / halfY,
+         approximateX, approximateY );
+
+      double error = sampler.distance(
+         approximateX, approximateY, exactX[k], exactY[k] );
+      // written so that a NaN error fails too
+      if( !( error <= cellError ) )
+        cellError = error;
+    }
+
+    if( cellError <= _maxError )
+    {
+      tree[cell].coefficients = coefficients;
+      if( cellError > _verifiedError )
+        _verifiedError = cellError;
+      return;
+    }
+
+    coefficientTable.resize( coefficients );
+    split = true;
+  }
+  else if( failed < numPoints )
+  { /* part of the cell cannot be converted, isolate it */
+    split = true;
+  }
+
+  if( !split || depth >= maxDepth )
+  {
+    _exactCells++;
+    return;
+  }
+
+  long children = tree.size();
+  tree[cell].children = children;
+  Cell child = { -1, -1 };
+  tree.insert( tree.end(), 4, child );
+
+  fit( children,     minX,    minY,    centerX, centerY, depth + 1 );
+  fit( children + 1, centerX, minY,    maxX,    centerY, depth + 1 );
+  fit( children + 2, minX,    centerY, centerX, maxY,    depth + 1 );
+  fit( children + 3, centerX, centerY, maxX,    maxY,    depth + 1 );
+}
+
+
+void CoordinateConversionApproximation::evaluate(
+   long   coefficients,
+   double u,
+   double v,
+   double &targetX,
+   double &targetY ) const
+{
+/*
+ *  The function evaluate sums the Chebyshev series of a cell at (u, v),
+ *  the point scaled to the range -1 to 1 across the cell.
+ */
+
+  int n = degree + 1;
+  const double* cx = &coefficientTable[coefficients];
+  const double* cy = cx + n * n;
+
+  double tu[MAX_DEGREE + 1];
+  double tv[MAX_DEGREE + 1];
+  tu[0] = 1.0;
+  tv[0] = 1.0;
+  tu[1] = u;
+  tv[1] = v;
+  int i, j;
+  for( i = 2; i < n; i++ )
+  {
+    tu[i] = 2.0 * u * tu[i - 1] - tu[i - 2];
+    tv[i] = 2.0 * v * tv[i - 1] - tv[i - 2];
+  }
+
+  double sumX = 0.0;
+  double sumY = 0.0;
+  for( i = 0; i < n; i++ )
+  {
+    double rowX = 0.0;
+    double rowY = 0.0;
+    for( j = 0; j < n; j++ )
+    {
+      rowX += cx[i * n + j] * tv[j];
+      rowY += cy[i * n + j] * tv[j];
+    }
+    sumX += rowX * tu[i];
+    sumY += rowY * tu[i];
+  }
+
+  targetX = sumX;
+  targetY = sumY;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,229 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef CoordinateConversionApproximation_H
+#define CoordinateConversionApproximation_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Approximation
+ *
+ * ABSTRACT
+ *
+ *    This component approximates the conversion of a Coordinate Conversion
+ *    Service over a rectangular area of the source coordinate system, so
+ *    dense grids of points, such as the pixels of a raster tile, can be
+ *    converted without running the full conversion for every point.
+ *
+ *    The area is divided into a quadtree of cells.  In each cell the
+ *    target coordinates are interpolated by bivariate Chebyshev polynomials
+ *    of the given degree, fitted to exact conversions at the Chebyshev
+ *    nodes of the cell.  The fit is then checked against exact conversions
+ *    on a grid covering the cell, including its edges and corners.  A cell
+ *    whose error exceeds maxError, in metres, is split into four, up to
+ *    maxDepth levels.  Cells that still exceed maxError at that depth, or
+ *    that contain points the service cannot convert, are converted exactly.
+ *
+ *    Source and target coordinate systems must be geodetic or map
+ *    projections with easting/northing coordinates.  Geodetic coordinates
+ *    are longitude (x) and latitude (y) in radians; heights are not
+ *    converted.  Geodetic errors are measured as distances on a sphere
+ *    slightly larger than the largest radius of curvature of the earth.
+ *
+ *
+ * ERROR HANDLING
+ *
+ *    The constructor throws CoordinateConversionException if the source or
+ *    target coordinate system is not supported, or if the area or error
+ *    bound is invalid.
+ *
+ *    convert reports errors per point through a status array: 0 if the
+ *    point was converted, otherwise an error message.  Points outside the
+ *    area get ErrorMessages::invalidArea.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The service must outlive the approximation, and must not be changed
+ *    while the approximation is in use.  convert may be called from
+ *    several threads.
+ *
+ *    maxError is not a guaranteed bound.  The fit of a cell is checked
+ *    only at its (degree + 2)^2 sample points, and the error between them
+ *    can be larger than the error found at them.  The check grid is denser
+ *    than the fitting nodes, so for smooth conversions the difference is
+ *    small; sampleCode/testCoordinateConversionApproximation.cpp measures
+ *    it on dense grids of points between the sample points.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    Documented that the error is checked at sample points only
+ */
+
+
+#include <vector>
+#include "SourceOrTarget.h"
+#include "CoordinateConversionSampler.h"
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class CoordinateConversionService;
+
+
+     /**
+      * Polynomial approximation of a conversion over an area, with its
+      * error checked at sample points
+      */
+
+#ifdef WIN32
+     class MSP_CCS CoordinateConversionApproximation
+#else
+     class CoordinateConversionApproximation
+#endif
+     {
+     public:
+
+        /**
+         *  The constructor fits the approximation, converting the sample
+         *  points exactly with the service.
+         *
+         * @param[in] service - exact conversion; not owned
+         * @param[in] minX - west or minimum easting of the area
+         * @param[in] minY - south or minimum northing of the area
+         * @param[in] maxX - east or maximum easting of the area
+         * @param[in] maxY - north or maximum northing of the area
+         * @param[in] maxError - largest error allowed at the sample points
+         *                       of a cell, in metres
+         * @param[in] degree - degree of the polynomials, 1 to 12
+         * @param[in] maxDepth - largest number of times the area is split
+         * @param[in] direction - SourceOrTarget::source approximates source
+         *                        to target, SourceOrTarget::target target
+         *                        to source
+         */
+        CoordinateConversionApproximation(
+           CoordinateConversionService* service,
+           double                       minX,
+           double                       minY,
+           double                       maxX,
+           double                       maxY,
+           double                       maxError,
+           int                          degree = 6,
+           int                          maxDepth = 8,
+           SourceOrTarget::Enum         direction = SourceOrTarget::source );
+
+        ~CoordinateConversionApproximation();
+
+        /**
+         *  Converts count points.  Points in cells that are converted
+         *  exactly are collected and converted after the others.
+         *
+         * @param[in] count - number of points
+         * @param[in] x - longitudes or eastings of the points
+         * @param[in] y - latitudes or northings of the points
+         * @param[out] targetX - converted longitudes or eastings
+         * @param[out] targetY - converted latitudes or northings
+         * @param[out] status - 0 if the point was converted, otherwise the
+         *                      error message
+         */
+        void convert(
+           long          count,
+           const double* x,
+           const double* y,
+           double*       targetX,
+           double*       targetY,
+           const char**  status ) const;
+
+        /**
+         *  Number of cells the area was divided into.
+         */
+        long cells() const;
+
+        /**
+         *  Number of those cells that are converted exactly.
+         */
+        long exactCells() const;
+
+        /**
+         *  Largest error, in metres, found at the sample points of the
+         *  approximated cells.  This is not a bound on the error between
+         *  the sample points, which can be larger.
+         */
+        double maxError() const;
+
+        /**
+         *  Number of exact conversions made to fit and check the cells.
+         */
+        long samples() const;
+
+     private:
+
+        /* Quadtree cell.  children is the index of the first of the four
+           children (south west, south east, north west, north east), or -1
+           for a leaf.  coefficients is the index of a leaf's polynomial
+           coefficients, or -1 if the leaf is converted exactly. */
+        struct Cell
+        {
+           long children;
+           long coefficients;
+        };
+
+        // no copy operators
+        CoordinateConversionApproximation(
+           const CoordinateConversionApproximation& );
+        CoordinateConversionApproximation& operator=(
+           const CoordinateConversionApproximation& );
+
+        void fit(
+           long   cell,
+           double minX,
+           double minY,
+           double maxX,
+           double maxY,
+           int    depth );
+
+        void evaluate(
+           long   coefficients,
+           double u,
+           double v,
+           double &targetX,
+           double &targetY ) const;
+
+        CoordinateConversionSampler sampler;
+
+        double areaMinX;
+        double areaMinY;
+        double areaMaxX;
+        double areaMaxY;
+        double _maxError;
+        int    degree;
+        int    maxDepth;
+
+        std::vector<Cell>   tree;
+        std::vector<double> coefficientTable;
+
+        long   _exactCells;
+        double _verifiedError;
+        long   _samples;
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,589 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Executor
+ *
+ * ABSTRACT
+ *
+ *    This component converts lists of coordinates asynchronously with a
+ *    Coordinate Conversion Service, coalescing small submissions into
+ *    larger collection conversions.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    A batch that throws is converted again request by request
+ */
+
+
+#include <algorithm>
+
+#ifdef WIN32
+#  include <windows.h>
+#else
+#  include <sys/time.h>
+#endif
+
+#include "CoordinateConversionExecutor.h"
+#include "CoordinateConversionService.h"
+#include "Accuracy.h"
+#include "CoordinateTuple.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+#include "CCSThread.h"
+#include "CCSThreadCondition.h"
+
+
+using namespace MSP::CCS;
+using MSP::CCSThread;
+using MSP::CCSThreadCondition;
+
+
+namespace
+{
+  // Number of recent request latencies kept for the percentiles
+  const unsigned int LATENCY_HISTORY = 4096;
+
+
+  double wallClock()
+  {
+#ifdef WIN32
+    return GetTickCount() / 1000.0;
+#else
+    struct timeval now;
+    gettimeofday( &now, 0 );
+    return now.tv_sec + now.tv_usec / 1000000.0;
+#endif
+  }
+
+
+  class ConditionLock
+  {
+  public:
+    ConditionLock( const CCSThreadCondition* theCondition ) :
+       condition( theCondition )
+    {
+      condition->lock();
+    }
+
+    ~ConditionLock()
+    {
+      condition->unlock();
+    }
+
+  private:
+    const CCSThreadCondition* condition;
+  };
+}
+
+
+/************************************************************************/
+/*                     CoordinateConversionRequest
+ */
+
+CoordinateConversionRequest::CoordinateConversionRequest(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   Callback                             _callback,
+   void*                                _userData ) :
+   _sourceCoordinates( sourceCoordinates ),
+   _sourceAccuracy( sourceAccuracy ),
+   callback( _callback ),
+   userData( _userData ),
+   submitTime( wallClock() ),
+   _latency( 0 ),
+   done( false ),
+   condition( new CCSThreadCondition() )
+{
+}
+
+
+CoordinateConversionRequest::~CoordinateConversionRequest()
+{
+  unsigned int i;
+  for( i = 0; i < _targetCoordinates.size(); i++ )
+    delete _targetCoordinates[i];
+
+  // points with no source coordinates pass their source accuracy through
+  for( i = 0; i < _targetAccuracy.size(); i++ )
+  {
+    if( i >= _sourceAccuracy.size() || _targetAccuracy[i] != _sourceAccuracy[i] )
+      delete _targetAccuracy[i];
+  }
+
+  delete condition;
+}
+
+
+bool CoordinateConversionRequest::isDone() const
+{
+  ConditionLock lock( condition );
+
+  return done;
+}
+
+
+void CoordinateConversionRequest::wait() const
+{
+  ConditionLock lock( condition );
+
+  while( !done )
+    condition->wait();
+}
+
+
+bool CoordinateConversionRequest::wait( long milliseconds ) const
+{
+  double deadline = wallClock() + milliseconds / 1000.0;
+
+  ConditionLock lock( condition );
+
+  while( !done )
+  {
+    long remaining = (long)( ( deadline - wallClock() ) * 1000 + 0.999 );
+    if( remaining <= 0 )
+      break;
+
+    condition->timedWait( remaining );
+  }
+
+  return done;
+}
+
+
+const std::vector<CoordinateTuple*>&
+CoordinateConversionRequest::targetCoordinates() const
+{
+  return _targetCoordinates;
+}
+
+
+const std::vector<Accuracy*>&
+CoordinateConversionRequest::targetAccuracy() const
+{
+  return _targetAccuracy;
+}
+
+
+const char* CoordinateConversionRequest::errorMessage() const
+{
+  return _errorMessage.c_str();
+}
+
+
+double CoordinateConversionRequest::latency() const
+{
+  return _latency;
+}
+
+
+void CoordinateConversionRequest::complete()
+{
+/*
+ *  Marks the request done and wakes its waiters.  A waiter may delete the
+ *  request as soon as the lock is released.
+ */
+
+  ConditionLock lock( condition );
+
+  done = true;
+  condition->broadcast();
+}
+
+
+/************************************************************************/
+/*                     CoordinateConversionExecutor
+ */
+
+CoordinateConversionExecutor::CoordinateConversionExecutor(
+   CoordinateConversionService* _service,
+   int                          numThreads,
+   long                         _maxQueuedPoints,
+   long                         _maxBatchPoints,
+   long                         _maxBatchDelay,
+   SourceOrTarget::Enum         _direction ) :
+   service( _service ),
+   direction( _direction ),
+   maxQueuedPoints( _maxQueuedPoints ),
+   maxBatchPoints( _maxBatchPoints ),
+   maxBatchDelay( _maxBatchDelay ),
+   condition( new CCSThreadCondition() ),
+   _queuedPoints( 0 ),
+   stopping( false ),
+   nextLatency( 0 ),
+   _completedRequests( 0 ),
+   _rejectedRequests( 0 ),
+   _batches( 0 )
+{
+  latencies.reserve( LATENCY_HISTORY );
+
+#ifndef NDK_BUILD
+  // Without worker threads the requests are converted by submit
+  for( int i = 0; i < numThreads; i++ )
+  {
+    CCSThread* thread = new CCSThread();
+    if( !thread->start( worker, this ) )
+    {
+      delete thread;
+      break;
+    }
+    threads.push_back( thread );
+  }
+#endif
+}
+
+
+CoordinateConversionExecutor::~CoordinateConversionExecutor()
+{
+  {
+    ConditionLock lock( condition );
+
+    stopping = true;
+    condition->broadcast();
+  }
+
+  for( unsigned int i = 0; i < threads.size(); i++ )
+  {
+    threads[i]->join();
+    delete threads[i];
+  }
+  threads.clear();
+
+  delete condition;
+}
+
+
+CoordinateConversionRequest* CoordinateConversionExecutor::submit(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   CoordinateConversionRequest::Callback callback,
+   void*                                userData )
+{
+  return enqueue( sourceCoordinates, sourceAccuracy, callback, userData, true );
+}
+
+
+CoordinateConversionRequest* CoordinateConversionExecutor::trySubmit(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   CoordinateConversionRequest::Callback callback,
+   void*                                userData )
+{
+  return enqueue( sourceCoordinates, sourceAccuracy, callback, userData, false );
+}
+
+
+double CoordinateConversionExecutor::latencyPercentile( double percentile ) const
+{
+  std::vector<double> sorted;
+  {
+    ConditionLock lock( condition );
+
+    sorted = latencies;
+  }
+
+  if( sorted.empty() )
+    return 0;
+
+  std::sort( sorted.begin(), sorted.end() );
+
+  if( percentile < 0 )
+    percentile = 0;
+  else if( percentile > 100 )
+    percentile = 100;
+
+  unsigned int index = (unsigned int)( percentile / 100 * sorted.size() + 0.5 );
+  if( index > 0 )
+    index--;
+  if( index >= sorted.size() )
+    index = sorted.size() - 1;
+
+  return sorted[index];
+}
+
+
+long CoordinateConversionExecutor::queuedPoints() const
+{
+  ConditionLock lock( condition );
+
+  return _queuedPoints;
+}
+
+
+long CoordinateConversionExecutor::completedRequests() const
+{
+  ConditionLock lock( condition );
+
+  return _completedRequests;
+}
+
+
+long CoordinateConversionExecutor::rejectedRequests() const
+{
+  ConditionLock lock( condition );
+
+  return _rejectedRequests;
+}
+
+
+long CoordinateConversionExecutor::batches() const
+{
+  ConditionLock lock( condition );
+
+  return _batches;
+}
+
+
+CoordinateConversionRequest* CoordinateConversionExecutor::enqueue(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   CoordinateConversionRequest::Callback callback,
+   void*                                userData,
+   bool                                 block )
+{
+  if( sourceCoordinates.size() != sourceAccuracy.size() )
+    throw CoordinateConversionException( ErrorMessages::collectionSize );
+
+  long numPoints = sourceCoordinates.size();
+
+  if( threads.empty() )
+  {
+    CoordinateConversionRequest* request = new CoordinateConversionRequest(
+       sourceCoordinates, sourceAccuracy, callback, userData );
+
+    std::vector<CoordinateConversionRequest*> batch( 1, request );
+    convertBatch( batch );
+
+    return request;
+  }
+
+  ConditionLock lock( condition );
+
+  // A list larger than the whole queue is let in once the queue is empty
+  while( _queuedPoints > 0 && _queuedPoints + numPoints > maxQueuedPoints )
+  {
+    if( !block )
+    {
+      _rejectedRequests++;
+      return 0;
+    }
+
+    condition->wait();
+  }
+
+  CoordinateConversionRequest* request = new CoordinateConversionRequest(
+     sourceCoordinates, sourceAccuracy, callback, userData );
+
+  queue.push_back( request );
+  _queuedPoints += numPoints;
+
+  condition->broadcast();
+
+  return request;
+}
+
+
+bool CoordinateConversionExecutor::convert(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   std::vector<CoordinateTuple*>&       targetCoordinates,
+   std::vector<Accuracy*>&              targetAccuracy,
+   std::string&                         errorMessage )
+{
+/*
+ *  Converts one list of coordinates with the service.  If the conversion
+ *  throws, the partly converted results are deleted, the message is
+ *  returned in errorMessage and false is returned.
+ */
+
+  try
+  {
+    if( direction == SourceOrTarget::source )
+      service->convertSourceToTargetCollection(
+         sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
+    else
+      service->convertTargetToSourceCollection(
+         sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
+  }
+  catch( CoordinateConversionException e )
+  {
+    errorMessage = e.getMessage();
+
+    unsigned int j;
+    for( j = 0; j < targetCoordinates.size(); j++ )
+      delete targetCoordinates[j];
+    for( j = 0; j < targetAccuracy.size(); j++ )
+    {
+      if( j >= sourceAccuracy.size() || targetAccuracy[j] != sourceAccuracy[j] )
+        delete targetAccuracy[j];
+    }
+    targetCoordinates.clear();
+    targetAccuracy.clear();
+
+    return false;
+  }
+
+  return true;
+}
+
+
+void CoordinateConversionExecutor::convertBatch(
+   std::vector<CoordinateConversionRequest*>& batch )
+{
+/*
+ *  Converts the requests in batch with one collection conversion, hands
+ *  each request its slice of the results and completes it.  If the
+ *  collection conversion throws, each request is converted on its own, so
+ *  the error is reported only by the requests it belongs to.
+ */
+
+  unsigned int numRequests = batch.size();
+  unsigned int i;
+
+  std::vector<CoordinateTuple*> sourceCoordinates;
+  std::vector<Accuracy*> sourceAccuracy;
+  for( i = 0; i < numRequests; i++ )
+  {
+    sourceCoordinates.insert( sourceCoordinates.end(),
+       batch[i]->_sourceCoordinates.begin(), batch[i]->_sourceCoordinates.end() );
+    sourceAccuracy.insert( sourceAccuracy.end(),
+       batch[i]->_sourceAccuracy.begin(), batch[i]->_sourceAccuracy.end() );
+  }
+
+  std::vector<CoordinateTuple*> targetCoordinates;
+  std::vector<Accuracy*> targetAccuracy;
+  targetCoordinates.reserve( sourceCoordinates.size() );
+  targetAccuracy.reserve( sourceCoordinates.size() );
+
+  std::string errorMessage;
+  bool converted = convert( sourceCoordinates, sourceAccuracy,
+     targetCoordinates, targetAccuracy, errorMessage );
+
+  unsigned int first = 0;
+  for( i = 0; i < numRequests; i++ )
+  {
+    CoordinateConversionRequest* request = batch[i];
+    unsigned int last = first + request->_sourceCoordinates.size();
+
+    if( converted )
+    {
+      request->_targetCoordinates.assign(
+         targetCoordinates.begin() + first, targetCoordinates.begin() + last );
+      request->_targetAccuracy.assign(
+         targetAccuracy.begin() + first, targetAccuracy.begin() + last );
+    }
+    else if( numRequests == 1 )
+      request->_errorMessage = errorMessage;
+    else
+      convert( request->_sourceCoordinates, request->_sourceAccuracy,
+         request->_targetCoordinates, request->_targetAccuracy,
+         request->_errorMessage );
+
+    first = last;
+  }
+
+  double completeTime = wallClock();
+  for( i = 0; i < numRequests; i++ )
+    batch[i]->_latency = completeTime - batch[i]->submitTime;
+
+  {
+    ConditionLock lock( condition );
+
+    for( i = 0; i < numRequests; i++ )
+    {
+      if( latencies.size() < LATENCY_HISTORY )
+        latencies.push_back( batch[i]->_latency );
+      else
+        latencies[nextLatency] = batch[i]->_latency;
+      nextLatency = ( nextLatency + 1 ) % LATENCY_HISTORY;
+    }
+
+    _completedRequests += numRequests;
+    _batches++;
+  }
+
+  for( i = 0; i < numRequests; i++ )
+  {
+    CoordinateConversionRequest* request = batch[i];
+    CoordinateConversionRequest::Callback callback = request->callback;
+    void* userData = request->userData;
+
+    // Once completed, a request without a callback belongs to its waiter
+    request->complete();
+
+    if( callback )
+      callback( request, userData );
+  }
+}
+
+
+void CoordinateConversionExecutor::worker( void* _executor )
+{
+  CoordinateConversionExecutor* executor =
+     (CoordinateConversionExecutor*)_executor;
+  const CCSThreadCondition* condition = executor->condition;
+
+  std::vector<CoordinateConversionRequest*> batch;
+
+  condition->lock();
+
+  while( true )
+  {
+    while( executor->queue.empty() && !executor->stopping )
+      condition->wait();
+
+    if( executor->queue.empty() )
+      break;
+
+    // Give small submissions a moment to accumulate into a larger batch
+    if( executor->_queuedPoints < executor->maxBatchPoints &&
+        executor->maxBatchDelay > 0 && !executor->stopping )
+    {
+      double deadline = wallClock() + executor->maxBatchDelay / 1000.0;
+      while( executor->_queuedPoints < executor->maxBatchPoints &&
+             !executor->stopping )
+      {
+        long remaining = (long)( ( deadline - wallClock() ) * 1000 + 0.999 );
+        if( remaining <= 0 )
+          break;
+
+        condition->timedWait( remaining );
+      }
+
+      // another worker may have taken the queue meanwhile
+      if( executor->queue.empty() )
+        continue;
+    }
+
+    long batchPoints = 0;
+    batch.clear();
+    while( !executor->queue.empty() )
+    {
+      CoordinateConversionRequest* request = executor->queue.front();
+      long numPoints = request->_sourceCoordinates.size();
+      if( !batch.empty() && batchPoints + numPoints > executor->maxBatchPoints )
+        break;
+
+      batch.push_back( request );
+      batchPoints += numPoints;
+      executor->queue.pop_front();
+    }
+
+    executor->_queuedPoints -= batchPoints;
+
+    // wake submitters waiting for room
+    condition->broadcast();
+    condition->unlock();
+
+    executor->convertBatch( batch );
+
+    condition->lock();
+  }
+
+  condition->unlock();
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,322 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef CoordinateConversionExecutor_H
+#define CoordinateConversionExecutor_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Executor
+ *
+ * ABSTRACT
+ *
+ *    This component converts lists of coordinates asynchronously with a
+ *    Coordinate Conversion Service.  Each submission returns a request that
+ *    can be waited on, or reports completion through a callback.
+ *
+ *    Submissions are queued and converted by a small pool of worker
+ *    threads.  A worker coalesces the queued requests into one collection
+ *    conversion of up to maxBatchPoints points, waiting up to maxBatchDelay
+ *    milliseconds for small submissions to accumulate, so many small
+ *    requests are converted as a few large batches.
+ *
+ *    At most maxQueuedPoints points wait in the queue.  submit blocks
+ *    until there is room, trySubmit returns 0 instead.
+ *
+ *
+ * ERROR HANDLING
+ *
+ *    Conversion errors are reported per coordinate through the error
+ *    message of the target coordinates, as for
+ *    convertSourceToTargetCollection.  Errors that stop a whole request are
+ *    reported by the request's errorMessage.  If such an error stops a
+ *    batch of coalesced requests, each request is converted again on its
+ *    own, so only the requests in error report it.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The service must outlive the executor, and the source coordinates and
+ *    accuracies of a request must stay valid until it has completed.
+ *
+ *    Without a callback, the caller waits for the request and then deletes
+ *    it.  With a callback, the callback is called on a worker thread once
+ *    the request has completed and is responsible for deleting it; such
+ *    requests must not be waited on.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    A batch that throws is converted again request by request
+ */
+
+
+#include <deque>
+#include <string>
+#include <vector>
+#include "SourceOrTarget.h"
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  class CCSThread;
+  class CCSThreadCondition;
+  namespace CCS
+  {
+    class Accuracy;
+    class CoordinateConversionService;
+    class CoordinateTuple;
+    class CoordinateConversionExecutor;
+
+
+     /**
+      * Pending or completed asynchronous conversion
+      */
+
+#ifdef WIN32
+     class MSP_CCS CoordinateConversionRequest
+#else
+     class CoordinateConversionRequest
+#endif
+     {
+     public:
+
+        /**
+         *  Completion callback, called on a worker thread.
+         */
+        typedef void (*Callback)(
+           CoordinateConversionRequest* request,
+           void*                        userData );
+
+        /**
+         *  Destructor.  Deletes the converted coordinates and accuracies.
+         */
+        ~CoordinateConversionRequest();
+
+        /**
+         *  Returns true once the request has been converted.
+         */
+        bool isDone() const;
+
+        /**
+         *  Waits until the request has been converted.
+         */
+        void wait() const;
+
+        /**
+         *  Waits at most milliseconds for the request to be converted.
+         *
+         *  @return true if the request has been converted
+         */
+        bool wait( long milliseconds ) const;
+
+        /**
+         *  Converted coordinates, one per source coordinate, owned by the
+         *  request.  Valid once the request is done.
+         */
+        const std::vector<CoordinateTuple*>& targetCoordinates() const;
+
+        /**
+         *  Converted accuracies, one per source coordinate, owned by the
+         *  request.  Valid once the request is done.
+         */
+        const std::vector<Accuracy*>& targetAccuracy() const;
+
+        /**
+         *  Error that stopped the whole request, or an empty string.
+         */
+        const char* errorMessage() const;
+
+        /**
+         *  Seconds from submission to completion.
+         */
+        double latency() const;
+
+     private:
+
+        friend class CoordinateConversionExecutor;
+
+        CoordinateConversionRequest(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           Callback                             callback,
+           void*                                userData );
+
+        // no copy operators
+        CoordinateConversionRequest( const CoordinateConversionRequest& );
+        CoordinateConversionRequest& operator=(
+           const CoordinateConversionRequest& );
+
+        void complete();
+
+        std::vector<CoordinateTuple*> _sourceCoordinates;
+        std::vector<Accuracy*>        _sourceAccuracy;
+        std::vector<CoordinateTuple*> _targetCoordinates;
+        std::vector<Accuracy*>        _targetAccuracy;
+        std::string                   _errorMessage;
+
+        Callback callback;
+        void*    userData;
+
+        double submitTime;
+        double _latency;
+        bool   done;
+
+        CCSThreadCondition* condition;
+     };
+
+
+     /**
+      * Asynchronous, batching front end to a Coordinate Conversion Service
+      */
+
+#ifdef WIN32
+     class MSP_CCS CoordinateConversionExecutor
+#else
+     class CoordinateConversionExecutor
+#endif
+     {
+     public:
+
+        /**
+         *  The constructor starts the worker threads.
+         *
+         * @param[in] service - converts the requests; not owned
+         * @param[in] numThreads - number of worker threads
+         * @param[in] maxQueuedPoints - points that may wait in the queue
+         * @param[in] maxBatchPoints - points converted in one collection call
+         * @param[in] maxBatchDelay - milliseconds a worker waits for a
+         *                            batch to fill
+         * @param[in] direction - SourceOrTarget::source converts source to
+         *                        target, SourceOrTarget::target target to
+         *                        source
+         */
+        CoordinateConversionExecutor(
+           CoordinateConversionService* service,
+           int                          numThreads = 1,
+           long                         maxQueuedPoints = 100000,
+           long                         maxBatchPoints = 1000,
+           long                         maxBatchDelay = 1,
+           SourceOrTarget::Enum         direction = SourceOrTarget::source );
+
+        /**
+         *  Destructor.  Converts the requests still queued and stops the
+         *  worker threads.
+         */
+        ~CoordinateConversionExecutor();
+
+        /**
+         *  Queues a list of coordinates for conversion, waiting while the
+         *  queue is full.  A list larger than maxQueuedPoints is accepted
+         *  once the queue is empty.
+         *
+         * @param[in] sourceCoordinates - coordinates to be converted
+         * @param[in] sourceAccuracy - accuracies, one per coordinate
+         * @param[in] callback - called when the request completes, or 0
+         * @param[in] userData - passed to the callback
+         * @return the request; with a callback, only a sign that the
+         *         request was accepted, as it may already be deleted
+         */
+        CoordinateConversionRequest* submit(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           CoordinateConversionRequest::Callback callback = 0,
+           void*                                userData = 0 );
+
+        /**
+         *  Same as submit, but returns 0 instead of waiting when the queue
+         *  is full.
+         */
+        CoordinateConversionRequest* trySubmit(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           CoordinateConversionRequest::Callback callback = 0,
+           void*                                userData = 0 );
+
+        /**
+         *  Returns the latency, in seconds, below which the given percentage
+         *  (0 to 100) of the recently completed requests finished.
+         */
+        double latencyPercentile( double percentile ) const;
+
+        /**
+         *  Number of points waiting in the queue.
+         */
+        long queuedPoints() const;
+
+        /**
+         *  Number of requests converted since the executor was created.
+         */
+        long completedRequests() const;
+
+        /**
+         *  Number of trySubmit calls refused because the queue was full.
+         */
+        long rejectedRequests() const;
+
+        /**
+         *  Number of collection conversions the requests were coalesced into.
+         */
+        long batches() const;
+
+     private:
+
+        // no copy operators
+        CoordinateConversionExecutor( const CoordinateConversionExecutor& );
+        CoordinateConversionExecutor& operator=(
+           const CoordinateConversionExecutor& );
+
+        CoordinateConversionRequest* enqueue(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           CoordinateConversionRequest::Callback callback,
+           void*                                userData,
+           bool                                 block );
+
+        bool convert(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           std::vector<CoordinateTuple*>&       targetCoordinates,
+           std::vector<Accuracy*>&              targetAccuracy,
+           std::string&                         errorMessage );
+
+        void convertBatch( std::vector<CoordinateConversionRequest*>& batch );
+
+        static void worker( void* executor );
+
+        CoordinateConversionService* service;
+        SourceOrTarget::Enum         direction;
+        long                         maxQueuedPoints;
+        long                         maxBatchPoints;
+        long                         maxBatchDelay;
+
+        CCSThreadCondition*                      condition;
+        std::vector<CCSThread*>                  threads;
+        std::deque<CoordinateConversionRequest*> queue;
+        long                                     _queuedPoints;
+        bool                                     stopping;
+
+        std::vector<double> latencies;
+        unsigned int        nextLatency;
+        long                _completedRequests;
+        long                _rejectedRequests;
+        long                _batches;
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,245 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Sampler
+ *
+ * ABSTRACT
+ *
+ *    This component converts arrays of x/y coordinates exactly with a
+ *    Coordinate Conversion Service.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ */
+
+
+#include <math.h>
+#include <vector>
+#include "CoordinateConversionSampler.h"
+#include "CoordinateConversionService.h"
+#include "CoordinateSystemParameters.h"
+#include "Accuracy.h"
+#include "GeodeticCoordinates.h"
+#include "MapProjectionCoordinates.h"
+#include "CoordinateSystem.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+
+
+using namespace MSP::CCS;
+
+
+namespace
+{
+  const double PI = 3.14159265358979323e0;
+  const double TWO_PI = 2.0 * PI;
+
+  // Metres per radian used to measure geodetic distances; slightly more
+  // than the polar radius of curvature, the largest of the common ellipsoids
+  const double GEODETIC_SCALE = 6400000.0;
+
+
+  bool isSupported( CoordinateType::Enum coordinateType )
+  {
+    switch( coordinateType )
+    {
+      case CoordinateType::geodetic:
+      case CoordinateType::albersEqualAreaConic:
+      case CoordinateType::azimuthalEquidistant:
+      case CoordinateType::bonne:
+      case CoordinateType::cassini:
+      case CoordinateType::cylindricalEqualArea:
+      case CoordinateType::eckert4:
+      case CoordinateType::eckert6:
+      case CoordinateType::equidistantCylindrical:
+      case CoordinateType::gnomonic:
+      case CoordinateType::lambertConformalConic1Parallel:
+      case CoordinateType::lambertConformalConic2Parallels:
+      case CoordinateType::mercatorStandardParallel:
+      case CoordinateType::mercatorScaleFactor:
+      case CoordinateType::millerCylindrical:
+      case CoordinateType::mollweide:
+      case CoordinateType::newZealandMapGrid:
+      case CoordinateType::neys:
+      case CoordinateType::obliqueMercator:
+      case CoordinateType::orthographic:
+      case CoordinateType::polarStereographicStandardParallel:
+      case CoordinateType::polarStereographicScaleFactor:
+      case CoordinateType::polyconic:
+      case CoordinateType::sinusoidal:
+      case CoordinateType::stereographic:
+      case CoordinateType::transverseCylindricalEqualArea:
+      case CoordinateType::transverseMercator:
+      case CoordinateType::vanDerGrinten:
+      case CoordinateType::webMercator:
+        return true;
+      default:
+        return false;
+    }
+  }
+}
+
+
+CoordinateConversionSampler::CoordinateConversionSampler(
+   CoordinateConversionService* _service,
+   SourceOrTarget::Enum         _direction ) :
+   service( _service ),
+   direction( _direction )
+{
+  SourceOrTarget::Enum targetDirection =
+     ( direction == SourceOrTarget::source ) ?
+        SourceOrTarget::target : SourceOrTarget::source;
+
+  sourceType = service->getCoordinateSystem( direction )->coordinateType();
+  targetType =
+     service->getCoordinateSystem( targetDirection )->coordinateType();
+
+  if( !isSupported( sourceType ) || !isSupported( targetType ) )
+    throw CoordinateConversionException( ErrorMessages::invalidType );
+}
+
+
+void CoordinateConversionSampler::convert(
+   long          count,
+   const double* x,
+   const double* y,
+   double*       targetX,
+   double*       targetY,
+   const char**  status ) const
+{
+/*
+ *  The function convert converts count points with the service.
+ *  Source to target conversions are made as one collection conversion.
+ *  convertTargetToSourceCollection converts from source to target, like
+ *  convertSourceToTargetCollection, so target to source conversions are
+ *  made point by point.
+ */
+
+  Accuracy sourceAccuracy;
+
+  std::vector<CoordinateTuple*> sourceCoordinates( count );
+  std::vector<CoordinateTuple*> targetCoordinates;
+  std::vector<Accuracy*>        targetAccuracies;
+
+  long i;
+  for( i = 0; i < count; i++ )
+    sourceCoordinates[i] = newCoordinates( sourceType, x[i], y[i] );
+
+  if( direction == SourceOrTarget::source )
+  {
+    std::vector<Accuracy*> sourceAccuracies( count, &sourceAccuracy );
+
+    service->convertSourceToTargetCollection(
+       sourceCoordinates, sourceAccuracies,
+       targetCoordinates, targetAccuracies );
+  }
+  else
+  {
+    for( i = 0; i < count; i++ )
+    {
+      CoordinateTuple* coordinates = newCoordinates( targetType, 0, 0 );
+      Accuracy* accuracy = new Accuracy();
+      targetCoordinates.push_back( coordinates );
+      targetAccuracies.push_back( accuracy );
+
+      try
+      {
+        service->convertTargetToSource(
+           sourceCoordinates[i], &sourceAccuracy, *coordinates, *accuracy );
+      }
+      catch( CoordinateConversionException e )
+      {
+        coordinates->setErrorMessage( e.getMessage() );
+      }
+    }
+  }
+
+  for( i = 0; i < count; i++ )
+  {
+    CoordinateTuple* coordinates = targetCoordinates[i];
+
+    if( coordinates->errorMessage()[0] != '\0' )
+      status[i] = CoordinateSystem::errorStatus( coordinates->errorMessage() );
+    else if( targetType == CoordinateType::geodetic )
+    {
+      GeodeticCoordinates* geodetic =
+         dynamic_cast< GeodeticCoordinates* >( coordinates );
+      targetX[i] = geodetic->longitude();
+      targetY[i] = geodetic->latitude();
+      status[i] = 0;
+    }
+    else
+    {
+      MapProjectionCoordinates* mapProjection =
+         dynamic_cast< MapProjectionCoordinates* >( coordinates );
+      targetX[i] = mapProjection->easting();
+      targetY[i] = mapProjection->northing();
+      status[i] = 0;
+    }
+
+    delete sourceCoordinates[i];
+    delete coordinates;
+    delete targetAccuracies[i];
+  }
+}
+
+
+CoordinateTuple* CoordinateConversionSampler::newCoordinates(
+   CoordinateType::Enum coordinateType,
+   double               x,
+   double               y ) const
+{
+  if( coordinateType == CoordinateType::geodetic )
+    return new GeodeticCoordinates( coordinateType, x, y );
+  else
+    return new MapProjectionCoordinates( coordinateType, x, y );
+}
+
+
+double CoordinateConversionSampler::distance(
+   double x1,
+   double y1,
+   double x2,
+   double y2 ) const
+{
+/*
+ *  The function distance returns the distance, in metres, between two
+ *  points of the target coordinate system.
+ */
+
+  if( targetType == CoordinateType::geodetic )
+  {
+    double dx = wrapLongitude( x1 - x2 ) * cos( 0.5 * ( y1 + y2 ) );
+    double dy = y1 - y2;
+    return GEODETIC_SCALE * sqrt( dx * dx + dy * dy );
+  }
+  else
+  {
+    double dx = x1 - x2;
+    double dy = y1 - y2;
+    return sqrt( dx * dx + dy * dy );
+  }
+}
+
+
+bool CoordinateConversionSampler::geodeticTarget() const
+{
+  return targetType == CoordinateType::geodetic;
+}
+
+
+double CoordinateConversionSampler::wrapLongitude( double longitude )
+{
+  if( longitude > PI )
+    longitude -= TWO_PI;
+  else if( longitude < -PI )
+    longitude += TWO_PI;
+
+  return longitude;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,148 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef CoordinateConversionSampler_H
+#define CoordinateConversionSampler_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Sampler
+ *
+ * ABSTRACT
+ *
+ *    This component converts arrays of x/y coordinates exactly with a
+ *    Coordinate Conversion Service, for the components that approximate a
+ *    conversion from exact samples (Coordinate Conversion Approximation,
+ *    Raster Warp Grid).  It also measures the distance, in metres, between
+ *    two points of the target coordinate system.
+ *
+ *    Source and target coordinate systems must be geodetic or map
+ *    projections with easting/northing coordinates.  Geodetic coordinates
+ *    are longitude (x) and latitude (y) in radians; heights are not
+ *    converted.  Geodetic distances are measured on a sphere slightly
+ *    larger than the largest radius of curvature of the earth.
+ *
+ *
+ * ERROR HANDLING
+ *
+ *    The constructor throws CoordinateConversionException if the source or
+ *    target coordinate system is not supported.  convert reports errors per
+ *    point through a status array: 0 if the point was converted, otherwise
+ *    an error message that stays valid for the life of the program.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The service must outlive the sampler.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ */
+
+
+#include "CoordinateType.h"
+#include "SourceOrTarget.h"
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class CoordinateConversionService;
+    class CoordinateTuple;
+
+
+     /**
+      * Exact x/y array conversions with a Coordinate Conversion Service
+      */
+
+#ifdef WIN32
+     class MSP_CCS CoordinateConversionSampler
+#else
+     class CoordinateConversionSampler
+#endif
+     {
+     public:
+
+        /**
+         * @param[in] service - exact conversion; not owned
+         * @param[in] direction - SourceOrTarget::source converts source to
+         *                        target, SourceOrTarget::target target to
+         *                        source
+         */
+        CoordinateConversionSampler(
+           CoordinateConversionService* service,
+           SourceOrTarget::Enum         direction = SourceOrTarget::source );
+
+        /**
+         *  Converts count points.  Source to target conversions are made
+         *  as one collection conversion.
+         *
+         * @param[in] count - number of points
+         * @param[in] x - longitudes or eastings of the points
+         * @param[in] y - latitudes or northings of the points
+         * @param[out] targetX - converted longitudes or eastings
+         * @param[out] targetY - converted latitudes or northings
+         * @param[out] status - 0 if the point was converted, otherwise the
+         *                      error message
+         */
+        void convert(
+           long          count,
+           const double* x,
+           const double* y,
+           double*       targetX,
+           double*       targetY,
+           const char**  status ) const;
+
+        /**
+         *  Distance, in metres, between two points of the target
+         *  coordinate system.
+         */
+        double distance(
+           double x1,
+           double y1,
+           double x2,
+           double y2 ) const;
+
+        /**
+         *  True if the target coordinates are geodetic.
+         */
+        bool geodeticTarget() const;
+
+        /**
+         *  Returns longitude in the range -PI to PI, given a longitude in
+         *  the range -3 PI to 3 PI.
+         */
+        static double wrapLongitude( double longitude );
+
+     private:
+
+        CoordinateTuple* newCoordinates(
+           CoordinateType::Enum coordinateType,
+           double               x,
+           double               y ) const;
+
+        CoordinateConversionService* service;
+        SourceOrTarget::Enum         direction;
+        CoordinateType::Enum         sourceType;
+        CoordinateType::Enum         targetType;
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -86,9 +86,20 @@
  *    06/16/14  Krinsky Add Web Mercator
  *    01/16/16  A. Layne MSP_DR30125 added pass of ellipsoid code into transverseMercator
  *              and UTM. 
+ *    10/19/26  convertCollection takes the service lock once per point,
+ *              so other conversions are not held up by a large collection
+ *    10/19/26  convertCollection reports point errors through status
+ *              codes (tryConvert) instead of exceptions
+ *    10/19/26  Added setCollectionOrder, collections can be converted in
+ *              Hilbert curve order (SpatialOrder)
+ *    10/19/26  The Transverse Mercator to BNG special cases test the
+ *              bngProjection found by setParameters
+ *    10/19/26  convertTargetToSourceCollection converts from the target
+ *              to the source, in the collection order
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "CoordinateConversionService.h"
 #include "CoordinateSystemParameters.h"
 #include "CoordinateTuple.h"
@@ -161,6 +172,7 @@
 #include "WarningMessages.h"
 #include "CCSThreadMutex.h"
 #include "CCSThreadLock.h"
+#include "SpatialOrder.h"
 
 using namespace MSP::CCS;
 using MSP::CCSThreadMutex;
@@ -168,9 +180,45 @@ using MSP::CCSThreadLock;
 
 //                DEFINES
 const double PI = 3.14159265358979323e0;
+const int ERROR_MESSAGE_LENGTH = 2000;   /* as CoordinateConversionException */
 CCSThreadMutex CoordinateConversionService::mutex;
 
 
+namespace
+{
+  /* Formats an error message the way CoordinateConversionException does */
+  void formatErrorMessage(
+     char*       errorMessage,
+     const char* directionStr,
+     const char* coordinateSystemName,
+     const char* separatorStr,
+     const char* message )
+  {
+    strcpy( errorMessage, directionStr );
+    strcat( errorMessage, coordinateSystemName );
+    strcat( errorMessage, separatorStr );
+    strcat( errorMessage, message );
+  }
+
+
+  /* Cleans up after a point that could not be converted */
+  bool conversionFailed(
+     Accuracy&            targetAccuracy,
+     GeodeticCoordinates* convertedGeodetic,
+     GeodeticCoordinates* wgs84Geodetic,
+     GeodeticCoordinates* shiftedGeodetic )
+  {
+    targetAccuracy.set( -1.0, -1.0, -1.0 );
+
+    delete convertedGeodetic;
+    delete wgs84Geodetic;
+    delete shiftedGeodetic;
+
+    return false;
+  }
+}
+
+
 
 CoordinateConversionService::CCSData::CCSData() :
   refCount( 1 )
@@ -214,7 +262,8 @@ CoordinateConversionService::CoordinateConversionService(
    MSP::CCS::CoordinateSystemParameters* sourceParameters,
    const char*                           targetDatumCode,
    MSP::CCS::CoordinateSystemParameters* targetParameters ) :
-   WGS84_datum_index( 0 )
+   WGS84_datum_index( 0 ),
+   collectionOrder( CollectionOrder::input )
 {
   //Instantiate the variables here so exceptions can be caught
   try
@@ -495,6 +544,7 @@ CoordinateConversionService::CoordinateConversionService(
      ccs.coordinateSystemState[SourceOrTarget::target].datumIndex;
 
   WGS84_datum_index = ccs.WGS84_datum_index;
+  collectionOrder = ccs.collectionOrder;
 }
 
 
@@ -558,6 +608,7 @@ CoordinateConversionService& CoordinateConversionService::operator=(
      ccs.coordinateSystemState[SourceOrTarget::target].datumIndex;
 
   WGS84_datum_index = ccs.WGS84_datum_index;
+  collectionOrder = ccs.collectionOrder;
 
   return *this;
 }
@@ -617,7 +668,8 @@ void CoordinateConversionService::convertSourceToTargetCollection(
  *  targetAccuracy     : Target circular, linear and spherical errors  (output)
  */
 
-  convertCollection(
+  convertCollectionInOrder(
+     SourceOrTarget::source, SourceOrTarget::target,
      sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
 }
 
@@ -638,7 +690,8 @@ void CoordinateConversionService::convertTargetToSourceCollection(
  *  sourceAccuracy     : Source circular, linear and spherical errors   (output)
  */
 
-  convertCollection(
+  convertCollectionInOrder(
+     SourceOrTarget::target, SourceOrTarget::source,
      targetCoordinates, targetAccuracy, sourceCoordinates, sourceAccuracy );
 }
     
@@ -667,6 +720,29 @@ DatumLibrary* CoordinateConversionService::getDatumLibrary()
 }
   
   
+void CoordinateConversionService::setCollectionOrder(
+   CollectionOrder::Enum order )
+{
+   /*
+    * The function setCollectionOrder sets the order in which the points
+    * of a collection are converted.
+    */
+
+  collectionOrder = order;
+}
+
+
+CollectionOrder::Enum CoordinateConversionService::getCollectionOrder() const
+{
+   /*
+    * The function getCollectionOrder returns the order in which the points
+    * of a collection are converted.
+    */
+
+  return collectionOrder;
+}
+
+
 int CoordinateConversionService::getServiceVersion()
 {
    /*
@@ -783,6 +859,7 @@ void CoordinateConversionService::initCoordinateSystemState(
   coordinateSystemState[direction].datumIndex       = 0;
   coordinateSystemState[direction].coordinateType   = CoordinateType::geodetic;
   coordinateSystemState[direction].coordinateSystem = 0;
+  coordinateSystemState[direction].bngProjection    = false;
 
   coordinateSystemState[direction].parameters.coordinateSystemParameters = 0;
   coordinateSystemState[direction].parameters.mapProjection3Parameters   = 0;
@@ -1161,6 +1238,8 @@ void CoordinateConversionService::setParameters(
   ellipsoidLibraryImplementation->ellipsoidParameters(
      ellipsoidIndex, &semiMajorAxis, &flattening );
 
+  row->bngProjection = false;
+
   switch( coordinateSystemState[direction].coordinateType )
   {
     case CoordinateType::albersEqualAreaConic:
@@ -1558,6 +1637,14 @@ void CoordinateConversionService::setParameters(
              param->falseNorthing(),
              param->scaleFactor(),
              ellipsoidCode);
+
+       /* BNG converts to and from these parameters directly, in convert */
+       row->bngProjection =
+          ((param->centralMeridian() == -2.0 * PI / 180) &&
+           (param->originLatitude()  == 49.0 * PI / 180) &&
+           (param->scaleFactor()     == .9996012717) &&
+           (param->falseEasting()    == 400000.0) &&
+           (param->falseNorthing()   == -100000.0));
        break;
     }
     case CoordinateType::universalPolarStereographic:
@@ -2195,7 +2282,8 @@ void CoordinateConversionService::convert(
  *  The function convert converts the current source coordinates in the coordinate
  *  system defined by the current source coordinate system parameters and source datum,
  *  into target coordinates in the coordinate system defined by the target coordinate
- *  system parameters and target datum.
+ *  system parameters and target datum.  If the coordinates cannot be converted, an
+ *  exception is thrown with a description of the error.
  *
  *  sourceDirection: Indicates which set of coordinates and parameters to use as the source (input)
  *  targetDirection: Indicates which set of coordinates and parameters to use as the target (input)
@@ -2203,6 +2291,36 @@ void CoordinateConversionService::convert(
 
   CCSThreadLock lock(&mutex);
 
+  char errorMessage[ERROR_MESSAGE_LENGTH];
+
+  if( !tryConvert(
+         sourceDirection, targetDirection,
+         sourceCoordinates, sourceAccuracy,
+         targetCoordinates, targetAccuracy, errorMessage ) )
+    throw CoordinateConversionException( errorMessage );
+}
+
+
+bool CoordinateConversionService::tryConvert(
+   SourceOrTarget::Enum sourceDirection,
+   SourceOrTarget::Enum targetDirection,
+   CoordinateTuple*     sourceCoordinates,
+   Accuracy*            sourceAccuracy,
+   CoordinateTuple&     targetCoordinates,
+   Accuracy&            targetAccuracy,
+   char*                errorMessage )
+{
+/*
+ *  The function tryConvert performs the conversion for convert and
+ *  convertCollection.  Instead of throwing, it returns false and copies the
+ *  error message into errorMessage if the coordinates cannot be converted.
+ *  The caller holds the service lock.
+ *
+ *  sourceDirection: Indicates which set of coordinates and parameters to use as the source (input)
+ *  targetDirection: Indicates which set of coordinates and parameters to use as the target (input)
+ *  errorMessage   : Error message, at least ERROR_MESSAGE_LENGTH characters   (output)
+ */
+
   GeodeticCoordinates* _convertedGeodetic = 0;
   GeodeticCoordinates* _wgs84Geodetic = 0;
   GeodeticCoordinates* _shiftedGeodetic = 0;
@@ -2219,7 +2337,8 @@ void CoordinateConversionService::convert(
      (source->coordinateType == CoordinateType::webMercator) &&
      (target->coordinateType != CoordinateType::geodetic) )
   {
-     throw CoordinateConversionException( ErrorMessages::webmInvalidTargetCS );
+     strcpy( errorMessage, ErrorMessages::webmInvalidTargetCS );
+     return false;
   }
 
   try
@@ -2385,14 +2504,7 @@ void CoordinateConversionService::convert(
       else if ((source->coordinateType == CoordinateType::transverseMercator) &&
                (target->coordinateType == CoordinateType::britishNationalGrid))
       {
-        MapProjection5Parameters* param =
-           source->parameters.mapProjection5Parameters;
-
-        if ((param->centralMeridian() == -2.0 * PI / 180) &&
-            (param->originLatitude()  == 49.0 * PI / 180) &&
-            (param->scaleFactor()     == .9996012717) &&
-            (param->falseEasting()    == 400000.0) &&
-            (param->falseNorthing()   == -100000.0))
+        if (source->bngProjection)
         {
             special = true;
 
@@ -2417,14 +2529,7 @@ void CoordinateConversionService::convert(
       else if((source->coordinateType == CoordinateType::britishNationalGrid) &&
               (target->coordinateType == CoordinateType::transverseMercator))
       {
-        MapProjection5Parameters* param =
-           target->parameters.mapProjection5Parameters;
-
-        if ((param->centralMeridian() == -2.0 * PI / 180) &&
-            (param->originLatitude() == 49.0 * PI / 180) &&
-            (param->scaleFactor() == .9996012717) &&
-            (param->falseEasting() == 400000.0) &&
-            (param->falseNorthing() == -100000.0))
+        if (target->bngProjection)
         {
             special = true;
 
@@ -2444,12 +2549,13 @@ void CoordinateConversionService::convert(
           special = false;
       }
      }
-     catch( CoordinateConversionException e )
+     catch( CoordinateConversionException& e )
      {
-       throw CoordinateConversionException(
-          "Input ",
+       formatErrorMessage(
+          errorMessage, "Input ",
           Coordinate_System_Table[source->coordinateType].Name,
           ": \n", e.getMessage() );
+       return conversionFailed( targetAccuracy, 0, 0, 0 );
     }
 
     if( !special )
@@ -2459,7 +2565,10 @@ void CoordinateConversionService::convert(
       /**********************************************************/
 
       _convertedGeodetic = convertSourceToGeodetic(
-         sourceDirection, sourceCoordinates, sourceWarningMessage );
+         sourceDirection, sourceCoordinates, sourceWarningMessage,
+         errorMessage );
+      if( !_convertedGeodetic )
+        return conversionFailed( targetAccuracy, 0, 0, 0 );
 
       /******************************/
       /* Datum Transformation Stage */
@@ -2501,6 +2610,20 @@ void CoordinateConversionService::convert(
           {
             long valid = 0;
 
+            const char* datumError = datumLibraryImplementation->checkGeodetic(
+               source->datumIndex, _wgs84Geodetic->longitude(),
+               _wgs84Geodetic->latitude() );
+            if( !datumError )
+              datumError = datumLibraryImplementation->checkGeodetic(
+                 target->datumIndex, _wgs84Geodetic->longitude(),
+                 _wgs84Geodetic->latitude() );
+            if( datumError )
+            {
+              strcpy( errorMessage, datumError );
+              return conversionFailed( targetAccuracy,
+                 _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
+            }
+
             /* check source datum validity */
             datumLibraryImplementation->validDatum(
                source->datumIndex, _wgs84Geodetic->longitude(),
@@ -2524,6 +2647,16 @@ void CoordinateConversionService::convert(
         { /* Shift to WGS84, apply geoid correction, shift to target datum */
           if (source->datumIndex != WGS84_datum_index)
           {
+            const char* datumError = datumLibraryImplementation->checkGeodetic(
+               source->datumIndex, _convertedGeodetic->longitude(),
+               _convertedGeodetic->latitude() );
+            if( datumError )
+            {
+              strcpy( errorMessage, datumError );
+              return conversionFailed( targetAccuracy,
+                 _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
+            }
+
             _wgs84Geodetic = datumLibraryImplementation->geodeticShiftToWGS84(
                source->datumIndex, _convertedGeodetic );
 
@@ -2653,6 +2786,16 @@ void CoordinateConversionService::convert(
 
           if (target->datumIndex != WGS84_datum_index)
           {
+            const char* datumError = datumLibraryImplementation->checkGeodetic(
+               target->datumIndex, _wgs84Geodetic->longitude(),
+               _wgs84Geodetic->latitude() );
+            if( datumError )
+            {
+              strcpy( errorMessage, datumError );
+              return conversionFailed( targetAccuracy,
+                 _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
+            }
+
             _shiftedGeodetic = 
                datumLibraryImplementation->geodeticShiftFromWGS84(
                   _wgs84Geodetic, target->datumIndex );
@@ -2708,6 +2851,20 @@ void CoordinateConversionService::convert(
               prec = precT;
            }
 
+           const char* datumError = datumLibraryImplementation->checkGeodetic(
+              source->datumIndex, _wgs84Geodetic->longitude(),
+              _wgs84Geodetic->latitude() );
+           if( !datumError )
+             datumError = datumLibraryImplementation->checkGeodetic(
+                target->datumIndex, _wgs84Geodetic->longitude(),
+                _wgs84Geodetic->latitude() );
+           if( datumError )
+           {
+             strcpy( errorMessage, datumError );
+             return conversionFailed( targetAccuracy,
+                _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
+           }
+
            Accuracy* _targetAccuracy =
               datumLibraryImplementation->datumShiftError(
            source->datumIndex, target->datumIndex,
@@ -2726,9 +2883,11 @@ void CoordinateConversionService::convert(
       /* Second coordinate conversion stage, convert from Geodetic */
       /*************************************************************/
 
-      convertGeodeticToTarget(
-         targetDirection, _shiftedGeodetic,
-         targetCoordinates, targetWarningMessage );
+      if( !convertGeodeticToTarget(
+             targetDirection, _shiftedGeodetic,
+             targetCoordinates, targetWarningMessage, errorMessage ) )
+        return conversionFailed( targetAccuracy,
+           _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
 
       // Format and set the warning message in the target coordinates
       char warningMessage[500] = "";
@@ -2764,17 +2923,14 @@ void CoordinateConversionService::convert(
       }
     } /* if (!special) */
   }
-  catch(CoordinateConversionException e)
+  catch(CoordinateConversionException& e)
   {
-    targetAccuracy.set(-1.0, -1.0, -1.0);
-	
-	/* since initialized to 0 at the top is safe to 
-	   cleanup memory before rethrowing the exception */
-    delete _convertedGeodetic;
-    delete _shiftedGeodetic;
-    delete _wgs84Geodetic;
+    strcpy( errorMessage, e.getMessage() );
 
-    throw CoordinateConversionException(e.getMessage());        
+	/* since initialized to 0 at the top is safe to 
+	   cleanup memory before returning the error */
+    return conversionFailed( targetAccuracy,
+       _convertedGeodetic, _wgs84Geodetic, _shiftedGeodetic );
   }
 
   // cleanup memory before returning
@@ -2782,13 +2938,15 @@ void CoordinateConversionService::convert(
   delete _shiftedGeodetic;
   delete _wgs84Geodetic;
 
+  return true;
 }
 
 
 GeodeticCoordinates* CoordinateConversionService::convertSourceToGeodetic(
    SourceOrTarget::Enum sourceDirection,
    CoordinateTuple*     sourceCoordinates,
-   char*                sourceWarningMessage )
+   char*                sourceWarningMessage,
+   char*                errorMessage )
 {
   Coordinate_State_Row* source = &coordinateSystemState[sourceDirection];
 
@@ -3070,20 +3228,23 @@ GeodeticCoordinates* CoordinateConversionService::convertSourceToGeodetic(
     }
   }
   }
-  catch( CoordinateConversionException e )
+  catch( CoordinateConversionException& e )
   {
-     throw CoordinateConversionException(
-        "Input ", Coordinate_System_Table[source->coordinateType].Name,
+     formatErrorMessage(
+        errorMessage, "Input ",
+        Coordinate_System_Table[source->coordinateType].Name,
         ": \n", e.getMessage() );
+     return 0;
   }
 }
 
 
-void CoordinateConversionService::convertGeodeticToTarget(
+bool CoordinateConversionService::convertGeodeticToTarget(
    SourceOrTarget::Enum targetDirection,
    GeodeticCoordinates* _shiftedGeodetic,
    CoordinateTuple&     targetCoordinates,
-   char*                targetWarningMessage )
+   char*                targetWarningMessage,
+   char*                errorMessage )
 {
   Coordinate_State_Row* target = &coordinateSystemState[targetDirection];
 
@@ -3607,6 +3768,18 @@ void CoordinateConversionService::convertGeodeticToTarget(
     }
     case CoordinateType::universalTransverseMercator:
     {
+        const char* utmError =
+           ((UTM*)(target->coordinateSystem))->checkGeodetic(
+              _shiftedGeodetic );
+        if( utmError )
+        {
+          formatErrorMessage(
+             errorMessage, "Output ",
+             Coordinate_System_Table[target->coordinateType].Name,
+             ": \n", utmError );
+          return false;
+        }
+
         UTMCoordinates* coordinates =
            ((UTM*)(target->coordinateSystem))->convertFromGeodetic(
               _shiftedGeodetic );
@@ -3647,16 +3820,106 @@ void CoordinateConversionService::convertGeodeticToTarget(
     }
   } /* switch (target->coordinateType) */
   }
-  catch( CoordinateConversionException e )
+  catch( CoordinateConversionException& e )
   {
-     throw CoordinateConversionException(
-        "Output ", Coordinate_System_Table[target->coordinateType].Name,
+     formatErrorMessage(
+        errorMessage, "Output ",
+        Coordinate_System_Table[target->coordinateType].Name,
         ": \n", e.getMessage() );
+     return false;
+  }
+
+  return true;
+}
+
+
+void CoordinateConversionService::convertCollectionInOrder(
+   const SourceOrTarget::Enum                     sourceDirection,
+   const SourceOrTarget::Enum                     targetDirection,
+   const std::vector<MSP::CCS::CoordinateTuple*>& sourceCoordinates,
+   const std::vector<MSP::CCS::Accuracy*>&        sourceAccuracy,
+   std::vector<MSP::CCS::CoordinateTuple*>&       targetCoordinates,
+   std::vector<MSP::CCS::Accuracy*>&              targetAccuracy )
+{
+/*
+ *  The function convertCollectionInOrder converts a list of coordinates
+ *  with convertCollection, in the order set by setCollectionOrder.  The
+ *  converted coordinates are returned in input order.
+ *
+ *  sourceDirection    : Coordinate system converted from              (input)
+ *  targetDirection    : Coordinate system converted to                (input)
+ *  sourceCoordinates  : Coordinates to be converted                   (input)
+ *  sourceAccuracy     : Circular, linear and spherical errors         (input)
+ *  targetCoordinates  : Converted coordinates                        (output)
+ *  targetAccuracy     : Circular, linear and spherical errors        (output)
+ */
+
+  int num = sourceCoordinates.size();
+  int numTargetCoordinates = targetCoordinates.size();
+  int numTargetAccuracies = targetAccuracy.size();
+
+  // Target lists that are partly filled are converted in input order, as
+  // the points they hold would not line up with the reordered points
+  if( collectionOrder != CollectionOrder::hilbert || num < 2 ||
+      (int)sourceAccuracy.size() != num ||
+      ( numTargetCoordinates != 0 && numTargetCoordinates != num ) ||
+      ( numTargetAccuracies != 0 && numTargetAccuracies != num ) )
+  {
+    convertCollection(
+       sourceDirection, targetDirection,
+       sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
+    return;
+  }
+
+  std::vector<long> order;
+  SpatialOrder::hilbertOrder( sourceCoordinates, order );
+
+  std::vector<CoordinateTuple*> orderedSourceCoordinates( num );
+  std::vector<Accuracy*>        orderedSourceAccuracy( num );
+  std::vector<CoordinateTuple*> orderedTargetCoordinates( numTargetCoordinates );
+  std::vector<Accuracy*>        orderedTargetAccuracy( numTargetAccuracies );
+  int k;
+  for( k = 0; k < num; k++ )
+  {
+    orderedSourceCoordinates[k] = sourceCoordinates[order[k]];
+    orderedSourceAccuracy[k] = sourceAccuracy[order[k]];
+    if( numTargetCoordinates )
+      orderedTargetCoordinates[k] = targetCoordinates[order[k]];
+    if( numTargetAccuracies )
+      orderedTargetAccuracy[k] = targetAccuracy[order[k]];
+  }
+
+  try
+  {
+    convertCollection(
+       sourceDirection, targetDirection,
+       orderedSourceCoordinates, orderedSourceAccuracy,
+       orderedTargetCoordinates, orderedTargetAccuracy );
+  }
+  catch( CoordinateConversionException e )
+  {
+    // the coordinates created for the caller are not handed back
+    if( numTargetCoordinates == 0 )
+    {
+      for( k = 0; k < (int)orderedTargetCoordinates.size(); k++ )
+        delete orderedTargetCoordinates[k];
+    }
+    throw e;
+  }
+
+  targetCoordinates.resize( num );
+  targetAccuracy.resize( num );
+  for( k = 0; k < num; k++ )
+  {
+    targetCoordinates[order[k]] = orderedTargetCoordinates[k];
+    targetAccuracy[order[k]] = orderedTargetAccuracy[k];
   }
 }
 
 
 void CoordinateConversionService::convertCollection(
+   const SourceOrTarget::Enum                     sourceDirection,
+   const SourceOrTarget::Enum                     targetDirection,
    const std::vector<MSP::CCS::CoordinateTuple*>& sourceCoordinatesCollection,
    const std::vector<MSP::CCS::Accuracy*>&        sourceAccuracyCollection,
    std::vector<MSP::CCS::CoordinateTuple*>&       targetCoordinatesCollection,
@@ -3666,6 +3929,8 @@ void CoordinateConversionService::convertCollection(
  *  The function convertCollection will convert a list of source coordinates
  *  to a list of target coordinates in a single step.
  *
+ *  sourceDirection : Coordinate system converted from                (input)
+ *  targetDirection : Coordinate system converted to                  (input)
  *  sourceCoordinatesCollection : Coordinates to be converted           (input)
  *  sourceAccuracyCollection  : Source circular/linear/spherical errors (input)
  *  targetCoordinatesCollection : Converted coordinates                 (output)
@@ -3676,13 +3941,21 @@ void CoordinateConversionService::convertCollection(
   int numTargetCoordinates = targetCoordinatesCollection.size();
   int numTargetAccuracies = targetAccuracyCollection.size();
   CoordinateType::Enum targetCoordinateType = 
-     coordinateSystemState[SourceOrTarget::target].coordinateType;
+     coordinateSystemState[targetDirection].coordinateType;
 
   CoordinateTuple* _targetCoordinates = 0;
   Accuracy* _targetAccuracy;
 
+  // Points that fail to convert are reported through this buffer rather
+  // than by exceptions, which are slow when many points are invalid
+  char errorMessage[ERROR_MESSAGE_LENGTH];
+
   for( int i = 0; i < num; i++ )
   {
+    // Taken per point, as convert does, so conversions on other threads
+    // are not held up for the whole collection
+    CCSThreadLock lock(&mutex);
+
     CoordinateTuple* _sourceCoordinates = sourceCoordinatesCollection[i];
     Accuracy* _sourceAccuracy = sourceAccuracyCollection[i];
 
@@ -3711,19 +3984,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::albersEqualAreaConic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3739,19 +4004,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::azimuthalEquidistant);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3767,19 +4024,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::bonne);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3795,19 +4044,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::britishNationalGrid);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3823,19 +4064,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::cassini);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3851,19 +4084,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::cylindricalEqualArea);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3879,19 +4104,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::eckert4);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3907,19 +4124,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::eckert6);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3935,19 +4144,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::equidistantCylindrical);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3963,17 +4164,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::geocentric);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source, SourceOrTarget::target,
-               sourceCoordinatesCollection[i], sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -3989,17 +4184,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::geodetic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source, SourceOrTarget::target,
-               sourceCoordinatesCollection[i], sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4014,19 +4203,11 @@ void CoordinateConversionService::convertCollection(
             _targetCoordinates = new GEOREFCoordinates(CoordinateType::georef);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4042,19 +4223,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::globalAreaReferenceSystem);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4070,19 +4243,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::gnomonic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4098,20 +4263,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::lambertConformalConic1Parallel);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates,
-               *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4127,19 +4283,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::lambertConformalConic2Parallels);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4155,19 +4303,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::localCartesian);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4183,19 +4323,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::mercatorStandardParallel);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4211,19 +4343,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::mercatorScaleFactor);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4239,19 +4363,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::militaryGridReferenceSystem);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4267,19 +4383,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::millerCylindrical);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4295,19 +4403,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::mollweide);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4323,19 +4423,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::newZealandMapGrid);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4351,19 +4443,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::neys);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4379,19 +4463,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::obliqueMercator);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4407,19 +4483,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::orthographic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4435,19 +4503,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::polarStereographicStandardParallel);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4463,19 +4523,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::polarStereographicScaleFactor);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4491,19 +4543,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::polyconic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4519,19 +4563,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::sinusoidal);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4547,19 +4583,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::stereographic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4575,19 +4603,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::transverseCylindricalEqualArea);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4603,19 +4623,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::transverseMercator);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4631,19 +4643,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::universalPolarStereographic);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               _sourceCoordinates,
-               _sourceAccuracy,
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4659,19 +4663,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::universalTransverseMercator);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4687,19 +4683,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::usNationalGrid);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4715,19 +4703,11 @@ void CoordinateConversionService::convertCollection(
                CoordinateType::vanDerGrinten);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
@@ -4743,19 +4723,11 @@ void CoordinateConversionService::convertCollection(
                new MapProjectionCoordinates(CoordinateType::webMercator);
             targetCoordinateExists = false;
           }
-          try
-          {
-            convert(
-               SourceOrTarget::source,
-               SourceOrTarget::target,
-               sourceCoordinatesCollection[i],
-               sourceAccuracyCollection[i],
-               *_targetCoordinates, *_targetAccuracy);
-          }
-          catch(CoordinateConversionException e)
-          {
-            _targetCoordinates->setErrorMessage(e.getMessage());
-          }
+          if( !tryConvert(
+                 sourceDirection, targetDirection,
+                 _sourceCoordinates, _sourceAccuracy,
+                 *_targetCoordinates, *_targetAccuracy, errorMessage ) )
+            _targetCoordinates->setErrorMessage( errorMessage );
 
           if(!targetCoordinateExists)
             targetCoordinatesCollection.push_back(_targetCoordinates);
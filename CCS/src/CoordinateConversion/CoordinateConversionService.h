@@ -72,10 +72,17 @@
  *   07-17-06    Added support for GARS
  *   03-17-07    Original C++ Code
  *   07-20-10    NGL BAEts27152 Updated getServiceVersion to return an int
+ *   10-19-26    Added setCollectionOrder, to convert collections in Hilbert
+ *               curve order
+ *   10-19-26    Whether a Transverse Mercator source or target has the BNG
+ *               parameters is found when its parameters are set
+ *   10-19-26    convertTargetToSourceCollection converts from the target to
+ *               the source, in the collection order
  */
 
 
 #include <vector>
+#include "CollectionOrder.h"
 #include "CoordinateType.h"
 #include "Precision.h"
 #include "SourceOrTarget.h"
@@ -274,6 +281,39 @@ namespace MSP
            std::vector<MSP::CCS::Accuracy*>&              sourceAccuracy );
 
 
+        /*
+         *  The function setCollectionOrder sets the order in which
+         *  convertSourceToTargetCollection and
+         *  convertTargetToSourceCollection convert the points of a
+         *  collection.  CollectionOrder::hilbert converts them in the order
+         *  of a Hilbert curve over their input coordinates, grouped by
+         *  zone or hemisphere (see Spatial Order), so points close to each
+         *  other are converted one after the other; the results are stored
+         *  in the input order.  Only the speed of the conversion changes.
+         *
+         *  Use CollectionOrder::hilbert only for conversions that reload
+         *  data when a point is far from the previous one, such as EGM2008
+         *  heights from the area of interest grid, on collections spread
+         *  over an area larger than the grid.  Other conversions are
+         *  slower in Hilbert order, by up to twice the time: converting
+         *  Geodetic points spread over the world to UTM takes about 1.5
+         *  times as long as in input order.  The default is
+         *  CollectionOrder::input.
+         *
+         * @param[in] order - order of the conversions
+         */
+        void setCollectionOrder( CollectionOrder::Enum order );
+
+
+        /*
+         *  The function getCollectionOrder returns the order in which
+         *  collections are converted.
+         *
+         * @return Order of the conversions
+         */
+        CollectionOrder::Enum getCollectionOrder() const;
+
+
         /*
          * The function getEllipsoidLibrary returns the ellipsoid library 
          * which provides access to ellipsoidparameter information.
@@ -404,6 +444,7 @@ namespace MSP
            CoordinateType::Enum coordinateType; // current CS type
            Parameters parameters;               // current CS parameters
            CoordinateSystem* coordinateSystem;  // current CS
+           bool bngProjection;  // CS is Transverse Mercator with the BNG parameters
       };
 
         /* coordinateSystemState[x] is set up as follows:
@@ -415,6 +456,8 @@ namespace MSP
 
         long WGS84_datum_index;
 
+        CollectionOrder::Enum collectionOrder;
+
         /*
          *  The function setDataLibraries sets the initial state of the engine
          *  in preparation for coordinate conversion and/or datum transformation
@@ -518,23 +561,71 @@ namespace MSP
            Accuracy&            targetAccuracy );
 
 
+        /*
+         *  The function tryConvert performs the conversion for convert and
+         *  convertCollection.  Instead of throwing, it returns false and
+         *  copies the error message into errorMessage if the coordinates
+         *  cannot be converted, so collections with many invalid points do
+         *  not pay for an exception per point.  The caller holds the service
+         *  lock.
+         *
+         *  errorMessage   : Error message buffer (2000 characters)   (output)
+         */
+
+        bool tryConvert(
+           SourceOrTarget::Enum sourceDirection,
+           SourceOrTarget::Enum targetDirection,
+           CoordinateTuple*     sourceCoordinates,
+           Accuracy*            sourceAccuracy,
+           CoordinateTuple&     targetCoordinates,
+           Accuracy&            targetAccuracy,
+           char*                errorMessage );
+
+
         GeodeticCoordinates* convertSourceToGeodetic(
            SourceOrTarget::Enum sourceDirection,
            CoordinateTuple*     sourceCoordinates,
-           char*                sourceWarningMessage );
+           char*                sourceWarningMessage,
+           char*                errorMessage );
 
 
-      void convertGeodeticToTarget(
+      bool convertGeodeticToTarget(
          SourceOrTarget::Enum targetDirection,
          GeodeticCoordinates* _shiftedGeodetic,
          CoordinateTuple&     targetCoordinates,
-         char*                targetWarningMessage );
+         char*                targetWarningMessage,
+         char*                errorMessage );
+
+
+        /*
+         *  The function convertCollectionInOrder converts a list of
+         *  coordinates with convertCollection, in the order set by
+         *  setCollectionOrder, and returns the converted coordinates in
+         *  input order.
+         *
+         *  sourceDirection    : Coordinate system converted from       (input)
+         *  targetDirection    : Coordinate system converted to         (input)
+         *  sourceCoordinates  : Coordinates to be converted            (input)
+         *  sourceAccuracy     : Circular, linear and spherical errors  (input)
+         *  targetCoordinates  : Converted coordinates                 (output)
+         *  targetAccuracy     : Circular, linear and spherical errors (output)
+         */
+
+        void convertCollectionInOrder(
+           const SourceOrTarget::Enum sourceDirection,
+           const SourceOrTarget::Enum targetDirection,
+           const std::vector<MSP::CCS::CoordinateTuple*>& sourceCoordinates,
+           const std::vector<MSP::CCS::Accuracy*>& sourceAccuracy,
+           std::vector<MSP::CCS::CoordinateTuple*>& targetCoordinates,
+           std::vector<MSP::CCS::Accuracy*>& targetAccuracy );
 
 
         /*
          *  The function convertCollection will convert a list of source
          *  coordinates to a list of target coordinates in a single step.
          *
+         *  sourceDirection              : Coordinate system converted from, source or target            (input)
+         *  targetDirection              : Coordinate system converted to, source or target              (input)
          *  sourceCoordinatesCollection  : Coordinates of the source coordinate system to be converted   (input)
          *  sourceAccuracyCollection     : Source circular, linear and spherical errors                  (input)
          *  targetCoordinatesCollection  : Converted coordinates of the target coordinate system         (output)
@@ -542,6 +633,8 @@ namespace MSP
          */
 
         void convertCollection(
+           const SourceOrTarget::Enum sourceDirection,
+           const SourceOrTarget::Enum targetDirection,
            const std::vector<MSP::CCS::CoordinateTuple*>& sourceCoordinatesCollection,
            const std::vector<MSP::CCS::Accuracy*>& sourceAccuracyCollection,
            std::vector<MSP::CCS::CoordinateTuple*>& targetCoordinatesCollection,
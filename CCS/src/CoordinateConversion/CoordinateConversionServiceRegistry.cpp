@@ -0,0 +1,585 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Service Registry
+ *
+ * ABSTRACT
+ *
+ *    This component shares Coordinate Conversion Services between callers
+ *    converting with the same datums and coordinate systems.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    Handles expose the conversions instead of the service
+ *   10-19-26    Services are built outside the registry lock
+ */
+
+
+#include <ctype.h>
+#include <stdio.h>
+
+#include "CoordinateConversionServiceRegistry.h"
+#include "CoordinateConversionService.h"
+#include "CoordinateSystemParameters.h"
+#include "EquidistantCylindricalParameters.h"
+#include "GeodeticParameters.h"
+#include "LocalCartesianParameters.h"
+#include "MapProjection3Parameters.h"
+#include "MapProjection4Parameters.h"
+#include "MapProjection5Parameters.h"
+#include "MapProjection6Parameters.h"
+#include "MercatorStandardParallelParameters.h"
+#include "MercatorScaleFactorParameters.h"
+#include "NeysParameters.h"
+#include "ObliqueMercatorParameters.h"
+#include "PolarStereographicStandardParallelParameters.h"
+#include "PolarStereographicScaleFactorParameters.h"
+#include "UTMParameters.h"
+#include "CoordinateType.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+#include "CCSThreadMutex.h"
+#include "CCSThreadLock.h"
+
+
+using namespace MSP::CCS;
+using MSP::CCSThreadMutex;
+using MSP::CCSThreadLock;
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    struct CoordinateConversionServiceEntry
+    {
+      std::string                  key;
+      CoordinateConversionService* service;
+      long                         refCount;
+    };
+  }
+}
+
+
+namespace
+{
+  // Guards the reference counts of all entries, which handles update
+  // without holding their registry's mutex
+  CCSThreadMutex refCountMutex;
+
+
+  void acquire( CoordinateConversionServiceEntry* entry )
+  {
+    CCSThreadLock lock( &refCountMutex );
+    entry->refCount++;
+  }
+
+
+  void release( CoordinateConversionServiceEntry* entry )
+  {
+    {
+      CCSThreadLock lock( &refCountMutex );
+      if( --entry->refCount > 0 )
+        return;
+    }
+
+    delete entry->service;
+    delete entry;
+  }
+
+
+  void appendDatum( std::string& key, const char* datumCode )
+  {
+    if( !datumCode )
+      throw CoordinateConversionException( ErrorMessages::invalidDatumCode );
+
+    // Same normalization as the datum library's code lookup
+    for( const char* c = datumCode; *c; c++ )
+    {
+      if( !isspace( (unsigned char)*c ) )
+        key += (char)toupper( (unsigned char)*c );
+    }
+    key += '|';
+  }
+
+
+  void appendValue( std::string& key, double value )
+  {
+    char buffer[32];
+    sprintf( buffer, "%.17g,", value );
+    key += buffer;
+  }
+
+
+  void appendParameters(
+     std::string&                key,
+     CoordinateSystemParameters* parameters )
+  {
+    if( !parameters )
+      throw CoordinateConversionException(
+         ErrorMessages::invalidType );
+
+    CoordinateType::Enum coordinateType = parameters->coordinateType();
+    appendValue( key, coordinateType );
+
+    switch( coordinateType )
+    {
+      case CoordinateType::albersEqualAreaConic:
+      case CoordinateType::lambertConformalConic2Parallels:
+      {
+        MapProjection6Parameters* p =
+           dynamic_cast< MapProjection6Parameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->originLatitude() );
+        appendValue( key, p->standardParallel1() );
+        appendValue( key, p->standardParallel2() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::azimuthalEquidistant:
+      case CoordinateType::bonne:
+      case CoordinateType::cassini:
+      case CoordinateType::cylindricalEqualArea:
+      case CoordinateType::gnomonic:
+      case CoordinateType::orthographic:
+      case CoordinateType::polyconic:
+      case CoordinateType::stereographic:
+      {
+        MapProjection4Parameters* p =
+           dynamic_cast< MapProjection4Parameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->originLatitude() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::eckert4:
+      case CoordinateType::eckert6:
+      case CoordinateType::millerCylindrical:
+      case CoordinateType::mollweide:
+      case CoordinateType::sinusoidal:
+      case CoordinateType::vanDerGrinten:
+      {
+        MapProjection3Parameters* p =
+           dynamic_cast< MapProjection3Parameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::equidistantCylindrical:
+      {
+        EquidistantCylindricalParameters* p =
+           dynamic_cast< EquidistantCylindricalParameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->standardParallel() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::geodetic:
+      {
+        GeodeticParameters* p =
+           dynamic_cast< GeodeticParameters* >( parameters );
+        appendValue( key, p->heightType() );
+        break;
+      }
+      case CoordinateType::lambertConformalConic1Parallel:
+      case CoordinateType::transverseMercator:
+      case CoordinateType::transverseCylindricalEqualArea:
+      {
+        MapProjection5Parameters* p =
+           dynamic_cast< MapProjection5Parameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->originLatitude() );
+        appendValue( key, p->scaleFactor() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::localCartesian:
+      {
+        LocalCartesianParameters* p =
+           dynamic_cast< LocalCartesianParameters* >( parameters );
+        appendValue( key, p->longitude() );
+        appendValue( key, p->latitude() );
+        appendValue( key, p->height() );
+        appendValue( key, p->orientation() );
+        break;
+      }
+      case CoordinateType::mercatorStandardParallel:
+      {
+        MercatorStandardParallelParameters* p =
+           dynamic_cast< MercatorStandardParallelParameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->standardParallel() );
+        appendValue( key, p->scaleFactor() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::mercatorScaleFactor:
+      {
+        MercatorScaleFactorParameters* p =
+           dynamic_cast< MercatorScaleFactorParameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->scaleFactor() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::neys:
+      {
+        NeysParameters* p = dynamic_cast< NeysParameters* >( parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->originLatitude() );
+        appendValue( key, p->standardParallel1() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::obliqueMercator:
+      {
+        ObliqueMercatorParameters* p =
+           dynamic_cast< ObliqueMercatorParameters* >( parameters );
+        appendValue( key, p->originLatitude() );
+        appendValue( key, p->longitude1() );
+        appendValue( key, p->latitude1() );
+        appendValue( key, p->longitude2() );
+        appendValue( key, p->latitude2() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        appendValue( key, p->scaleFactor() );
+        break;
+      }
+      case CoordinateType::polarStereographicStandardParallel:
+      {
+        PolarStereographicStandardParallelParameters* p =
+           dynamic_cast< PolarStereographicStandardParallelParameters* >(
+              parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->standardParallel() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::polarStereographicScaleFactor:
+      {
+        PolarStereographicScaleFactorParameters* p =
+           dynamic_cast< PolarStereographicScaleFactorParameters* >(
+              parameters );
+        appendValue( key, p->centralMeridian() );
+        appendValue( key, p->scaleFactor() );
+        appendValue( key, p->hemisphere() );
+        appendValue( key, p->falseEasting() );
+        appendValue( key, p->falseNorthing() );
+        break;
+      }
+      case CoordinateType::universalTransverseMercator:
+      {
+        UTMParameters* p = dynamic_cast< UTMParameters* >( parameters );
+        appendValue( key, p->zone() );
+        appendValue( key, p->override() );
+        break;
+      }
+      default:
+        // No parameters beyond the coordinate type
+        break;
+    }
+
+    key += '|';
+  }
+}
+
+
+/************************************************************************/
+/*                  SharedCoordinateConversionService                   */
+/************************************************************************/
+
+SharedCoordinateConversionService::SharedCoordinateConversionService() :
+   entry( 0 )
+{
+}
+
+
+SharedCoordinateConversionService::SharedCoordinateConversionService(
+   CoordinateConversionServiceEntry* _entry ) :
+   entry( _entry )
+{
+  acquire( entry );
+}
+
+
+SharedCoordinateConversionService::SharedCoordinateConversionService(
+   const SharedCoordinateConversionService& shared ) :
+   entry( shared.entry )
+{
+  if( entry )
+    acquire( entry );
+}
+
+
+SharedCoordinateConversionService::~SharedCoordinateConversionService()
+{
+  release();
+}
+
+
+SharedCoordinateConversionService& SharedCoordinateConversionService::operator=(
+   const SharedCoordinateConversionService& shared )
+{
+  if( entry != shared.entry )
+  {
+    if( shared.entry )
+      acquire( shared.entry );
+    release();
+    entry = shared.entry;
+  }
+
+  return *this;
+}
+
+
+bool SharedCoordinateConversionService::empty() const
+{
+  return entry == 0;
+}
+
+
+void SharedCoordinateConversionService::convertSourceToTarget(
+   CoordinateTuple* sourceCoordinates,
+   Accuracy*        sourceAccuracy,
+   CoordinateTuple& targetCoordinates,
+   Accuracy&        targetAccuracy ) const
+{
+  entry->service->convertSourceToTarget(
+     sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
+}
+
+
+void SharedCoordinateConversionService::convertTargetToSource(
+   CoordinateTuple* targetCoordinates,
+   Accuracy*        targetAccuracy,
+   CoordinateTuple& sourceCoordinates,
+   Accuracy&        sourceAccuracy ) const
+{
+  entry->service->convertTargetToSource(
+     targetCoordinates, targetAccuracy, sourceCoordinates, sourceAccuracy );
+}
+
+
+void SharedCoordinateConversionService::convertSourceToTargetCollection(
+   const std::vector<CoordinateTuple*>& sourceCoordinates,
+   const std::vector<Accuracy*>&        sourceAccuracy,
+   std::vector<CoordinateTuple*>&       targetCoordinates,
+   std::vector<Accuracy*>&              targetAccuracy ) const
+{
+  entry->service->convertSourceToTargetCollection(
+     sourceCoordinates, sourceAccuracy, targetCoordinates, targetAccuracy );
+}
+
+
+void SharedCoordinateConversionService::convertTargetToSourceCollection(
+   const std::vector<CoordinateTuple*>& targetCoordinates,
+   const std::vector<Accuracy*>&        targetAccuracy,
+   std::vector<CoordinateTuple*>&       sourceCoordinates,
+   std::vector<Accuracy*>&              sourceAccuracy ) const
+{
+  entry->service->convertTargetToSourceCollection(
+     targetCoordinates, targetAccuracy, sourceCoordinates, sourceAccuracy );
+}
+
+
+const char* SharedCoordinateConversionService::getDatum(
+   const SourceOrTarget::Enum direction ) const
+{
+  return entry->service->getDatum( direction );
+}
+
+
+const CoordinateSystemParameters* SharedCoordinateConversionService::getCoordinateSystem(
+   const SourceOrTarget::Enum direction ) const
+{
+  return entry->service->getCoordinateSystem( direction );
+}
+
+
+void SharedCoordinateConversionService::release()
+{
+  if( entry )
+  {
+    ::release( entry );
+    entry = 0;
+  }
+}
+
+
+/************************************************************************/
+/*                 CoordinateConversionServiceRegistry                  */
+/************************************************************************/
+
+CoordinateConversionServiceRegistry::CoordinateConversionServiceRegistry(
+   unsigned int capacity ) :
+   mutex( new CCSThreadMutex() ),
+   _capacity( capacity > 0 ? capacity : 1 ),
+   _hits( 0 ),
+   _misses( 0 ),
+   _evictions( 0 )
+{
+}
+
+
+CoordinateConversionServiceRegistry::~CoordinateConversionServiceRegistry()
+{
+  clear();
+
+  delete mutex;
+  mutex = 0;
+}
+
+
+SharedCoordinateConversionService CoordinateConversionServiceRegistry::get(
+   const char*                 sourceDatumCode,
+   CoordinateSystemParameters* sourceParameters,
+   const char*                 targetDatumCode,
+   CoordinateSystemParameters* targetParameters )
+{
+  std::string key = makeKey(
+     sourceDatumCode, sourceParameters, targetDatumCode, targetParameters );
+
+  {
+    CCSThreadLock lock( mutex );
+
+    EntryMap::iterator found = index.find( key );
+    if( found != index.end() )
+    {
+      _hits++;
+      entries.splice( entries.begin(), entries, found->second );
+      return SharedCoordinateConversionService( *found->second );
+    }
+
+    _misses++;
+  }
+
+  // Built without the lock, so gets of other services are not held up
+  // while the datum and ellipsoid tables are read.  Throws for invalid
+  // datums or parameters, leaving the registry unchanged.
+  CoordinateConversionService* service = new CoordinateConversionService(
+     sourceDatumCode, sourceParameters, targetDatumCode, targetParameters );
+
+  CoordinateConversionServiceEntry* entry =
+     new CoordinateConversionServiceEntry;
+  entry->key      = key;
+  entry->service  = service;
+  entry->refCount = 1;   // held by the registry
+
+  SharedCoordinateConversionService shared;
+  EntryList dropped;
+  {
+    CCSThreadLock lock( mutex );
+
+    EntryMap::iterator found = index.find( key );
+    if( found != index.end() )
+    {
+      // Another thread added the service while this one was built
+      entries.splice( entries.begin(), entries, found->second );
+      shared = SharedCoordinateConversionService( *found->second );
+      dropped.push_back( entry );
+    }
+    else
+    {
+      entries.push_front( entry );
+      index[key] = entries.begin();
+      shared = SharedCoordinateConversionService( entry );
+
+      while( entries.size() > _capacity )
+      {
+        CoordinateConversionServiceEntry* oldest = entries.back();
+        entries.pop_back();
+        index.erase( oldest->key );
+        dropped.push_back( oldest );
+        _evictions++;
+      }
+    }
+  }
+
+  // Services no longer held are deleted outside the lock too
+  for( EntryList::iterator i = dropped.begin(); i != dropped.end(); ++i )
+    ::release( *i );
+
+  return shared;
+}
+
+
+void CoordinateConversionServiceRegistry::clear()
+{
+  CCSThreadLock lock( mutex );
+
+  for( EntryList::iterator i = entries.begin(); i != entries.end(); ++i )
+    ::release( *i );
+
+  entries.clear();
+  index.clear();
+}
+
+
+unsigned int CoordinateConversionServiceRegistry::capacity() const
+{
+  return _capacity;
+}
+
+
+unsigned int CoordinateConversionServiceRegistry::size() const
+{
+  CCSThreadLock lock( mutex );
+
+  return entries.size();
+}
+
+
+long CoordinateConversionServiceRegistry::hits() const
+{
+  CCSThreadLock lock( mutex );
+
+  return _hits;
+}
+
+
+long CoordinateConversionServiceRegistry::misses() const
+{
+  CCSThreadLock lock( mutex );
+
+  return _misses;
+}
+
+
+long CoordinateConversionServiceRegistry::evictions() const
+{
+  CCSThreadLock lock( mutex );
+
+  return _evictions;
+}
+
+
+std::string CoordinateConversionServiceRegistry::makeKey(
+   const char*                 sourceDatumCode,
+   CoordinateSystemParameters* sourceParameters,
+   const char*                 targetDatumCode,
+   CoordinateSystemParameters* targetParameters )
+{
+  std::string key;
+
+  appendDatum( key, sourceDatumCode );
+  appendParameters( key, sourceParameters );
+  appendDatum( key, targetDatumCode );
+  appendParameters( key, targetParameters );
+
+  return key;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,278 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef CoordinateConversionServiceRegistry_H
+#define CoordinateConversionServiceRegistry_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Coordinate Conversion Service Registry
+ *
+ * ABSTRACT
+ *
+ *    This component keeps the Coordinate Conversion Services built for the
+ *    (source datum, source coordinate system, target datum, target
+ *    coordinate system) combinations in use, so each combination is set up
+ *    once and shared instead of being constructed or copied for every
+ *    caller.
+ *
+ *    Services are looked up by a key made from the datum codes, normalized
+ *    as the datum library compares them (upper case, blanks removed), and
+ *    every coordinate system parameter value.  At most capacity services
+ *    are kept; the least recently used one is dropped when a new one is
+ *    added.
+ *
+ *    get returns a SharedCoordinateConversionService, a reference counted
+ *    handle.  Copying a handle only copies a pointer, so each thread can
+ *    keep its own handle to the same service.  A service is deleted when
+ *    it has been dropped from the registry and its last handle is gone.
+ *
+ *    The handle gives access to the conversions and to the service's
+ *    datums and coordinate systems, but not to the service itself, so a
+ *    holder cannot change a service other holders convert with.  Shared services keep the
+ *    default collection order (CollectionOrder::input); callers that
+ *    need another order construct their own CoordinateConversionService.
+ *
+ *
+ * ERROR HANDLING
+ *
+ *    Errors building a service (invalid datum or coordinate system
+ *    parameters) are thrown by get as CoordinateConversionException, and
+ *    nothing is added to the registry.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The services are shared and immutable.  Conversions are serialized
+ *    by a lock that every CoordinateConversionService in the process
+ *    shares, taken per point, so threads converting with a shared
+ *    service, or with different services, do not convert in parallel.
+ *    A service is built without holding the registry's lock, so a get
+ *    that builds a service does not hold up gets of other services.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    Handles expose the conversions instead of the service
+ *   10-19-26    Services are built outside the registry lock
+ */
+
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "SourceOrTarget.h"
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  class CCSThreadMutex;
+  namespace CCS
+  {
+    class CoordinateConversionService;
+    class CoordinateSystemParameters;
+    class CoordinateTuple;
+    class Accuracy;
+    class CoordinateConversionServiceRegistry;
+    struct CoordinateConversionServiceEntry;
+
+
+     /**
+      * Reference counted handle to a registry's Coordinate Conversion Service
+      */
+
+#ifdef WIN32
+     class MSP_CCS SharedCoordinateConversionService
+#else
+     class SharedCoordinateConversionService
+#endif
+     {
+     public:
+
+        /**
+         *  Creates an empty handle.
+         */
+        SharedCoordinateConversionService();
+
+        SharedCoordinateConversionService(
+           const SharedCoordinateConversionService& shared );
+
+        ~SharedCoordinateConversionService();
+
+        SharedCoordinateConversionService& operator=(
+           const SharedCoordinateConversionService& shared );
+
+        /**
+         *  Returns true for an empty handle.
+         */
+        bool empty() const;
+
+        /**
+         *  The conversion functions call those of the shared service; see
+         *  CoordinateConversionService.  The handle must not be empty.
+         */
+        void convertSourceToTarget(
+           CoordinateTuple* sourceCoordinates,
+           Accuracy*        sourceAccuracy,
+           CoordinateTuple& targetCoordinates,
+           Accuracy&        targetAccuracy ) const;
+
+        void convertTargetToSource(
+           CoordinateTuple* targetCoordinates,
+           Accuracy*        targetAccuracy,
+           CoordinateTuple& sourceCoordinates,
+           Accuracy&        sourceAccuracy ) const;
+
+        void convertSourceToTargetCollection(
+           const std::vector<CoordinateTuple*>& sourceCoordinates,
+           const std::vector<Accuracy*>&        sourceAccuracy,
+           std::vector<CoordinateTuple*>&       targetCoordinates,
+           std::vector<Accuracy*>&              targetAccuracy ) const;
+
+        void convertTargetToSourceCollection(
+           const std::vector<CoordinateTuple*>& targetCoordinates,
+           const std::vector<Accuracy*>&        targetAccuracy,
+           std::vector<CoordinateTuple*>&       sourceCoordinates,
+           std::vector<Accuracy*>&              sourceAccuracy ) const;
+
+        /**
+         *  Returns the datum code of the source or target.
+         *
+         * @param[in] direction - source or target
+         */
+        const char* getDatum( const SourceOrTarget::Enum direction ) const;
+
+        /**
+         *  Returns the parameters of the source or target coordinate
+         *  system.
+         *
+         * @param[in] direction - source or target
+         */
+        const CoordinateSystemParameters* getCoordinateSystem(
+           const SourceOrTarget::Enum direction ) const;
+
+     private:
+
+        friend class CoordinateConversionServiceRegistry;
+
+        explicit SharedCoordinateConversionService(
+           CoordinateConversionServiceEntry* entry );
+
+        void release();
+
+        CoordinateConversionServiceEntry* entry;
+     };
+
+
+     /**
+      * Bounded, least recently used cache of Coordinate Conversion Services
+      */
+
+#ifdef WIN32
+     class MSP_CCS CoordinateConversionServiceRegistry
+#else
+     class CoordinateConversionServiceRegistry
+#endif
+     {
+     public:
+
+        /**
+         * @param[in] capacity - number of services kept (at least 1)
+         */
+        CoordinateConversionServiceRegistry( unsigned int capacity = 256 );
+
+        /**
+         *  Destructor.  Services still held by handles stay valid.
+         */
+        ~CoordinateConversionServiceRegistry();
+
+        /**
+         *  Returns the service converting between the given datums and
+         *  coordinate systems, building it on first use.
+         *
+         * @param[in] sourceDatumCode - standard 5-letter datum code
+         * @param[in] sourceParameters - input coordinate system
+         * @param[in] targetDatumCode - standard 5-letter datum code
+         * @param[in] targetParameters - output coordinate system
+         */
+        SharedCoordinateConversionService get(
+           const char*                 sourceDatumCode,
+           CoordinateSystemParameters* sourceParameters,
+           const char*                 targetDatumCode,
+           CoordinateSystemParameters* targetParameters );
+
+        /**
+         *  Drops every service from the registry.
+         */
+        void clear();
+
+        unsigned int capacity() const;
+
+        /**
+         *  Number of services in the registry.
+         */
+        unsigned int size() const;
+
+        /**
+         *  Number of get calls answered from the registry.
+         */
+        long hits() const;
+
+        /**
+         *  Number of get calls that built a service.
+         */
+        long misses() const;
+
+        /**
+         *  Number of services dropped to make room for new ones.
+         */
+        long evictions() const;
+
+     private:
+
+        typedef std::list<CoordinateConversionServiceEntry*> EntryList;
+        typedef std::map<std::string, EntryList::iterator>  EntryMap;
+
+        // no copy operators
+        CoordinateConversionServiceRegistry(
+           const CoordinateConversionServiceRegistry& );
+        CoordinateConversionServiceRegistry& operator=(
+           const CoordinateConversionServiceRegistry& );
+
+        static std::string makeKey(
+           const char*                 sourceDatumCode,
+           CoordinateSystemParameters* sourceParameters,
+           const char*                 targetDatumCode,
+           CoordinateSystemParameters* targetParameters );
+
+        CCSThreadMutex* mutex;
+
+        unsigned int _capacity;
+
+        // most recently used first
+        EntryList entries;
+        EntryMap  index;
+
+        long _hits;
+        long _misses;
+        long _evictions;
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,593 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Raster Warp Grid
+ *
+ * ABSTRACT
+ *
+ *    This component interpolates the source raster coordinates of the
+ *    pixels of an output raster from exact conversions on an adaptively
+ *    refined lattice of nodes.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ */
+
+
+#include "RasterWarpGrid.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+#include "CCSThread.h"
+
+
+using namespace MSP::CCS;
+using MSP::CCSThread;
+
+
+namespace
+{
+  void catmullRom( double t, double* weights )
+  {
+    double t2 = t * t;
+    double t3 = t2 * t;
+
+    weights[0] = 0.5 * ( -t3 + 2.0 * t2 - t );
+    weights[1] = 0.5 * ( 3.0 * t3 - 5.0 * t2 + 2.0 );
+    weights[2] = 0.5 * ( -3.0 * t3 + 4.0 * t2 + t );
+    weights[3] = 0.5 * ( t3 - t2 );
+  }
+}
+
+
+RasterWarpGrid::RasterWarpGrid(
+   CoordinateConversionService* service,
+   long                         _width,
+   long                         _height,
+   double                       _originX,
+   double                       _originY,
+   double                       _pixelWidth,
+   double                       _pixelHeight,
+   double                       _tolerance,
+   long                         _nodeSpacing,
+   Interpolation                _interpolation,
+   SourceOrTarget::Enum         direction ) :
+   sampler( service, direction ),
+   width( _width ),
+   height( _height ),
+   originX( _originX ),
+   originY( _originY ),
+   pixelWidth( _pixelWidth ),
+   pixelHeight( _pixelHeight ),
+   tolerance( _tolerance ),
+   nodeSpacing( 1 ),
+   interpolation( _interpolation ),
+   leaves( 0 )
+{
+  // written so that a NaN tolerance fails too
+  if( width < 1 || height < 1 || _nodeSpacing < 1 || !( tolerance > 0 ) )
+    throw CoordinateConversionException( ErrorMessages::rasterWarp );
+
+  while( nodeSpacing * 2 <= _nodeSpacing )
+    nodeSpacing *= 2;
+
+  cellColumns = ( width - 1 + nodeSpacing - 1 ) / nodeSpacing;
+  if( cellColumns < 1 )
+    cellColumns = 1;
+  cellRows = ( height - 1 + nodeSpacing - 1 ) / nodeSpacing;
+  if( cellRows < 1 )
+    cellRows = 1;
+
+  refine();
+}
+
+
+RasterWarpGrid::~RasterWarpGrid()
+{
+}
+
+
+void RasterWarpGrid::sourceCoordinates(
+   double*      x,
+   double*      y,
+   const char** status,
+   int          numThreads ) const
+{
+  RowJob job;
+  job.grid = this;
+  job.x = x;
+  job.y = y;
+  job.status = status;
+  job.pixels = false;
+  job.sourceOriginX = 0;
+  job.sourceOriginY = 0;
+  job.sourcePixelWidth = 1;
+  job.sourcePixelHeight = 1;
+
+  fill( job, numThreads );
+}
+
+
+void RasterWarpGrid::sourcePixels(
+   double       sourceOriginX,
+   double       sourceOriginY,
+   double       sourcePixelWidth,
+   double       sourcePixelHeight,
+   double*      column,
+   double*      row,
+   const char** status,
+   int          numThreads ) const
+{
+  RowJob job;
+  job.grid = this;
+  job.x = column;
+  job.y = row;
+  job.status = status;
+  job.pixels = true;
+  job.sourceOriginX = sourceOriginX;
+  job.sourceOriginY = sourceOriginY;
+  job.sourcePixelWidth = sourcePixelWidth;
+  job.sourcePixelHeight = sourcePixelHeight;
+
+  fill( job, numThreads );
+}
+
+
+long RasterWarpGrid::nodes() const
+{
+  return nodeTable.size();
+}
+
+
+long RasterWarpGrid::cells() const
+{
+  return leaves;
+}
+
+
+void RasterWarpGrid::refine()
+{
+/*
+ *  The function refine builds the lattice one level of cells at a time.
+ *  The nodes all cells of a level need are converted together, then each
+ *  cell either becomes a leaf or is split into four cells of the next
+ *  level.
+ */
+
+  std::vector<PendingCell> pending;
+  std::vector<PendingCell> next;
+
+  long numRoots = cellColumns * cellRows;
+  Cell root = { -1, -1, false };
+  tree.assign( numRoots, root );
+  for( long i = 0; i < numRoots; i++ )
+  {
+    PendingCell cell;
+    cell.cell = i;
+    cell.column = ( i % cellColumns ) * nodeSpacing;
+    cell.row = ( i / cellColumns ) * nodeSpacing;
+    cell.size = nodeSpacing;
+    pending.push_back( cell );
+  }
+
+  while( !pending.empty() )
+  {
+    std::vector<long> columns;
+    std::vector<long> rows;
+    unsigned int p;
+    int i, j;
+
+    for( p = 0; p < pending.size(); p++ )
+    {
+      const PendingCell& cell = pending[p];
+      if( cell.column > width - 1 || cell.row > height - 1 )
+        continue;
+
+      if( interpolation == bicubic )
+      {
+        for( j = -1; j <= 2; j++ )
+        {
+          for( i = -1; i <= 2; i++ )
+            requestNode( cell.column + i * cell.size,
+               cell.row + j * cell.size, columns, rows );
+        }
+      }
+      else
+      {
+        for( j = 0; j <= 1; j++ )
+        {
+          for( i = 0; i <= 1; i++ )
+            requestNode( cell.column + i * cell.size,
+               cell.row + j * cell.size, columns, rows );
+        }
+      }
+      if( cell.size > 1 )
+        requestNode( cell.column + cell.size / 2, cell.row + cell.size / 2,
+           columns, rows );
+      if( cell.size > 2 )
+      {
+        for( j = 1; j <= 3; j += 2 )
+        {
+          for( i = 1; i <= 3; i += 2 )
+            requestNode( cell.column + i * cell.size / 4,
+               cell.row + j * cell.size / 4, columns, rows );
+        }
+      }
+    }
+
+    long count = columns.size();
+    if( count > 0 )
+    {
+      std::vector<double>      x( count );
+      std::vector<double>      y( count );
+      std::vector<double>      sourceX( count );
+      std::vector<double>      sourceY( count );
+      std::vector<const char*> status( count );
+
+      for( long k = 0; k < count; k++ )
+      {
+        x[k] = originX + columns[k] * pixelWidth;
+        y[k] = originY + rows[k] * pixelHeight;
+      }
+
+      sampler.convert(
+         count, &x[0], &y[0], &sourceX[0], &sourceY[0], &status[0] );
+
+      long first = nodeTable.size() - count;
+      for( long k = 0; k < count; k++ )
+      {
+        nodeTable[first + k].x = sourceX[k];
+        nodeTable[first + k].y = sourceY[k];
+        nodeTable[first + k].status = status[k];
+      }
+    }
+
+    next.clear();
+    for( p = 0; p < pending.size(); p++ )
+    {
+      const PendingCell& cell = pending[p];
+      if( cell.column > width - 1 || cell.row > height - 1 )
+        continue;
+
+      long references[16];
+      bool cornersConverted = true;
+      bool allConverted = true;
+      for( j = -1; j <= 2; j++ )
+      {
+        for( i = -1; i <= 2; i++ )
+        {
+          bool corner = ( i == 0 || i == 1 ) && ( j == 0 || j == 1 );
+          if( !corner && interpolation != bicubic )
+            continue;
+
+          long reference = nodeIndex.find( nodeKey(
+             cell.column + i * cell.size, cell.row + j * cell.size ) )->second;
+          references[( j + 1 ) * 4 + i + 1] = reference;
+
+          if( nodeTable[reference].status )
+          {
+            allConverted = false;
+            if( corner )
+              cornersConverted = false;
+          }
+        }
+      }
+      bool bicubicCell = ( interpolation == bicubic ) && allConverted;
+      if( !bicubicCell )
+      {
+        references[0] = references[5];
+        references[1] = references[6];
+        references[2] = references[9];
+        references[3] = references[10];
+      }
+
+      bool split = false;
+      if( cell.size > 1 )
+      {
+        if( !cornersConverted )
+          split = true;
+
+        // the centre, then the centres of the quarters
+        int numChecks = ( cell.size > 2 ) ? 5 : 1;
+        for( int check = 0; check < numChecks && !split; check++ )
+        {
+          int quarterU = ( check == 0 ) ? 2 : 1 + 2 * ( ( check - 1 ) % 2 );
+          int quarterV = ( check == 0 ) ? 2 : 1 + 2 * ( ( check - 1 ) / 2 );
+          const Node& exact = node( cell.column + quarterU * cell.size / 4,
+             cell.row + quarterV * cell.size / 4 );
+
+          if( exact.status )
+            split = true;
+          else
+          {
+            double x, y;
+            interpolate( references, bicubicCell,
+               quarterU / 4.0, quarterV / 4.0, x, y );
+            // written so that a NaN error splits too
+            if( !( sampler.distance( x, y, exact.x, exact.y ) <= tolerance ) )
+              split = true;
+          }
+        }
+      }
+
+      if( split )
+      {
+        long children = tree.size();
+        long half = cell.size / 2;
+        Cell child = { -1, -1, false };
+        tree[cell.cell].children = children;
+        tree.insert( tree.end(), 4, child );
+
+        for( int k = 0; k < 4; k++ )
+        {
+          PendingCell childCell;
+          childCell.cell = children + k;
+          childCell.column = cell.column + ( k % 2 ) * half;
+          childCell.row = cell.row + ( k / 2 ) * half;
+          childCell.size = half;
+          next.push_back( childCell );
+        }
+      }
+      else
+      {
+        int numReferences = bicubicCell ? 16 : 4;
+        tree[cell.cell].nodes = nodeReferences.size();
+        tree[cell.cell].bicubic = bicubicCell;
+        nodeReferences.insert(
+           nodeReferences.end(), references, references + numReferences );
+        leaves++;
+      }
+    }
+
+    pending.swap( next );
+  }
+}
+
+
+long RasterWarpGrid::nodeKey( long column, long row ) const
+{
+/*
+ *  The function nodeKey returns the key of a node in nodeIndex.  Bicubic
+ *  cells use nodes up to nodeSpacing pixels outside the lattice.
+ */
+
+  long stride = ( cellColumns + 2 ) * nodeSpacing + 1;
+
+  return ( row + nodeSpacing ) * stride + column + nodeSpacing;
+}
+
+
+void RasterWarpGrid::requestNode(
+   long               column,
+   long               row,
+   std::vector<long>& columns,
+   std::vector<long>& rows )
+{
+/*
+ *  The function requestNode adds a node to nodeTable, and to the nodes to
+ *  be converted, unless it is already there.
+ */
+
+  long key = nodeKey( column, row );
+  if( nodeIndex.find( key ) != nodeIndex.end() )
+    return;
+
+  Node added = { 0, 0, 0 };
+  nodeIndex[key] = nodeTable.size();
+  nodeTable.push_back( added );
+  columns.push_back( column );
+  rows.push_back( row );
+}
+
+
+const RasterWarpGrid::Node& RasterWarpGrid::node( long column, long row ) const
+{
+  return nodeTable[nodeIndex.find( nodeKey( column, row ) )->second];
+}
+
+
+void RasterWarpGrid::interpolate(
+   const long* references,
+   bool        bicubicCell,
+   double      u,
+   double      v,
+   double      &x,
+   double      &y ) const
+{
+/*
+ *  The function interpolate interpolates the source coordinates at (u, v),
+ *  the position in the cell from 0 to 1 across and down.  Geodetic
+ *  longitudes are made continuous across 180 degrees first.
+ *
+ *  references  : Indexes of the cell's nodes, 16 if bicubicCell, else 4
+ */
+
+  bool geodetic = sampler.geodeticTarget();
+  double sumX = 0.0;
+  double sumY = 0.0;
+
+  if( bicubicCell )
+  {
+    double weightU[4];
+    double weightV[4];
+    catmullRom( u, weightU );
+    catmullRom( v, weightV );
+
+    double referenceX = nodeTable[references[5]].x;
+    for( int j = 0; j < 4; j++ )
+    {
+      double rowX = 0.0;
+      double rowY = 0.0;
+      for( int i = 0; i < 4; i++ )
+      {
+        const Node& n = nodeTable[references[j * 4 + i]];
+        double nodeX = n.x;
+        if( geodetic )
+          nodeX = referenceX +
+             CoordinateConversionSampler::wrapLongitude( nodeX - referenceX );
+        rowX += weightU[i] * nodeX;
+        rowY += weightU[i] * n.y;
+      }
+      sumX += weightV[j] * rowX;
+      sumY += weightV[j] * rowY;
+    }
+  }
+  else
+  {
+    double weights[4] = {
+       ( 1.0 - u ) * ( 1.0 - v ), u * ( 1.0 - v ), ( 1.0 - u ) * v, u * v };
+
+    double referenceX = nodeTable[references[0]].x;
+    for( int i = 0; i < 4; i++ )
+    {
+      const Node& n = nodeTable[references[i]];
+      double nodeX = n.x;
+      if( geodetic )
+        nodeX = referenceX +
+           CoordinateConversionSampler::wrapLongitude( nodeX - referenceX );
+      sumX += weights[i] * nodeX;
+      sumY += weights[i] * n.y;
+    }
+  }
+
+  if( geodetic )
+    sumX = CoordinateConversionSampler::wrapLongitude( sumX );
+
+  x = sumX;
+  y = sumY;
+}
+
+
+void RasterWarpGrid::pixel(
+   long         column,
+   long         row,
+   double       &x,
+   double       &y,
+   const char*  &status ) const
+{
+/*
+ *  The function pixel returns the source coordinates of one output pixel.
+ */
+
+  long cellColumn = column / nodeSpacing;
+  if( cellColumn > cellColumns - 1 )
+    cellColumn = cellColumns - 1;
+  long cellRow = row / nodeSpacing;
+  if( cellRow > cellRows - 1 )
+    cellRow = cellRows - 1;
+
+  long cell = cellRow * cellColumns + cellColumn;
+  long cellX = cellColumn * nodeSpacing;
+  long cellY = cellRow * nodeSpacing;
+  long size = nodeSpacing;
+
+  while( tree[cell].children >= 0 )
+  {
+    long half = size / 2;
+    long child = tree[cell].children;
+    if( column >= cellX + half )
+    {
+      cellX += half;
+      child += 1;
+    }
+    if( row >= cellY + half )
+    {
+      cellY += half;
+      child += 2;
+    }
+    size = half;
+    cell = child;
+  }
+
+  const Cell& leaf = tree[cell];
+  const long* references = &nodeReferences[leaf.nodes];
+
+  if( size == 1 )
+  { /* the pixel is one of the corners, which may not have converted */
+    int corner = ( column > cellX ? 1 : 0 ) + ( row > cellY ? 2 : 0 );
+    const Node& n = nodeTable[references[leaf.bicubic ?
+       5 + ( corner % 2 ) + 4 * ( corner / 2 ) : corner]];
+    x = n.x;
+    y = n.y;
+    status = n.status;
+    return;
+  }
+
+  interpolate( references, leaf.bicubic,
+     (double)( column - cellX ) / size, (double)( row - cellY ) / size, x, y );
+  status = 0;
+}
+
+
+void RasterWarpGrid::fill( RowJob& job, int numThreads ) const
+{
+/*
+ *  The function fill splits the rows of the output raster into numThreads
+ *  bands and fills them on separate threads.  A band whose thread cannot
+ *  be started is filled on the calling thread.
+ */
+
+  if( numThreads > height )
+    numThreads = height;
+  if( numThreads <= 1 )
+  {
+    job.firstRow = 0;
+    job.lastRow = height - 1;
+    fillRows( &job );
+    return;
+  }
+
+  std::vector<RowJob>     jobs( numThreads, job );
+  std::vector<CCSThread*> threads( numThreads );
+  std::vector<bool>       started( numThreads );
+  int t;
+  for( t = 0; t < numThreads; t++ )
+  {
+    jobs[t].firstRow = height * t / numThreads;
+    jobs[t].lastRow = height * ( t + 1 ) / numThreads - 1;
+    threads[t] = new CCSThread();
+    started[t] = threads[t]->start( fillRows, &jobs[t] );
+  }
+
+  for( t = 0; t < numThreads; t++ )
+  {
+    if( started[t] )
+      threads[t]->join();
+    else
+      fillRows( &jobs[t] );
+    delete threads[t];
+  }
+}
+
+
+void RasterWarpGrid::fillRows( void* rowJob )
+{
+  RowJob* job = (RowJob*)rowJob;
+  const RasterWarpGrid* grid = job->grid;
+
+  for( long row = job->firstRow; row <= job->lastRow; row++ )
+  {
+    long offset = row * grid->width;
+    for( long column = 0; column < grid->width; column++ )
+    {
+      double x, y;
+      const char* status;
+      grid->pixel( column, row, x, y, status );
+
+      if( job->pixels && !status )
+      {
+        x = ( x - job->sourceOriginX ) / job->sourcePixelWidth;
+        y = ( y - job->sourceOriginY ) / job->sourcePixelHeight;
+      }
+
+      job->x[offset + column] = x;
+      job->y[offset + column] = y;
+      job->status[offset + column] = status;
+    }
+  }
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,305 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef RasterWarpGrid_H
+#define RasterWarpGrid_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Raster Warp Grid
+ *
+ * ABSTRACT
+ *
+ *    This component computes, for every pixel of an output raster, the
+ *    coordinates of the pixel centre in the coordinate system of a source
+ *    raster, as needed to reproject (warp) the source raster.  The service
+ *    converts from the output raster's coordinate system (direction) to the
+ *    source raster's.
+ *
+ *    Output pixel centres are originX + column * pixelWidth, originY + row
+ *    * pixelHeight.  Exact conversions are made only on a lattice of nodes
+ *    nodeSpacing pixels apart; the pixels of each lattice cell are
+ *    interpolated from the nodes, bilinearly from the cell's corners or
+ *    bicubically (Catmull-Rom) from the surrounding 4 x 4 nodes.  The
+ *    centre of each cell, and the centres of its quarters, are converted
+ *    exactly and compared with the interpolation; a cell whose error
+ *    exceeds tolerance, in metres, or with nodes that cannot be converted,
+ *    is split into four, down to cells one pixel wide, whose pixels are
+ *    all converted exactly.  The quarter centres are the centres of the
+ *    cells a split makes, so their conversions are not wasted.
+ *
+ *    The lattice is built by the constructor.  sourceCoordinates then
+ *    fills a dense map of source coordinates, and sourcePixels the column
+ *    and row lookup tables into the source raster; both split the rows
+ *    among numThreads threads and make no further conversions.
+ *
+ *    Coordinate systems must be geodetic or map projections with
+ *    easting/northing coordinates, as for Coordinate Conversion Sampler;
+ *    geodetic coordinates are longitude (x) and latitude (y) in radians.
+ *
+ *
+ * ERROR HANDLING
+ *
+ *    The constructor throws CoordinateConversionException if a coordinate
+ *    system is not supported, or if the raster size, node spacing or
+ *    tolerance is invalid.
+ *
+ *    Pixels that cannot be converted are reported through a status array:
+ *    0 if the pixel was converted, otherwise an error message.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The service is only used by the constructor.  Outputs hold width *
+ *    height values, row by row.
+ *
+ *    The tolerance is checked at the centres only; an error that does not
+ *    show there is not detected.  Use a node spacing at which the
+ *    conversion is smooth over a cell.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ */
+
+
+#include <map>
+#include <vector>
+#include "SourceOrTarget.h"
+#include "CoordinateConversionSampler.h"
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class CoordinateConversionService;
+
+
+     /**
+      * Interpolated source coordinates of the pixels of an output raster
+      */
+
+#ifdef WIN32
+     class MSP_CCS RasterWarpGrid
+#else
+     class RasterWarpGrid
+#endif
+     {
+     public:
+
+        enum Interpolation
+        {
+           bilinear,
+           bicubic
+        };
+
+        /**
+         *  The constructor converts the lattice nodes and refines the
+         *  lattice cells until they meet the tolerance.
+         *
+         * @param[in] service - exact conversion; not owned
+         * @param[in] width - number of columns of the output raster
+         * @param[in] height - number of rows of the output raster
+         * @param[in] originX - x of the centre of output pixel (0, 0)
+         * @param[in] originY - y of the centre of output pixel (0, 0)
+         * @param[in] pixelWidth - x step from one column to the next
+         * @param[in] pixelHeight - y step from one row to the next,
+         *                          negative for north up rasters
+         * @param[in] tolerance - largest interpolation error allowed at the
+         *                        cell and quarter centres, in metres
+         * @param[in] nodeSpacing - pixels between lattice nodes, rounded
+         *                          down to a power of two
+         * @param[in] interpolation - bilinear or bicubic
+         * @param[in] direction - SourceOrTarget::source if the output
+         *                        raster is in the service's source
+         *                        coordinate system, SourceOrTarget::target
+         *                        if it is in the target coordinate system
+         */
+        RasterWarpGrid(
+           CoordinateConversionService* service,
+           long                         width,
+           long                         height,
+           double                       originX,
+           double                       originY,
+           double                       pixelWidth,
+           double                       pixelHeight,
+           double                       tolerance,
+           long                         nodeSpacing = 32,
+           Interpolation                interpolation = bilinear,
+           SourceOrTarget::Enum         direction = SourceOrTarget::source );
+
+        ~RasterWarpGrid();
+
+        /**
+         *  Fills the source coordinates of every output pixel.
+         *
+         * @param[out] x - source longitudes or eastings
+         * @param[out] y - source latitudes or northings
+         * @param[out] status - 0 if the pixel was converted, otherwise the
+         *                      error message
+         * @param[in] numThreads - number of threads sharing the rows
+         */
+        void sourceCoordinates(
+           double*      x,
+           double*      y,
+           const char** status,
+           int          numThreads = 1 ) const;
+
+        /**
+         *  Fills the column and row lookup tables into a source raster:
+         *  the fractional column and row of the source raster at the
+         *  centre of every output pixel.
+         *
+         * @param[in] sourceOriginX - x of the centre of source pixel (0, 0)
+         * @param[in] sourceOriginY - y of the centre of source pixel (0, 0)
+         * @param[in] sourcePixelWidth - x step of the source raster columns
+         * @param[in] sourcePixelHeight - y step of the source raster rows
+         * @param[out] column - source raster columns
+         * @param[out] row - source raster rows
+         * @param[out] status - 0 if the pixel was converted, otherwise the
+         *                      error message
+         * @param[in] numThreads - number of threads sharing the rows
+         */
+        void sourcePixels(
+           double       sourceOriginX,
+           double       sourceOriginY,
+           double       sourcePixelWidth,
+           double       sourcePixelHeight,
+           double*      column,
+           double*      row,
+           const char** status,
+           int          numThreads = 1 ) const;
+
+        /**
+         *  Number of exact conversions made to build the lattice.
+         */
+        long nodes() const;
+
+        /**
+         *  Number of lattice cells after refinement.
+         */
+        long cells() const;
+
+     private:
+
+        /* Converted lattice node */
+        struct Node
+        {
+           double      x;
+           double      y;
+           const char* status;
+        };
+
+        /* Lattice cell.  children is the index of the first of the four
+           children (north west, north east, south west, south east in
+           raster order), or -1 for a leaf.  A leaf's nodes are at
+           nodeReferences[nodes], 4 corners for bilinear leaves, 16 for
+           bicubic ones, row by row; nodes is -1 for cells outside the
+           raster. */
+        struct Cell
+        {
+           long children;
+           long nodes;
+           bool bicubic;
+        };
+
+        /* Cell waiting for its nodes while the lattice is refined */
+        struct PendingCell
+        {
+           long cell;
+           long column;
+           long row;
+           long size;
+        };
+
+        /* Rows filled by one thread */
+        struct RowJob
+        {
+           const RasterWarpGrid* grid;
+           long                  firstRow;
+           long                  lastRow;
+           double*               x;
+           double*               y;
+           const char**          status;
+           bool                  pixels;
+           double                sourceOriginX;
+           double                sourceOriginY;
+           double                sourcePixelWidth;
+           double                sourcePixelHeight;
+        };
+
+        // no copy operators
+        RasterWarpGrid( const RasterWarpGrid& );
+        RasterWarpGrid& operator=( const RasterWarpGrid& );
+
+        void refine();
+
+        long nodeKey( long column, long row ) const;
+
+        void requestNode(
+           long               column,
+           long               row,
+           std::vector<long>& columns,
+           std::vector<long>& rows );
+
+        const Node& node( long column, long row ) const;
+
+        void interpolate(
+           const long* references,
+           bool        bicubicCell,
+           double      u,
+           double      v,
+           double      &x,
+           double      &y ) const;
+
+        void pixel(
+           long         column,
+           long         row,
+           double       &x,
+           double       &y,
+           const char*  &status ) const;
+
+        void fill( RowJob& job, int numThreads ) const;
+
+        static void fillRows( void* job );
+
+        CoordinateConversionSampler sampler;
+
+        long          width;
+        long          height;
+        double        originX;
+        double        originY;
+        double        pixelWidth;
+        double        pixelHeight;
+        double        tolerance;
+        long          nodeSpacing;
+        Interpolation interpolation;
+
+        long cellColumns;
+        long cellRows;
+
+        std::vector<Node>    nodeTable;
+        std::map<long, long> nodeIndex;
+        std::vector<Cell>    tree;
+        std::vector<long>    nodeReferences;
+        long                 leaves;
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,344 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Spatial Order
+ *
+ * ABSTRACT
+ *
+ *    This component computes a Hilbert curve order of the points of a
+ *    collection, grouped by zone or hemisphere where the coordinate system
+ *    has them.
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ *   10-19-26    Longitudes east of 180 degrees are wrapped before keying
+ */
+
+
+#include <math.h>
+#include "SpatialOrder.h"
+#include "CoordinateType.h"
+#include "CoordinateTuple.h"
+#include "BNGCoordinates.h"
+#include "CartesianCoordinates.h"
+#include "GARSCoordinates.h"
+#include "GEOREFCoordinates.h"
+#include "GeodeticCoordinates.h"
+#include "MapProjectionCoordinates.h"
+#include "MGRSorUSNGCoordinates.h"
+#include "UPSCoordinates.h"
+#include "UTMCoordinates.h"
+
+
+using namespace MSP::CCS;
+
+
+namespace
+{
+  const double PI = 3.14159265358979323e0;
+  const double PI_OVER_2 = PI / 2.0;
+  const double TWO_PI = 2.0 * PI;
+  const unsigned long GRID_SIZE = 65536;          // cells per axis
+  const unsigned long LAST_GROUP = 0xFFFFFFFFUL;  // missing points
+  const double UTM_MAX_EASTING = 1000000.0;
+  const double UTM_MAX_NORTHING = 10000000.0;
+  const double UPS_MAX_EASTING_NORTHING = 4000000.0;
+}
+
+
+void SpatialOrder::hilbertOrder(
+   const std::vector<CoordinateTuple*>& coordinates,
+   std::vector<long>&                   order )
+{
+  long num = coordinates.size();
+  std::vector<Entry> entries( num );
+
+  // points of projections without fixed bounds, keyed once the bounding
+  // box of the collection is known
+  std::vector<long>   planarIndex;
+  std::vector<double> planarX;
+  std::vector<double> planarY;
+  double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+  bool bounded = false;
+
+  for( long i = 0; i < num; i++ )
+  {
+    Entry& entry = entries[i];
+    entry.group = LAST_GROUP;
+    entry.key = 0;
+    entry.index = i;
+
+    CoordinateTuple* tuple = coordinates[i];
+    if( !tuple )
+      continue;
+
+    double x = 0.0, y = 0.0;
+    bool geographic = false;
+    bool planar = false;
+
+    if( GeodeticCoordinates* geodetic =
+           dynamic_cast< GeodeticCoordinates* >( tuple ) )
+    {
+      x = geodetic->longitude();
+      y = geodetic->latitude();
+      geographic = true;
+    }
+    else if( CartesianCoordinates* cartesian =
+                dynamic_cast< CartesianCoordinates* >( tuple ) )
+    {
+      if( cartesian->coordinateType() == CoordinateType::geocentric )
+      {
+        x = atan2( cartesian->y(), cartesian->x() );
+        y = atan2( cartesian->z(),
+           sqrt( cartesian->x() * cartesian->x() +
+                 cartesian->y() * cartesian->y() ) );
+        geographic = true;
+      }
+      else
+      {
+        x = cartesian->x();
+        y = cartesian->y();
+        planar = true;
+      }
+    }
+    else if( UTMCoordinates* utm = dynamic_cast< UTMCoordinates* >( tuple ) )
+    {
+      x = utm->easting();
+      y = utm->northing();
+      if( x == x && y == y )
+      {
+        entry.group = utm->zone() * 2 + ( utm->hemisphere() == 'S' );
+        entry.key = hilbertKey( gridCell( x, 0.0, UTM_MAX_EASTING ),
+                                gridCell( y, 0.0, UTM_MAX_NORTHING ) );
+      }
+    }
+    else if( UPSCoordinates* ups = dynamic_cast< UPSCoordinates* >( tuple ) )
+    {
+      x = ups->easting();
+      y = ups->northing();
+      if( x == x && y == y )
+      {
+        entry.group = ( ups->hemisphere() == 'S' );
+        entry.key = hilbertKey( gridCell( x, 0.0, UPS_MAX_EASTING_NORTHING ),
+                                gridCell( y, 0.0, UPS_MAX_EASTING_NORTHING ) );
+      }
+    }
+    else if( MapProjectionCoordinates* mapProjection =
+                dynamic_cast< MapProjectionCoordinates* >( tuple ) )
+    {
+      x = mapProjection->easting();
+      y = mapProjection->northing();
+      planar = true;
+    }
+    else if( MGRSorUSNGCoordinates* mgrs =
+                dynamic_cast< MGRSorUSNGCoordinates* >( tuple ) )
+      stringKey( mgrs->MGRSString(), entry.group, entry.key );
+    else if( GARSCoordinates* gars = dynamic_cast< GARSCoordinates* >( tuple ) )
+      stringKey( gars->GARSString(), entry.group, entry.key );
+    else if( GEOREFCoordinates* georef =
+                dynamic_cast< GEOREFCoordinates* >( tuple ) )
+      stringKey( georef->GEOREFString(), entry.group, entry.key );
+    else if( BNGCoordinates* bng = dynamic_cast< BNGCoordinates* >( tuple ) )
+      stringKey( bng->BNGString(), entry.group, entry.key );
+
+    if( geographic && x == x && y == y )
+    {
+      // longitudes of up to 360 degrees are accepted; key them with the
+      // equal longitudes west of 180 degrees
+      if( x > PI )
+        x -= TWO_PI;
+
+      entry.group = 0;
+      entry.key = hilbertKey( gridCell( x, -PI, PI ),
+                              gridCell( y, -PI_OVER_2, PI_OVER_2 ) );
+    }
+    else if( planar && x == x && y == y )
+    {
+      planarIndex.push_back( i );
+      planarX.push_back( x );
+      planarY.push_back( y );
+      if( !bounded )
+      {
+        minX = maxX = x;
+        minY = maxY = y;
+        bounded = true;
+      }
+      else
+      {
+        if( x < minX ) minX = x;
+        if( x > maxX ) maxX = x;
+        if( y < minY ) minY = y;
+        if( y > maxY ) maxY = y;
+      }
+    }
+  }
+
+  for( unsigned int j = 0; j < planarIndex.size(); j++ )
+  {
+    Entry& entry = entries[planarIndex[j]];
+    entry.group = 0;
+    entry.key = hilbertKey( gridCell( planarX[j], minX, maxX ),
+                            gridCell( planarY[j], minY, maxY ) );
+  }
+
+  sortEntries( entries );
+
+  order.resize( num );
+  for( long k = 0; k < num; k++ )
+    order[k] = entries[k].index;
+}
+
+
+unsigned long SpatialOrder::hilbertKey( unsigned long x, unsigned long y )
+{
+/*
+ *  The function hilbertKey walks down the quadrants of the curve from the
+ *  largest, adding the cells of the quadrants passed, and rotates the
+ *  remaining coordinates into the orientation of the quadrant entered.
+ */
+
+  unsigned long distance = 0;
+  for( unsigned long s = GRID_SIZE / 2; s > 0; s /= 2 )
+  {
+    unsigned long rx = ( x & s ) ? 1 : 0;
+    unsigned long ry = ( y & s ) ? 1 : 0;
+    distance += s * s * ( ( 3 * rx ) ^ ry );
+
+    if( ry == 0 )
+    {
+      if( rx == 1 )
+      {
+        x = GRID_SIZE - 1 - x;
+        y = GRID_SIZE - 1 - y;
+      }
+      unsigned long swap = x;
+      x = y;
+      y = swap;
+    }
+  }
+
+  return distance;
+}
+
+
+void SpatialOrder::sortEntries( std::vector<Entry>& entries )
+{
+/*
+ *  The function sortEntries sorts entries by group, then key, keeping the
+ *  input order of equal entries.  It is a least significant digit radix
+ *  sort on the bytes of key, then group; the bytes that are the same in
+ *  every entry, such as the group of a collection in one zone, are
+ *  skipped.
+ */
+
+  long num = entries.size();
+  if( num < 2 )
+    return;
+
+  std::vector<long> counts( 8 * 256, 0 );
+  long i;
+  int digit;
+  for( i = 0; i < num; i++ )
+  {
+    for( digit = 0; digit < 4; digit++ )
+    {
+      counts[digit * 256 + ( ( entries[i].key >> ( 8 * digit ) ) & 0xFF )]++;
+      counts[( digit + 4 ) * 256 +
+         ( ( entries[i].group >> ( 8 * digit ) ) & 0xFF )]++;
+    }
+  }
+
+  std::vector<Entry> sorted( num );
+  for( digit = 0; digit < 8; digit++ )
+  {
+    long* count = &counts[digit * 256];
+    int b;
+    bool constant = false;
+    for( b = 0; b < 256; b++ )
+    {
+      if( count[b] == num )
+        constant = true;
+    }
+    if( constant )
+      continue;
+
+    long offset = 0;
+    for( b = 0; b < 256; b++ )
+    {
+      long bucket = count[b];
+      count[b] = offset;
+      offset += bucket;
+    }
+
+    int shift = 8 * ( digit % 4 );
+    for( i = 0; i < num; i++ )
+    {
+      unsigned long value = ( digit < 4 ) ? entries[i].key : entries[i].group;
+      sorted[count[( value >> shift ) & 0xFF]++] = entries[i];
+    }
+    entries.swap( sorted );
+  }
+}
+
+
+unsigned long SpatialOrder::gridCell( double value, double min, double max )
+{
+/*
+ *  The function gridCell returns the cell, 0 to GRID_SIZE - 1, of value
+ *  in the range min to max; values outside the range get the first or
+ *  last cell.
+ */
+
+  if( !( max > min ) )
+    return 0;
+
+  double cell = ( value - min ) / ( max - min ) * GRID_SIZE;
+  if( !( cell > 0.0 ) )
+    return 0;
+  if( cell >= GRID_SIZE - 1 )
+    return GRID_SIZE - 1;
+
+  return (unsigned long)cell;
+}
+
+
+void SpatialOrder::stringKey(
+   const char*    string,
+   unsigned long &group,
+   unsigned long &key )
+{
+/*
+ *  The function stringKey packs the first four characters of string into
+ *  group and the next four into key, so strings sort by their leading
+ *  characters.
+ */
+
+  group = 0;
+  key = 0;
+  bool ended = false;
+  for( int i = 0; i < 8; i++ )
+  {
+    unsigned long c = 0;
+    if( !ended )
+    {
+      c = (unsigned char)string[i];
+      if( c == 0 )
+        ended = true;
+    }
+
+    if( i < 4 )
+      group = ( group << 8 ) | c;
+    else
+      key = ( key << 8 ) | c;
+  }
+
+  // keep clear of the group of missing points
+  if( group == LAST_GROUP )
+    group--;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
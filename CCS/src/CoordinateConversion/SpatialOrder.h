@@ -0,0 +1,122 @@
+// CLASSIFICATION: UNCLASSIFIED
+#ifndef SpatialOrder_H
+#define SpatialOrder_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Spatial Order
+ *
+ * ABSTRACT
+ *
+ *    This component computes an order of the points of a collection in
+ *    which points close to each other on the ground are next to each
+ *    other, so a collection converted in that order reuses the geoid
+ *    grid window, datum area and projection zone of the previous point
+ *    instead of reloading them for points in arbitrary order.
+ *
+ *    Points are first grouped by the part of their coordinate system they
+ *    fall in, then ordered along a Hilbert curve within each group:
+ *
+ *       Geodetic, geocentric    longitude and latitude over the world
+ *       UTM                     grouped by zone and hemisphere, easting
+ *                               and northing over the zone
+ *       UPS                     grouped by hemisphere
+ *       Other map projections,  easting and northing (x and y) over the
+ *       local Cartesian         bounding box of the collection
+ *       MGRS, USNG, GARS,       grouped and ordered by the leading
+ *       GEOREF, BNG             characters of the string, which name the
+ *                               zone, band and square or cell
+ *
+ *    Missing points, and points with coordinates that are not numbers,
+ *    are put last.  Points with the same key keep their input order.
+ *
+ *
+ * REUSE NOTES
+ *
+ *    The order only changes which point is converted when; converting in
+ *    any order gives the same results.
+ *
+ *
+ * MODIFICATIONS
+ *
+ *   Date        Description
+ *   ----        -----------
+ *   10-19-26    Original Code
+ */
+
+
+#include <vector>
+
+
+#ifdef WIN32
+#ifdef MSP_CCS_EXPORTS
+#define MSP_CCS __declspec(dllexport)
+#elif defined (MSP_CCS_IMPORTS)
+#define MSP_CCS __declspec(dllimport)
+#else
+#define MSP_CCS
+#endif
+#endif
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class CoordinateTuple;
+
+
+     /**
+      * Hilbert curve order of the points of a collection
+      */
+
+#ifdef WIN32
+     class MSP_CCS SpatialOrder
+#else
+     class SpatialOrder
+#endif
+     {
+     public:
+
+        /**
+         *  Computes the order in which to convert a collection.
+         *
+         * @param[in] coordinates - points of the collection; may hold nulls
+         * @param[out] order - order[k] is the index in coordinates of the
+         *                     k-th point to convert
+         */
+        static void hilbertOrder(
+           const std::vector<CoordinateTuple*>& coordinates,
+           std::vector<long>&                   order );
+
+        /**
+         *  Returns the distance along the Hilbert curve that fills a
+         *  65536 x 65536 grid of the cell in column x and row y.
+         */
+        static unsigned long hilbertKey( unsigned long x, unsigned long y );
+
+     private:
+
+        /* Sort entry of one point */
+        struct Entry
+        {
+           unsigned long group;
+           unsigned long key;
+           long          index;
+        };
+
+        static void sortEntries( std::vector<Entry>& entries );
+
+        static unsigned long gridCell( double value, double min, double max );
+
+        static void stringKey(
+           const char*    string,
+           unsigned long &group,
+           unsigned long &key );
+     };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -80,6 +80,7 @@
  *    ----              -----------
  *    07-09-99          Original Code
  *    03-08-07          Original C++ Code
+ *    10-19-26          Added warm-started batch inverse
  *    
  *
  */
@@ -147,7 +148,7 @@ AlbersEqualAreaConic::AlbersEqualAreaConic(
    double standardParallel2,
    double falseEasting,
    double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< AlbersEqualAreaConic, MapProjectionCoordinates >(),
   es( 0.08181919084262188000 ),
   es2( 0.0066943799901413800 ),
   C( 1.4896626908850 ),
@@ -447,6 +448,113 @@ MSP::CCS::GeodeticCoordinates* AlbersEqualAreaConic::convertToGeodetic(
  *    northing          : Northing (Y) in meters                 (input)
  *    latitude          : Latitude (phi) in radians              (output)
  *    longitude         : Longitude (lambda) in radians          (output)
+ */
+
+  double longitude, latitude;
+  double correction = 0.0;
+  long iterations = 0;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     correction, longitude, latitude, iterations );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates(
+     CoordinateType::geodetic, longitude, latitude );
+}
+
+
+double AlbersEqualAreaConic::esSine( double sinlat )
+{
+  return es * sinlat;
+}
+
+
+double AlbersEqualAreaConic::albersQ(
+   double slat, double oneminussqressin, double essin )
+{
+  return (one_MINUS_es2)*(slat / (oneminussqressin) -   
+     (1 / (two_es)) *log((1 - essin) / (1 + essin)));
+}
+
+
+void AlbersEqualAreaConic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  convertToGeodeticBatch(
+     count, x, y, z, longitudes, latitudes, heights, status, 0 );
+}
+
+
+void AlbersEqualAreaConic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status,
+   long*         iterations )
+{
+/*
+ * The function convertToGeodeticBatch converts Albers projection
+ * coordinates to geodetic coordinates.  The latitude iteration of each
+ * point is seeded with the previous point's correction to the initial
+ * guess, so nearby points converge in fewer iterations.  A point that
+ * fails from that seed is retried from the initial guess.
+ *
+ *    iterations : Latitude iterations of each point, or 0 if not wanted (output)
+ */
+
+  double correction = 0.0;
+
+  for( long i = 0; i < count; i++ )
+  {
+    long pointIterations = 0;
+    double seed = correction;
+
+    status[i] = toGeodetic( x[i], y[i], correction,
+       longitudes[i], latitudes[i], pointIterations );
+    if( status[i] && seed != 0.0 )
+    {
+      correction = 0.0;
+      status[i] = toGeodetic( x[i], y[i], correction,
+         longitudes[i], latitudes[i], pointIterations );
+    }
+    if( status[i] )
+      correction = 0.0;
+
+    if( heights )
+      heights[i] = 0.0;
+    if( iterations )
+      iterations[i] = pointIterations;
+  }
+}
+
+
+const char* AlbersEqualAreaConic::toGeodetic(
+   double  easting,
+   double  northing,
+   double &correction,
+   double &longitude,
+   double &latitude,
+   long   &iterations )
+{
+/*
+ * The function toGeodetic converts one point to geodetic coordinates,
+ * returning the error message, or 0 if the point was converted.  The
+ * latitude iteration starts from asin(q/2) plus correction; correction
+ * returns the converged latitude minus that guess.  iterations is
+ * increased by the number of iterations taken.
  */
 
   double dy, dx;
@@ -454,26 +562,23 @@ MSP::CCS::GeodeticCoordinates* AlbersEqualAreaConic::convertToGeodetic(
   double q, qconst, q_OVER_2;
   double rho, rho_n;
   double PHI, Delta_PHI = 1.0;
+  double guess;
   double sin_phi;
   double es_sin, one_MINUS_SQRes_sin;
   double theta = 0.0;
   int count = 60;
-  double longitude, latitude;
   double tolerance = 4.85e-10; /* approximately 1/1000th of
                                   an arc second or 1/10th meter */
 
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
   if(   (easting < (Albers_False_Easting - Albers_Delta_Easting)) 
      || (easting >  Albers_False_Easting + Albers_Delta_Easting))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if(   (northing < (Albers_False_Northing - Albers_Delta_Northing)) 
      || (northing >  Albers_False_Northing + Albers_Delta_Northing))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Albers_False_Northing;
@@ -503,13 +608,15 @@ MSP::CCS::GeodeticCoordinates* AlbersEqualAreaConic::convertToGeodetic(
       latitude = -PI_OVER_2;
     else
     {
-      PHI = asin(q_OVER_2);
+      guess = asin(q_OVER_2);
       if (es < 1.0e-10)
-        latitude = PHI;
+        latitude = guess;
       else
       {
+        PHI = guess + correction;
         while ((fabs(Delta_PHI) > tolerance) && count)
         {
+          iterations++;
           sin_phi = sin(PHI);
           es_sin = esSine( sin_phi );
           one_MINUS_SQRes_sin = oneMinusSqr( es_sin );
@@ -522,8 +629,9 @@ MSP::CCS::GeodeticCoordinates* AlbersEqualAreaConic::convertToGeodetic(
         }
 
         if(!count)
-          throw CoordinateConversionException( ErrorMessages::northing );
+          return ErrorMessages::northing;
 
+        correction = PHI - guess;
         latitude = PHI;
       }
 
@@ -553,22 +661,8 @@ MSP::CCS::GeodeticCoordinates* AlbersEqualAreaConic::convertToGeodetic(
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates(
-     CoordinateType::geodetic, longitude, latitude );
-}
-
-
-double AlbersEqualAreaConic::esSine( double sinlat )
-{
-  return es * sinlat;
+  return 0;
 }
 
 
-double AlbersEqualAreaConic::albersQ(
-   double slat, double oneminussqressin, double essin )
-{
-  return (one_MINUS_es2)*(slat / (oneminussqressin) -   
-     (1 / (two_es)) *log((1 - essin) / (1 + essin)));
-}
-
 // CLASSIFICATION: UNCLASSIFIED
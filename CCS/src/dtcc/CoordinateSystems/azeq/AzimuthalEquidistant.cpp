@@ -129,7 +129,7 @@ AzimuthalEquidistant::AzimuthalEquidistant(
    double originLatitude,
    double falseEasting,
    double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< AzimuthalEquidistant, MapProjectionCoordinates >(),
   Ra( 6371007.1810824 ),
   Sin_Azeq_Origin_Lat( 0.0 ),
   Cos_Azeq_Origin_Lat( 1.0 ),
@@ -501,5 +501,4 @@ MSP::CCS::GeodeticCoordinates* AzimuthalEquidistant::convertToGeodetic( MSP::CCS
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -82,7 +82,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -99,7 +99,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class AzimuthalEquidistant : public CoordinateSystem
+    class AzimuthalEquidistant : public PointBatchCoordinateSystem< AzimuthalEquidistant, MapProjectionCoordinates >
     {
     public:
 
@@ -74,6 +74,11 @@
  * 
  *    1/19/2016        A. Layne MSP_DR30125 Updated to pass ellipsoid code to 
  *					   TransverseMercator 
+ *    10-19-26         Grid letters are found through lookup tables and the
+ *                     strings written without sprintf; added batch
+ *                     conversions, projected through TransverseMercator
+ *                     together
+ *    10-19-26         Precisions above 5 give 1 meter strings
  *
  *
  */
@@ -88,6 +93,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 #include "TransverseMercator.h"
 #include "BritishNationalGrid.h"
 #include "BNGCoordinates.h"
@@ -102,6 +108,7 @@
  *    math.h      - Standard C math library
  *    stdio.h     - Standard C input/output library
  *    string.h    - Standard C string handling library
+ *    vector      - Standard C++ vector
  *    TransverseMercator.h  - Is used to convert transverse mercator coordinates
  *    BritishNationalGrid.h       - Is for prototype error checking
  *    BNGCoordinates.h   - defines bng coordinates
@@ -143,39 +150,32 @@ const double BNG_Min_Northing = -14829.0;
 
 static const char* Airy = "AA";
 
-/************************************************************************/
-//                           LOCAL FUNCTIONS
+/* Index in BNG500GRID of each of the letters A to Z, or -1 */
+const long BNG500_INDEX[26] = { -1, -1, -1, -1, -1, -1, -1,  4, -1,  5, -1, -1, -1,
+                                 2,  3, -1, -1, -1,  0,  1, -1, -1, -1, -1, -1, -1 };
 
-void findIndex( char letter, const char* letterArray, long *index )
-{   
-/*
- * The function findIndex searches for a given letter in an array. 
- * It returns the index of the letter in the array if the letter is found.
- * If the letter is not found, an error code is returned, otherwise
- * BNG_NO_ERROR is returned. 
- *
- *    letter              : Letter being searched for         
- *    letter_Array        : Array being searched         
- *    index               : Index of letter in array        
- */
-  long i = 0;
-  long not_Found = 1;
-  long length = strlen(letterArray);
+/* Index in BNG100GRID of each of the letters A to Z, or -1 */
+const long BNG100_INDEX[26] = { 20, 21, 22, 23, 24, 15, 16, 17, -1, 18, 19, 10, 11,
+                                12, 13, 14,  5,  6,  7,  8,  9,  0,  1,  2,  3,  4 };
 
-  while ((i < length) && (not_Found))
-  {
-    if (letter == letterArray[i])
-    {
-      *index = i;
-      not_Found = 0;
-    }
-    i++;
-  }
-  if (not_Found)
-    throw CoordinateConversionException( ErrorMessages::bngString );
-} 
+/* The 100,000 unit squares within the valid area of each 500,000 unit
+   square, as bits numbered by their index in BNG100GRID.  The 500,000 unit
+   squares are in the order of BNG100GRID, from 1,000,000 units west and
+   500,000 units south of square SV. */
+const long BNG_IN_AREA[25] = {
+  0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,   /* V W X Y Z */
+  0x0000000, 0x0000000, 0x1ef7bff, 0x0739ce3, 0x0000000,   /* Q R S T U */
+  0x0000000, 0x0000000, 0x1fffffe, 0x0339ce7, 0x0000000,   /* L M N O P */
+  0x0000000, 0x0000000, 0x0007fff, 0x0000c63, 0x0000000,   /* F G H J K */
+  0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000 }; /* A B C D E */
+
+/* Units of easting and northing per digit of each precision */
+const long BNG_DIVISOR[6] = { 100000, 10000, 1000, 100, 10, 1 };
 
 
+/************************************************************************/
+//                           LOCAL FUNCTIONS
+
 long roundBNG( double value )
 { 
 /* Round value to nearest integer, using standard engineering rule */
@@ -190,155 +190,108 @@ long roundBNG( double value )
 } 
 
 
-void makeBNGString( char ltrnum[4], long easting, long northing, char* BNGString, long precision )
+void makeBNGString( long index500, long index100, long easting, long northing, char* BNGString, long precision )
 /* Construct a BNG string from its component parts */
 { 
-
-  double divisor;
-  long east;
-  long north;
+  long divisor = BNG_DIVISOR[precision];
+  long unitInterval = 100000 / divisor;
+  long value[2];
+  long remainder;
   long i;
   long j;
-  double unitInterval;
-
-  i = 0;
-  for (j = 0; j < 3; j++)
-    BNGString[i++] = ltrnum[j];
-  divisor = pow (10.0, (5.0 - precision));
-  unitInterval = pow (10.0, (double)precision);
-
-  east = roundBNG (easting/divisor);
-  if (east == unitInterval)
-    east -= 1;
-  if ((precision == 0) && (east == 1))
-    east = 0;
-  i += sprintf (BNGString + i, "%*.*ld", precision, precision, east);
-
-  north = roundBNG (northing/divisor);
-  if (north == unitInterval)
-    north -= 1;
-  if ((precision == 0) && (north == 1))
-    north = 0;
-  i += sprintf (BNGString + i, "%*.*ld",  precision, precision, north);
+  char* digits = BNGString + 3;
+
+  BNGString[0] = BNG100GRID[index500];
+  BNGString[1] = BNG100GRID[index100];
+  BNGString[2] = ' ';
+
+  value[0] = easting;
+  value[1] = northing;
+  for (i = 0; i < 2; i++)
+  {
+    /* Round to the nearest digit as roundBNG does */
+    remainder = value[i] % divisor;
+    value[i] /= divisor;
+    if ((2 * remainder > divisor) ||
+        ((2 * remainder == divisor) && (value[i] % 2 == 1)))
+      value[i]++;
+    if (value[i] == unitInterval)
+      value[i] -= 1;
+
+    for (j = precision - 1; j >= 0; j--)
+    {
+      digits[j] = (char)('0' + value[i] % 10);
+      value[i] /= 10;
+    }
+    digits += precision;
+  }
+  *digits = 0;
 } 
 
 
-bool checkOutOfArea( char BNG500, char BNG100 )
+const char* encodeBNG( double easting, double northing, long precision, char* BNGString )
 { 
 /*
- * The function checkOutOfArea checks if the 500,000 and 
- * 100,000 unit square identifications are within the valid area. If
- * they are not, an error code is returned, otherwise BNG_NO_ERROR 
- * is returned.
+ * The function encodeBNG writes the BNG string of Transverse Mercator
+ * (easting and northing) coordinates to a buffer of BNG_STRING_SIZE
+ * characters.  It returns the error message, or 0 if the string was
+ * written.
  *
- *    BNG500        : 500,000 square unit identification         
- *    BNG100        : 100,000 square unit identification         
+ *    easting    : Easting (X), in meters                  (input)
+ *    northing   : Northing (Y), in meters                 (input)
+ *    precision  : Precision level of BNG string           (input)
+ *    BNGString  : British National Grid coordinate string (output)
  */
 
-  bool outOfArea = false;
+  long temp_Easting, temp_Northing;
+  long index500, index100;
 
-  switch (BNG500)
-  {
-    case 'S':
-      switch (BNG100)
-      {
-        case 'A':
-        case 'F':
-        case 'L':
-          outOfArea = true;
-          break;
-        default:
-          break;
-      }
-      break;
-    case 'N':
-      switch (BNG100)
-      {
-        case 'V':
-          outOfArea = true;
-          break;
-        default:
-          break;
-      }
-      break;
-
-    case 'H':
-      if (BNG100 < 'L')
-        outOfArea = true;
-      break;
-    case 'T':
-      switch (BNG100)
-      {
-        case 'D':
-        case 'E':
-        case 'J':
-        case 'K':
-        case 'O':
-        case 'P':
-        case 'T':
-        case 'U':
-        case 'X':
-        case 'Y':
-        case 'Z':
-          outOfArea = true;
-          break;
-        default:
-          break;
-      }
-      break;
-    case 'O':
-      switch (BNG100)
-      {
-        case 'C':
-        case 'D':
-        case 'E':
-        case 'J':
-        case 'K':
-        case 'O':
-        case 'P':
-        case 'T':
-        case 'U':
-        case 'Y':
-        case 'Z':
-          outOfArea = true;
-          break;
-        default:
-          break;
-      }
-      break;
-    case 'J':
-      switch (BNG100)
-      {
-        case 'L':
-        case 'M':
-        case 'Q':
-        case 'R':
-        case 'V':
-        case 'W':
-       ///   Error_Code = BNG_NO_ERROR;
-          break;
-        default:
-          outOfArea = true;
-          break;
-      }
-      break;
-    default:
-      outOfArea = true;
-      break;
+  if (!((easting >= BNG_Min_Easting) && (easting <= BNG_Max_Easting)))
+  { /* Easting out of range  */
+    return ErrorMessages::easting;
+  }
+  if (!((northing >= BNG_Min_Northing) && (northing <= BNG_Max_Northing)))
+  { /* Northing out of range */
+    return ErrorMessages::northing;
   }
 
-  return outOfArea;
+  if (precision < 0)
+    precision = 0;
+  if (precision > 5)
+    precision = 5;
+
+  /* The range checks keep both squares within the grid */
+  temp_Easting  = roundBNG(easting) + 1000000;
+  temp_Northing = roundBNG(northing) + 500000;
+
+  index500 = (temp_Northing / 500000) * 5 + temp_Easting / 500000;
+  temp_Easting %= 500000;
+  temp_Northing %= 500000;
+  index100 = (temp_Northing / 100000) * 5 + temp_Easting / 100000;
+
+  if (!((BNG_IN_AREA[index500] >> index100) & 1))
+    return ErrorMessages::invalidArea;
+
+  makeBNGString(index500, index100, temp_Easting % 100000, temp_Northing % 100000, BNGString, precision);
+
+  return 0;
 } 
 
 
-void breakBNGString( char* BNGString, char letters[3], double* easting, double* northing, long* precision )
+const char* breakBNGString( const char* BNGString, double* easting, double* northing )
 { 
-/* Break down a BNG string into its component parts */
+/*
+ * Break down a BNG string into its component parts, returning the
+ * Transverse Mercator coordinates of the point it names.  Returns the
+ * error message, or 0 if the string is well formed.
+ */
 
   long i = 0;
   long j;
   long num_digits = 0;
   long num_letters;
+  long index500;
+  long index100;
   long length = strlen(BNGString);
 
   while (BNGString[i] == ' ')
@@ -347,17 +300,18 @@ void breakBNGString( char* BNGString, char letters[3], double* easting, double*
   while (isalpha(BNGString[i]))
     i++;
   num_letters = i - j;
-  if (num_letters == 2)
-  {
-    /* get letters */
-    letters[0] = (char)toupper(BNGString[j]);
-    letters[1] = (char)toupper(BNGString[j+1]);
-    letters[2] = 0;
-  }
-  else
-    throw CoordinateConversionException( ErrorMessages::bngString );
+  if (num_letters != 2)
+    return ErrorMessages::bngString;
+
+  index500 = toupper(BNGString[j]) - 'A';
+  index100 = toupper(BNGString[j+1]) - 'A';
+  if ((index500 < 0) || (index500 >= 26) || (index100 < 0) || (index100 >= 26))
+    return ErrorMessages::bngString;
+  index500 = BNG500_INDEX[index500];
+  index100 = BNG100_INDEX[index100];
+  if ((index500 < 0) || (index100 < 0))
+    return ErrorMessages::bngString;
 
-  checkOutOfArea(letters[0], letters[1]);
   while (BNGString[i] == ' ')
     i++;
   j = i;
@@ -368,42 +322,63 @@ void breakBNGString( char* BNGString, char letters[3], double* easting, double*
     if (isdigit(BNGString[i]))
       i++;
     else
-      throw CoordinateConversionException( ErrorMessages::bngString );
+      return ErrorMessages::bngString;
   }
 
   num_digits = i - j;
-  if ((num_digits <= 10) && (num_digits%2 == 0))
+  if ((num_digits > 10) || (num_digits%2 != 0))
+    return ErrorMessages::bngString;
+
+  /* get easting & northing */
+  long n = num_digits / 2;
+  long east = 0;
+  long north = 0;
+  for (i = 0; i < n; i++)
   {
-    long n;
-    char east_string[6];
-    char north_string[6];
-    long east;
-    long north;
-    double multiplier;
-
-    /* get easting & northing */
-    n = num_digits / 2;
-    *precision = n;
-    if (n > 0)
-    {
-      strncpy (east_string, BNGString+j, n);
-      east_string[n] = 0;
-      sscanf (east_string, "%ld", &east);
-      strncpy (north_string, BNGString+j+n, n);
-      north_string[n] = 0;
-      sscanf (north_string, "%ld", &north);
-      multiplier = pow (10.0, 5.0 - n);
-      *easting = east * multiplier;
-      *northing = north * multiplier;
-    }
-    else
-    {
-      *easting = 0.0;
-      *northing = 0.0;
-    }
+    east = east * 10 + (BNGString[j+i] - '0');
+    north = north * 10 + (BNGString[j+n+i] - '0');
   }
-  else
-    throw CoordinateConversionException( ErrorMessages::bngString );
+
+  *easting = (double)(east * BNG_DIVISOR[n]) +
+     500000 * (index500 % 2) + 100000 * (index100 % 5);
+  *northing = (double)(north * BNG_DIVISOR[n]) +
+     500000 * (index500 / 2) + 100000 * (index100 / 5);
+
+  return 0;
+} 
+
+
+const char* checkGeodetic( double longitude, double latitude, const char* longitudeError, const char* latitudeError )
+{ 
+/*
+ * The function checkGeodetic returns latitudeError if the latitude is
+ * outside of the valid area, longitudeError if the longitude is, and 0
+ * otherwise.
+ */
+
+  if ((latitude < MIN_LAT) || (latitude > MAX_LAT))
+    return latitudeError;
+  if ((longitude < MIN_LON) || (longitude > MAX_LON))
+    return longitudeError;
+
+  return 0;
+} 
+
+
+const char* checkTransverseMercator( double easting, double northing )
+{ 
+/*
+ * The function checkTransverseMercator returns an error message if
+ * Transverse Mercator (easting and northing) coordinates are outside of
+ * the valid area, and 0 otherwise.
+ */
+
+  if ((easting < BNG_Min_Easting) || (easting > BNG_Max_Easting))
+    return ErrorMessages::invalidArea;
+  if ((northing < BNG_Min_Northing) || (northing > BNG_Max_Northing))
+    return ErrorMessages::invalidArea;
+
+  return 0;
 } 
 
 
@@ -414,9 +389,7 @@ void breakBNGString( char* BNGString, char letters[3], double* easting, double*
 
 BritishNationalGrid::BritishNationalGrid( char *ellipsoidCode ) :
   CoordinateSystem( 6377563.396, 1 / 299.324964600 ),
-  transverseMercator( 0 ),
-  BNG_Easting( 0.0 ),
-  BNG_Northing( 0.0 )
+  transverseMercator( 0 )
 {
 /*
  * The constructor receives the ellipsoid code and sets
@@ -426,7 +399,6 @@ BritishNationalGrid::BritishNationalGrid( char *ellipsoidCode ) :
  *   ellipsoidCode : 2-letter code for ellipsoid           (input)
  */
 
-  strcpy( BNG_Letters, "SV" );
   strcpy( BNG_Ellipsoid_Code, "AA");
 
   if ( strcmp( ellipsoidCode, Airy ) != 0 )
@@ -446,8 +418,6 @@ BritishNationalGrid::BritishNationalGrid( const BritishNationalGrid &bng )
   transverseMercator = new TransverseMercator( *( bng.transverseMercator ) );
   semiMajorAxis = bng.semiMajorAxis;
   flattening = bng.flattening;
-  BNG_Easting = bng.BNG_Easting;     
-  BNG_Northing = bng.BNG_Northing; 
 }
 
 
@@ -465,8 +435,6 @@ BritishNationalGrid& BritishNationalGrid::operator=( const BritishNationalGrid &
     transverseMercator->operator=( *bng.transverseMercator );
     semiMajorAxis = bng.semiMajorAxis;
     flattening = bng.flattening;
-    BNG_Easting = bng.BNG_Easting;     
-    BNG_Northing = bng.BNG_Northing; 
   }
 
   return *this;
@@ -501,56 +469,17 @@ MSP::CCS::BNGCoordinates* BritishNationalGrid::convertFromGeodetic( MSP::CCS::Ge
  *  
  */
 
-  double TMEasting, TMNorthing;
+  char BNGString[BNG_STRING_SIZE];
+  const char* errorMessage;
 
   double longitude = geodeticCoordinates->longitude();
   double latitude  = geodeticCoordinates->latitude();
 
-  if ((latitude < MIN_LAT) || (latitude > MAX_LAT))
-  {  /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
-  }
-  if ((longitude < MIN_LON) || (longitude > MAX_LON))
-  {  /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
-  }
-
-  MapProjectionCoordinates* transverseMercatorCoordinates =
-     transverseMercator->convertFromGeodetic( geodeticCoordinates );
-
-  TMEasting  = transverseMercatorCoordinates->easting();
-  TMNorthing = transverseMercatorCoordinates->northing();
-
-  if ((TMEasting < 0.0) && (TMEasting > -2.0))
-    transverseMercatorCoordinates->setEasting( 0.0 );
-  if ((TMNorthing < 0.0) && (TMNorthing > -2.0))
-    transverseMercatorCoordinates->setNorthing( 0.0 );
+  convertFromGeodeticBatch( 1, &longitude, &latitude, precision, BNGString, &errorMessage );
+  if (errorMessage)
+    throw CoordinateConversionException( errorMessage );
 
-  TMEasting  = transverseMercatorCoordinates->easting();
-  TMNorthing = transverseMercatorCoordinates->northing();
-
-  if ((TMEasting < BNG_Min_Easting) || (TMEasting > BNG_Max_Easting))
-  {
-    delete transverseMercatorCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-  if ((TMNorthing < BNG_Min_Northing) || (TMNorthing > BNG_Max_Northing))
-  {
-    delete transverseMercatorCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-
-  BNGCoordinates* bngCoordinates = 0;
-  try {
-	bngCoordinates = convertFromTransverseMercator( transverseMercatorCoordinates, precision );
-	delete transverseMercatorCoordinates;
-  }
-  catch ( CoordinateConversionException e ){
-    delete transverseMercatorCoordinates;
-    throw e;
-  }
-
-  return bngCoordinates;
+  return new BNGCoordinates( CoordinateType::britishNationalGrid, BNGString );
 }
 
 
@@ -569,53 +498,20 @@ MSP::CCS::GeodeticCoordinates* BritishNationalGrid::convertToGeodetic( MSP::CCS:
  */
 
   double TMEasting, TMNorthing;
-  long in_Precision;
-
-  char* BNGString = bngCoordinates->BNGString();
-  
-  breakBNGString( BNGString, BNG_Letters, &BNG_Easting, &BNG_Northing, &in_Precision );
-  
-  MapProjectionCoordinates* transverseMercatorCoordinates = convertToTransverseMercator( bngCoordinates );
-  TMEasting = transverseMercatorCoordinates->easting();
-  TMNorthing = transverseMercatorCoordinates->northing();
-
-  if ((TMEasting < BNG_Min_Easting) || (TMEasting > BNG_Max_Easting))
-  {
-    delete transverseMercatorCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-  if ((TMNorthing < BNG_Min_Northing) || (TMNorthing > BNG_Max_Northing))
-  {
-    delete transverseMercatorCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-
-  GeodeticCoordinates* geodeticCoordinates = 0;
-  double latitude;
-  double longitude;
-  try {
-	geodeticCoordinates = transverseMercator->convertToGeodetic( transverseMercatorCoordinates );
-    latitude = geodeticCoordinates->latitude();
-    longitude = geodeticCoordinates->longitude();
-    delete transverseMercatorCoordinates;
-  }
-  catch ( CoordinateConversionException e ){
-    delete transverseMercatorCoordinates;
-    throw e;
-  }
-
-  if ((latitude < MIN_LAT) || (latitude > MAX_LAT))
-  {
-    delete geodeticCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-  if ((longitude < MIN_LON) || (longitude > MAX_LON))
-  {
-    delete geodeticCoordinates;
-    throw CoordinateConversionException( ErrorMessages::invalidArea );
-  }
-
-  return geodeticCoordinates;
+  double longitude, latitude;
+  const char* errorMessage;
+
+  errorMessage = breakBNGString( bngCoordinates->BNGString(), &TMEasting, &TMNorthing );
+  if (!errorMessage)
+    errorMessage = checkTransverseMercator( TMEasting, TMNorthing );
+  if (!errorMessage)
+    transverseMercator->convertToGeodeticBatch( 1, &TMEasting, &TMNorthing, 0, &longitude, &latitude, 0, &errorMessage );
+  if (!errorMessage)
+    errorMessage = checkGeodetic( longitude, latitude, ErrorMessages::invalidArea, ErrorMessages::invalidArea );
+  if (errorMessage)
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
 }
 
 
@@ -633,78 +529,12 @@ MSP::CCS::BNGCoordinates* BritishNationalGrid::convertFromTransverseMercator( Ma
  *    BNGString  : British National Grid coordinate string (output)
  */
 
-  char letters[4];
-  long x, y;
-  long index;
-  long temp_Easting, temp_Northing;
-  char BNGString[21];
+  char BNGString[BNG_STRING_SIZE];
 
-  double easting = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
-  if ((easting < BNG_Min_Easting) || (easting > BNG_Max_Easting))
-  { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
-  }
-  if ((northing < BNG_Min_Northing) || (northing > BNG_Max_Northing))
-  { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
-  }
-
-  temp_Easting  = roundBNG(easting);
-  temp_Northing = roundBNG(northing);
-
-  temp_Easting  += 1000000; 
-  temp_Northing += 500000;
-
-  x = temp_Easting / 500000;
-  y = temp_Northing / 500000;
-
-  index = y * 5 + x;
-  if ((index >= 0) && (index < 25))
-  {
-    letters[0] = BNG100GRID[index];
-    temp_Easting %= 500000;
-    temp_Northing %= 500000;
-    x = temp_Easting / 100000;
-    y = temp_Northing / 100000;
-    index = y * 5 + x;
-    if ((index >= 0) && (index < 25))
-    {
-      letters[1] = BNG100GRID[index];
-
-      if( checkOutOfArea(letters[0], letters[1]) )
-      {
-        throw CoordinateConversionException( ErrorMessages::invalidArea );
-      }
-
-      letters[2] = ' ';
-      letters[3] = 0;
-      temp_Easting %= 100000;
-      temp_Northing %= 100000;
-      makeBNGString(letters, temp_Easting, temp_Northing, BNGString, precision);
-    }
-    else
-    {
-      long five_y = 5 * y;
-      if ((x >= (25 - five_y)) || (x < -five_y))
-        throw CoordinateConversionException( ErrorMessages::easting );
-      if ((five_y >= (25 - x)) || (five_y < -x))
-      {
-        throw CoordinateConversionException( ErrorMessages::northing );
-      }
-    }
-  }
-  else
-  {
-    long five_y = 5 * y;
-    if ((x >= (25 - five_y)) || (x < -five_y))
-      throw CoordinateConversionException( ErrorMessages::easting );
-    if ((five_y >= (25 - x)) || (five_y < -x))
-    {
-       throw CoordinateConversionException( ErrorMessages::northing );
-    }
-  }
+  const char* errorMessage = encodeBNG( mapProjectionCoordinates->easting(),
+     mapProjectionCoordinates->northing(), precision, BNGString );
+  if (errorMessage)
+    throw CoordinateConversionException( errorMessage );
 
   return new BNGCoordinates( CoordinateType::britishNationalGrid, BNGString );
 } 
@@ -724,31 +554,107 @@ MSP::CCS::MapProjectionCoordinates* BritishNationalGrid::convertToTransverseMerc
  *    northing   : Northing (Y), in meters                 (output)
  */
 
-  long northing_Offset, easting_Offset;
-  long i = 0;
-  long j = 0;
-  long in_Precision;
+  double easting, northing;
 
-  char* BNGString = bngCoordinates->BNGString();
+  const char* errorMessage = breakBNGString( bngCoordinates->BNGString(), &easting, &northing );
+  if (errorMessage)
+    throw CoordinateConversionException( errorMessage );
 
-  breakBNGString( BNGString, BNG_Letters, &BNG_Easting, &BNG_Northing, &in_Precision );
+  return new MapProjectionCoordinates( CoordinateType::transverseMercator, easting, northing );
+} 
 
-  findIndex(BNG_Letters[0], BNG500GRID, &i);
 
-  northing_Offset = 500000 * (i / 2);
-  easting_Offset = 500000 * (i % 2);
+void BritishNationalGrid::convertFromGeodeticBatch( long count, const double* longitudes, const double* latitudes, long precision, char* BNGStrings, const char** status )
+{
+/*
+ * The function convertFromGeodeticBatch converts count geodetic
+ * coordinates to BNG coordinate strings, written BNG_STRING_SIZE
+ * characters apart, setting the status of each point.
+ *
+ *    count       : Number of points                          (input)
+ *    longitudes  : Longitudes, in radians                    (input)
+ *    latitudes   : Latitudes, in radians                     (input)
+ *    precision   : Precision level of BNG strings            (input)
+ *    BNGStrings  : British National Grid coordinate strings (output)
+ *    status      : Error message of each point, or 0        (output)
+ */
 
-  findIndex(BNG_Letters[1], BNG100GRID, &j);
+  if (count <= 0)
+    return;
 
-  northing_Offset += 100000 * (j / 5);
-  easting_Offset += 100000 * (j % 5);
+  std::vector<double>      easting( count );
+  std::vector<double>      northing( count );
+  std::vector<const char*> error( count );
 
-  double easting = BNG_Easting + easting_Offset;
-  double northing = BNG_Northing + northing_Offset;
+  transverseMercator->convertFromGeodeticBatch( count, longitudes, latitudes, 0,
+     &easting[0], &northing[0], 0, &error[0] );
 
-  return new MapProjectionCoordinates( CoordinateType::transverseMercator, easting, northing );
-} 
+  for (long i = 0; i < count; i++)
+  {
+    char* BNGString = BNGStrings + i * BNG_STRING_SIZE;
+    BNGString[0] = 0;
+
+    status[i] = checkGeodetic( longitudes[i], latitudes[i], ErrorMessages::longitude, ErrorMessages::latitude );
+    if (!status[i])
+      status[i] = error[i];
+    if (status[i])
+      continue;
+
+    if ((easting[i] < 0.0) && (easting[i] > -2.0))
+      easting[i] = 0.0;
+    if ((northing[i] < 0.0) && (northing[i] > -2.0))
+      northing[i] = 0.0;
+
+    status[i] = checkTransverseMercator( easting[i], northing[i] );
+    if (!status[i])
+      status[i] = encodeBNG( easting[i], northing[i], precision, BNGString );
+  }
+}
+
+
+void BritishNationalGrid::convertToGeodeticBatch( long count, const char* BNGStrings, double* longitudes, double* latitudes, const char** status )
+{
+/*
+ * The function convertToGeodeticBatch converts count BNG coordinate
+ * strings, held BNG_STRING_SIZE characters apart, to geodetic
+ * coordinates, setting the status of each point.
+ *
+ *    count       : Number of points                          (input)
+ *    BNGStrings  : British National Grid coordinate strings  (input)
+ *    longitudes  : Longitudes, in radians                   (output)
+ *    latitudes   : Latitudes, in radians                    (output)
+ *    status      : Error message of each point, or 0        (output)
+ */
 
+  if (count <= 0)
+    return;
+
+  std::vector<double>      easting( count );
+  std::vector<double>      northing( count );
+  std::vector<const char*> error( count );
+
+  for (long i = 0; i < count; i++)
+  {
+    error[i] = breakBNGString( BNGStrings + i * BNG_STRING_SIZE, &easting[i], &northing[i] );
+    if (!error[i])
+      error[i] = checkTransverseMercator( easting[i], northing[i] );
+    if (error[i])
+      easting[i] = northing[i] = 0.0;
+  }
+
+  transverseMercator->convertToGeodeticBatch( count, &easting[0], &northing[0], 0,
+     longitudes, latitudes, 0, status );
+
+  for (long i = 0; i < count; i++)
+  {
+    if (error[i])
+      status[i] = error[i];
+    else if (!status[i])
+      status[i] = checkGeodetic( longitudes[i], latitudes[i], ErrorMessages::invalidArea, ErrorMessages::invalidArea );
+    if (status[i])
+      longitudes[i] = latitudes[i] = 0.0;
+  }
+}
 
 
 
@@ -72,6 +72,9 @@
  *    ----              -----------
  *    09-06-00          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Grid letters are found through tables; added batch
+ *                      conversions
+ *    10-19-26          Precisions above 5 give 1 meter strings
  *
  *
  */
@@ -90,6 +93,7 @@ namespace MSP
     class BNGCoordinates;
     class GeodeticCoordinates;
 
+    #define BNG_STRING_SIZE 14  /* BNG string, including the null */
 
     /***************************************************************************/
     /*
@@ -134,6 +138,11 @@ namespace MSP
        * longitude) coordinates to a BNG coordinate string, according to the 
        * current ellipsoid parameters.  If any errors occur, an exception is thrown 
        * with a description of the error.
+       *
+       * Precision is the number of digits of each of the easting and the
+       * northing, from 0 (100 km) to 5 (1 m).  Precisions below 0 are
+       * taken as 0 and those above 5 as 5, as the longest strings
+       * convertToGeodetic reads have 5 digits each.
        * 
        *    longitude  : Longitude, in radians                   (input)
        *    latitude   : Latitude, in radians                    (input)
@@ -164,7 +173,8 @@ namespace MSP
        * The function convertFromTransverseMercator converts Transverse Mercator
        * (easting and northing) coordinates to a BNG coordinate string, according
        * to the current ellipsoid parameters.  If any errors occur, an exception is thrown 
-       * with a description of the error.
+       * with a description of the error.  Precision is as for
+       * convertFromGeodetic.
        *
        *    easting    : Easting (X), in meters                  (input)
        *    northing   : Northing (Y), in meters                 (input)
@@ -188,13 +198,60 @@ namespace MSP
 
       MSP::CCS::MapProjectionCoordinates* convertToTransverseMercator( MSP::CCS::BNGCoordinates* bngCoordinates );
 
+
+      /*
+       * The function convertFromGeodeticBatch converts count geodetic
+       * coordinates, held in contiguous arrays, to BNG coordinate strings,
+       * according to the current ellipsoid parameters.  The points are
+       * projected together, and the strings are written BNG_STRING_SIZE
+       * characters apart, null terminated.  Precision is as for
+       * convertFromGeodetic.  Errors are reported through status as for
+       * CoordinateSystem's batch conversions.
+       *
+       *    count       : Number of points                          (input)
+       *    longitudes  : Longitudes, in radians                    (input)
+       *    latitudes   : Latitudes, in radians                     (input)
+       *    precision   : Precision level of BNG strings            (input)
+       *    BNGStrings  : British National Grid coordinate strings (output)
+       *    status      : Error message of each point, or 0        (output)
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         long          precision,
+         char*         BNGStrings,
+         const char**  status );
+
+
+      /*
+       * The function convertToGeodeticBatch converts count BNG coordinate
+       * strings, held BNG_STRING_SIZE characters apart, to geodetic
+       * coordinates according to the current ellipsoid parameters.  Errors
+       * are reported through status as for convertFromGeodeticBatch.
+       *
+       *    count       : Number of points                          (input)
+       *    BNGStrings  : British National Grid coordinate strings  (input)
+       *    longitudes  : Longitudes, in radians                   (output)
+       *    latitudes   : Latitudes, in radians                    (output)
+       *    status      : Error message of each point, or 0        (output)
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const char*   BNGStrings,
+         double*       longitudes,
+         double*       latitudes,
+         const char**  status );
+
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
+
     private:
 
       TransverseMercator* transverseMercator;
     
-      char BNG_Letters[3];
-      double BNG_Easting;
-      double BNG_Northing;
       char BNG_Ellipsoid_Code[3];
 
     };
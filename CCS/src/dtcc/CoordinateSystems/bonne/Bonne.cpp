@@ -89,6 +89,7 @@
 #include "GeodeticCoordinates.h"
 #include "CoordinateConversionException.h"
 #include "ErrorMessages.h"
+#include "EllipsoidConstants.h"
 
 /*
  *    math.h  - Is needed to call the math functions (sqrt, pow, exp, log,
@@ -127,7 +128,7 @@ double bonnCoeffTimesSine( double coeff, double x, double latit )
  */
 
 Bonne::Bonne( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Bonne, MapProjectionCoordinates >(),
   sinusoidal( 0 ),        
   es2( 0.0066943799901413800 ),        
   es4( 4.4814723452405e-005 ),
@@ -170,8 +171,6 @@ Bonne::Bonne( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double
  *                              origin latitude of the projection         (input)
  */
 
-  double j, three_es4;
-  double x,e1,e2,e3,e4;
   double clat; 
   double sin2lat, sin4lat, sin6lat, lat;
   double inv_f = 1 / ellipsoidFlattening;
@@ -227,15 +226,14 @@ Bonne::Bonne( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double
 	{
 		Sin_Bonn_Origin_Lat = sin(Bonn_Origin_Lat);
 
-		es2 = 2 * flattening - flattening * flattening;
-		es4 = es2 * es2;
-		es6 = es4 * es2;
-		j = 45.0 * es6 / 1024.0;
-		three_es4 = 3.0 * es4;
-		c0 = 1 - es2 / 4.0 - three_es4 / 64.0 - 5.0 * es6 / 256.0;
-		c1 = 3.0 * es2 / 8.0 + three_es4 / 32.0 + j;
-		c2 = 15.0 * es4 / 256.0 + j;
-		c3 = 35.0 * es6 / 3072.0;
+		const EllipsoidConstants constants( semiMajorAxis, flattening );
+		es2 = constants.es2;
+		es4 = constants.es4;
+		es6 = constants.es6;
+		c0 = constants.c0;
+		c1 = constants.c1;
+		c2 = constants.c2;
+		c3 = constants.c3;
 
 		clat = cos(Bonn_Origin_Lat);
 		m1 = bonnm(clat, Sin_Bonn_Origin_Lat);
@@ -246,15 +244,10 @@ Bonne::Bonne( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double
 		sin6lat = bonnCoeffTimesSine(c3, 6.0, Bonn_Origin_Lat);
 		M1 = bonnM(lat, sin2lat, sin4lat, sin6lat);
 
-		x = sqrt (1.0 - es2);
-		e1 = (1.0 - x) / (1.0 + x);
-		e2 = e1 * e1;
-		e3 = e2 * e1;
-		e4 = e3 * e1;
-		a0 = 3.0 * e1 / 2.0 - 27.0 * e3 / 32.0;
-		a1 = 21.0 * e2 / 16.0 - 55.0 * e4 / 32.0;
-		a2 = 151.0 * e3 / 96.0;
-		a3 = 1097.0 * e4 / 512.0;
+		a0 = constants.a0;
+		a1 = constants.a1;
+		a2 = constants.a2;
+		a3 = constants.a3;
 		if (Sin_Bonn_Origin_Lat == 0.0)
 			Bonn_am1sin = 0.0;
 		else
@@ -561,5 +554,4 @@ double Bonne::floatEq( double x, double v, double epsilon )
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -75,11 +75,13 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Ellipsoid constants are computed by
+ *                      EllipsoidConstants
  *
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -97,7 +99,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class Bonne : public CoordinateSystem
+    class Bonne : public PointBatchCoordinateSystem< Bonne, MapProjectionCoordinates >
     {
     public:
 
@@ -91,6 +91,7 @@
 #include "CoordinateConversionException.h"
 #include "ErrorMessages.h"
 #include "WarningMessages.h"
+#include "EllipsoidConstants.h"
 
 /*
  *    math.h    - Standard C math library
@@ -128,7 +129,7 @@ double cassCoeffTimesSine( double coeff, double x, double latit )
  */
 
 Cassini::Cassini( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Cassini, MapProjectionCoordinates >(),
   es2( 0.0066943799901413800 ),
   es4( 4.4814723452405e-005 ),
   es6( 3.0000678794350e-007 ),
@@ -169,8 +170,6 @@ Cassini::Cassini( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, dou
  *                              origin latitude of the projection        (input)
  */
 
-  double j,three_es4;
-  double x, e1, e2, e3, e4;
   double lat, sin2lat, sin4lat, sin6lat;
   double inv_f = 1 / ellipsoidFlattening;
 
@@ -200,31 +199,25 @@ Cassini::Cassini( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, dou
   Cass_Origin_Long = centralMeridian;
   Cass_False_Northing = falseNorthing;
   Cass_False_Easting = falseEasting;
-  es2 = 2 * flattening - flattening * flattening;
-  es4 = es2 * es2;
-  es6 = es4 * es2;
-  j = 45.0 * es6 / 1024.0;
-  three_es4 = 3.0 * es4;
-  c0 = 1 - es2 / 4.0 - three_es4 / 64.0 - 5.0 * es6 / 256.0;
-  c1 = 3.0 * es2 /8.0 + three_es4 / 32.0 + j;
-  c2 = 15.0 * es4 / 256.0 + j;
-  c3 = 35.0 * es6 / 3072.0;
+  const EllipsoidConstants constants( semiMajorAxis, flattening );
+  es2 = constants.es2;
+  es4 = constants.es4;
+  es6 = constants.es6;
+  c0 = constants.c0;
+  c1 = constants.c1;
+  c2 = constants.c2;
+  c3 = constants.c3;
   lat = c0 * Cass_Origin_Lat;
   sin2lat = cassCoeffTimesSine(c1, 2.0, Cass_Origin_Lat);
   sin4lat = cassCoeffTimesSine(c2, 4.0, Cass_Origin_Lat);
   sin6lat = cassCoeffTimesSine(c3, 6.0, Cass_Origin_Lat);
   M0 = cassM( lat, sin2lat, sin4lat, sin6lat );
 
-  One_Minus_es2 = 1.0 - es2;
-  x = sqrt (One_Minus_es2);
-  e1 = (1 - x) / (1 + x);
-  e2 = e1 * e1;
-  e3 = e2 * e1;
-  e4 = e3 * e1;
-  a0 = 3.0 * e1 / 2.0 - 27.0 * e3 / 32.0;
-  a1 = 21.0 * e2 / 16.0 - 55.0 * e4 / 32.0;
-  a2 = 151.0 * e3 / 96.0;
-  a3 = 1097.0 * e4 /512.0;
+  One_Minus_es2 = constants.One_MINUS_es2;
+  a0 = constants.a0;
+  a1 = constants.a1;
+  a2 = constants.a2;
+  a3 = constants.a3;
 
   if (Cass_Origin_Long > 0)
   {
@@ -580,5 +573,4 @@ double Cassini::floatEq( double x, double v, double epsilon )
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
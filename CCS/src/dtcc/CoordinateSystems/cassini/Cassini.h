@@ -77,11 +77,13 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-07-07          Original C++ Code
+ *    10-19-26          Ellipsoid constants are computed by
+ *                      EllipsoidConstants
  *
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -98,7 +100,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class Cassini : public CoordinateSystem
+    class Cassini : public PointBatchCoordinateSystem< Cassini, MapProjectionCoordinates >
     {
     public:
 
@@ -126,7 +126,7 @@ double cyeqCoeffTimesSine( double coeff, double c, double Beta )
  */
 
 CylindricalEqualArea::CylindricalEqualArea( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< CylindricalEqualArea, MapProjectionCoordinates >(),
   es( .081819190842622 ),
   es2( 0.0066943799901413800 ),
   es4( 4.4814723452405e-005 ),
@@ -473,5 +473,4 @@ double CylindricalEqualArea::cyleqarQ( double slat, double x )
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -80,7 +80,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -97,7 +97,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class CylindricalEqualArea : public CoordinateSystem
+    class CylindricalEqualArea : public PointBatchCoordinateSystem< CylindricalEqualArea, MapProjectionCoordinates >
     {
     public:
 
@@ -124,6 +124,7 @@
  *    07/13/12          K.Lam, BAEts29544, fixed problem with create datum
  *    07/17/12          S.Gillis,MSP_00029561,Fixed problem with deleting datum
  *    08/13/12          S. Gillis, MSP_00029654, Added lat/lon to define7ParamDatum
+ *    10/19/26          Added checkGeodetic, a non-throwing range check
  */
 
 
@@ -1703,13 +1704,9 @@ GeodeticCoordinates* DatumLibraryImplementation::geodeticShiftFromWGS84(
   double WGS84Latitude = sourceCoordinates->latitude();
   double WGS84Height = sourceCoordinates->height();
 
-  if( ( targetIndex < 0) || (targetIndex >= datumList.size() ) )
-    throw CoordinateConversionException( ErrorMessages::invalidIndex );
-  if(( WGS84Latitude < ( -90 * PI_OVER_180 ) ) ||
-     ( WGS84Latitude > (  90 * PI_OVER_180 ) ) )
-    throw CoordinateConversionException( ErrorMessages::latitude );
-  if( ( WGS84Longitude < ( -PI ) ) || ( WGS84Longitude > TWO_PI ) )
-    throw CoordinateConversionException( ErrorMessages::longitude );
+  const char* error = checkGeodetic( targetIndex, WGS84Longitude, WGS84Latitude );
+  if( error )
+    throw CoordinateConversionException( error );
 
   Datum* localDatum = datumList[targetIndex];
   switch( localDatum->datumType() )
@@ -1805,13 +1802,9 @@ GeodeticCoordinates* DatumLibraryImplementation::geodeticShiftToWGS84( const lon
   double sourceLatitude = sourceCoordinates->latitude(); 
   double sourceHeight = sourceCoordinates->height();
 
-  if( ( sourceIndex < 0 ) || ( sourceIndex >= datumList.size() ) )
-    throw CoordinateConversionException( ErrorMessages::invalidIndex );
-  if(( sourceLatitude < ( -90 * PI_OVER_180 ) ) ||
-     ( sourceLatitude > (  90 * PI_OVER_180 ) ) )
-    throw CoordinateConversionException( ErrorMessages::latitude );
-  if( ( sourceLongitude < ( -PI ) ) || ( sourceLongitude > TWO_PI ) )
-    throw CoordinateConversionException( ErrorMessages::longitude );
+  const char* error = checkGeodetic( sourceIndex, sourceLongitude, sourceLatitude );
+  if( error )
+    throw CoordinateConversionException( error );
 
   Datum* localDatum = datumList[sourceIndex];
   switch( localDatum->datumType() )
@@ -1898,6 +1891,33 @@ void DatumLibraryImplementation::retrieveDatumType(
 } 
 
 
+const char* DatumLibraryImplementation::checkGeodetic(
+   const long index,
+   double longitude,
+   double latitude ) const
+{
+/*
+ *  The function checkGeodetic checks the datum index and location given to
+ *  geodeticShiftToWGS84, geodeticShiftFromWGS84 and validDatum without
+ *  throwing.  It returns the message of the error those functions would
+ *  throw, or 0 if the index and location are valid.
+ *
+ *   index     : The index of a given datum in the datum table      (input)
+ *   longitude : Longitude of the location to be checked in radians (input)
+ *   latitude  : Latitude of the location to be checked in radians  (input)
+ */
+
+  if( ( index < 0 ) || ( index >= datumList.size() ) )
+    return ErrorMessages::invalidIndex;
+  if( ( latitude < MIN_LAT ) || ( latitude > MAX_LAT ) )
+    return ErrorMessages::latitude;
+  if( ( longitude < MIN_LON ) || ( longitude > MAX_LON ) )
+    return ErrorMessages::longitude;
+
+  return 0;
+}
+
+
 void DatumLibraryImplementation::validDatum(
    const long index,
    double longitude,
@@ -1917,12 +1937,9 @@ void DatumLibraryImplementation::validDatum(
  */
   *result = 0;
 
-  if( ( index < 0 ) || ( index >= datumList.size() ) )
-    throw CoordinateConversionException( ErrorMessages::invalidIndex );
-  if( ( latitude < MIN_LAT ) || ( latitude > MAX_LAT ) )
-    throw CoordinateConversionException( ErrorMessages::latitude );
-  if( ( longitude < MIN_LON ) || ( longitude > MAX_LON ) )
-    throw CoordinateConversionException( ErrorMessages::longitude );
+  const char* error = checkGeodetic( index, longitude, latitude );
+  if( error )
+    throw CoordinateConversionException( error );
   
   Datum* datum = datumList[index];
 
@@ -536,6 +536,20 @@ namespace MSP
       void validDatum( const long index, double longitude, double latitude, long *result );
 
 
+      /*
+       *  The function checkGeodetic checks the datum index and location given to
+       *  geodeticShiftToWGS84, geodeticShiftFromWGS84 and validDatum without throwing.
+       *  It returns the message of the error those functions would throw, or 0 if the
+       *  index and location are valid.
+       *
+       *   index     : The index of a given datum in the datum table      (input)
+       *   longitude : Longitude of the location to be checked in radians (input)
+       *   latitude  : Latitude of the location to be checked in radians  (input)
+       */
+
+      const char* checkGeodetic( const long index, double longitude, double latitude ) const;
+
+
       /*
        *  The function setEllipsoidLibrary sets the ellipsoid library information
        *  which is needed to create datums and calculate datum shifts.
@@ -70,6 +70,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-06-07          Original C++ Code
+ *    10-19-26          Batch conversions seed Newton's method from a
+ *                      table, with a fixed number of iterations
  *
  */
 
@@ -117,6 +119,58 @@ double calculateNum( double theta, double sinTheta, double cosTheta )
 }
 
 
+const int ECK4_SEEDS = 32;                /* Intervals of the seed table      */
+const int ECK4_ITERATIONS = 3;            /* Newton iterations of the batch   */
+
+
+/*
+ * The batch conversion from geodetic solves for u = PI/2 - |theta|, the
+ * angle from the pole, where num = two_PLUS_PI_OVER_2 * sin(|latitude|)
+ * becomes u - sin(u) * cos(u) + 2 * (1 - cos(u)) = two_PLUS_PI_OVER_2 * w^2,
+ * with w the square root of 1 - sin(|latitude|).  u is nearly proportional
+ * to w near the poles, where theta is not smooth in latitude.
+ */
+double calculatePolarNum( double u, double sinU, double cosU )
+{
+  return u - sinU * cosU + 2.0 * sinU * sinU / (1.0 + cosU);
+}
+
+
+namespace
+{
+  /*
+   * The seeds of the batch conversion from geodetic.  Node k holds u for
+   * w = k / ECK4_SEEDS, found by bisection.
+   */
+  struct Eckert4Seeds
+  {
+    double u[ECK4_SEEDS + 1];
+
+    Eckert4Seeds()
+    {
+      for( int k = 0; k <= ECK4_SEEDS; k++ )
+      {
+        double w = (double)k / ECK4_SEEDS;
+        double c = two_PLUS_PI_OVER_2 * w * w;
+        double low = 0.0;
+        double high = PI_OVER_2;
+        for( int n = 0; n < 64; n++ )
+        {
+          double mid = (low + high) / 2.0;
+          if( calculatePolarNum(mid, sin(mid), cos(mid)) > c )
+            high = mid;
+          else
+            low = mid;
+        }
+        u[k] = (low + high) / 2.0;
+      }
+    }
+  };
+
+  const Eckert4Seeds eckert4Seeds;
+}
+
+
 /************************************************************************/
 /*                              FUNCTIONS     
  *
@@ -352,24 +406,132 @@ MSP::CCS::GeodeticCoordinates* Eckert4::convertToGeodetic( MSP::CCS::MapProjecti
  *    latitude          : Latitude (phi) in radians              (output)
  */
 
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void Eckert4::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+/*
+ * Instead of iterating each point to a tolerance as convertFromGeodetic
+ * does, the batch takes ECK4_ITERATIONS Newton steps in u (see
+ * calculatePolarNum) from a seed interpolated in eckert4Seeds, so every
+ * point costs the same.  The results agree with convertFromGeodetic to
+ * well within a millimeter, except near the poles, where round off slows
+ * its iteration and the batch is the more accurate.
+ */
+
+  const double Sqrt2 = sqrt(2.0);
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude = latitudes[i];
+    status[i] = 0;
+    if( z )
+      z[i] = 0.0;
+
+    if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
+    {  /* Latitude out of range */
+      status[i] = ErrorMessages::latitude;
+      continue;
+    }
+    if ((longitude < -PI) || (longitude > TWO_PI))
+    {  /* Longitude out of range */
+      status[i] = ErrorMessages::longitude;
+      continue;
+    }
+
+    double dlam = longitude - Eck4_Origin_Long;
+    if (dlam > PI)
+      dlam -= TWO_PI;
+    if (dlam < -PI)
+      dlam += TWO_PI;
+
+    /* w^2 = 1 - sin(|latitude|), without cancellation near the poles */
+    double w = Sqrt2 * sin(PI / 4.0 - fabs(latitude) / 2.0);
+
+    double position = w * ECK4_SEEDS;
+    int k = (int)position;
+    if (k > ECK4_SEEDS - 1)
+      k = ECK4_SEEDS - 1;
+    double u = eckert4Seeds.u[k] +
+               (position - k) * (eckert4Seeds.u[k + 1] - eckert4Seeds.u[k]);
+
+    double c = two_PLUS_PI_OVER_2 * w * w;
+    for( int n = 0; n < ECK4_ITERATIONS; n++ )
+    {
+      double sin_u = sin(u);
+      double derivative = 2.0 * sin_u * (1.0 + sin_u);
+      if (derivative > 0.0)
+        u -= (calculatePolarNum(u, sin_u, cos(u)) - c) / derivative;
+    }
+
+    double cos_u = cos(u);
+    if (latitude < 0.0)
+      cos_u = -cos_u;
+    x[i] = Ra0 * dlam * (1.0 + sin(u)) + Eck4_False_Easting;
+    y[i] = Ra1 * cos_u + Eck4_False_Northing;
+  }
+}
+
+
+void Eckert4::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* Eckert4::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
+{
   double theta;
   double sin_theta, cos_theta;
   double num;
   double dx, dy;
   double i;
 
-  double easting = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
   if ((easting < (Eck4_False_Easting + Eck4_Min_Easting))
       || (easting > (Eck4_False_Easting + Eck4_Max_Easting)))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Eck4_False_Northing - Eck4_Delta_Northing)) 
       || (northing > (Eck4_False_Northing + Eck4_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Eck4_False_Northing;
@@ -385,8 +547,8 @@ MSP::CCS::GeodeticCoordinates* Eckert4::convertToGeodetic( MSP::CCS::MapProjecti
   cos_theta = cos(theta);
   num = calculateNum(theta, sin_theta, cos_theta);
 
-  double latitude = asin(num / two_PLUS_PI_OVER_2);
-  double longitude = Eck4_Origin_Long + dx / (Ra0 * (1 + cos_theta));
+  latitude = asin(num / two_PLUS_PI_OVER_2);
+  longitude = Eck4_Origin_Long + dx / (Ra0 * (1 + cos_theta));
 
   if (latitude > PI_OVER_2)  /* force distorted values to 90, -90 degrees */
     latitude = PI_OVER_2;
@@ -403,9 +565,8 @@ MSP::CCS::GeodeticCoordinates* Eckert4::convertToGeodetic( MSP::CCS::MapProjecti
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
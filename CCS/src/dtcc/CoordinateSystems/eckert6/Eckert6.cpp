@@ -70,6 +70,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-06-07          Original C++ Code
+ *    10-19-26          Batch conversions seed Newton's method from a
+ *                      table, with a fixed number of iterations
  *
  */
 
@@ -112,6 +114,45 @@ const double MAX_LAT = ( (PI * 90) / 180.0 );  /* 90 degrees in radians    */
 const double TWO_PI = (2.0 * PI);                  
 const double one_PLUS_PI_OVER_2 = (1.0 + PI / 2.0);
 
+const int ECK6_SEEDS = 32;                /* Intervals of the seed table      */
+const int ECK6_ITERATIONS = 2;            /* Newton iterations of the batch   */
+
+
+namespace
+{
+  /*
+   * The seeds of the batch conversion from geodetic.  Node k holds theta,
+   * solving theta + sin(theta) = one_PLUS_PI_OVER_2 * sin(latitude), for
+   * latitude = k * PI_OVER_2 / ECK6_SEEDS, found by bisection.  Southern
+   * latitudes use the nodes of their northern reflections.
+   */
+  struct Eckert6Seeds
+  {
+    double theta[ECK6_SEEDS + 1];
+
+    Eckert6Seeds()
+    {
+      for( int k = 0; k <= ECK6_SEEDS; k++ )
+      {
+        double c = one_PLUS_PI_OVER_2 * sin(k * PI_OVER_2 / ECK6_SEEDS);
+        double low = 0.0;
+        double high = PI_OVER_2;
+        for( int n = 0; n < 64; n++ )
+        {
+          double mid = (low + high) / 2.0;
+          if( mid + sin(mid) > c )
+            high = mid;
+          else
+            low = mid;
+        }
+        theta[k] = (low + high) / 2.0;
+      }
+    }
+  };
+
+  const Eckert6Seeds eckert6Seeds;
+}
+
 
 /************************************************************************/
 /*                              FUNCTIONS     
@@ -344,23 +385,122 @@ MSP::CCS::GeodeticCoordinates* Eckert6::convertToGeodetic(
  *    latitude          : Latitude (phi) in radians              (output)
  */
 
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates(
+     CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void Eckert6::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+/*
+ * Instead of iterating each point to a tolerance as convertFromGeodetic
+ * does, the batch takes ECK6_ITERATIONS Newton steps from a seed
+ * interpolated in eckert6Seeds, so every point costs the same.  The
+ * results agree with convertFromGeodetic to well within a millimeter.
+ */
+
+  const double Seed_Scale = ECK6_SEEDS / PI_OVER_2;
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude = latitudes[i];
+    status[i] = 0;
+    if( z )
+      z[i] = 0.0;
+
+    if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
+    {  /* Latitude out of range */
+      status[i] = ErrorMessages::latitude;
+      continue;
+    }
+    if ((longitude < -PI) || (longitude > TWO_PI))
+    {  /* Longitude out of range */
+      status[i] = ErrorMessages::longitude;
+      continue;
+    }
+
+    double dlam = longitude - Eck6_Origin_Long;
+    if (dlam > PI)
+      dlam -= TWO_PI;
+    if (dlam < -PI)
+      dlam += TWO_PI;
+
+    double abs_lat = fabs(latitude);
+    double position = abs_lat * Seed_Scale;
+    int k = (int)position;
+    if (k > ECK6_SEEDS - 1)
+      k = ECK6_SEEDS - 1;
+    double theta = eckert6Seeds.theta[k] +
+       (position - k) * (eckert6Seeds.theta[k + 1] - eckert6Seeds.theta[k]);
+
+    double c = one_PLUS_PI_OVER_2 * sin(abs_lat);
+    for( int n = 0; n < ECK6_ITERATIONS; n++ )
+      theta -= (theta + sin(theta) - c) / (1.0 + cos(theta));
+
+    if (latitude < 0.0)
+      theta = -theta;
+    x[i] = Ra_Over_Sqrt_Two_Plus_PI * dlam * (1.0 + cos(theta)) +
+           Eck6_False_Easting;
+    y[i] = 2.0 * Ra_Over_Sqrt_Two_Plus_PI * theta + Eck6_False_Northing;
+  }
+}
+
+
+void Eckert6::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* Eckert6::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
+{
   double dx, dy;
   double theta;
   double i;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if ((easting < (Eck6_False_Easting + Eck6_Min_Easting))
       || (easting > (Eck6_False_Easting + Eck6_Max_Easting)))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Eck6_False_Northing - Eck6_Delta_Northing))
       || (northing > (Eck6_False_Northing + Eck6_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Eck6_False_Northing;
@@ -391,10 +531,8 @@ MSP::CCS::GeodeticCoordinates* Eckert6::convertToGeodetic(
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates(
-     CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -75,6 +75,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-06-07          Original C++ Code
+ *    10-19-26          Batch conversions no longer create coordinate
+ *                      objects for each point
  *
  *
  */
@@ -325,18 +327,99 @@ MSP::CCS::MapProjectionCoordinates* EquidistantCylindrical::convertFromGeodetic(
  *    northing          : Northing (Y) in meters              (output)
  */
 
-  double dlam;     /* Longitude - Central Meridan */
+  double easting, northing;
+
+  const char* errorMessage = fromGeodetic(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( CoordinateType::equidistantCylindrical, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* EquidistantCylindrical::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Equidistant Cylindrical projection
+ * (easting and northing) coordinates to geodetic (latitude and longitude)
+ * coordinates, according to the current ellipsoid, spherical radius
+ * and Equidistant Cylindrical projection coordinates.
+ * If any errors occur, an exception is thrown with a description 
+ * of the error.
+ *
+ *    easting           : Easting (X) in meters                  (input)
+ *    northing          : Northing (Y) in meters                 (input)
+ *    longitude         : Longitude (lambda) in radians          (output)
+ *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
 
-  double longitude = geodeticCoordinates->longitude();
-  double latitude = geodeticCoordinates->latitude();
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void EquidistantCylindrical::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void EquidistantCylindrical::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* EquidistantCylindrical::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double &easting,
+   double &northing )
+{
+  double dlam;     /* Longitude - Central Meridan */
 
   if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
   {  /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   {  /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
+    return ErrorMessages::longitude;
   }
 
   dlam = longitude - Eqcy_Origin_Long;
@@ -349,44 +432,30 @@ MSP::CCS::MapProjectionCoordinates* EquidistantCylindrical::convertFromGeodetic(
     dlam += TWO_PI;
   }
 
-  double easting = Ra_Cos_Eqcy_Std_Parallel * dlam + Eqcy_False_Easting;
-  double northing = Ra * latitude + Eqcy_False_Northing;
+  easting = Ra_Cos_Eqcy_Std_Parallel * dlam + Eqcy_False_Easting;
+  northing = Ra * latitude + Eqcy_False_Northing;
 
-  return new MapProjectionCoordinates( CoordinateType::equidistantCylindrical, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* EquidistantCylindrical::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* EquidistantCylindrical::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
 {
-/*
- * The function convertToGeodetic converts Equidistant Cylindrical projection
- * (easting and northing) coordinates to geodetic (latitude and longitude)
- * coordinates, according to the current ellipsoid, spherical radius
- * and Equidistant Cylindrical projection coordinates.
- * If any errors occur, an exception is thrown with a description 
- * of the error.
- *
- *    easting           : Easting (X) in meters                  (input)
- *    northing          : Northing (Y) in meters                 (input)
- *    longitude         : Longitude (lambda) in radians          (output)
- *    latitude          : Latitude (phi) in radians              (output)
- */
-
   double dx, dy;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if ((easting < (Eqcy_False_Easting + Eqcy_Min_Easting))
       || (easting > (Eqcy_False_Easting + Eqcy_Max_Easting)))
   { /* Easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Eqcy_False_Northing - Eqcy_Delta_Northing))
       || (northing > (Eqcy_False_Northing + Eqcy_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Eqcy_False_Northing;
@@ -413,9 +482,8 @@ MSP::CCS::GeodeticCoordinates* EquidistantCylindrical::convertToGeodetic( MSP::C
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -69,6 +69,10 @@
  *    ----              -----------
  *    07-10-06          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Added cell keys; convertFromGeodetic makes the
+ *                      string of the key of the point's cell
+ *    10-19-26          Added enumeration of the cells covering an area
+ *    10-19-26          Added batch conversions of coordinate strings
  */
 
 
@@ -141,82 +145,62 @@ const char _7 = '7';
 const char _8 = '8';
 const char _9 = '9';
 
+/* Fields of GARS cell keys, documented in GARS.h */
+const int KEY_QUADRANT_SHIFT = 4;
+const int KEY_COLUMN_SHIFT = 6;
+const int KEY_ROW_SHIFT = 16;
+const long KEY_KEYPAD_MASK = 0xF;
+const long KEY_QUADRANT_MASK = 0x3;
+const long KEY_COLUMN_MASK = 0x3FF;
+const long KEY_ROW_MASK = 0x1FF;
+const long MAX_KEY_PRECISION = 2;     /* 5 minute cells                   */
+const long GARS_COLUMNS = 720;        /* 30 minute cells east/west        */
+const long GARS_ROWS = 360;           /* 30 minute cells north/south      */
+const long FIVE_MINUTE_CELLS = 6;     /* 5 minute cells across 30 minutes */
 
-/************************************************************************/
-/*                              FUNCTIONS     
- *
- */
-
-GARS::GARS() :
-  CoordinateSystem( 0, 0 )
-{
-}
+/* 15 minute quadrant and 5 minute keypad values, by key index            */
+const char QUADRANT_VALUES[] = "3142";
+const char KEYPAD_VALUES[] = "741852963";
 
+/* Key indices of quadrant values 1-4 and keypad values 1-9               */
+const long QUADRANT_INDICES[4] = { 1, 3, 0, 2 };
+const long KEYPAD_INDICES[9] = { 2, 5, 8, 1, 4, 7, 0, 3, 6 };
 
-GARS::GARS( const GARS &g )
-{
-  semiMajorAxis = g.semiMajorAxis;
-  flattening = g.flattening;
-}
-
-
-GARS::~GARS()
-{
-}
-
-
-GARS& GARS::operator=( const GARS &g )
-{
-  if( this != &g )
-  {
-    semiMajorAxis = g.semiMajorAxis;
-    flattening = g.flattening;
-  }
-
-  return *this;
-}
 
+/************************************************************************/
+/*                              LOCAL FUNCTIONS
+ *
+ */
 
-MSP::CCS::GARSCoordinates* GARS::convertFromGeodetic( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision )
+const char* computeGARSKey( double longitude, double latitude, long precision, CellKey* key )
 {
-/*   
- *  The function convertFromGeodetic converts Geodetic (latitude and longitude in radians)
- *  coordinates to a GARS coordinate string.  Precision specifies the
- *  number of digits in the GARS string for latitude and longitude:
- *                                  0: 30 minutes (5 characters)
- *                                  1: 15 minutes (6 characters)
- *                                  2: 5 minutes (7 characters)
+/*
+ *  The function computeGARSKey computes the key of the GARS cell of Geodetic
+ *  (latitude and longitude in radians) coordinates.  It returns the error
+ *  message if the coordinates or precision are invalid, otherwise 0.
  *
  *    longitude   : Longitude in radians.                  (input)
  *    latitude    : Latitude in radians.                   (input)
  *    precision   : Precision specified by the user.       (input)
- *    GARSString  : GARS coordinate string.                (output)
- *
+ *    key         : GARS cell key.                         (output)
  */
 
-  long ew_value;
-  long letter_index[GARS_LETTERS + 1];    /* GARS letters                 */
-  char _15_minute_value_str[2] = "";
-  char _5_minute_value_str[2] = "";
   double round_error = 5.0e-11;
-  char* _15_minute_array[2][2] = {{"3", "1"}, {"4", "2"}};
-  char* _5_minute_array[3][3] = {{"7", "4", "1"}, {"8", "5", "2"}, {"9", "6", "3"}};
   double long_minutes, lat_minutes; 
   double long_remainder, lat_remainder; 
   long horiz_index_30, vert_index_30; 
   long horiz_index_15, vert_index_15; 
   long horiz_index_5, vert_index_5; 
-  char GARSString[8];
 
-  double latitude = geodeticCoordinates->latitude() * RADIAN_TO_DEGREE;
-  double longitude = geodeticCoordinates->longitude() *  RADIAN_TO_DEGREE;
+  latitude *= RADIAN_TO_DEGREE;
+  longitude *= RADIAN_TO_DEGREE;
 
   if ( ( latitude < MIN_LATITUDE ) || ( latitude > MAX_LATITUDE ) )
-    throw CoordinateConversionException( ErrorMessages::latitude );
+    return ErrorMessages::latitude;
   if ( ( longitude < MIN_LONGITUDE ) || ( longitude > MAX_LONGITUDE ) )
-    throw CoordinateConversionException( ErrorMessages::longitude );
+    return ErrorMessages::longitude;
   if ( ( precision < 0 ) || ( precision > MAX_PRECISION ) )
-    throw CoordinateConversionException( ErrorMessages::precision );
+    return ErrorMessages::precision;
 
   /* North pole is an exception, read over and down */
   if( latitude == MAX_LATITUDE )
@@ -251,14 +235,157 @@ MSP::CCS::GARSCoordinates* GARS::convertFromGeodetic( MSP::CCS::GeodeticCoordina
   horiz_index_5 = ( long )( long_remainder / 5.0 ); 
   vert_index_5 = ( long )( lat_remainder / 5.0 );
 
+  /* Longitudes rounded up to 180 degrees are in the last column */
+  if( horiz_index_30 >= GARS_COLUMNS )
+  {
+    horiz_index_30 = GARS_COLUMNS - 1;
+    horiz_index_15 = 1;
+    horiz_index_5 = 2;
+  }
+
+  /* Precisions above 2 give 5 minute cells */
+  if( precision > MAX_KEY_PRECISION )
+    precision = MAX_KEY_PRECISION;
+  if( precision < 2 )
+  {
+    horiz_index_5 = 0;
+    vert_index_5 = 0;
+  }
+  if( precision < 1 )
+  {
+    horiz_index_15 = 0;
+    vert_index_15 = 0;
+  }
+
+  *key = ( ( CellKey )precision << CELL_KEY_PRECISION_SHIFT ) |
+         ( ( CellKey )vert_index_30 << KEY_ROW_SHIFT ) |
+         ( ( CellKey )horiz_index_30 << KEY_COLUMN_SHIFT ) |
+         ( ( CellKey )( horiz_index_15 * 2 + vert_index_15 ) << KEY_QUADRANT_SHIFT ) |
+         ( CellKey )( horiz_index_5 * 3 + vert_index_5 );
+
+  return 0;
+}
+
+
+const char* extractGARSKey(
+   CellKey key,
+   long*   precision,
+   long*   row,
+   long*   column,
+   long*   quadrant,
+   long*   keypad )
+{
+/*
+ *  The function extractGARSKey extracts the fields of a GARS cell key.  It
+ *  returns ErrorMessages::garsString if the key is not that of a GARS cell,
+ *  otherwise 0.
+ *
+ *    key         : GARS cell key.                                 (input)
+ *    precision   : Precision, 0-2.                               (output)
+ *    row         : 30 minute row from 90 degrees S, 0-359.       (output)
+ *    column      : 30 minute column from 180 degrees W, 0-719.   (output)
+ *    quadrant    : 15 minute quadrant index, 0-3.                (output)
+ *    keypad      : 5 minute keypad index, 0-8.                   (output)
+ */
+
+  CellKey key_precision = key >> CELL_KEY_PRECISION_SHIFT;
+
+  if( key_precision > ( CellKey )MAX_KEY_PRECISION )
+    return ErrorMessages::garsString;
+
+  *precision = ( long )key_precision;
+  *row = ( long )( ( key >> KEY_ROW_SHIFT ) & KEY_ROW_MASK );
+  *column = ( long )( ( key >> KEY_COLUMN_SHIFT ) & KEY_COLUMN_MASK );
+  *quadrant = ( long )( ( key >> KEY_QUADRANT_SHIFT ) & KEY_QUADRANT_MASK );
+  *keypad = ( long )( key & KEY_KEYPAD_MASK );
+
+  /* Bits outside the fields must be 0 */
+  if( key != ( ( key_precision << CELL_KEY_PRECISION_SHIFT ) |
+               ( ( CellKey )*row << KEY_ROW_SHIFT ) |
+               ( ( CellKey )*column << KEY_COLUMN_SHIFT ) |
+               ( ( CellKey )*quadrant << KEY_QUADRANT_SHIFT ) |
+               ( CellKey )*keypad ) )
+    return ErrorMessages::garsString;
+
+  if( ( *row >= GARS_ROWS ) || ( *column >= GARS_COLUMNS ) || ( *keypad > 8 ) )
+    return ErrorMessages::garsString;
+
+  /* Indices finer than the precision are 0 */
+  if( ( ( *precision < 1 ) && ( *quadrant != 0 ) ) ||
+      ( ( *precision < 2 ) && ( *keypad != 0 ) ) )
+    return ErrorMessages::garsString;
+
+  return 0;
+}
+
+
+void getFiveMinuteIndices( CellKey key, long* column, long* row )
+{
+/*
+ *  The function getFiveMinuteIndices returns the column and row of the
+ *  south west 5 minute cell of a valid GARS cell key.
+ *
+ *    key         : GARS cell key.                                 (input)
+ *    column      : 5 minute column from 180 degrees W, 0-4319.   (output)
+ *    row         : 5 minute row from 90 degrees S, 0-2159.       (output)
+ */
+
+  long quadrant = ( long )( ( key >> KEY_QUADRANT_SHIFT ) & KEY_QUADRANT_MASK );
+  long keypad = ( long )( key & KEY_KEYPAD_MASK );
+
+  *column = ( long )( ( key >> KEY_COLUMN_SHIFT ) & KEY_COLUMN_MASK ) * FIVE_MINUTE_CELLS +
+            ( quadrant / 2 ) * 3 + keypad / 3;
+  *row = ( long )( ( key >> KEY_ROW_SHIFT ) & KEY_ROW_MASK ) * FIVE_MINUTE_CELLS +
+         ( quadrant % 2 ) * 3 + keypad % 3;
+}
+
+
+CellKey makeFiveMinuteKey( long column, long row, long precision )
+{
+/*
+ *  The function makeFiveMinuteKey returns the key of the GARS cell of a
+ *  precision whose south west 5 minute cell is at a column and row.
+ *
+ *    column      : 5 minute column from 180 degrees W, 0-4319.    (input)
+ *    row         : 5 minute row from 90 degrees S, 0-2159.        (input)
+ *    precision   : Precision, 0-2.                                (input)
+ */
+
+  long horiz_index_5 = column % 3;
+  long vert_index_5 = row % 3;
+  long horiz_index_15 = ( column % FIVE_MINUTE_CELLS ) / 3;
+  long vert_index_15 = ( row % FIVE_MINUTE_CELLS ) / 3;
+
+  return ( ( CellKey )precision << CELL_KEY_PRECISION_SHIFT ) |
+         ( ( CellKey )( row / FIVE_MINUTE_CELLS ) << KEY_ROW_SHIFT ) |
+         ( ( CellKey )( column / FIVE_MINUTE_CELLS ) << KEY_COLUMN_SHIFT ) |
+         ( ( CellKey )( horiz_index_15 * 2 + vert_index_15 ) << KEY_QUADRANT_SHIFT ) |
+         ( CellKey )( horiz_index_5 * 3 + vert_index_5 );
+}
+
+
+void writeGARSString( CellKey key, char* GARSString )
+{
+/*
+ *  The function writeGARSString writes the GARS coordinate string of a
+ *  valid GARS cell key.
+ *
+ *    key         : GARS cell key.                  (input)
+ *    GARSString  : GARS coordinate string.        (output)
+ */
+
+  long letter_index[GARS_LETTERS + 1];    /* GARS letters                 */
+  long precision = ( long )( key >> CELL_KEY_PRECISION_SHIFT );
+  long vert_index_30 = ( long )( ( key >> KEY_ROW_SHIFT ) & KEY_ROW_MASK );
+
   /* Calculate 30 minute east/west value, 1-720 */
-  ew_value = horiz_index_30 + 1;
+  long ew_value = ( long )( ( key >> KEY_COLUMN_SHIFT ) & KEY_COLUMN_MASK ) + 1;
 
   /* Calculate 30 minute north/south first letter, A-Q */
-  letter_index[0] = ( long )( vert_index_30 / 24.0 );
+  letter_index[0] = vert_index_30 / 24;
 
   /* Calculate 30 minute north/south second letter, A-Z */
-  letter_index[1] = ( long )( vert_index_30 - letter_index[0] * 24.0 );
+  letter_index[1] = vert_index_30 - letter_index[0] * 24;
 
   /* Letters I and O are invalid, so skip them */
   if( letter_index[0] >= LETTER_I )
@@ -271,29 +398,92 @@ MSP::CCS::GARSCoordinates* GARS::convertFromGeodetic( MSP::CCS::GeodeticCoordina
   if( letter_index[1] >= LETTER_O )
     letter_index[1] ++;
 
-  /* Get 15 minute quadrant value, 1-4 */
-  strcpy( _15_minute_value_str, _15_minute_array[horiz_index_15][vert_index_15] );
-
-  /* Get 5 minute keypad value, 1-9 */
-  strcpy( _5_minute_value_str, _5_minute_array[horiz_index_5][vert_index_5] );
-
-  /* Form the gars string */
-  if( ew_value < 10 )
-    sprintf ( GARSString, "00%d%c%c", ew_value, ( char )( letter_index[0] + LETTER_A_OFFSET ), ( char )( letter_index[1] + LETTER_A_OFFSET ) );
-  else if( ew_value < 100 )
-    sprintf ( GARSString, "0%d%c%c", ew_value, ( char )( letter_index[0] + LETTER_A_OFFSET ), ( char )( letter_index[1] + LETTER_A_OFFSET ) );
-  else
-    sprintf ( GARSString, "%d%c%c", ew_value, ( char )( letter_index[0] + LETTER_A_OFFSET ), ( char )( letter_index[1] + LETTER_A_OFFSET ) );
+  GARSString[0] = ( char )( '0' + ew_value / 100 );
+  GARSString[1] = ( char )( '0' + ew_value / 10 % 10 );
+  GARSString[2] = ( char )( '0' + ew_value % 10 );
+  GARSString[3] = ( char )( letter_index[0] + LETTER_A_OFFSET );
+  GARSString[4] = ( char )( letter_index[1] + LETTER_A_OFFSET );
+  GARSString[5] = '\0';
 
   if( precision > 0 )
   {
-    strcat( GARSString, _15_minute_value_str);
+    /* 15 minute quadrant value, 1-4 */
+    GARSString[5] = QUADRANT_VALUES[( key >> KEY_QUADRANT_SHIFT ) & KEY_QUADRANT_MASK];
+    GARSString[6] = '\0';
 
     if( precision > 1 )
-      strcat( GARSString, _5_minute_value_str);
+    {
+      /* 5 minute keypad value, 1-9 */
+      GARSString[6] = KEYPAD_VALUES[key & KEY_KEYPAD_MASK];
+      GARSString[7] = '\0';
+    }
+  }
+}
+
+
+/************************************************************************/
+/*                              FUNCTIONS     
+ *
+ */
+
+GARS::GARS() :
+  CoordinateSystem( 0, 0 )
+{
+}
+
+
+GARS::GARS( const GARS &g )
+{
+  semiMajorAxis = g.semiMajorAxis;
+  flattening = g.flattening;
+}
+
+
+GARS::~GARS()
+{
+}
+
+
+GARS& GARS::operator=( const GARS &g )
+{
+  if( this != &g )
+  {
+    semiMajorAxis = g.semiMajorAxis;
+    flattening = g.flattening;
   }
 
-  GARSString[7] = '\0';
+  return *this;
+}
+
+
+MSP::CCS::GARSCoordinates* GARS::convertFromGeodetic( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision )
+{
+/*   
+ *  The function convertFromGeodetic converts Geodetic (latitude and longitude in radians)
+ *  coordinates to a GARS coordinate string.  Precision specifies the
+ *  number of digits in the GARS string for latitude and longitude:
+ *                                  0: 30 minutes (5 characters)
+ *                                  1: 15 minutes (6 characters)
+ *                                  2: 5 minutes (7 characters)
+ *
+ *    longitude   : Longitude in radians.                  (input)
+ *    latitude    : Latitude in radians.                   (input)
+ *    precision   : Precision specified by the user.       (input)
+ *    GARSString  : GARS coordinate string.                (output)
+ *
+ */
+
+  CellKey key;
+  char GARSString[GARS_STRING_SIZE];
+
+  const char* errorMessage = computeGARSKey(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     precision, &key );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  /* Form the gars string */
+  writeGARSString( key, GARSString );
 
   return new GARSCoordinates( CoordinateType::globalAreaReferenceSystem, GARSString );
 }
@@ -465,5 +655,337 @@ MSP::CCS::GeodeticCoordinates* GARS::convertToGeodetic( MSP::CCS::GARSCoordinate
 }
 
 
+void GARS::convertFromGeodeticBatch( long count, const double* longitudes, const double* latitudes, long precision, char* GARSStrings, const char** status )
+{
+/*
+ *  The function convertFromGeodeticBatch converts count Geodetic
+ *  coordinates to GARS coordinate strings, written GARS_STRING_SIZE
+ *  characters apart, setting the status of each point.  The string of a
+ *  point that cannot be converted is empty.
+ *
+ *    longitudes  : Longitudes in radians                   (input)
+ *    latitudes   : Latitudes in radians                    (input)
+ *    precision   : Precision specified by the user.        (input)
+ *    GARSStrings : GARS coordinate strings                (output)
+ *    status      : Error message of each point, or 0      (output)
+ */
+
+  CellKey key;
+
+  for( long i = 0; i < count; i++ )
+  {
+    char* GARSString = GARSStrings + i * GARS_STRING_SIZE;
+
+    status[i] = computeGARSKey( longitudes[i], latitudes[i], precision, &key );
+    if( status[i] )
+      GARSString[0] = '\0';
+    else
+      writeGARSString( key, GARSString );
+  }
+}
+
+
+void GARS::convertToGeodeticBatch( long count, const char* GARSStrings, double* longitudes, double* latitudes, const char** status )
+{
+/*
+ *  The function convertToGeodeticBatch converts count GARS coordinate
+ *  strings, held GARS_STRING_SIZE characters apart, to Geodetic
+ *  coordinates, setting the status of each point.
+ *
+ *    GARSStrings : GARS coordinate strings                 (input)
+ *    longitudes  : Longitudes in radians                  (output)
+ *    latitudes   : Latitudes in radians                   (output)
+ *    status      : Error message of each point, or 0      (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    GARSCoordinates garsCoordinates( CoordinateType::globalAreaReferenceSystem, GARSStrings + i * GARS_STRING_SIZE );
+
+    try
+    {
+      GeodeticCoordinates* geodeticCoordinates = convertToGeodetic( &garsCoordinates );
+
+      longitudes[i] = geodeticCoordinates->longitude();
+      latitudes[i] = geodeticCoordinates->latitude();
+      delete geodeticCoordinates;
+      status[i] = 0;
+    }
+    catch( CoordinateConversionException& e )
+    {
+      status[i] = errorStatus( e.getMessage() );
+    }
+  }
+}
+
+
+CellKey GARS::convertFromGeodeticToCellKey( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision )
+{
+/*
+ *  The function convertFromGeodeticToCellKey returns the key of the GARS
+ *  cell of Geodetic (latitude and longitude in radians) coordinates.
+ *
+ *    longitude   : Longitude in radians.                  (input)
+ *    latitude    : Latitude in radians.                   (input)
+ *    precision   : Precision specified by the user.       (input)
+ */
+
+  CellKey key;
+
+  const char* errorMessage = computeGARSKey(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     precision, &key );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return key;
+}
+
+
+void GARS::convertFromGeodeticToCellKeys( long count, const double* longitudes, const double* latitudes, long precision, CellKey* keys, const char** status )
+{
+/*
+ *  The function convertFromGeodeticToCellKeys converts count Geodetic
+ *  coordinates to GARS cell keys, setting the status of each point.
+ *
+ *    count       : Number of points                        (input)
+ *    longitudes  : Longitudes in radians                   (input)
+ *    latitudes   : Latitudes in radians                    (input)
+ *    precision   : Precision specified by the user.        (input)
+ *    keys        : GARS cell keys                         (output)
+ *    status      : Error message of each point, or 0      (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    keys[i] = 0;
+    status[i] = computeGARSKey( longitudes[i], latitudes[i], precision, &keys[i] );
+  }
+}
+
+
+void GARS::convertCellKeysToBounds( long count, const CellKey* keys, double* westLongitudes, double* southLatitudes, double* eastLongitudes, double* northLatitudes, const char** status )
+{
+/*
+ *  The function convertCellKeysToBounds converts count GARS cell keys to
+ *  the bounds of their cells, in radians, setting the status of each key.
+ *
+ *    count          : Number of keys                      (input)
+ *    keys           : GARS cell keys                      (input)
+ *    westLongitudes : West edges in radians              (output)
+ *    southLatitudes : South edges in radians             (output)
+ *    eastLongitudes : East edges in radians              (output)
+ *    northLatitudes : North edges in radians             (output)
+ *    status         : Error message of each key, or 0    (output)
+ */
+
+  /* Size of the cells of each precision, in minutes */
+  const double cell_minutes[MAX_KEY_PRECISION + 1] = { 30.0, 15.0, 5.0 };
+
+  long precision, row, column, quadrant, keypad;
+
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = extractGARSKey( keys[i], &precision, &row, &column, &quadrant, &keypad );
+    if( status[i] )
+    {
+      westLongitudes[i] = southLatitudes[i] = 0.0;
+      eastLongitudes[i] = northLatitudes[i] = 0.0;
+      continue;
+    }
+
+    /* Minutes from the south west corner of the grid */
+    double lon_minutes = column * 30.0 + ( quadrant / 2 ) * 15.0 + ( keypad / 3 ) * 5.0;
+    double lat_minutes = row * 30.0 + ( quadrant % 2 ) * 15.0 + ( keypad % 3 ) * 5.0;
+
+    westLongitudes[i] = ( MIN_LONGITUDE + lon_minutes / MIN_PER_DEG ) * PI_OVER_180;
+    southLatitudes[i] = ( MIN_LATITUDE + lat_minutes / MIN_PER_DEG ) * PI_OVER_180;
+    eastLongitudes[i] = ( MIN_LONGITUDE + ( lon_minutes + cell_minutes[precision] ) / MIN_PER_DEG ) * PI_OVER_180;
+    northLatitudes[i] = ( MIN_LATITUDE + ( lat_minutes + cell_minutes[precision] ) / MIN_PER_DEG ) * PI_OVER_180;
+  }
+}
+
+
+CellKey GARS::convertStringToCellKey( const char* GARSString )
+{
+/*
+ *  The function convertStringToCellKey returns the key of a GARS
+ *  coordinate string.  The checks are those of convertToGeodetic, with
+ *  the 30 minute value and letters also checked against the grid.
+ *
+ *    GARSString  : GARS coordinate string.     (input)
+ *
+ */
+
+  long index = 0;
+  long ew_value = 0;
+  long ns_index[2];
+  long precision;
+  long quadrant = 0;
+  long keypad = 0;
+
+  long gars_length = strlen( GARSString );
+  if ( ( gars_length < GARS_MINIMUM ) || ( gars_length > GARS_MAXIMUM ) )
+    throw CoordinateConversionException( ErrorMessages::garsString );
+
+  /* Get 30 minute east/west value, 1-720 */
+  while( isdigit( GARSString[index] ) )
+  {
+    ew_value = ew_value * 10 + ( GARSString[index] - '0' );
+    index++;
+  }
+
+  if( ( index != 3 ) || ( ew_value < 1 ) || ( ew_value > GARS_COLUMNS ) )
+    throw CoordinateConversionException( ErrorMessages::garsString );
+
+  /* Get 30 minute north/south letters, A-Q and A-Z */
+  for( int i = 0; i < 2; i++ )
+  {
+    char letter = GARSString[index++];
+    if( !isalpha( letter ) )
+      throw CoordinateConversionException( i == 0 ? ErrorMessages::longitude : ErrorMessages::latitude );
+
+    ns_index[i] = toupper( letter ) - LETTER_A_OFFSET;
+
+    /* Letter I and O are invalid */
+    if( ( ns_index[i] == LETTER_I ) || ( ns_index[i] == LETTER_O ) )
+      throw CoordinateConversionException( ErrorMessages::garsString );
+    if( ns_index[i] > LETTER_O )
+      ns_index[i] --;
+    if( ns_index[i] > LETTER_I ) 
+      ns_index[i] --;
+  }
+
+  long vert_index_30 = ns_index[0] * 24 + ns_index[1];
+  if( ( ns_index[1] >= 24 ) || ( vert_index_30 >= GARS_ROWS ) )
+    throw CoordinateConversionException( ErrorMessages::garsString );
+
+  precision = gars_length - GARS_MINIMUM;
+
+  if( precision > 0 )
+  {
+    /* Get 15 minute quadrant value, 1-4 */
+    char _15_minute_value = GARSString[index++];
+    if( _15_minute_value < _1 || _15_minute_value > _4 )
+      throw CoordinateConversionException( ErrorMessages::longitude_min );
+    quadrant = QUADRANT_INDICES[_15_minute_value - _1];
+
+    if( precision > 1 )
+    {
+      /* Get 5 minute keypad value, 1-9 */
+      char _5_minute_value = GARSString[index];
+      if( _5_minute_value < _1 || _5_minute_value > _9 )
+        throw CoordinateConversionException( ErrorMessages::latitude_min );
+      keypad = KEYPAD_INDICES[_5_minute_value - _1];
+    }
+  }
+
+  return ( ( CellKey )precision << CELL_KEY_PRECISION_SHIFT ) |
+         ( ( CellKey )vert_index_30 << KEY_ROW_SHIFT ) |
+         ( ( CellKey )( ew_value - 1 ) << KEY_COLUMN_SHIFT ) |
+         ( ( CellKey )quadrant << KEY_QUADRANT_SHIFT ) |
+         ( CellKey )keypad;
+}
+
+
+void GARS::convertCellKeyToString( CellKey key, char* GARSString )
+{
+/*
+ *  The function convertCellKeyToString writes the GARS coordinate string
+ *  of a cell key.
+ *
+ *    key         : GARS cell key               (input)
+ *    GARSString  : GARS coordinate string.     (output)
+ *
+ */
+
+  long precision, row, column, quadrant, keypad;
+
+  const char* errorMessage = extractGARSKey( key, &precision, &row, &column, &quadrant, &keypad );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  writeGARSString( key, GARSString );
+}
+
+
+
+
+long GARS::enumerateCellKeys( double westLongitude, double southLatitude, double eastLongitude, double northLatitude, long precision, CellKey* keys, long maxKeys )
+{
+/*
+ *  The function enumerateCellKeys writes the keys of the GARS cells
+ *  covering an area, and returns their number.
+ *
+ *    westLongitude  : West edge in radians                       (input)
+ *    southLatitude  : South edge in radians                      (input)
+ *    eastLongitude  : East edge in radians                       (input)
+ *    northLatitude  : North edge in radians                      (input)
+ *    precision      : Precision specified by the user.           (input)
+ *    keys           : GARS cell keys                            (output)
+ *    maxKeys        : Number of keys that fit in keys            (input)
+ *
+ */
+
+  CellKey south_west, north_east;
+  long first_column, last_column, first_row, last_row;
+
+  const char* errorMessage = computeGARSKey( westLongitude, southLatitude, MAX_KEY_PRECISION, &south_west );
+  if( !errorMessage )
+    errorMessage = computeGARSKey( eastLongitude, northLatitude, MAX_KEY_PRECISION, &north_east );
+  if( !errorMessage && ( ( precision < 0 ) || ( precision > MAX_PRECISION ) ) )
+    errorMessage = ErrorMessages::precision;
+  if( !errorMessage && ( southLatitude > northLatitude ) )
+    errorMessage = ErrorMessages::latitude;
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  if( precision > MAX_KEY_PRECISION )
+    precision = MAX_KEY_PRECISION;
+
+  /* 5 minute cells across a cell of the precision */
+  long cell_size = ( precision == 0 ) ? FIVE_MINUTE_CELLS : ( ( precision == 1 ) ? 3 : 1 );
+  long columns_per_row = GARS_COLUMNS * FIVE_MINUTE_CELLS / cell_size;
+
+  getFiveMinuteIndices( south_west, &first_column, &first_row );
+  getFiveMinuteIndices( north_east, &last_column, &last_row );
+  first_column /= cell_size;
+  last_column /= cell_size;
+  first_row /= cell_size;
+  last_row /= cell_size;
+
+  /* The area runs east from its west edge, across 180 degrees if its */
+  /* east edge is west of its west edge                               */
+  double west = westLongitude * RADIAN_TO_DEGREE;
+  double width = ( eastLongitude - westLongitude ) * RADIAN_TO_DEGREE;
+  if( west >= 180.0 )
+    west -= 360.0;
+  if( width < 0.0 )
+    width += 360.0;
+
+  long columns = last_column - first_column + 1;
+  if( west + width >= 180.0 )
+    columns += columns_per_row;
+  if( ( columns > columns_per_row ) || ( width >= 360.0 ) )
+  {
+    first_column = 0;
+    columns = columns_per_row;
+  }
+  long rows = last_row - first_row + 1;
+
+  long count = 0;
+  for( long row = first_row; ( row <= last_row ) && ( count < maxKeys ); row++ )
+  {
+    for( long i = 0; ( i < columns ) && ( count < maxKeys ); i++ )
+    {
+      long column = ( first_column + i ) % columns_per_row;
+      keys[count++] = makeFiveMinuteKey( column * cell_size, row * cell_size, precision );
+    }
+  }
+
+  return rows * columns;
+}
+
+
 
 // CLASSIFICATION: UNCLASSIFIED
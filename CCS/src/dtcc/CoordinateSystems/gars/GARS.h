@@ -72,10 +72,15 @@
  *    ----              -----------
  *    07-10-06          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Added cell keys, with bulk conversion of geodetic
+ *                      coordinates to keys and of keys to cell bounds
+ *    10-19-26          Added enumeration of the cells covering an area
+ *    10-19-26          Added batch conversions of coordinate strings
  */
 
 
 #include "CoordinateSystem.h"
+#include "CellKey.h"
 
 
 namespace MSP
@@ -91,7 +96,9 @@ namespace MSP
      *                              DEFINES
      */
 
-    class GARS : public CoordinateSystem
+    #define GARS_STRING_SIZE 8  /* GARS string, including the null */
+
+    class MSP_DTCC_API GARS : public CoordinateSystem
     {
     public:
 
@@ -136,6 +143,152 @@ namespace MSP
        */
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::GARSCoordinates* garsCoordinates );
+
+
+      /*
+       *  The function convertFromGeodeticBatch converts count Geodetic
+       *  coordinates, held in contiguous arrays, to GARS coordinate
+       *  strings, written GARS_STRING_SIZE characters apart and null
+       *  terminated.  Errors are reported through status as for
+       *  CoordinateSystem's batch conversions.
+       *
+       *    count       : Number of points                      (input)
+       *    longitudes  : Longitudes in radians                 (input)
+       *    latitudes   : Latitudes in radians                  (input)
+       *    precision   : Precision specified by the user.      (input)
+       *    GARSStrings : GARS coordinate strings               (output)
+       *    status      : Error message of each point, or 0     (output)
+       */
+
+      void convertFromGeodeticBatch( long count, const double* longitudes, const double* latitudes, long precision, char* GARSStrings, const char** status );
+
+
+      /*
+       *  The function convertToGeodeticBatch converts count GARS
+       *  coordinate strings, held GARS_STRING_SIZE characters apart, to
+       *  Geodetic coordinates.  Errors are reported through status as for
+       *  convertFromGeodeticBatch.
+       *
+       *    count       : Number of points                      (input)
+       *    GARSStrings : GARS coordinate strings               (input)
+       *    longitudes  : Longitudes in radians                 (output)
+       *    latitudes   : Latitudes in radians                  (output)
+       *    status      : Error message of each point, or 0     (output)
+       */
+
+      void convertToGeodeticBatch( long count, const char* GARSStrings, double* longitudes, double* latitudes, const char** status );
+
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
+
+
+      /*
+       *  A GARS cell key holds the indices of a cell, from the least
+       *  significant bit:
+       *
+       *      bits  0-3   : 5 minute keypad index, 0-8 (keypad 7 4 1 8 5 2 9 6 3)
+       *      bits  4-5   : 15 minute quadrant index, 0-3 (quadrant 3 1 4 2)
+       *      bits  6-15  : 30 minute column from 180 degrees W, 0-719
+       *      bits 16-24  : 30 minute row from 90 degrees S, 0-359
+       *      bits 56-57  : precision, 0-2
+       *
+       *  The indices finer than the precision are 0, so keys of the same
+       *  precision sort by row and then column.  The precision bits stay
+       *  in a shifted key, so (cellKeyFields( key ) >> 6) names the 30
+       *  minute cell of a key of any precision.
+       */
+
+      /*
+       *  The function convertFromGeodeticToCellKey returns the key of the
+       *  GARS cell of Geodetic (latitude and longitude in radians)
+       *  coordinates; it is the key of the string convertFromGeodetic
+       *  returns.  Precisions above 2 give 5 minute cells, as they do for
+       *  strings.
+       *
+       *    geodeticCoordinates : Geodetic coordinates              (input)
+       *    precision           : Precision specified by the user.  (input)
+       */
+
+      CellKey convertFromGeodeticToCellKey( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision );
+
+
+      /*
+       *  The function convertFromGeodeticToCellKeys converts count Geodetic
+       *  coordinates, held in contiguous arrays, to GARS cell keys.  Points
+       *  that cannot be converted are not thrown as exceptions: status[i]
+       *  is set to the error message, or to 0 when point i was converted.
+       *
+       *    count      : Number of points                        (input)
+       *    longitudes : Longitudes in radians                   (input)
+       *    latitudes  : Latitudes in radians                    (input)
+       *    precision  : Precision specified by the user.        (input)
+       *    keys       : GARS cell keys                         (output)
+       *    status     : Error message of each point, or 0      (output)
+       */
+
+      void convertFromGeodeticToCellKeys( long count, const double* longitudes, const double* latitudes, long precision, CellKey* keys, const char** status );
+
+
+      /*
+       *  The function convertCellKeysToBounds converts count GARS cell
+       *  keys to the bounds of their cells in radians.  Errors are
+       *  reported through status as for convertFromGeodeticToCellKeys.
+       *
+       *    count          : Number of keys                      (input)
+       *    keys           : GARS cell keys                      (input)
+       *    westLongitudes : West edges in radians              (output)
+       *    southLatitudes : South edges in radians             (output)
+       *    eastLongitudes : East edges in radians              (output)
+       *    northLatitudes : North edges in radians             (output)
+       *    status         : Error message of each key, or 0    (output)
+       */
+
+      void convertCellKeysToBounds( long count, const CellKey* keys, double* westLongitudes, double* southLatitudes, double* eastLongitudes, double* northLatitudes, const char** status );
+
+
+      /*
+       *  The function convertStringToCellKey returns the key of a GARS
+       *  coordinate string; its precision is given by the length of the
+       *  string.
+       *
+       *    GARSString  : GARS coordinate string.     (input)
+       */
+
+      CellKey convertStringToCellKey( const char* GARSString );
+
+
+      /*
+       *  The function convertCellKeyToString writes the GARS coordinate
+       *  string of a cell key to a buffer of GARS_STRING_SIZE characters.
+       *
+       *    key         : GARS cell key               (input)
+       *    GARSString  : GARS coordinate string.     (output)
+       */
+
+      void convertCellKeyToString( CellKey key, char* GARSString );
+
+
+      /*
+       *  The function enumerateCellKeys returns the number of GARS cells of
+       *  a precision that cover an area, the cells convertFromGeodetic
+       *  gives for the points of the area, and writes the first maxKeys of
+       *  their keys row by row from the south west.  The area runs east
+       *  from its west edge to its east edge, across 180 degrees when the
+       *  east edge is west of the west edge.  The time taken is
+       *  proportional to the number of keys written.  The area is a
+       *  longitude and latitude box; callers covering a polygon enumerate
+       *  its bounding box and keep the cells that meet the polygon.
+       *
+       *    westLongitude  : West edge in radians                   (input)
+       *    southLatitude  : South edge in radians                  (input)
+       *    eastLongitude  : East edge in radians                   (input)
+       *    northLatitude  : North edge in radians                  (input)
+       *    precision      : Precision specified by the user.       (input)
+       *    keys           : GARS cell keys                        (output)
+       *    maxKeys        : Number of keys that fit in keys        (input)
+       */
+
+      long enumerateCellKeys( double westLongitude, double southLatitude, double eastLongitude, double northLatitude, long precision, CellKey* keys, long maxKeys );
     
     };
   }
@@ -71,6 +71,7 @@
  *    3-02-07           Original C++ Code
  *    01/24/11          I. Krinsky    BAEts28121   
  *                      Terrain Service rearchitecture
+ *    10/19/26          Added batch conversions
  *
  */
 
@@ -151,7 +152,39 @@ namespace MSP
             MSP::CCS::GeodeticCoordinates* convertToGeodetic(
                MSP::CCS::CartesianCoordinates* cartesianCoordinates );
 
+
+            /*
+             * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+             * convert arrays of points between geodetic and geocentric (X, Y, Z)
+             * coordinates, reporting errors per point through status instead of
+             * exceptions, as described in CoordinateSystem.
+             * convertToGeodeticBatch uses a closed form solution that agrees
+             * with convertToGeodetic within 1.0e-7 meters.
+             */
+
+            void convertFromGeodeticBatch(
+               long          count,
+               const double* longitudes,
+               const double* latitudes,
+               const double* heights,
+               double*       x,
+               double*       y,
+               double*       z,
+               const char**  status );
+
+            void convertToGeodeticBatch(
+               long          count,
+               const double* x,
+               const double* y,
+               const double* z,
+               double*       longitudes,
+               double*       latitudes,
+               double*       heights,
+               const char**  status );
+
          private:
+
+            void selectAlgorithm();
     
             void geocentricToGeodetic(
                const double x,
@@ -70,6 +70,11 @@
  *    ----              -----------
  *    02-20-97          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Added cell keys; convertFromGeodetic makes the
+ *                      string of the key of the point's cell
+ *    10-19-26          Added enumeration of the cells covering an area
+ *    10-19-26          Added batch conversions of coordinate strings
+ *    10-19-26          Keys of precision 1 and 2 strings are canonical
  */
 
 
@@ -137,13 +142,24 @@ const double RADIAN_TO_DEGREE = (180.0 / PI);
 const double QUAD = 15.0;                    /* Degrees per grid square               */
 const double ROUND_ERROR = 0.0000005;        /* Rounding factor                       */
 
+/* Fields of GEOREF cell keys, documented in GEOREF.h */
+const int KEY_LAT_MINUTES_SHIFT = 17;
+const int KEY_LETTER_SHIFT[GEOREF_LETTERS] = { 44, 49, 34, 39 };  /* By letter  */
+const long KEY_MINUTES_MASK = 0x1FFFF;
+const long KEY_LETTER_MASK = 0x1F;
+const long KEY_MAX_LETTER[GEOREF_LETTERS] = { 23, 11, 14, 14 };
+const long THOUSANDTHS_PER_DEG = 60000;      /* Thousandths of a minute per degree    */
+
+/* Thousandths of a minute in the last digit of each precision */
+const long PRECISION_STEP[MAX_PRECISION + 1] = { 100000, 10000, 1000, 100, 10, 1 };
+
 
 /************************************************************************/
 /*                              LOCAL FUNCTIONS     
  *
  */
 
-void extractDegrees( char *GEOREFString, double *longitude, double *latitude )
+void extractDegrees( const char *GEOREFString, double *longitude, double *latitude )
 { 
 /*    
  *  This function extracts the latitude and longitude degree parts of the 
@@ -190,7 +206,7 @@ void extractDegrees( char *GEOREFString, double *longitude, double *latitude )
 } 
 
 
-void extractMinutes( char *GEOREFString, long start, long length, long errorType, double *minutes )
+void extractMinutes( const char *GEOREFString, long start, long length, long errorType, double *minutes )
 { 
 /*    
  *  This function extracts the minutes from the GEOREF string.  The minutes
@@ -247,14 +263,14 @@ long roundGEOREF( double value )
 } 
 
 
-void convertMinutesToString( double minutes, long precision, char *str )
+long convertMinutesToThousandths( double minutes, long precision )
 { 
 /*    
- *  This function converts minutes to a string of length precision.
+ *  This function rounds minutes to precision digits, and returns them in
+ *  thousandths of a minute.
  *
  *    minutes       : Minutes to be converted                  (input)
- *    precision     : Length of resulting string               (input)
- *    str           : String to hold converted minutes         (output)
+ *    precision     : Number of digits of the minutes          (input)
  */
 
   double divisor;
@@ -264,12 +280,196 @@ void convertMinutesToString( double minutes, long precision, char *str )
     minutes = 59.999;
   minutes = minutes * 1000;
   min = roundGEOREF (minutes/divisor);
-  sprintf (str, "%*.*ld", precision, precision, min);
-  if (precision == 1)
-    strcat (str, "0");
+
+  return min * PRECISION_STEP[precision];
 } 
 
 
+CellKey makeGEOREFKey( long precision, const long letter_number[GEOREF_LETTERS], long long_thousandths, long lat_thousandths )
+{
+/*
+ *  This function packs the fields of a GEOREF cell key.  A precision 2 key
+ *  whose minutes are both multiples of ten gets precision 1, as the two
+ *  write the same string.
+ *
+ *    precision        : Precision, 0-5                               (input)
+ *    letter_number    : Letters, without I and O                     (input)
+ *    long_thousandths : Longitude minutes, in thousandths            (input)
+ *    lat_thousandths  : Latitude minutes, in thousandths             (input)
+ */
+
+  long i;                                 /* counter in for loop            */
+
+  if ((precision == 2) && (long_thousandths % PRECISION_STEP[1] == 0)
+      && (lat_thousandths % PRECISION_STEP[1] == 0))
+    precision = 1;
+
+  CellKey key = ((CellKey)precision << CELL_KEY_PRECISION_SHIFT)
+                | ((CellKey)lat_thousandths << KEY_LAT_MINUTES_SHIFT)
+                | (CellKey)long_thousandths;
+
+  for (i = 0; i < GEOREF_LETTERS; i++)
+    key |= (CellKey)letter_number[i] << KEY_LETTER_SHIFT[i];
+
+  return key;
+}
+
+
+const char* computeGEOREFKey( double longitude, double latitude, long precision, CellKey* key )
+{
+/*
+ *  This function computes the key of the GEOREF cell of Geodetic (latitude
+ *  and longitude in radians) coordinates.  It returns the error message if
+ *  the coordinates or precision are invalid, otherwise 0.
+ *
+ *    longitude    : Longitude in radians.                  (input)
+ *    latitude     : Latitude in radians.                   (input)
+ *    precision    : Precision specified by the user.       (input)
+ *    key          : GEOREF cell key.                       (output)
+ */
+
+  double long_min;                        /* GEOREF longitude minute part   */
+  double lat_min;                         /* GEOREF latitude minute part    */
+  double origin_long;                     /* Origin longitude (-180 degrees)*/
+  double origin_lat;                      /* Origin latitude (-90 degrees)  */
+  long letter_number[GEOREF_LETTERS + 1]; /* GEOREF letters, without I and O */
+
+  latitude = latitude * RADIAN_TO_DEGREE;
+  longitude = longitude * RADIAN_TO_DEGREE;
+
+  if ((latitude < (double)LATITUDE_LOW) 
+      || (latitude > (double)LATITUDE_HIGH))
+    return ErrorMessages::latitude;
+  if ((longitude < (double)LONGITUDE_LOW) 
+      || (longitude > (double)LONGITUDE_HIGH))
+    return ErrorMessages::longitude;
+  if ((precision < 0) || (precision > MAX_PRECISION))
+    return ErrorMessages::precision;
+
+  if (longitude > 180)
+      longitude -= 360;
+
+  origin_long = (double)LONGITUDE_LOW;
+  origin_lat = (double)LATITUDE_LOW;
+  letter_number[0] = (long)((longitude-origin_long) / QUAD + ROUND_ERROR);
+  longitude = longitude - ((double)letter_number[0] * QUAD + origin_long);
+  letter_number[2] = (long)(longitude + ROUND_ERROR);
+  long_min = (longitude - (double)letter_number[2]) * (double)MIN_PER_DEG;
+  letter_number[1] = (long)((latitude - origin_lat) / QUAD + ROUND_ERROR);
+  latitude = latitude - ((double)letter_number[1] * QUAD + origin_lat);
+  letter_number[3] = (long)(latitude + ROUND_ERROR);
+  lat_min = (latitude - (double)letter_number[3]) * (double)MIN_PER_DEG;
+
+  if (letter_number[0] == 24)
+  { /* longitude of 180 degrees, Z and Q */
+    letter_number[0] = 23;
+    letter_number[2] = 14;
+    long_min = 59.999;
+  }
+  if (letter_number[1] == 12)
+  { /* latitude of 90 degrees, M and Q */
+    letter_number[1] = 11;
+    letter_number[3] = 14;
+    lat_min = 59.999;
+  }
+
+  *key = makeGEOREFKey( precision, letter_number,
+                        convertMinutesToThousandths(long_min, precision),
+                        convertMinutesToThousandths(lat_min, precision) );
+
+  return 0;
+}
+
+
+const char* extractGEOREFKey( CellKey key, long *precision, long letter_number[GEOREF_LETTERS], long *long_thousandths, long *lat_thousandths )
+{
+/*
+ *  This function extracts the fields of a GEOREF cell key.  It returns
+ *  ErrorMessages::georefString if the key is not that of a GEOREF string,
+ *  otherwise 0.
+ *
+ *    key              : GEOREF cell key                              (input)
+ *    precision        : Precision, 0-5                              (output)
+ *    letter_number    : Letters, without I and O                    (output)
+ *    long_thousandths : Longitude minutes, in thousandths           (output)
+ *    lat_thousandths  : Latitude minutes, in thousandths            (output)
+ */
+
+  long i;                                 /* counter in for loop            */
+  CellKey key_precision = key >> CELL_KEY_PRECISION_SHIFT;
+  CellKey fields;
+
+  if (key_precision > (CellKey)MAX_PRECISION)
+    return ErrorMessages::georefString;
+
+  *precision = (long)key_precision;
+  *long_thousandths = (long)(key & KEY_MINUTES_MASK);
+  *lat_thousandths = (long)((key >> KEY_LAT_MINUTES_SHIFT) & KEY_MINUTES_MASK);
+  fields = (key_precision << CELL_KEY_PRECISION_SHIFT)
+           | ((CellKey)*lat_thousandths << KEY_LAT_MINUTES_SHIFT)
+           | (CellKey)*long_thousandths;
+  for (i = 0; i < GEOREF_LETTERS; i++)
+  {
+    letter_number[i] = (long)((key >> KEY_LETTER_SHIFT[i]) & KEY_LETTER_MASK);
+    if (letter_number[i] > KEY_MAX_LETTER[i])
+      return ErrorMessages::georefString;
+    fields |= (CellKey)letter_number[i] << KEY_LETTER_SHIFT[i];
+  }
+
+  /* Bits outside the fields must be 0 */
+  if (fields != key)
+    return ErrorMessages::georefString;
+
+  /* Minutes are whole digits of the precision, up to 60; rounding at */
+  /* precision 0 gives 0 or 1 in the digit of 100 minutes             */
+  long step = PRECISION_STEP[*precision];
+  long max_thousandths = (step > THOUSANDTHS_PER_DEG) ? step : THOUSANDTHS_PER_DEG;
+  if ((*long_thousandths % step != 0) || (*long_thousandths > max_thousandths)
+      || (*lat_thousandths % step != 0) || (*lat_thousandths > max_thousandths))
+    return ErrorMessages::georefString;
+
+  return 0;
+}
+
+
+void writeGEOREFString( long precision, const long letter_number[GEOREF_LETTERS], long long_thousandths, long lat_thousandths, char *GEOREFString )
+{
+/*
+ *  This function writes the GEOREF string of the fields of a valid GEOREF
+ *  cell key.
+ *
+ *    precision        : Precision, 0-5                               (input)
+ *    letter_number    : Letters, without I and O                     (input)
+ *    long_thousandths : Longitude minutes, in thousandths            (input)
+ *    lat_thousandths  : Latitude minutes, in thousandths             (input)
+ *    GEOREFString     : GEOREF coordinate string                    (output)
+ */
+
+  long i;                                 /* counter in for loop            */
+  long letter;
+  char *str;
+
+  for (i=0;i<4;i++)
+  {
+    letter = letter_number[i];
+    if (letter >= LETTER_I)
+      letter += 1;
+    if (letter >= LETTER_O)
+      letter += 1;
+    GEOREFString[i] = (char)(letter + LETTER_A_OFFSET);
+  }
+
+  str = GEOREFString + GEOREF_LETTERS;
+  str += sprintf (str, "%*.*ld", (int)precision, (int)precision, long_thousandths / PRECISION_STEP[precision]);
+  if (precision == 1)
+    *str++ = '0';
+  str += sprintf (str, "%*.*ld", (int)precision, (int)precision, lat_thousandths / PRECISION_STEP[precision]);
+  if (precision == 1)
+    *str++ = '0';
+  *str = 0;
+}
+
+
 /************************************************************************/
 /*                              FUNCTIONS     
  *
@@ -325,69 +525,18 @@ MSP::CCS::GEOREFCoordinates* GEOREF::convertFromGeodetic( MSP::CCS::GeodeticCoor
  *
  */
 
-  double long_min;                        /* GEOREF longitude minute part   */
-  double lat_min;                         /* GEOREF latitude minute part    */
-  double origin_long;                     /* Origin longitude (-180 degrees)*/
-  double origin_lat;                      /* Origin latitude (-90 degrees)  */
-  long letter_number[GEOREF_LETTERS + 1]; /* GEOREF letters                 */
-  char long_min_str[MAX_PRECISION + 1];   /* Longitude minute string        */
-  char lat_min_str[MAX_PRECISION + 1];    /* Latitude minute string         */
-  long i;                                 /* counter in for loop            */
+  CellKey key;                            /* GEOREF cell key                */
+  long letter_number[GEOREF_LETTERS];     /* GEOREF letters, without I and O */
+  long long_thousandths;                  /* Longitude minutes, thousandths */
+  long lat_thousandths;                   /* Latitude minutes, thousandths  */
   char GEOREFString[21];
 
-  double latitude = geodeticCoordinates->latitude() * RADIAN_TO_DEGREE;
-  double longitude = geodeticCoordinates->longitude() * RADIAN_TO_DEGREE;
-
-  if ((latitude < (double)LATITUDE_LOW) 
-      || (latitude > (double)LATITUDE_HIGH))
-    throw CoordinateConversionException( ErrorMessages::latitude );
-  if ((longitude < (double)LONGITUDE_LOW) 
-      || (longitude > (double)LONGITUDE_HIGH))
-    throw CoordinateConversionException( ErrorMessages::longitude );
-  if ((precision < 0) || (precision > MAX_PRECISION))
-    throw CoordinateConversionException( ErrorMessages::precision );
+  const char* errorMessage = computeGEOREFKey( geodeticCoordinates->longitude(), geodeticCoordinates->latitude(), precision, &key );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
 
-  if (longitude > 180)
-      longitude -= 360;
-
-  origin_long = (double)LONGITUDE_LOW;
-  origin_lat = (double)LATITUDE_LOW;
-  letter_number[0] = (long)((longitude-origin_long) / QUAD + ROUND_ERROR);
-  longitude = longitude - ((double)letter_number[0] * QUAD + origin_long);
-  letter_number[2] = (long)(longitude + ROUND_ERROR);
-  long_min = (longitude - (double)letter_number[2]) * (double)MIN_PER_DEG;
-  letter_number[1] = (long)((latitude - origin_lat) / QUAD + ROUND_ERROR);
-  latitude = latitude - ((double)letter_number[1] * QUAD + origin_lat);
-  letter_number[3] = (long)(latitude + ROUND_ERROR);
-  lat_min = (latitude - (double)letter_number[3]) * (double)MIN_PER_DEG;
-  for (i = 0;i < 4; i++)
-  {
-    if (letter_number[i] >= LETTER_I)
-      letter_number[i] += 1;
-    if (letter_number[i] >= LETTER_O)
-      letter_number[i] += 1;
-  }
-
-  if (letter_number[0] == 26)
-  { /* longitude of 180 degrees */
-    letter_number[0] = LETTER_Z;
-    letter_number[2] = LETTER_Q;
-    long_min = 59.999;
-  }
-  if (letter_number[1] == 13)
-  { /* latitude of 90 degrees */
-    letter_number[1] = LETTER_M;
-    letter_number[3] = LETTER_Q;
-    lat_min = 59.999;
-  }
-
-  for (i=0;i<4;i++)
-    GEOREFString[i] = (char)(letter_number[i] + LETTER_A_OFFSET);
-  GEOREFString[4] = 0;
-  convertMinutesToString(long_min,precision,long_min_str);
-  convertMinutesToString(lat_min,precision,lat_min_str);
-  strcat(GEOREFString,long_min_str);
-  strcat(GEOREFString,lat_min_str);
+  extractGEOREFKey( key, &precision, letter_number, &long_thousandths, &lat_thousandths );
+  writeGEOREFString( precision, letter_number, long_thousandths, lat_thousandths, GEOREFString );
 
   return new GEOREFCoordinates( CoordinateType::georef, GEOREFString );
 }
@@ -443,5 +592,336 @@ MSP::CCS::GeodeticCoordinates* GEOREF::convertToGeodetic( MSP::CCS::GEOREFCoordi
 }
 
 
+void GEOREF::convertFromGeodeticBatch( long count, const double* longitudes, const double* latitudes, long precision, char* GEOREFStrings, const char** status )
+{
+/*
+ *  The function convertFromGeodeticBatch converts count Geodetic
+ *  coordinates to GEOREF coordinate strings, written GEOREF_STRING_SIZE
+ *  characters apart, setting the status of each point.  The string of a
+ *  point that cannot be converted is empty.
+ *
+ *    longitudes    : Longitudes in radians                 (input)
+ *    latitudes     : Latitudes in radians                  (input)
+ *    precision     : Precision specified by the user.      (input)
+ *    GEOREFStrings : GEOREF coordinate strings            (output)
+ *    status        : Error message of each point, or 0    (output)
+ */
+
+  CellKey key;                            /* GEOREF cell key                */
+  long key_precision;                     /* Precision of the key           */
+  long letter_number[GEOREF_LETTERS];     /* GEOREF letters, without I and O */
+  long long_thousandths;                  /* Longitude minutes, thousandths */
+  long lat_thousandths;                   /* Latitude minutes, thousandths  */
+
+  for( long i = 0; i < count; i++ )
+  {
+    char* GEOREFString = GEOREFStrings + i * GEOREF_STRING_SIZE;
+
+    status[i] = computeGEOREFKey( longitudes[i], latitudes[i], precision, &key );
+    if( status[i] )
+    {
+      GEOREFString[0] = '\0';
+      continue;
+    }
+
+    extractGEOREFKey( key, &key_precision, letter_number, &long_thousandths, &lat_thousandths );
+    writeGEOREFString( key_precision, letter_number, long_thousandths, lat_thousandths, GEOREFString );
+  }
+}
+
+
+void GEOREF::convertToGeodeticBatch( long count, const char* GEOREFStrings, double* longitudes, double* latitudes, const char** status )
+{
+/*
+ *  The function convertToGeodeticBatch converts count GEOREF coordinate
+ *  strings, held GEOREF_STRING_SIZE characters apart, to Geodetic
+ *  coordinates, setting the status of each point.
+ *
+ *    GEOREFStrings : GEOREF coordinate strings             (input)
+ *    longitudes    : Longitudes in radians                (output)
+ *    latitudes     : Latitudes in radians                 (output)
+ *    status        : Error message of each point, or 0    (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    GEOREFCoordinates georefCoordinates( CoordinateType::georef, GEOREFStrings + i * GEOREF_STRING_SIZE );
+
+    try
+    {
+      GeodeticCoordinates* geodeticCoordinates = convertToGeodetic( &georefCoordinates );
+
+      longitudes[i] = geodeticCoordinates->longitude();
+      latitudes[i] = geodeticCoordinates->latitude();
+      delete geodeticCoordinates;
+      status[i] = 0;
+    }
+    catch( CoordinateConversionException& e )
+    {
+      status[i] = errorStatus( e.getMessage() );
+    }
+  }
+}
+
+
+CellKey GEOREF::convertFromGeodeticToCellKey( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision )
+{
+/*
+ *  The function convertFromGeodeticToCellKey returns the key of the GEOREF
+ *  cell of Geodetic (latitude and longitude in radians) coordinates.
+ *
+ *    longitude    : Longitude in radians.                  (input)
+ *    latitude     : Latitude in radians.                   (input)
+ *    precision    : Precision specified by the user.       (input)
+ */
+
+  CellKey key;
+
+  const char* errorMessage = computeGEOREFKey( geodeticCoordinates->longitude(), geodeticCoordinates->latitude(), precision, &key );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return key;
+}
+
+
+void GEOREF::convertFromGeodeticToCellKeys( long count, const double* longitudes, const double* latitudes, long precision, CellKey* keys, const char** status )
+{
+/*
+ *  The function convertFromGeodeticToCellKeys converts count Geodetic
+ *  coordinates to GEOREF cell keys, setting the status of each point.
+ *
+ *    count       : Number of points                        (input)
+ *    longitudes  : Longitudes in radians                   (input)
+ *    latitudes   : Latitudes in radians                    (input)
+ *    precision   : Precision specified by the user.        (input)
+ *    keys        : GEOREF cell keys                       (output)
+ *    status      : Error message of each point, or 0      (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    keys[i] = 0;
+    status[i] = computeGEOREFKey( longitudes[i], latitudes[i], precision, &keys[i] );
+  }
+}
+
+
+void GEOREF::convertCellKeysToBounds( long count, const CellKey* keys, double* westLongitudes, double* southLatitudes, double* eastLongitudes, double* northLatitudes, const char** status )
+{
+/*
+ *  The function convertCellKeysToBounds converts count GEOREF cell keys to
+ *  the bounds of their cells, in radians, setting the status of each key.
+ *  The minutes of a key are rounded, so its cell extends half a digit
+ *  either side of them, clipped to its 1 degree square.
+ *
+ *    count          : Number of keys                      (input)
+ *    keys           : GEOREF cell keys                    (input)
+ *    westLongitudes : West edges in radians              (output)
+ *    southLatitudes : South edges in radians             (output)
+ *    eastLongitudes : East edges in radians              (output)
+ *    northLatitudes : North edges in radians             (output)
+ *    status         : Error message of each key, or 0    (output)
+ */
+
+  long precision;
+  long letter_number[GEOREF_LETTERS];
+  long long_thousandths;
+  long lat_thousandths;
+
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = extractGEOREFKey( keys[i], &precision, letter_number, &long_thousandths, &lat_thousandths );
+    if( status[i] )
+    {
+      westLongitudes[i] = southLatitudes[i] = 0.0;
+      eastLongitudes[i] = northLatitudes[i] = 0.0;
+      continue;
+    }
+
+    double half_step = PRECISION_STEP[precision] / 2.0;
+    double longitude = LONGITUDE_LOW + letter_number[0] * QUAD + letter_number[2];
+    double latitude = LATITUDE_LOW + letter_number[1] * QUAD + letter_number[3];
+
+    double west = long_thousandths - half_step;
+    double east = long_thousandths + half_step;
+    double south = lat_thousandths - half_step;
+    double north = lat_thousandths + half_step;
+    if( west < 0.0 )
+      west = 0.0;
+    if( south < 0.0 )
+      south = 0.0;
+    /* Minutes of 60 are written as 59.999 */
+    if( ( east > THOUSANDTHS_PER_DEG ) || ( long_thousandths == THOUSANDTHS_PER_DEG - 1 ) )
+      east = THOUSANDTHS_PER_DEG;
+    if( ( north > THOUSANDTHS_PER_DEG ) || ( lat_thousandths == THOUSANDTHS_PER_DEG - 1 ) )
+      north = THOUSANDTHS_PER_DEG;
+
+    westLongitudes[i] = ( longitude + west / THOUSANDTHS_PER_DEG ) * DEGREE_TO_RADIAN;
+    southLatitudes[i] = ( latitude + south / THOUSANDTHS_PER_DEG ) * DEGREE_TO_RADIAN;
+    eastLongitudes[i] = ( longitude + east / THOUSANDTHS_PER_DEG ) * DEGREE_TO_RADIAN;
+    northLatitudes[i] = ( latitude + north / THOUSANDTHS_PER_DEG ) * DEGREE_TO_RADIAN;
+  }
+}
+
+
+CellKey GEOREF::convertStringToCellKey( const char* GEOREFString )
+{
+/*
+ *  The function convertStringToCellKey returns the key of a GEOREF
+ *  coordinate string.
+ *
+ *    GEOREFString : GEOREF coordinate string.     (input)
+ *
+ */
+
+  long minutes_length;       /* length of minutes in the GEOREF string       */
+  long georef_length;        /* length of GEOREF string                      */
+  long precision;
+  double long_minutes;       /* Longitude minute part of GEOREF              */
+  double lat_minutes;        /* Latitude minute part of GEOREF               */
+  double longitude, latitude;
+  long letter_number[GEOREF_LETTERS];
+
+  georef_length = strlen(GEOREFString);
+  if ((georef_length < GEOREF_MINIMUM) || (georef_length > GEOREF_MAXIMUM) 
+      || ((georef_length % 2) != 0))
+    throw CoordinateConversionException( ErrorMessages::georefString );
+
+  extractDegrees( GEOREFString, &longitude, &latitude );
+  minutes_length = (georef_length - GEOREF_LETTERS) / 2;
+
+  extractMinutes(GEOREFString, GEOREF_LETTERS, minutes_length, 
+                                GEOREF_STR_LON_MIN_ERROR, &long_minutes);
+
+  extractMinutes(GEOREFString, (GEOREF_LETTERS+minutes_length),
+                                minutes_length, GEOREF_STR_LAT_MIN_ERROR, &lat_minutes);
+
+  /* A single digit is whole minutes */
+  precision = (minutes_length == 1) ? 2 : minutes_length;
+
+  letter_number[0] = (long)longitude / (long)QUAD;
+  letter_number[1] = (long)latitude / (long)QUAD;
+  letter_number[2] = (long)longitude % (long)QUAD;
+  letter_number[3] = (long)latitude % (long)QUAD;
+
+  return makeGEOREFKey( precision, letter_number,
+                        roundGEOREF(long_minutes * 1000),
+                        roundGEOREF(lat_minutes * 1000) );
+}
+
+
+void GEOREF::convertCellKeyToString( CellKey key, char* GEOREFString )
+{
+/*
+ *  The function convertCellKeyToString writes the GEOREF coordinate
+ *  string of a cell key.
+ *
+ *    key          : GEOREF cell key               (input)
+ *    GEOREFString : GEOREF coordinate string.    (output)
+ *
+ */
+
+  long precision;
+  long letter_number[GEOREF_LETTERS];
+  long long_thousandths;
+  long lat_thousandths;
+
+  const char* errorMessage = extractGEOREFKey( key, &precision, letter_number, &long_thousandths, &lat_thousandths );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  writeGEOREFString( precision, letter_number, long_thousandths, lat_thousandths, GEOREFString );
+}
+
+
+long GEOREF::enumerateCellKeys( double westLongitude, double southLatitude, double eastLongitude, double northLatitude, long precision, CellKey* keys, long maxKeys )
+{
+/*
+ *  The function enumerateCellKeys writes the keys of the GEOREF cells
+ *  covering an area, and returns their number.  Cells are numbered across
+ *  the grid by degree and then by minute value.
+ *
+ *    westLongitude  : West edge in radians                       (input)
+ *    southLatitude  : South edge in radians                      (input)
+ *    eastLongitude  : East edge in radians                       (input)
+ *    northLatitude  : North edge in radians                      (input)
+ *    precision      : Precision specified by the user.           (input)
+ *    keys           : GEOREF cell keys                          (output)
+ *    maxKeys        : Number of keys that fit in keys            (input)
+ *
+ */
+
+  CellKey south_west, north_east;
+  long sw_letters[GEOREF_LETTERS], ne_letters[GEOREF_LETTERS];
+  long sw_long, sw_lat, ne_long, ne_lat;
+  long key_precision;                     /* Precision of a corner key      */
+  long letter_number[GEOREF_LETTERS];
+
+  const char* errorMessage = computeGEOREFKey( westLongitude, southLatitude, precision, &south_west );
+  if( !errorMessage )
+    errorMessage = computeGEOREFKey( eastLongitude, northLatitude, precision, &north_east );
+  if( !errorMessage && ( southLatitude > northLatitude ) )
+    errorMessage = ErrorMessages::latitude;
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  /* The corner keys may have precision 1 where 2 was asked for */
+  extractGEOREFKey( south_west, &key_precision, sw_letters, &sw_long, &sw_lat );
+  extractGEOREFKey( north_east, &key_precision, ne_letters, &ne_long, &ne_lat );
+
+  /* Minute values in a degree: up to 60 minutes, or 0 and 1 at precision 0 */
+  long step = PRECISION_STEP[precision];
+  long values = ( ( step > THOUSANDTHS_PER_DEG ) ? step : THOUSANDTHS_PER_DEG ) / step + 1;
+  long columns_per_row = 360 * values;
+
+  long first_column = ( sw_letters[0] * (long)QUAD + sw_letters[2] ) * values + sw_long / step;
+  long last_column = ( ne_letters[0] * (long)QUAD + ne_letters[2] ) * values + ne_long / step;
+  long first_row = ( sw_letters[1] * (long)QUAD + sw_letters[3] ) * values + sw_lat / step;
+  long last_row = ( ne_letters[1] * (long)QUAD + ne_letters[3] ) * values + ne_lat / step;
+
+  /* The area runs east from its west edge, across 180 degrees if its */
+  /* east edge is west of its west edge                               */
+  double west = westLongitude * RADIAN_TO_DEGREE;
+  double width = ( eastLongitude - westLongitude ) * RADIAN_TO_DEGREE;
+  if( west > 180.0 )
+    west -= 360.0;
+  if( width < 0.0 )
+    width += 360.0;
+
+  long columns = last_column - first_column + 1;
+  if( west + width > 180.0 )
+    columns += columns_per_row;
+  if( ( columns > columns_per_row ) || ( width >= 360.0 ) )
+  {
+    first_column = 0;
+    columns = columns_per_row;
+  }
+  long rows = last_row - first_row + 1;
+
+  long count = 0;
+  for( long row = first_row; ( row <= last_row ) && ( count < maxKeys ); row++ )
+  {
+    long lat_degree = row / values;
+    letter_number[1] = lat_degree / (long)QUAD;
+    letter_number[3] = lat_degree % (long)QUAD;
+
+    for( long i = 0; ( i < columns ) && ( count < maxKeys ); i++ )
+    {
+      long column = ( first_column + i ) % columns_per_row;
+      long long_degree = column / values;
+      letter_number[0] = long_degree / (long)QUAD;
+      letter_number[2] = long_degree % (long)QUAD;
+
+      keys[count++] = makeGEOREFKey( precision, letter_number,
+                                     ( column % values ) * step,
+                                     ( row % values ) * step );
+    }
+  }
+
+  return rows * columns;
+}
+
+
 
 // CLASSIFICATION: UNCLASSIFIED
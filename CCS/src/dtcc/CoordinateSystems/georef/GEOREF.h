@@ -73,10 +73,16 @@
  *    ----              -----------
  *    02-20-97          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Added cell keys, with bulk conversion of geodetic
+ *                      coordinates to keys and of keys to cell bounds
+ *    10-19-26          Added enumeration of the cells covering an area
+ *    10-19-26          Added batch conversions of coordinate strings
+ *    10-19-26          Keys of precision 1 and 2 strings are canonical
  */
 
 
 #include "CoordinateSystem.h"
+#include "CellKey.h"
 
 
 namespace MSP
@@ -95,8 +101,10 @@ namespace MSP
     const long GEOREF_STR_LAT_MIN_ERROR = 0x0020;
     const long GEOREF_STR_LON_MIN_ERROR = 0x0040;
 
+    #define GEOREF_STRING_SIZE 15  /* GEOREF string, including the null */
 
-    class GEOREF : public CoordinateSystem
+
+    class MSP_DTCC_API GEOREF : public CoordinateSystem
     {
     public:
 
@@ -145,6 +153,165 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::GEOREFCoordinates* GEOREFString );
 
+
+      /*
+       *  The function convertFromGeodeticBatch converts count Geodetic
+       *  coordinates, held in contiguous arrays, to GEOREF coordinate
+       *  strings, written GEOREF_STRING_SIZE characters apart and null
+       *  terminated.  Errors are reported through status as for
+       *  CoordinateSystem's batch conversions.
+       *
+       *    count         : Number of points                    (input)
+       *    longitudes    : Longitudes in radians               (input)
+       *    latitudes     : Latitudes in radians                (input)
+       *    precision     : Precision specified by the user.    (input)
+       *    GEOREFStrings : GEOREF coordinate strings           (output)
+       *    status        : Error message of each point, or 0   (output)
+       */
+
+      void convertFromGeodeticBatch( long count, const double* longitudes, const double* latitudes, long precision, char* GEOREFStrings, const char** status );
+
+
+      /*
+       *  The function convertToGeodeticBatch converts count GEOREF
+       *  coordinate strings, held GEOREF_STRING_SIZE characters apart, to
+       *  Geodetic coordinates.  Errors are reported through status as for
+       *  convertFromGeodeticBatch.
+       *
+       *    count         : Number of points                    (input)
+       *    GEOREFStrings : GEOREF coordinate strings           (input)
+       *    longitudes    : Longitudes in radians               (output)
+       *    latitudes     : Latitudes in radians                (output)
+       *    status        : Error message of each point, or 0   (output)
+       */
+
+      void convertToGeodeticBatch( long count, const char* GEOREFStrings, double* longitudes, double* latitudes, const char** status );
+
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
+
+
+      /*
+       *  A GEOREF cell key holds the parts of a GEOREF string, from the
+       *  least significant bit:
+       *
+       *      bits  0-16  : longitude minutes, in thousandths of a minute
+       *      bits 17-33  : latitude minutes, in thousandths of a minute
+       *      bits 34-38  : 1 degree longitude letter, 0-14 (A-Q without I and O)
+       *      bits 39-43  : 1 degree latitude letter, 0-14
+       *      bits 44-48  : 15 degree longitude letter, 0-23 (A-Z without I and O)
+       *      bits 49-53  : 15 degree latitude letter, 0-11 (A-M without I)
+       *      bits 56-58  : precision, 0-5
+       *
+       *  The minutes are those of the string, as rounded to the precision.
+       *  The precision bits stay in a shifted key, so
+       *  (cellKeyFields( key ) >> 34) names the 1 degree square and
+       *  (cellKeyFields( key ) >> 44) the 15 degree square of a key of any
+       *  precision.
+       *
+       *  Precision 1 writes each minute part as two digits ending in 0,
+       *  like precision 2, so a string cannot tell the two apart.  A key
+       *  has the coarsest precision that writes its string: precision 2
+       *  cells whose minutes are both multiples of ten have precision 1
+       *  keys, and the bounds of their 10 minute cells.  Keys from strings
+       *  and from Geodetic coordinates then match.
+       */
+
+      /*
+       *  The function convertFromGeodeticToCellKey returns the key of the
+       *  GEOREF cell of Geodetic (latitude and longitude in radians)
+       *  coordinates; it is the key of the string convertFromGeodetic
+       *  returns.
+       *
+       *    geodeticCoordinates : Geodetic coordinates              (input)
+       *    precision           : Precision specified by the user.  (input)
+       */
+
+      CellKey convertFromGeodeticToCellKey( MSP::CCS::GeodeticCoordinates* geodeticCoordinates, long precision );
+
+
+      /*
+       *  The function convertFromGeodeticToCellKeys converts count Geodetic
+       *  coordinates, held in contiguous arrays, to GEOREF cell keys.  Points
+       *  that cannot be converted are not thrown as exceptions: status[i]
+       *  is set to the error message, or to 0 when point i was converted.
+       *
+       *    count      : Number of points                        (input)
+       *    longitudes : Longitudes in radians                   (input)
+       *    latitudes  : Latitudes in radians                    (input)
+       *    precision  : Precision specified by the user.        (input)
+       *    keys       : GEOREF cell keys                       (output)
+       *    status     : Error message of each point, or 0      (output)
+       */
+
+      void convertFromGeodeticToCellKeys( long count, const double* longitudes, const double* latitudes, long precision, CellKey* keys, const char** status );
+
+
+      /*
+       *  The function convertCellKeysToBounds converts count GEOREF cell
+       *  keys to the bounds, in radians, of the points whose minutes round
+       *  to those of the key, within the key's 1 degree square.  Errors are
+       *  reported through status as for convertFromGeodeticToCellKeys.
+       *
+       *    count          : Number of keys                      (input)
+       *    keys           : GEOREF cell keys                    (input)
+       *    westLongitudes : West edges in radians              (output)
+       *    southLatitudes : South edges in radians             (output)
+       *    eastLongitudes : East edges in radians              (output)
+       *    northLatitudes : North edges in radians             (output)
+       *    status         : Error message of each key, or 0    (output)
+       */
+
+      void convertCellKeysToBounds( long count, const CellKey* keys, double* westLongitudes, double* southLatitudes, double* eastLongitudes, double* northLatitudes, const char** status );
+
+
+      /*
+       *  The function convertStringToCellKey returns the key of a GEOREF
+       *  coordinate string, with the checks of convertToGeodetic.  Its
+       *  precision is the number of digits of each minute part, or 2 for
+       *  a single digit, but 1 for two digits both ending in 0.  The
+       *  strings of keys give back the same keys, except those of
+       *  precision 0 keys whose minutes round up to 1.
+       *
+       *    GEOREFString : GEOREF coordinate string.     (input)
+       */
+
+      CellKey convertStringToCellKey( const char* GEOREFString );
+
+
+      /*
+       *  The function convertCellKeyToString writes the GEOREF coordinate
+       *  string of a cell key to a buffer of GEOREF_STRING_SIZE characters.
+       *
+       *    key          : GEOREF cell key               (input)
+       *    GEOREFString : GEOREF coordinate string.    (output)
+       */
+
+      void convertCellKeyToString( CellKey key, char* GEOREFString );
+
+
+      /*
+       *  The function enumerateCellKeys returns the number of GEOREF cells
+       *  of a precision that cover an area, the cells convertFromGeodetic
+       *  gives for the points of the area, and writes the first maxKeys of
+       *  their keys row by row from the south west.  The area runs east
+       *  from its west edge to its east edge, across 180 degrees when the
+       *  east edge is west of the west edge.  The time taken is
+       *  proportional to the number of keys written.  The area is a
+       *  longitude and latitude box; callers covering a polygon enumerate
+       *  its bounding box and keep the cells that meet the polygon.
+       *
+       *    westLongitude  : West edge in radians                   (input)
+       *    southLatitude  : South edge in radians                  (input)
+       *    eastLongitude  : East edge in radians                   (input)
+       *    northLatitude  : North edge in radians                  (input)
+       *    precision      : Precision specified by the user.       (input)
+       *    keys           : GEOREF cell keys                      (output)
+       *    maxKeys        : Number of keys that fit in keys        (input)
+       */
+
+      long enumerateCellKeys( double westLongitude, double southLatitude, double eastLongitude, double northLatitude, long precision, CellKey* keys, long maxKeys );
+
     private:
     
     };
@@ -125,7 +125,7 @@ Gnomonic::Gnomonic(
    double originLatitude,
    double falseEasting,
    double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Gnomonic, MapProjectionCoordinates >(),
   Ra( 6371007.1810824 ),
   Sin_Gnom_Origin_Lat( 0.0 ),
   Cos_Gnom_Origin_Lat( 1.0 ),
@@ -441,5 +441,4 @@ MSP::CCS::GeodeticCoordinates* Gnomonic::convertToGeodetic(
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
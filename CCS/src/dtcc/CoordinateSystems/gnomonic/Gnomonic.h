@@ -81,7 +81,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -98,7 +98,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class Gnomonic : public CoordinateSystem
+    class Gnomonic : public PointBatchCoordinateSystem< Gnomonic, MapProjectionCoordinates >
     {
     public:
 
@@ -73,6 +73,8 @@
  *    Date              Description
  *    ----              -----------
  *    3-1-07          Original Code
+ *    10-19-26        Batch conversions no longer create coordinate
+ *                    objects for each point
  *
  */
 
@@ -257,6 +259,95 @@ MSP::CCS::MapProjectionCoordinates* VanDerGrinten::convertFromGeodetic( MSP::CCS
  *    northing          : Northing (Y) in meters              (output)
  */
 
+  double easting, northing;
+
+  const char* errorMessage = fromGeodetic(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( CoordinateType::vanDerGrinten, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* VanDerGrinten::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Grinten projection
+ * (easting and northing) coordinates to geodetic (latitude and longitude)
+ * coordinates, according to the current ellipsoid and Grinten projection
+ * coordinates.  If any errors occur, an exception is thrown with a description 
+ * of the error.
+ *
+ *    easting           : Easting (X) in meters                  (input)
+ *    northing          : Northing (Y) in meters                 (input)
+ *    longitude         : Longitude (lambda) in radians          (output)
+ *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+double VanDerGrinten::floatEq( double x, double v, double epsilon )
+{
+  return (((v - epsilon) < x) && (x < (v + epsilon)));
+}
+
+
+void VanDerGrinten::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void VanDerGrinten::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* VanDerGrinten::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double &easting,
+   double &northing )
+{
   double dlam;                      /* Longitude - Central Meridan */
   double aa, aasqr;
   double gg;
@@ -266,18 +357,14 @@ MSP::CCS::MapProjectionCoordinates* VanDerGrinten::convertFromGeodetic( MSP::CCS
   double theta;
   double sin_theta, cos_theta;
   double qq;
-  double easting, northing;
-
-  double longitude = geodeticCoordinates->longitude();
-  double latitude  = geodeticCoordinates->latitude();
 
   if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
   {  /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   {  /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
+    return ErrorMessages::longitude;
   }
 
   dlam = longitude - Grin_Origin_Long;
@@ -342,25 +429,16 @@ MSP::CCS::MapProjectionCoordinates* VanDerGrinten::convertFromGeodetic( MSP::CCS
       northing *= -1.0;
   }
 
-  return new MapProjectionCoordinates( CoordinateType::vanDerGrinten, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* VanDerGrinten::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* VanDerGrinten::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
 {
-/*
- * The function convertToGeodetic converts Grinten projection
- * (easting and northing) coordinates to geodetic (latitude and longitude)
- * coordinates, according to the current ellipsoid and Grinten projection
- * coordinates.  If any errors occur, an exception is thrown with a description 
- * of the error.
- *
- *    easting           : Easting (X) in meters                  (input)
- *    northing          : Northing (Y) in meters                 (input)
- *    longitude         : Longitude (lambda) in radians          (output)
- *    latitude          : Latitude (phi) in radians              (output)
- */
-
   double dx, dy;
   double xx, xxsqr;
   double yy, yysqr, two_yysqr;
@@ -377,20 +455,16 @@ MSP::CCS::GeodeticCoordinates* VanDerGrinten::convertToGeodetic( MSP::CCS::MapPr
   double temp;
   const double epsilon = 1.0e-2;
   double delta = PI_Ra + epsilon;
-  double longitude, latitude;
-
-  double easting = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if ((easting > (Grin_False_Easting + delta)) ||
       (easting < (Grin_False_Easting - delta)))
   { /* Easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing > (Grin_False_Northing + delta)) ||
       (northing < (Grin_False_Northing - delta)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   temp = sqrt(easting * easting + northing * northing);
@@ -400,7 +474,7 @@ MSP::CCS::GeodeticCoordinates* VanDerGrinten::convertToGeodetic( MSP::CCS::MapPr
       (temp < (Grin_False_Easting  - PI_Ra - epsilon)) ||
       (temp < (Grin_False_Northing - PI_Ra - epsilon)))
   { /* Point is outside of projection area */
-      throw CoordinateConversionException( ErrorMessages::radius );
+      return ErrorMessages::radius;
   }
 
   dy = northing - Grin_False_Northing;
@@ -459,13 +533,7 @@ MSP::CCS::GeodeticCoordinates* VanDerGrinten::convertToGeodetic( MSP::CCS::MapPr
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
-}
-
-
-double VanDerGrinten::floatEq( double x, double v, double epsilon )
-{
-  return (((v - epsilon) < x) && (x < (v + epsilon)));
+  return 0;
 }
 
 
@@ -79,6 +79,7 @@
  *    03-05-2005        Original Code
  *    03-02-2007        Original C++ Code
  *    02-25-2009        Merged Lambert 1 and 2
+ *    10-19-26          Added warm-started batch inverse
  *
  */
 
@@ -131,7 +132,7 @@ const double ONE_SECOND = 4.89e-6;
  */
 
 LambertConformalConic::LambertConformalConic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing, double scaleFactor ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< LambertConformalConic, MapProjectionCoordinates >(),
   coordinateType( CoordinateType::lambertConformalConic1Parallel ),
   es( 0.08181919084262188000 ),
   es_OVER_2( .040909595421311 ),
@@ -227,7 +228,7 @@ LambertConformalConic::LambertConformalConic( double ellipsoidSemiMajorAxis, dou
 
 
 LambertConformalConic::LambertConformalConic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double standardParallel1, double standardParallel2, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< LambertConformalConic, MapProjectionCoordinates >(),
   coordinateType( CoordinateType::lambertConformalConic2Parallels ),
   es( 0.081819190842621 ),
   es_OVER_2( 0.040909595421311 ),
@@ -570,101 +571,15 @@ MSP::CCS::GeodeticCoordinates* LambertConformalConic::convertToGeodetic( MSP::CC
  *    latitude         : Latitude, in radians                         (output)
  */
 
-  double dx;
-  double dy;
-  double rho;
-  double rho_olat_MINUS_dy;
-  double t;
-  double PHI;
-  double es_sin;
-  double tempPHI = 0.0;
-  double theta = 0.0;
-  double tolerance = 4.85e-10;
-  int count = 30;
   double longitude, latitude;
+  double correction = 0.0;
+  long iterations = 0;
 
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
-  if ((easting < (Lambert_False_Easting - Lambert_Delta_Easting))
-      ||(easting > (Lambert_False_Easting + Lambert_Delta_Easting)))
-  { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting );
-  }
-  if ((northing < (Lambert_False_Northing - Lambert_Delta_Northing))
-      || (northing > (Lambert_False_Northing + Lambert_Delta_Northing)))
-  { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing );
-  }
-
-  dy                = northing - Lambert_False_Northing;
-  dx                = easting  - Lambert_False_Easting;
-  rho_olat_MINUS_dy = Lambert_1_rho_olat - dy;
-  rho = sqrt(dx * dx + (rho_olat_MINUS_dy) * (rho_olat_MINUS_dy));
-
-  if (Lambert_1_n < 0.0)
-  {
-    rho *= -1.0;
-    dx *= -1.0;
-    rho_olat_MINUS_dy *= -1.0;
-  }
-
-  if (rho != 0.0)
-  {
-    theta = atan2(dx, rho_olat_MINUS_dy) / Lambert_1_n;
-    t = Lambert_1_t0 * pow(rho / Lambert_1_rho0, 1 / Lambert_1_n);
-    PHI = PI_OVER_2 - 2.0 * atan(t);
-    while (fabs(PHI - tempPHI) > tolerance && count)
-    {
-      tempPHI = PHI;
-      es_sin = esSin(sin(PHI));
-      PHI = PI_OVER_2 - 2.0 * atan(t * pow((1.0 - es_sin) / (1.0 + es_sin), es_OVER_2));
-      count --;
-    }
-
-    if(!count)
-      throw CoordinateConversionException( ErrorMessages::northing );
-
-    latitude = PHI;
-    longitude = theta + Lambert_Origin_Long;
-
-    if (fabs(latitude) < 2.0e-7)  /* force lat to 0 to avoid -0 degrees */
-      latitude = 0.0;
-    if (latitude > PI_OVER_2)  /* force distorted values to 90, -90 degrees */
-      latitude = PI_OVER_2;
-    else if (latitude < -PI_OVER_2)
-      latitude = -PI_OVER_2;
-
-    if (longitude > PI)
-    {
-      if (longitude - PI < 3.5e-6) 
-        longitude = PI;
-      else
-        longitude -= TWO_PI;
-    }
-    if (longitude < -PI)
-    {
-      if (fabs(longitude + PI) < 3.5e-6)
-        longitude = -PI;
-      else
-        longitude += TWO_PI;
-    }
-
-    if (fabs(longitude) < 2.0e-7)  /* force lon to 0 to avoid -0 degrees */
-      longitude = 0.0;
-    if (longitude > PI)  /* force distorted values to 180, -180 degrees */
-      longitude = PI;
-    else if (longitude < -PI)
-      longitude = -PI;
-  }
-  else
-  {
-    if (Lambert_1_n > 0.0)
-      latitude = PI_OVER_2;
-    else
-      latitude = -PI_OVER_2;
-    longitude = Lambert_Origin_Long;
-  }
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     correction, longitude, latitude, iterations );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
 
   return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
 }
@@ -768,5 +683,182 @@ double LambertConformalConic::esSin( double sinlat )
 }
 
 
+void LambertConformalConic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  convertToGeodeticBatch(
+     count, x, y, z, longitudes, latitudes, heights, status, 0 );
+}
+
+
+void LambertConformalConic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status,
+   long*         iterations )
+{
+/*
+ * The function convertToGeodeticBatch converts Lambert Conformal Conic
+ * projection coordinates to geodetic coordinates.  The latitude iteration
+ * of each point is seeded with the previous point's correction to the
+ * spherical initial guess, so nearby points converge in fewer iterations.
+ * A point that fails from that seed is retried from the initial guess.
+ *
+ *    iterations : Latitude iterations of each point, or 0 if not wanted (output)
+ */
+
+  double correction = 0.0;
+
+  for( long i = 0; i < count; i++ )
+  {
+    long pointIterations = 0;
+    double seed = correction;
+
+    status[i] = toGeodetic( x[i], y[i], correction,
+       longitudes[i], latitudes[i], pointIterations );
+    if( status[i] && seed != 0.0 )
+    {
+      correction = 0.0;
+      status[i] = toGeodetic( x[i], y[i], correction,
+         longitudes[i], latitudes[i], pointIterations );
+    }
+    if( status[i] )
+      correction = 0.0;
+
+    if( heights )
+      heights[i] = 0.0;
+    if( iterations )
+      iterations[i] = pointIterations;
+  }
+}
+
+
+const char* LambertConformalConic::toGeodetic(
+   double  easting,
+   double  northing,
+   double &correction,
+   double &longitude,
+   double &latitude,
+   long   &iterations )
+{
+/*
+ * The function toGeodetic converts one point to geodetic coordinates,
+ * returning the error message, or 0 if the point was converted.  The
+ * latitude iteration starts from the spherical initial guess plus
+ * correction; correction returns the converged latitude minus the guess.
+ * iterations is increased by the number of iterations taken.
+ */
+
+  double dx;
+  double dy;
+  double rho;
+  double rho_olat_MINUS_dy;
+  double t;
+  double PHI;
+  double guess;
+  double es_sin;
+  double tempPHI = 0.0;
+  double theta = 0.0;
+  double tolerance = 4.85e-10;
+  int count = 30;
+
+  if ((easting < (Lambert_False_Easting - Lambert_Delta_Easting))
+      ||(easting > (Lambert_False_Easting + Lambert_Delta_Easting)))
+  { /* Easting out of range  */
+    return ErrorMessages::easting;
+  }
+  if ((northing < (Lambert_False_Northing - Lambert_Delta_Northing))
+      || (northing > (Lambert_False_Northing + Lambert_Delta_Northing)))
+  { /* Northing out of range */
+    return ErrorMessages::northing;
+  }
+
+  dy                = northing - Lambert_False_Northing;
+  dx                = easting  - Lambert_False_Easting;
+  rho_olat_MINUS_dy = Lambert_1_rho_olat - dy;
+  rho = sqrt(dx * dx + (rho_olat_MINUS_dy) * (rho_olat_MINUS_dy));
+
+  if (Lambert_1_n < 0.0)
+  {
+    rho *= -1.0;
+    dx *= -1.0;
+    rho_olat_MINUS_dy *= -1.0;
+  }
+
+  if (rho != 0.0)
+  {
+    theta = atan2(dx, rho_olat_MINUS_dy) / Lambert_1_n;
+    t = Lambert_1_t0 * pow(rho / Lambert_1_rho0, 1 / Lambert_1_n);
+    guess = PI_OVER_2 - 2.0 * atan(t);
+    PHI = guess + correction;
+    while (fabs(PHI - tempPHI) > tolerance && count)
+    {
+      iterations++;
+      tempPHI = PHI;
+      es_sin = esSin(sin(PHI));
+      PHI = PI_OVER_2 - 2.0 * atan(t * pow((1.0 - es_sin) / (1.0 + es_sin), es_OVER_2));
+      count --;
+    }
+
+    if(!count)
+      return ErrorMessages::northing;
+
+    correction = PHI - guess;
+    latitude = PHI;
+    longitude = theta + Lambert_Origin_Long;
+
+    if (fabs(latitude) < 2.0e-7)  /* force lat to 0 to avoid -0 degrees */
+      latitude = 0.0;
+    if (latitude > PI_OVER_2)  /* force distorted values to 90, -90 degrees */
+      latitude = PI_OVER_2;
+    else if (latitude < -PI_OVER_2)
+      latitude = -PI_OVER_2;
+
+    if (longitude > PI)
+    {
+      if (longitude - PI < 3.5e-6) 
+        longitude = PI;
+      else
+        longitude -= TWO_PI;
+    }
+    if (longitude < -PI)
+    {
+      if (fabs(longitude + PI) < 3.5e-6)
+        longitude = -PI;
+      else
+        longitude += TWO_PI;
+    }
+
+    if (fabs(longitude) < 2.0e-7)  /* force lon to 0 to avoid -0 degrees */
+      longitude = 0.0;
+    if (longitude > PI)  /* force distorted values to 180, -180 degrees */
+      longitude = PI;
+    else if (longitude < -PI)
+      longitude = -PI;
+  }
+  else
+  {
+    if (Lambert_1_n > 0.0)
+      latitude = PI_OVER_2;
+    else
+      latitude = -PI_OVER_2;
+    longitude = Lambert_Origin_Long;
+  }
+
+  return 0;
+}
+
 
 // CLASSIFICATION: UNCLASSIFIED
@@ -82,11 +82,12 @@
  *    03-05-2005        Original Code
  *    03-02-2007        Original C++ Code
  *    02-25-2009        Merged Lambert 1 and 2
+ *    10-19-26          Added warm-started batch inverse
  *
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 #include "CoordinateType.h"
 
 
@@ -105,7 +106,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class LambertConformalConic : public CoordinateSystem
+    class LambertConformalConic : public PointBatchCoordinateSystem< LambertConformalConic, MapProjectionCoordinates >
     {
     public:
 
@@ -224,6 +225,45 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The function convertToGeodeticBatch converts an array of easting and
+       * northing coordinates to geodetic coordinates, reporting errors per
+       * point through status instead of exceptions, as described in
+       * CoordinateSystem.
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
+
+      /*
+       * Same as convertToGeodeticBatch, also returning the number of
+       * latitude iterations taken for each point.  The iteration of each
+       * point is seeded from the previous point's solution, so runs of
+       * nearby points, such as tracks, converge in fewer iterations.
+       *
+       *    iterations : Iterations of each point, or 0 if not wanted  (output)
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status,
+         long*         iterations );
+
     private:
     
       CoordinateType::Enum coordinateType;
@@ -275,6 +315,14 @@ namespace MSP
       double lambertT( double lat, double essin );
 
       double esSin(double sinlat);
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &correction,
+         double &longitude,
+         double &latitude,
+         long   &iterations );
     };
   }
 }
@@ -71,6 +71,8 @@
  *	  03-2-07			Original C++ Code
  *    3/23/11           N. Lundgren BAEts28583 Updated for memory leaks in 
  *                      convertFromGeodetic and convertToGeodetic
+ *    10/19/26          Added batch conversions using precomputed affine
+ *                      transforms between geocentric and local cartesian
  *
  */
 
@@ -112,6 +114,7 @@ using namespace MSP::CCS;
 const double PI = 3.14159265358979323e0;    /* PI */
 const double PI_OVER_2 = ( PI / 2.0e0);                 
 const double TWO_PI = (2.0 * PI);                    
+const long BATCH_BLOCK_SIZE = 256;     /* Points per geocentric block */
 
 
 /************************************************************************/
@@ -207,6 +210,8 @@ LocalCartesian::LocalCartesian( double ellipsoidSemiMajorAxis, double ellipsoidF
   v0 = val * Sin_LocalCart_Origin_Lon;
   w0 = ((N0 * (1 - es2)) + LocalCart_Origin_Height) * Sin_LocalCart_Origin_Lat;
 
+  setAffineTransforms();
+
   geocentric = new Geocentric( semiMajorAxis, flattening );
 }
 
@@ -232,6 +237,8 @@ LocalCartesian::LocalCartesian( const LocalCartesian &lc )
   Cos_LocalCart_Orientation = lc.Cos_LocalCart_Orientation; 
   Sin_Lat_Sin_Orient = lc.Sin_Lat_Sin_Orient; 
   Sin_Lat_Cos_Orient = lc.Sin_Lat_Cos_Orient; 
+
+  setAffineTransforms();
 }
 
 
@@ -265,6 +272,8 @@ LocalCartesian& LocalCartesian::operator=( const LocalCartesian &lc )
     Cos_LocalCart_Orientation = lc.Cos_LocalCart_Orientation; 
     Sin_Lat_Sin_Orient = lc.Sin_Lat_Sin_Orient; 
     Sin_Lat_Cos_Orient = lc.Sin_Lat_Cos_Orient; 
+
+    setAffineTransforms();
   }
 
   return *this;
@@ -490,4 +499,158 @@ MSP::CCS::CartesianCoordinates* LocalCartesian::convertToGeocentric( const MSP::
   return new CartesianCoordinates( CoordinateType::geocentric, U, V, W );
 }
 
+
+void LocalCartesian::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* heights,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts geodetic coordinates to
+ * local cartesian coordinates in one pass: each point is converted to
+ * geocentric coordinates and then to local cartesian coordinates with the
+ * precomputed geocentric to local cartesian transform.
+ */
+
+  const double (*M)[4] = geocentricToLocal;
+  double one_MINUS_es2 = 1 - es2;
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude  = latitudes[i];
+    double height    = heights ? heights[i] : 0.0;
+
+    if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
+    { /* geodetic latitude out of range */
+      status[i] = ErrorMessages::latitude;
+      continue;
+    }
+    if ((longitude < -PI) || (longitude > TWO_PI))
+    { /* geodetic longitude out of range */
+      status[i] = ErrorMessages::longitude;
+      continue;
+    }
+
+    if (longitude > PI)
+      longitude -= TWO_PI;
+
+    double Sin_Lat = sin(latitude);
+    double Cos_Lat = cos(latitude);
+    double Rn = semiMajorAxis / sqrt(1.0 - es2 * Sin_Lat * Sin_Lat);
+    double val = (Rn + height) * Cos_Lat;
+    double U = val * cos(longitude);
+    double V = val * sin(longitude);
+    double W = (Rn * one_MINUS_es2 + height) * Sin_Lat;
+
+    x[i] = M[0][0] * U + M[0][1] * V + M[0][2] * W + M[0][3];
+    y[i] = M[1][0] * U + M[1][1] * V + M[1][2] * W + M[1][3];
+    if( z )
+      z[i] = M[2][0] * U + M[2][1] * V + M[2][2] * W + M[2][3];
+    status[i] = 0;
+  }
+}
+
+
+void LocalCartesian::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts local cartesian coordinates
+ * to geodetic coordinates.  Blocks of points are converted to geocentric
+ * coordinates with the precomputed local cartesian to geocentric
+ * transform, and each block is then converted to geodetic coordinates by
+ * the geocentric batch conversion.
+ */
+
+  const double (*M)[4] = localToGeocentric;
+  double U[BATCH_BLOCK_SIZE];
+  double V[BATCH_BLOCK_SIZE];
+  double W[BATCH_BLOCK_SIZE];
+
+  for( long start = 0; start < count; start += BATCH_BLOCK_SIZE )
+  {
+    long n = count - start;
+    if( n > BATCH_BLOCK_SIZE )
+      n = BATCH_BLOCK_SIZE;
+
+    for( long j = 0; j < n; j++ )
+    {
+      double X = x[start + j];
+      double Y = y[start + j];
+      double Z = z ? z[start + j] : 0.0;
+
+      U[j] = M[0][0] * X + M[0][1] * Y + M[0][2] * Z + M[0][3];
+      V[j] = M[1][0] * X + M[1][1] * Y + M[1][2] * Z + M[1][3];
+      W[j] = M[2][0] * X + M[2][1] * Y + M[2][2] * Z + M[2][3];
+    }
+
+    geocentric->convertToGeodeticBatch(
+       n, U, V, W, longitudes + start, latitudes + start,
+       heights ? heights + start : 0, status + start );
+
+    for( long i = start; i < start + n; i++ )
+    {
+      if (longitudes[i] > PI)
+        longitudes[i] -= TWO_PI;
+      if (longitudes[i] < -PI)
+        longitudes[i] += TWO_PI;
+    }
+  }
+}
+
+
+void LocalCartesian::setAffineTransforms()
+{
+/*
+ * The function setAffineTransforms combines the local origin and the
+ * orientation into the affine transforms between geocentric and local
+ * cartesian coordinates used by the batch conversions.  The rows of the
+ * rotation are those of convertFromGeocentric; the inverse rotation is
+ * their transpose.
+ */
+
+  double R[3][3];
+
+  R[0][0] = -Cos_LocalCart_Orientation * Sin_LocalCart_Origin_Lon + Sin_Lat_Sin_Orient * Cos_LocalCart_Origin_Lon;
+  R[0][1] = Cos_LocalCart_Orientation * Cos_LocalCart_Origin_Lon + Sin_Lat_Sin_Orient * Sin_LocalCart_Origin_Lon;
+  R[0][2] = -Sin_LocalCart_Orientation * Cos_LocalCart_Origin_Lat;
+
+  R[1][0] = -Sin_LocalCart_Orientation * Sin_LocalCart_Origin_Lon - Sin_Lat_Cos_Orient * Cos_LocalCart_Origin_Lon;
+  R[1][1] = Sin_LocalCart_Orientation * Cos_LocalCart_Origin_Lon - Sin_Lat_Cos_Orient * Sin_LocalCart_Origin_Lon;
+  R[1][2] = Cos_LocalCart_Orientation * Cos_LocalCart_Origin_Lat;
+
+  R[2][0] = Cos_LocalCart_Origin_Lat * Cos_LocalCart_Origin_Lon;
+  R[2][1] = Cos_LocalCart_Origin_Lat * Sin_LocalCart_Origin_Lon;
+  R[2][2] = Sin_LocalCart_Origin_Lat;
+
+  double origin[3] = { u0, v0, w0 };
+
+  for( int row = 0; row < 3; row++ )
+  {
+    geocentricToLocal[row][3] = 0.0;
+    localToGeocentric[row][3] = origin[row];
+
+    for( int col = 0; col < 3; col++ )
+    {
+      geocentricToLocal[row][col] = R[row][col];
+      geocentricToLocal[row][3] -= R[row][col] * origin[col];
+      localToGeocentric[row][col] = R[col][row];
+    }
+  }
+}
+
+
 // CLASSIFICATION: UNCLASSIFIED
@@ -72,6 +72,7 @@
  *    ----              -----------
  *	  07-16-99			    Original Code
  *	  03-2-07			      Original C++ Code
+ *    10-19-26          Added batch conversions
  *
  */
 
@@ -169,6 +170,34 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::CartesianCoordinates* cartesianCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and local cartesian (X, Y, Z)
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
       /*
        * The function convertFromGeocentric converts geocentric
        * coordinates according to the current ellipsoid and local origin parameters.
@@ -227,6 +256,12 @@ namespace MSP
       double Cos_Lat_Cos_Orient; /* cos(LocalCart_Origin_Lat) * cos(LocalCart_Orientation) */
       double Cos_Lat_Sin_Orient; /* cos(LocalCart_Origin_Lat) * sin(LocalCart_Orientation) */
 
+      /* Affine transforms [rotation | translation] used by the batch conversions */
+      double geocentricToLocal[3][4];   /* Geocentric to local cartesian     */
+      double localToGeocentric[3][4];   /* Local cartesian to geocentric     */
+
+      void setAffineTransforms();
+
     };
   }
 }
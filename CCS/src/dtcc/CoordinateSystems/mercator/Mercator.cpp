@@ -72,6 +72,7 @@
  *    ----              -----------
  *    10-02-97          Original Code
  *    03-06-07          Original C++ Code
+ *    10-19-26          Added batch conversions
  *
  */
 
@@ -460,6 +461,89 @@ MSP::CCS::MapProjectionCoordinates* Mercator::convertFromGeodetic( MSP::CCS::Geo
  *    latitude          : Latitude (phi) in radians           (input)
  *    easting           : Easting (X) in meters               (output)
  *    northing          : Northing (Y) in meters              (output)
+ */
+
+  double easting, northing;
+  const char* errorMessage = fromGeodetic(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( coordinateType, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* Mercator::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Mercator projection
+ * (easting and northing) coordinates to geodetic (latitude and longitude)
+ * coordinates, according to the current ellipsoid and Mercator projection
+ * coordinates.  If any errors occur, an exception is thrown with a description 
+ * of the error.
+ *
+ *    easting           : Easting (X) in meters                  (input)
+ *    northing          : Northing (Y) in meters                 (input)
+ *    longitude         : Longitude (lambda) in radians          (output)
+ *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void Mercator::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void Mercator::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* Mercator::fromGeodetic(
+   double longitude, double latitude, double& easting, double& northing ) const
+{
+/*
+ * The function fromGeodetic converts one point to easting and northing,
+ * returning the error message, or 0 if the point was converted.
  */
 
   double ctanz2;        /* Cotangent of z/2 - z - Isometric colatitude     */
@@ -468,16 +552,13 @@ MSP::CCS::MapProjectionCoordinates* Mercator::convertFromGeodetic( MSP::CCS::Geo
   double tan_temp;
   double pow_temp;
 
-  double longitude = geodeticCoordinates->longitude();
-  double latitude  = geodeticCoordinates->latitude();
-
   if ((latitude < -MAX_LAT) || (latitude > MAX_LAT))
   { /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   { /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude );
+    return ErrorMessages::longitude;
   }
 
   if (longitude > PI)
@@ -487,58 +568,48 @@ MSP::CCS::MapProjectionCoordinates* Mercator::convertFromGeodetic( MSP::CCS::Geo
   pow_temp = pow( ((1.e0 - e_x_sinlat) / (1.e0 + e_x_sinlat)),
                   (Merc_e / 2.e0) );
   ctanz2 = tan_temp * pow_temp;
-  double northing = Merc_Scale_Factor * semiMajorAxis * log(ctanz2) + Merc_False_Northing;
+  northing = Merc_Scale_Factor * semiMajorAxis * log(ctanz2) + Merc_False_Northing;
   Delta_Long = longitude - Merc_Cent_Mer;
   if (Delta_Long > PI)
     Delta_Long -= TWO_PI;
   if (Delta_Long < -PI)
     Delta_Long += TWO_PI;
-  double easting = Merc_Scale_Factor * semiMajorAxis * Delta_Long
+  easting = Merc_Scale_Factor * semiMajorAxis * Delta_Long
              + Merc_False_Easting;
 
-  return new MapProjectionCoordinates( coordinateType, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* Mercator::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* Mercator::toGeodetic(
+   double easting, double northing, double& longitude, double& latitude ) const
 {
 /*
- * The function convertToGeodetic converts Mercator projection
- * (easting and northing) coordinates to geodetic (latitude and longitude)
- * coordinates, according to the current ellipsoid and Mercator projection
- * coordinates.  If any errors occur, an exception is thrown with a description 
- * of the error.
- *
- *    easting           : Easting (X) in meters                  (input)
- *    northing          : Northing (Y) in meters                 (input)
- *    longitude         : Longitude (lambda) in radians          (output)
- *    latitude          : Latitude (phi) in radians              (output)
+ * The function toGeodetic converts one point to longitude and latitude,
+ * returning the error message, or 0 if the point was converted.
  */
 
   double dx;     /* Delta easting - Difference in easting (easting-FE)      */
   double dy;     /* Delta northing - Difference in northing (northing-FN)   */
   double xphi;   /* Isometric latitude                                      */
 
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
   if ((easting < (Merc_False_Easting - Merc_Delta_Easting))
       || (easting > (Merc_False_Easting + Merc_Delta_Easting)))
   { /* Easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Merc_False_Northing - Merc_Delta_Northing))
       || (northing > (Merc_False_Northing + Merc_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Merc_False_Northing;
   dx = easting - Merc_False_Easting;
-  double longitude = Merc_Cent_Mer + dx / (Merc_Scale_Factor * semiMajorAxis);
+  longitude = Merc_Cent_Mer + dx / (Merc_Scale_Factor * semiMajorAxis);
   xphi = PI_OVER_2 
          - 2.e0 * atan(1.e0 / exp(dy / (Merc_Scale_Factor * semiMajorAxis)));
-  double latitude = xphi + Merc_ab * sin(2.e0 * xphi) + Merc_bb * sin(4.e0 * xphi)
+  latitude = xphi + Merc_ab * sin(2.e0 * xphi) + Merc_bb * sin(4.e0 * xphi)
               + Merc_cb * sin(6.e0 * xphi) + Merc_db * sin(8.e0 * xphi);
 
   if (longitude > PI)
@@ -546,9 +617,8 @@ MSP::CCS::GeodeticCoordinates* Mercator::convertToGeodetic( MSP::CCS::MapProject
   if (longitude < -PI)
     longitude += TWO_PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -75,6 +75,7 @@
  *    ----              -----------
  *    10-02-97          Original Code
  *    03-06-07          Original C++ Code
+ *    10-19-26          Added batch conversions
  *
  */
 
@@ -227,6 +228,34 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
     private:
     
       CoordinateType::Enum coordinateType;
@@ -253,6 +282,13 @@ namespace MSP
       double Merc_Delta_Easting;
       double Merc_Delta_Northing;
 
+      const char* fromGeodetic(
+         double longitude, double latitude,
+         double& easting, double& northing ) const;
+
+      const char* toGeodetic(
+         double easting, double northing,
+         double& longitude, double& latitude ) const;
     };
   }
 }
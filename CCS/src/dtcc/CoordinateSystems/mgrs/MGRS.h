@@ -72,18 +72,23 @@
  *    Date              Description
  *    ----              -----------
  *    2-27-07          Original Code
+ *    10-19-26         Added batch conversions, with the points converted
+ *                     through UTM grouped by zone
+ *    10-19-26         Conversions are made by GridReference, shared with
+ *                     USNG
+ *    10-19-26         Added enumeration of the squares covering an area
  */
 
 
 #include "CoordinateSystem.h"
+#include "GridReferenceString.h"
+#include "GridReference.h"
 
 
 namespace MSP
 {
   namespace CCS
   {
-    class UPS;
-    class UTM;
     class EllipsoidParameters;
     class MGRSorUSNGCoordinates;
     class GeodeticCoordinates;
@@ -91,6 +96,7 @@ namespace MSP
     class UTMCoordinates;
 
     #define MGRS_LETTERS 3
+    #define MGRS_STRING_SIZE GRID_REFERENCE_STRING_SIZE  /* batch strings */
 
     /**********************************************************************/
     /*
@@ -237,144 +243,105 @@ namespace MSP
       MSP::CCS::UPSCoordinates* convertToUPS(
          MSP::CCS::MGRSorUSNGCoordinates* mgrsorUSNGCoordinates );
 
-    private:
-
-      UPS* ups;
-      UTM* utm;
-    
-      char MGRSEllipsoidCode[3];
-
 
       /*
-       * The function fromUTM calculates an MGRS coordinate string
-       * based on the zone, latitude, easting and northing.
-       *
-       *    zone       : Zone number             (input)
-       *    hemisphere : Hemisphere              (input)
-       *    longitude  : Longitude in radians    (input)
-       *    latitude   : Latitude in radians     (input)
-       *    easting    : Easting                 (input)
-       *    northing   : Northing                (input)
-       *    precision  : Precision               (input)
-       *    MGRSString : MGRS coordinate string  (output)
-       */
-
-      MSP::CCS::MGRSorUSNGCoordinates* fromUTM(
-         MSP::CCS::UTMCoordinates* utmCoordinates,
-         double longitude,
-         double latitude,
-         long precision );
-
-      /*
-       * The function toUTM converts an MGRS coordinate string
-       * to UTM projection (zone, hemisphere, easting and northing) coordinates
-       * according to the current ellipsoid parameters.  If any errors occur,
-       * an exception is thrown with a description of the error.
+       * The function convertFromGeodeticBatch converts count geodetic
+       * coordinates, held in contiguous arrays, to MGRS coordinate strings,
+       * according to the current ellipsoid parameters.  The points outside
+       * the polar regions are converted to UTM grouped by zone; the points
+       * in the extended zones over southern Norway and Svalbard are then
+       * converted again, together, in those zones.  The strings are
+       * written MGRS_STRING_SIZE characters apart, null terminated.
+       * Errors are reported through status as for CoordinateSystem's batch
+       * conversions.
        *
-       *    MGRSString : MGRS coordinate string           (input)
-       *    zone       : UTM zone                         (output)
-       *    hemisphere : North or South hemisphere        (output)
-       *    easting    : Easting (X) in meters            (output)
-       *    northing   : Northing (Y) in meters           (output)
+       *    count       : Number of points                          (input)
+       *    longitudes  : Longitudes in radians                     (input)
+       *    latitudes   : Latitudes in radians                      (input)
+       *    precision   : Precision level of MGRS strings           (input)
+       *    MGRSStrings : MGRS coordinate strings                  (output)
+       *    status      : Error message of each point, or 0        (output)
        */
 
-      MSP::CCS::UTMCoordinates* toUTM(
-         long zone,
-         long letters[MGRS_LETTERS],
-         double easting,
-         double northing,
-         long in_precision );
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         long          precision,
+         char*         MGRSStrings,
+         const char**  status );
 
 
       /*
-       * The function fromUPS converts UPS (hemisphere, easting, 
-       * and northing) coordinates to an MGRS coordinate string according to 
-       * the current ellipsoid parameters.
+       * The function convertToGeodeticBatch converts count MGRS coordinate
+       * strings, held MGRS_STRING_SIZE characters apart, to geodetic
+       * coordinates according to the current ellipsoid parameters.  The
+       * points in UTM zones are converted grouped by zone.  Errors are
+       * reported through status as for convertFromGeodeticBatch; warnings
+       * are not reported.
        *
-       *    hemisphere    : Hemisphere either 'N' or 'S'     (input)
-       *    easting       : Easting/X in meters              (input)
-       *    northing      : Northing/Y in meters             (input)
-       *    precision     : Precision level of MGRS string   (input)
-       *    MGRSString    : MGRS coordinate string           (output)
+       *    count       : Number of points                          (input)
+       *    MGRSStrings : MGRS coordinate strings                   (input)
+       *    longitudes  : Longitudes in radians                    (output)
+       *    latitudes   : Latitudes in radians                     (output)
+       *    status      : Error message of each point, or 0        (output)
        */
 
-      MSP::CCS::MGRSorUSNGCoordinates* fromUPS(
-         MSP::CCS::UPSCoordinates* upsCoordinates,
-         long precision );
+      void convertToGeodeticBatch(
+         long          count,
+         const char*   MGRSStrings,
+         double*       longitudes,
+         double*       latitudes,
+         const char**  status );
 
-      /*
-       * The function toUPS converts an MGRS coordinate string
-       * to UPS (hemisphere, easting, and northing) coordinates, according
-       * to the current ellipsoid parameters. If any errors occur, an
-       * exception is thrown with a description of the error.
-       *
-       *    MGRSString    : MGRS coordinate string           (input)
-       *    hemisphere    : Hemisphere either 'N' or 'S'     (output)
-       *    easting       : Easting/X in meters              (output)
-       *    northing      : Northing/Y in meters             (output)
-       */
-
-      MSP::CCS::UPSCoordinates* toUPS(
-         long letters[MGRS_LETTERS],
-         double easting, double northing );
 
       /*
-       * The function getGridValues sets the letter range used for 
-       * the 2nd letter in the MGRS coordinate string, based on the set 
-       * number of the utm zone. It also sets the pattern offset using a
-       * value of A for the second letter of the grid square, based on 
-       * the grid pattern and set number of the utm zone.
+       * The function enumerateSquares returns the number of MGRS squares
+       * of a precision (100,000 meters at precision 0 to 1 meter at 5)
+       * that cover the part of an area between 80 degrees S and 84
+       * degrees N, the squares convertFromGeodetic gives for its points,
+       * and writes the first maxStrings of their strings MGRS_STRING_SIZE
+       * characters apart.  The squares are written by latitude band, then
+       * by zone from 180 degrees W, with the extended zones over southern
+       * Norway and Svalbard, then row by row from the south west.  The
+       * area runs east from its west edge to its east edge, across 180
+       * degrees when the east edge is west of the west edge.  The time
+       * taken is proportional to the number of squares.  If any errors
+       * occur, an exception is thrown with a description of the error.
        *
-       *    zone            : Zone number             (input)
-       *    ltr2_low_value  : 2nd letter low number   (output)
-       *    ltr2_high_value : 2nd letter high number  (output)
-       *    pattern_offset  : Pattern offset          (output)
-       */
-
-      void getGridValues(
-         long zone,
-         long* ltr2_low_value,
-         long* ltr2_high_value,
-         double* pattern_offset );
-
-    
-      /*
-       * The function getLatitudeBandMinNorthing receives a latitude band 
-       * letter and uses the Latitude_Band_Table to determine the 
-       * minimum northing and northing offset for that latitude band letter.
+       * Only the UTM part of the area is covered: the UPS squares of the
+       * polar caps, north of 84 degrees N and south of 80 degrees S, are
+       * neither counted nor written, and an area within a cap has no
+       * squares.  The area is a longitude and latitude box; callers
+       * covering a polygon enumerate its bounding box and keep the squares
+       * that meet the polygon.
        *
-       *   letter          : Latitude band letter               (input)
-       *   min_northing    : Minimum northing for that letter	(output)
-       *   northing_offset : Latitude band northing offset  	(output)
+       *    westLongitude : West edge in radians                  (input)
+       *    southLatitude : South edge in radians                 (input)
+       *    eastLongitude : East edge in radians                  (input)
+       *    northLatitude : North edge in radians                 (input)
+       *    precision     : Precision level of MGRS strings       (input)
+       *    MGRSStrings   : MGRS coordinate strings              (output)
+       *    maxStrings    : Number of strings that fit           (input)
        */
 
-      void getLatitudeBandMinNorthing(
-         long letter, double* min_northing, double* northing_offset );
-
+      long enumerateSquares(
+         double westLongitude,
+         double southLatitude,
+         double eastLongitude,
+         double northLatitude,
+         long   precision,
+         char*  MGRSStrings,
+         long   maxStrings );
 
-      /*
-       * The function inLatitudeRange receives a latitude band letter
-       * and uses the Latitude_Band_Table to determine if the latitude
-       * falls within the band boundaries for that latitude band letter.  
-       *
-       *   letter   : Latitude band letter                        (input)
-       *   latitude : Latitude to test                            (input)
-       *   border   : Border added to band in radians             (input)
-       */
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
 
-      bool inLatitudeRange( long letter, double latitude, double border );
-   
+    private:
 
-      /*
-       * The function getLatitudeLetter receives a latitude value
-       * and uses the Latitude_Band_Table to determine the latitude band 
-       * letter for that latitude.
-       *
-       *   latitude   : Latitude              (input)
-       *   letter     : Latitude band letter  (output)
-       */
+      GridReference< MGRSGrid >* grid;
 
-      void getLatitudeLetter( double latitude, int* letter );
+      char MGRSEllipsoidCode[3];
     };
   }
 }
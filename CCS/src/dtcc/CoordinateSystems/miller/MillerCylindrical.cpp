@@ -71,6 +71,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions no longer create coordinate
+ *                      objects for each point
  *
  */
 
@@ -270,18 +272,100 @@ MSP::CCS::MapProjectionCoordinates* MillerCylindrical::convertFromGeodetic( MSP:
  *    northing          : Northing (Y) in meters              (output)
  */
 
+  double easting, northing;
+
+  const char* errorMessage = fromGeodetic(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( CoordinateType::millerCylindrical, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* MillerCylindrical::convertToGeodetic(
+   MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Miller Cylindrical projection
+ * (easting and northing) coordinates to geodetic (latitude and longitude)
+ * coordinates, according to the current ellipsoid and Miller Cylindrical projection
+ * coordinates.  If any errors occur, an exception is thrown with a description 
+ * of the error.
+ *
+ *    easting           : Easting (X) in meters                  (input)
+ *    northing          : Northing (Y) in meters                 (input)
+ *    longitude         : Longitude (lambda) in radians          (output)
+ *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void MillerCylindrical::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void MillerCylindrical::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* MillerCylindrical::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double &easting,
+   double &northing )
+{
   double dlam;     /* Longitude - Central Meridan */
-  double longitude = geodeticCoordinates->longitude();
-  double latitude = geodeticCoordinates->latitude();
   double slat = sin(0.8 * latitude);
 
   if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
   {  /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   {  /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
+    return ErrorMessages::longitude;
   }
 
   dlam = longitude - Mill_Origin_Long;
@@ -293,50 +377,37 @@ MSP::CCS::MapProjectionCoordinates* MillerCylindrical::convertFromGeodetic( MSP:
   {
     dlam += TWO_PI;
   }
-  double easting = Ra * dlam + Mill_False_Easting;
-  double northing = (Ra / 1.6) * log((1.0 + slat) /
+  easting = Ra * dlam + Mill_False_Easting;
+  northing = (Ra / 1.6) * log((1.0 + slat) /
                                (1.0 - slat)) + Mill_False_Northing;
 
-  return new MapProjectionCoordinates( CoordinateType::millerCylindrical, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* MillerCylindrical::convertToGeodetic(
-   MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* MillerCylindrical::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
 {
-/*
- * The function convertToGeodetic converts Miller Cylindrical projection
- * (easting and northing) coordinates to geodetic (latitude and longitude)
- * coordinates, according to the current ellipsoid and Miller Cylindrical projection
- * coordinates.  If any errors occur, an exception is thrown with a description 
- * of the error.
- *
- *    easting           : Easting (X) in meters                  (input)
- *    northing          : Northing (Y) in meters                 (input)
- *    longitude         : Longitude (lambda) in radians          (output)
- *    latitude          : Latitude (phi) in radians              (output)
- */
-
   double dx, dy;
 
-  double easting = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
   if ((easting < (Mill_False_Easting + Mill_Min_Easting))
       || (easting > (Mill_False_Easting + Mill_Max_Easting)))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Mill_False_Northing - Mill_Delta_Northing)) || 
       (northing > (Mill_False_Northing + Mill_Delta_Northing) ))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Mill_False_Northing;
   dx = easting  - Mill_False_Easting;
-  double latitude = atan(sinh(0.8 * dy / Ra)) / 0.8;
-  double longitude = Mill_Origin_Long + dx / Ra;
+  latitude = atan(sinh(0.8 * dy / Ra)) / 0.8;
+  longitude = Mill_Origin_Long + dx / Ra;
 
   if (latitude > PI_OVER_2)  /* force distorted values to 90, -90 degrees */
     latitude = PI_OVER_2;
@@ -353,9 +424,8 @@ MSP::CCS::GeodeticCoordinates* MillerCylindrical::convertToGeodetic(
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
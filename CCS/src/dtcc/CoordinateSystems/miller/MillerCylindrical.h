@@ -74,6 +74,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions no longer create coordinate
+ *                      objects for each point
  *
  */
 
@@ -175,6 +177,34 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
     private:
     
       /* Ellipsoid Parameters, default to WGS 84 */
@@ -191,6 +221,24 @@ namespace MSP
       double Mill_Max_Easting;
       double Mill_Min_Easting;
 
+      /*
+       * The functions fromGeodetic and toGeodetic convert one point as
+       * convertFromGeodetic and convertToGeodetic do, returning the error
+       * message, or 0 if the point was converted.
+       */
+
+      const char* fromGeodetic(
+         double  longitude,
+         double  latitude,
+         double &easting,
+         double &northing );
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &longitude,
+         double &latitude );
+
     };
   }
 }
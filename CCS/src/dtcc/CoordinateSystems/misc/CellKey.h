@@ -0,0 +1,54 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef CellKey_H
+#define CellKey_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Cell Key
+ *
+ * ABSTRACT
+ *
+ *    A cell key is a 64 bit integer naming a cell of the GARS or GEOREF
+ *    grid, so that points can be binned and counted without building
+ *    coordinate strings.  GARS and GEOREF convert between geodetic
+ *    coordinates, keys, cell bounds and strings, and document how their
+ *    keys are laid out.  The precision of the cell is part of its key,
+ *    in bits 56 and above; cellKeyFields clears it, so that the parent
+ *    cells of keys of different precisions can be compared.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code
+ *    10-19-26    Added cellKeyFields
+ */
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    typedef unsigned long long CellKey;
+
+    /* First bit of the precision of a cell key */
+    const int CELL_KEY_PRECISION_SHIFT = 56;
+
+    /*
+     * The function cellKeyFields returns a cell key with its precision
+     * cleared, leaving the fields that place the cell in the grid.
+     *
+     *    key : GARS or GEOREF cell key                  (input)
+     */
+
+    inline CellKey cellKeyFields( CellKey key )
+    {
+      return key & ( ( (CellKey)1 << CELL_KEY_PRECISION_SHIFT ) - 1 );
+    }
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -1,9 +1,73 @@
 // CLASSIFICATION: UNCLASSIFIED
 
+#include <string.h>
+#include <set>
+#include <string>
 #include "CoordinateSystem.h"
+#include "ErrorMessages.h"
+#include "CCSThreadMutex.h"
+#include "CCSThreadLock.h"
 
 
 using namespace MSP::CCS;
+using MSP::CCSThreadMutex;
+using MSP::CCSThreadLock;
+
+
+namespace
+{
+  const double PI = 3.14159265358979323e0;
+  const double TWO_PI = 2.0 * PI;
+  const long BATCH_BLOCK_SIZE = 256;     /* Points widened to double at once */
+
+  // The ErrorMessages strings, which errorStatus hands out as they are
+  const char** const ERROR_MESSAGES[] =
+  {
+    &ErrorMessages::geoidFileOpenError, &ErrorMessages::geoidFileParseError,
+    &ErrorMessages::ellipsoidFileOpenError,
+    &ErrorMessages::ellipsoidFileCloseError,
+    &ErrorMessages::ellipsoidFileParseError, &ErrorMessages::ellipse,
+    &ErrorMessages::invalidEllipsoidCode,
+    &ErrorMessages::datumFileOpenError, &ErrorMessages::datumFileCloseError,
+    &ErrorMessages::datumFileParseError, &ErrorMessages::datumDomain,
+    &ErrorMessages::datumRotation, &ErrorMessages::datumSigma,
+    &ErrorMessages::datumType, &ErrorMessages::invalidDatumCode,
+    &ErrorMessages::notUserDefined, &ErrorMessages::ellipseInUse,
+    &ErrorMessages::semiMajorAxis, &ErrorMessages::ellipsoidFlattening,
+    &ErrorMessages::orientation, &ErrorMessages::originLatitude,
+    &ErrorMessages::originLongitude, &ErrorMessages::centralMeridian,
+    &ErrorMessages::scaleFactor, &ErrorMessages::zone,
+    &ErrorMessages::zoneOverride, &ErrorMessages::standardParallel1,
+    &ErrorMessages::standardParallel2, &ErrorMessages::standardParallel1_2,
+    &ErrorMessages::standardParallelHemisphere, &ErrorMessages::precision,
+    &ErrorMessages::bngEllipsoid, &ErrorMessages::nzmgEllipsoid,
+    &ErrorMessages::webmEllipsoid, &ErrorMessages::webmConversionTo,
+    &ErrorMessages::webmInvalidTargetCS, &ErrorMessages::webmZoom,
+    &ErrorMessages::webmTile, &ErrorMessages::latitude1,
+    &ErrorMessages::latitude2, &ErrorMessages::latitude1_2,
+    &ErrorMessages::longitude1, &ErrorMessages::longitude2,
+    &ErrorMessages::omercHemisphere, &ErrorMessages::hemisphere,
+    &ErrorMessages::radius,
+    &ErrorMessages::latitude, &ErrorMessages::longitude,
+    &ErrorMessages::easting, &ErrorMessages::northing,
+    &ErrorMessages::projection, &ErrorMessages::invalidArea,
+    &ErrorMessages::bngString, &ErrorMessages::garsString,
+    &ErrorMessages::georefString, &ErrorMessages::mgrsString,
+    &ErrorMessages::usngString,
+    &ErrorMessages::invalidIndex, &ErrorMessages::invalidName,
+    &ErrorMessages::invalidType, &ErrorMessages::collectionSize,
+    &ErrorMessages::batchConversion, &ErrorMessages::approximation,
+    &ErrorMessages::rasterWarp, &ErrorMessages::latitude_min,
+    &ErrorMessages::longitude_min
+  };
+  const long ERROR_MESSAGE_COUNT =
+     sizeof( ERROR_MESSAGES ) / sizeof( ERROR_MESSAGES[0] );
+
+  // Copies of other error messages handed out as batch statuses.  Set
+  // elements do not move, so their c_str() pointers stay valid.
+  std::set< std::string >* errorStatuses = 0;
+  CCSThreadMutex errorStatusMutex;
+}
 
 
 CoordinateSystem::CoordinateSystem() :
@@ -70,4 +134,204 @@ void CoordinateSystem::getEllipsoidParameters( double* _semiMajorAxis, double* _
 
 }
 
+
+void CoordinateSystem::convertFromGeodeticBatch(
+   long          count,
+   const double* ,
+   const double* ,
+   const double* ,
+   double*       ,
+   double*       ,
+   double*       ,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts count geodetic
+ * coordinates to coordinates of this coordinate system.  Coordinate
+ * systems without a batch conversion report every point as an error.
+ */
+
+  for( long i = 0; i < count; i++ )
+    status[i] = ErrorMessages::batchConversion;
+}
+
+
+void CoordinateSystem::convertToGeodeticBatch(
+   long          count,
+   const double* ,
+   const double* ,
+   const double* ,
+   double*       ,
+   double*       ,
+   double*       ,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts count coordinates of this
+ * coordinate system to geodetic coordinates.  Coordinate systems without
+ * a batch conversion report every point as an error.
+ */
+
+  for( long i = 0; i < count; i++ )
+    status[i] = ErrorMessages::batchConversion;
+}
+
+
+void CoordinateSystem::convertFromGeodeticFloatBatch(
+   long          count,
+   double        originLongitude,
+   double        originLatitude,
+   const float*  longitudes,
+   const float*  latitudes,
+   double        originX,
+   double        originY,
+   float*        x,
+   float*        y,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticFloatBatch converts count geodetic
+ * offsets from a tile origin, in single precision, to map projection
+ * offsets from a second origin.  The points are widened to double a block
+ * at a time on the stack and converted by convertFromGeodeticBatch, so
+ * only the block is held in double precision.
+ *
+ *    count           : Number of points                          (input)
+ *    originLongitude : Longitude of the tile origin in radians   (input)
+ *    originLatitude  : Latitude of the tile origin in radians    (input)
+ *    longitudes      : Longitude offsets in radians              (input)
+ *    latitudes       : Latitude offsets in radians               (input)
+ *    originX         : Easting of the tile origin in meters      (input)
+ *    originY         : Northing of the tile origin in meters     (input)
+ *    x               : Easting offsets in meters                (output)
+ *    y               : Northing offsets in meters               (output)
+ *    status          : Error message of each point, or 0        (output)
+ */
+
+  double blockLongitudes[BATCH_BLOCK_SIZE];
+  double blockLatitudes[BATCH_BLOCK_SIZE];
+  double blockX[BATCH_BLOCK_SIZE];
+  double blockY[BATCH_BLOCK_SIZE];
+  long j;
+
+  for( long start = 0; start < count; start += BATCH_BLOCK_SIZE )
+  {
+    long size = count - start;
+    if( size > BATCH_BLOCK_SIZE )
+      size = BATCH_BLOCK_SIZE;
+
+    for( j = 0; j < size; j++ )
+    {
+      blockLongitudes[j] = originLongitude + longitudes[start + j];
+      blockLatitudes[j] = originLatitude + latitudes[start + j];
+    }
+
+    convertFromGeodeticBatch( size, blockLongitudes, blockLatitudes, 0,
+       blockX, blockY, 0, status + start );
+
+    for( j = 0; j < size; j++ )
+    {
+      if( !status[start + j] )
+      {
+        x[start + j] = (float)( blockX[j] - originX );
+        y[start + j] = (float)( blockY[j] - originY );
+      }
+    }
+  }
+}
+
+
+void CoordinateSystem::convertToGeodeticFloatBatch(
+   long          count,
+   double        originX,
+   double        originY,
+   const float*  x,
+   const float*  y,
+   double        originLongitude,
+   double        originLatitude,
+   float*        longitudes,
+   float*        latitudes,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticFloatBatch converts count map projection
+ * offsets from a tile origin, in single precision, to geodetic offsets
+ * from a second origin, a block at a time through convertToGeodeticBatch.
+ * Longitude offsets are taken across the 180 degree meridian when that is
+ * shorter.
+ *
+ *    count           : Number of points                          (input)
+ *    originX         : Easting of the tile origin in meters      (input)
+ *    originY         : Northing of the tile origin in meters     (input)
+ *    x               : Easting offsets in meters                 (input)
+ *    y               : Northing offsets in meters                (input)
+ *    originLongitude : Longitude of the output origin in radians (input)
+ *    originLatitude  : Latitude of the output origin in radians  (input)
+ *    longitudes      : Longitude offsets in radians             (output)
+ *    latitudes       : Latitude offsets in radians              (output)
+ *    status          : Error message of each point, or 0        (output)
+ */
+
+  double blockX[BATCH_BLOCK_SIZE];
+  double blockY[BATCH_BLOCK_SIZE];
+  double blockLongitudes[BATCH_BLOCK_SIZE];
+  double blockLatitudes[BATCH_BLOCK_SIZE];
+  long j;
+
+  for( long start = 0; start < count; start += BATCH_BLOCK_SIZE )
+  {
+    long size = count - start;
+    if( size > BATCH_BLOCK_SIZE )
+      size = BATCH_BLOCK_SIZE;
+
+    for( j = 0; j < size; j++ )
+    {
+      blockX[j] = originX + x[start + j];
+      blockY[j] = originY + y[start + j];
+    }
+
+    convertToGeodeticBatch( size, blockX, blockY, 0,
+       blockLongitudes, blockLatitudes, 0, status + start );
+
+    for( j = 0; j < size; j++ )
+    {
+      if( !status[start + j] )
+      {
+        double dlam = blockLongitudes[j] - originLongitude;
+        if( dlam > PI )
+          dlam -= TWO_PI;
+        else if( dlam < -PI )
+          dlam += TWO_PI;
+        longitudes[start + j] = (float)dlam;
+        latitudes[start + j] = (float)( blockLatitudes[j] - originLatitude );
+      }
+    }
+  }
+}
+
+
+const char* CoordinateSystem::errorStatus( const char* message )
+{
+/*
+ * The function errorStatus returns an error message that stays valid for
+ * the life of the program, for use as a batch status: the ErrorMessages
+ * string equal to message, or else a copy of message.
+ *
+ *    message : Error message, e.g. from an exception             (input)
+ */
+
+  for( long i = 0; i < ERROR_MESSAGE_COUNT; i++ )
+  {
+    if( strcmp( *ERROR_MESSAGES[i], message ) == 0 )
+      return *ERROR_MESSAGES[i];
+  }
+
+  CCSThreadLock lock( &errorStatusMutex );
+
+  if( !errorStatuses )
+    errorStatuses = new std::set< std::string >();
+
+  return errorStatuses->insert( message ).first->c_str();
+}
+
 // CLASSIFICATION: UNCLASSIFIED
@@ -33,7 +33,7 @@ namespace MSP
       CoordinateSystem( double _semiMajorAxis, double _flattening );
 
 
-      ~CoordinateSystem();
+      virtual ~CoordinateSystem();
 
 
       /*
@@ -46,6 +46,171 @@ namespace MSP
 
       void getEllipsoidParameters( double* _semiMajorAxis, double* _flattening );
 
+
+      /*
+       * The function convertFromGeodeticBatch converts count geodetic
+       * coordinates, held in contiguous arrays, to coordinates of this
+       * coordinate system.  Map projections produce easting (x) and
+       * northing (y); geocentric and local cartesian produce x, y and z.
+       * Points that cannot be converted are not thrown as exceptions:
+       * status[i] is set to the error message, or to 0 when point i was
+       * converted.  Warnings are not reported.  Coordinate systems whose
+       * coordinates are not plain numbers (UTM, UPS and the grid reference
+       * strings) have batch conversions of their own coordinates instead,
+       * and set every status of these to ErrorMessages::batchConversion.
+       *
+       *    count      : Number of points                               (input)
+       *    longitudes : Longitudes in radians                          (input)
+       *    latitudes  : Latitudes in radians                           (input)
+       *    heights    : Ellipsoid heights in meters, or 0 for none     (input)
+       *    x          : Eastings or X coordinates in meters           (output)
+       *    y          : Northings or Y coordinates in meters          (output)
+       *    z          : Z coordinates in meters, or 0 if not wanted   (output)
+       *    status     : Error message of each point, or 0             (output)
+       */
+
+      virtual void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+
+      /*
+       * The function convertToGeodeticBatch converts count coordinates of
+       * this coordinate system, held in contiguous arrays, to geodetic
+       * coordinates.  Errors are reported through status as for
+       * convertFromGeodeticBatch.
+       *
+       *    count      : Number of points                               (input)
+       *    x          : Eastings or X coordinates in meters            (input)
+       *    y          : Northings or Y coordinates in meters           (input)
+       *    z          : Z coordinates in meters, or 0 for none         (input)
+       *    longitudes : Longitudes in radians                         (output)
+       *    latitudes  : Latitudes in radians                          (output)
+       *    heights    : Ellipsoid heights in meters, or 0 if not wanted (output)
+       *    status     : Error message of each point, or 0             (output)
+       */
+
+      virtual void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
+
+      /*
+       * The function convertFromGeodeticFloatBatch converts count geodetic
+       * coordinates to map projection coordinates like
+       * convertFromGeodeticBatch, for callers that hold points in single
+       * precision.  The points are offsets from a tile origin, so that
+       * floats keep their precision: longitude originLongitude +
+       * longitudes[i] and latitude originLatitude + latitudes[i] are
+       * converted in double precision, and x[i] and y[i] are set to the
+       * easting less originX and the northing less originY, rounded to
+       * float.  x[i] and y[i] are set only where status[i] is 0.  The
+       * points go through convertFromGeodeticBatch, so coordinate systems
+       * without a batch conversion of eastings and northings (UTM, UPS,
+       * BNG and the grid reference strings) set every status to
+       * ErrorMessages::batchConversion.  A UTM tile is converted with the
+       * Transverse Mercator projection of its zone instead.
+       *
+       * Rounding to float changes a value by at most 6.0e-8 of its
+       * magnitude, so the error is about 6.0e-8 times the extent of the
+       * tile: 6 millimeters for a tile of 100 kilometers, whose angular
+       * offsets are within 0.016 radians.  An error of d radians in the
+       * geodetic offsets moves the point by up to d times the semi-major
+       * axis times the point scale of the projection: about 1 for
+       * Transverse Mercator within a UTM zone width of its central
+       * meridian and for the conic projections near their standard
+       * parallels, 1 / cos(latitude) for Mercator and Web Mercator, and
+       * growing toward the edges of the pseudocylindrical projections.
+       * Tiles should be kept small where the scale is large, such as near
+       * the poles on Mercator, and should not straddle the 180 degree
+       * meridian of projections whose eastings wrap there, whose tiles
+       * would span the width of the map.
+       *
+       *    count           : Number of points                          (input)
+       *    originLongitude : Longitude of the tile origin in radians   (input)
+       *    originLatitude  : Latitude of the tile origin in radians    (input)
+       *    longitudes      : Longitude offsets in radians              (input)
+       *    latitudes       : Latitude offsets in radians               (input)
+       *    originX         : Easting of the tile origin in meters      (input)
+       *    originY         : Northing of the tile origin in meters     (input)
+       *    x               : Easting offsets in meters                (output)
+       *    y               : Northing offsets in meters               (output)
+       *    status          : Error message of each point, or 0        (output)
+       */
+
+      void convertFromGeodeticFloatBatch(
+         long          count,
+         double        originLongitude,
+         double        originLatitude,
+         const float*  longitudes,
+         const float*  latitudes,
+         double        originX,
+         double        originY,
+         float*        x,
+         float*        y,
+         const char**  status );
+
+
+      /*
+       * The function convertToGeodeticFloatBatch converts count map
+       * projection coordinates, held as single precision offsets from a
+       * tile origin, to geodetic offsets from a second origin, in the
+       * manner of convertFromGeodeticFloatBatch.  Longitude offsets are
+       * taken across the 180 degree meridian when that is shorter.  The
+       * error of the geodetic offsets is that of the map projection
+       * offsets divided by the point scale and the semi-major axis, plus
+       * their own rounding to float.
+       *
+       *    count           : Number of points                          (input)
+       *    originX         : Easting of the tile origin in meters      (input)
+       *    originY         : Northing of the tile origin in meters     (input)
+       *    x               : Easting offsets in meters                 (input)
+       *    y               : Northing offsets in meters                (input)
+       *    originLongitude : Longitude of the output origin in radians (input)
+       *    originLatitude  : Latitude of the output origin in radians  (input)
+       *    longitudes      : Longitude offsets in radians             (output)
+       *    latitudes       : Latitude offsets in radians              (output)
+       *    status          : Error message of each point, or 0        (output)
+       */
+
+      void convertToGeodeticFloatBatch(
+         long          count,
+         double        originX,
+         double        originY,
+         const float*  x,
+         const float*  y,
+         double        originLongitude,
+         double        originLatitude,
+         float*        longitudes,
+         float*        latitudes,
+         const char**  status );
+
+
+      /*
+       * The function errorStatus returns an error message that stays
+       * valid for the life of the program, for use as a batch status.  A
+       * message equal to an ErrorMessages string is returned as that
+       * string, without locking, so statuses may be compared with
+       * ErrorMessages pointers.  Other messages are copied once, under a
+       * lock, and equal messages share the copy.
+       *
+       *    message : Error message, e.g. from an exception             (input)
+       */
+
+      static const char* errorStatus( const char* message );
+
     protected:
 
       double semiMajorAxis;
@@ -0,0 +1,192 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef CoordinateSystemBatch_H
+#define CoordinateSystemBatch_H
+
+/*
+ * Generic implementations of CoordinateSystem::convertFromGeodeticBatch and
+ * convertToGeodeticBatch that convert one point at a time through a
+ * coordinate system's single point convertFromGeodetic and
+ * convertToGeodetic.  Coordinate systems without a native batch kernel
+ * derive from PointBatchCoordinateSystem, which provides both, and
+ * override the direction they have a kernel for.
+ */
+
+#include "CoordinateSystem.h"
+#include "CartesianCoordinates.h"
+#include "GeodeticCoordinates.h"
+#include "MapProjectionCoordinates.h"
+#include "CoordinateType.h"
+#include "CoordinateConversionException.h"
+
+namespace MSP
+{
+  namespace CCS
+  {
+    inline void setBatchPoint(
+       MapProjectionCoordinates& coordinates, double x, double y, double )
+    {
+      coordinates.set( x, y );
+    }
+
+
+    inline void setBatchPoint(
+       CartesianCoordinates& coordinates, double x, double y, double z )
+    {
+      coordinates.set( x, y, z );
+    }
+
+
+    inline void storeBatchPoint(
+       MapProjectionCoordinates* coordinates,
+       double* x, double* y, double* z, long i )
+    {
+      x[i] = coordinates->easting();
+      y[i] = coordinates->northing();
+      if( z )
+        z[i] = 0.0;
+
+      delete coordinates;
+    }
+
+
+    inline void storeBatchPoint(
+       CartesianCoordinates* coordinates,
+       double* x, double* y, double* z, long i )
+    {
+      x[i] = coordinates->x();
+      y[i] = coordinates->y();
+      if( z )
+        z[i] = coordinates->z();
+
+      delete coordinates;
+    }
+
+
+    template< class System >
+    void convertFromGeodeticPoints(
+       System*       system,
+       long          count,
+       const double* longitudes,
+       const double* latitudes,
+       const double* heights,
+       double*       x,
+       double*       y,
+       double*       z,
+       const char**  status )
+    {
+      GeodeticCoordinates geodeticCoordinates( CoordinateType::geodetic );
+
+      for( long i = 0; i < count; i++ )
+      {
+        geodeticCoordinates.set(
+           longitudes[i], latitudes[i], heights ? heights[i] : 0.0 );
+
+        try
+        {
+          // Overloads on the coordinate class the system returns
+          storeBatchPoint( system->convertFromGeodetic( &geodeticCoordinates ),
+             x, y, z, i );
+          status[i] = 0;
+        }
+        catch( CoordinateConversionException& e )
+        {
+          status[i] = CoordinateSystem::errorStatus( e.getMessage() );
+        }
+      }
+    }
+
+
+    template< class System, class Coordinates >
+    void convertToGeodeticPoints(
+       System*       system,
+       long          count,
+       const double* x,
+       const double* y,
+       const double* z,
+       double*       longitudes,
+       double*       latitudes,
+       double*       heights,
+       const char**  status )
+    {
+      Coordinates coordinates;
+
+      for( long i = 0; i < count; i++ )
+      {
+        setBatchPoint( coordinates, x[i], y[i], z ? z[i] : 0.0 );
+
+        try
+        {
+          GeodeticCoordinates* geodeticCoordinates =
+             system->convertToGeodetic( &coordinates );
+
+          longitudes[i] = geodeticCoordinates->longitude();
+          latitudes[i]  = geodeticCoordinates->latitude();
+          if( heights )
+            heights[i] = geodeticCoordinates->height();
+
+          delete geodeticCoordinates;
+          status[i] = 0;
+        }
+        catch( CoordinateConversionException& e )
+        {
+          status[i] = CoordinateSystem::errorStatus( e.getMessage() );
+        }
+      }
+    }
+
+
+    template< class System, class Coordinates >
+    class PointBatchCoordinateSystem : public CoordinateSystem
+    {
+    public:
+
+      PointBatchCoordinateSystem() :
+        CoordinateSystem()
+      {
+      }
+
+
+      PointBatchCoordinateSystem( double _semiMajorAxis, double _flattening ) :
+        CoordinateSystem( _semiMajorAxis, _flattening )
+      {
+      }
+
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status )
+      {
+        convertFromGeodeticPoints( static_cast< System* >( this ),
+           count, longitudes, latitudes, heights, x, y, z, status );
+      }
+
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status )
+      {
+        convertToGeodeticPoints< System, Coordinates >(
+           static_cast< System* >( this ),
+           count, x, y, z, longitudes, latitudes, heights, status );
+      }
+    };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,84 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Ellipsoid Constants
+ *
+ * ABSTRACT
+ *
+ *    This component computes the constants projections derive from an
+ *    ellipsoid.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code
+ *    10-19-26    Computed by each projection instead of cached
+ */
+
+#include <math.h>
+#include "EllipsoidConstants.h"
+
+
+using namespace MSP::CCS;
+
+
+namespace
+{
+  /* e1 of the footpoint latitude series, (1 - b/a) / (1 + b/a) */
+  double footpointE1( double One_MINUS_es2 )
+  {
+    double x = sqrt( One_MINUS_es2 );
+    return (1.0 - x) / (1.0 + x);
+  }
+
+  double footpointA0( double e1 )
+  {
+    double e3 = e1 * e1 * e1;
+    return 3.0 * e1 / 2.0 - 27.0 * e3 / 32.0;
+  }
+
+  double footpointA1( double e1 )
+  {
+    double e2 = e1 * e1;
+    double e4 = e2 * e1 * e1;
+    return 21.0 * e2 / 16.0 - 55.0 * e4 / 32.0;
+  }
+
+  double footpointA2( double e1 )
+  {
+    double e3 = e1 * e1 * e1;
+    return 151.0 * e3 / 96.0;
+  }
+
+  double footpointA3( double e1 )
+  {
+    double e4 = e1 * e1 * e1 * e1;
+    return 1097.0 * e4 / 512.0;
+  }
+}
+
+
+EllipsoidConstants::EllipsoidConstants(
+   double ellipsoidSemiMajorAxis,
+   double ellipsoidFlattening ) :
+  semiMajorAxis( ellipsoidSemiMajorAxis ),
+  flattening( ellipsoidFlattening ),
+  es2( 2 * flattening - flattening * flattening ),
+  es4( es2 * es2 ),
+  es6( es4 * es2 ),
+  es( sqrt( es2 ) ),
+  One_MINUS_es2( 1.0 - es2 ),
+  c0( 1.0 - es2 / 4.0 - 3.0 * es4 / 64.0 - 5.0 * es6 / 256.0 ),
+  c1( 3.0 * es2 / 8.0 + 3.0 * es4 / 32.0 + 45.0 * es6 / 1024.0 ),
+  c2( 15.0 * es4 / 256.0 + 45.0 * es6 / 1024.0 ),
+  c3( 35.0 * es6 / 3072.0 ),
+  a0( footpointA0( footpointE1( One_MINUS_es2 ) ) ),
+  a1( footpointA1( footpointE1( One_MINUS_es2 ) ) ),
+  a2( footpointA2( footpointE1( One_MINUS_es2 ) ) ),
+  a3( footpointA3( footpointE1( One_MINUS_es2 ) ) )
+{
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
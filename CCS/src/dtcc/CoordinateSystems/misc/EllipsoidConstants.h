@@ -0,0 +1,91 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef EllipsoidConstants_H
+#define EllipsoidConstants_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Ellipsoid Constants
+ *
+ * ABSTRACT
+ *
+ *    This component holds the constants that projections derive from the
+ *    semi-major axis and flattening of an ellipsoid: the powers of the
+ *    eccentricity squared and the coefficients of the meridional arc
+ *    series and of its inverse, the footpoint latitude series.
+ *
+ *    The constants are computed with the expressions the projections
+ *    used, in one place, so conversions give the same results as before.
+ *    They are not cached: they take a few dozen operations, no more than
+ *    looking them up under a lock would.
+ *
+ * ERROR HANDLING
+ *
+ *    The ellipsoid parameters are not checked; projections check them
+ *    before computing their constants.  Nothing is thrown.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code
+ *    10-19-26    Computed by each projection instead of cached
+ */
+
+#include "DtccApi.h"
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class MSP_DTCC_API EllipsoidConstants
+    {
+    public:
+
+      /*
+       * The constructor computes the constants of the ellipsoid with the
+       * given semi-major axis and flattening.
+       *
+       *    semiMajorAxis : Semi-major axis of ellipsoid, in meters (input)
+       *    flattening    : Flattening of ellipsoid                 (input)
+       */
+
+      EllipsoidConstants( double semiMajorAxis, double flattening );
+
+      const double semiMajorAxis;
+      const double flattening;
+
+      /* Eccentricity squared and its powers, and eccentricity */
+      const double es2;
+      const double es4;
+      const double es6;
+      const double es;
+      const double One_MINUS_es2;
+
+      /* Meridional arc series: M = a * (c0 * lat - c1 * sin(2 * lat)
+         + c2 * sin(4 * lat) - c3 * sin(6 * lat)) */
+      const double c0;
+      const double c1;
+      const double c2;
+      const double c3;
+
+      /* Footpoint latitude series: lat = mu + a0 * sin(2 * mu)
+         + a1 * sin(4 * mu) + a2 * sin(6 * mu) + a3 * sin(8 * mu) */
+      const double a0;
+      const double a1;
+      const double a2;
+      const double a3;
+
+    private:
+
+      EllipsoidConstants( const EllipsoidConstants &c );
+
+      EllipsoidConstants& operator=( const EllipsoidConstants &c );
+    };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,2254 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Grid Reference
+ *
+ * ABSTRACT
+ *
+ *    This component converts between geodetic, UTM and UPS coordinates and
+ *    the coordinate strings of MGRS and USNG, with the rules of either
+ *    given by the template parameter.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code, from the implementations of MGRS and USNG
+ *    10-19-26    Added enumeration of the squares covering an area
+ */
+
+
+/***************************************************************************/
+/*
+ *                               INCLUDES
+ */
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include "GridReference.h"
+#include "GridReferenceString.h"
+#include "CoordinateSystem.h"
+#include "UPS.h"
+#include "UTM.h"
+#include "MGRSorUSNGCoordinates.h"
+#include "GeodeticCoordinates.h"
+#include "UPSCoordinates.h"
+#include "UTMCoordinates.h"
+#include "CoordinateConversionException.h"
+#include "ErrorMessages.h"
+#include "WarningMessages.h"
+#include "CCSThreadMutex.h"
+#include "CCSThreadLock.h"
+
+/*
+ *      math.h      - Standard C math library
+ *      string.h    - Standard C string handling library
+ *      vector      - batch work arrays and the shared projections
+ *      GridReference.h - function prototype error checking
+ *      GridReferenceString.h - builds and breaks down coordinate strings
+ *      CoordinateSystem.h - batch error messages
+ *      UPS.h       - Universal Polar Stereographic (UPS) projection
+ *      UTM.h       - Universal Transverse Mercator (UTM) projection
+ *      MGRSorUSNGCoordinates.h   - defines mgrs coordinates
+ *      GeodeticCoordinates.h   - defines geodetic coordinates
+ *      UPSCoordinates.h   - defines ups coordinates
+ *      UTMCoordinates.h   - defines utm coordinates
+ *      CoordinateConversionException.h - Exception handler
+ *      ErrorMessages.h  - Contains exception messages
+ *      WarningMessages.h  - Contains warning messages
+ *      CCSThreadMutex.h, CCSThreadLock.h - guard the shared projections
+ */
+
+using namespace MSP::CCS;
+using MSP::CCSThreadMutex;
+using MSP::CCSThreadLock;
+
+
+/************************************************************************/
+/*                               DEFINES
+ *
+ */
+
+#define EPSILON 1.75e-7   /* approx 1.0e-5 degrees (~1 meter) in radians */
+
+#define LETTER_A  0    /* ARRAY INDEX FOR LETTER A */
+#define LETTER_B  1    /* ARRAY INDEX FOR LETTER B */
+#define LETTER_C  2    /* ARRAY INDEX FOR LETTER C */
+#define LETTER_D  3    /* ARRAY INDEX FOR LETTER D */
+#define LETTER_E  4    /* ARRAY INDEX FOR LETTER E */
+#define LETTER_F  5    /* ARRAY INDEX FOR LETTER F */
+#define LETTER_G  6    /* ARRAY INDEX FOR LETTER G */
+#define LETTER_H  7    /* ARRAY INDEX FOR LETTER H */
+#define LETTER_I  8    /* ARRAY INDEX FOR LETTER I */
+#define LETTER_J  9    /* ARRAY INDEX FOR LETTER J */
+#define LETTER_K  10   /* ARRAY INDEX FOR LETTER K */
+#define LETTER_L  11   /* ARRAY INDEX FOR LETTER L */
+#define LETTER_M  12   /* ARRAY INDEX FOR LETTER M */
+#define LETTER_N  13   /* ARRAY INDEX FOR LETTER N */
+#define LETTER_O  14   /* ARRAY INDEX FOR LETTER O */
+#define LETTER_P  15   /* ARRAY INDEX FOR LETTER P */
+#define LETTER_Q  16   /* ARRAY INDEX FOR LETTER Q */
+#define LETTER_R  17   /* ARRAY INDEX FOR LETTER R */
+#define LETTER_S  18   /* ARRAY INDEX FOR LETTER S */
+#define LETTER_T  19   /* ARRAY INDEX FOR LETTER T */
+#define LETTER_U  20   /* ARRAY INDEX FOR LETTER U */
+#define LETTER_V  21   /* ARRAY INDEX FOR LETTER V */
+#define LETTER_W  22   /* ARRAY INDEX FOR LETTER W */
+#define LETTER_X  23   /* ARRAY INDEX FOR LETTER X */
+#define LETTER_Y  24   /* ARRAY INDEX FOR LETTER Y */
+#define LETTER_Z  25   /* ARRAY INDEX FOR LETTER Z */
+
+#define ONEHT     100000.e0     /* ONE HUNDRED THOUSAND */
+#define TWOMIL    2000000.e0    /* TWO MILLION          */
+#define PI     3.14159265358979323e0
+#define PI_OVER_2    (PI / 2.0e0)
+#define PI_OVER_180  (PI / 180.0e0)
+
+#define MIN_EASTING  100000.0
+#define MAX_EASTING  900000.0
+#define MIN_NORTHING 0.0
+#define MAX_NORTHING 10000000.0
+#define MAX_PRECISION  5   /* Maximum precision of easting & northing */
+#define MIN_NON_POLAR_LAT  (-80.0 * ( PI / 180.0 )) /* -80 deg in rad */
+#define MAX_NON_POLAR_LAT  ( 84.0 * ( PI / 180.0 )) /*  84 deg in rad */
+
+#define MIN_EAST_NORTH  0.0
+#define MAX_EAST_NORTH  3999999.0
+
+#define _6     (6.0  * (PI / 180.0))
+#define _8     (8.0  * (PI / 180.0))
+#define _72    (72.0 * (PI / 180.0))
+#define _80    (80.0 * (PI / 180.0))
+#define _80_5  (80.5 * (PI / 180.0))
+#define _84_5  (84.5 * (PI / 180.0))
+
+#define _500000  500000.0
+
+/*
+ *    CLARKE_1866 : Ellipsoid code for CLARKE_1866
+ *    CLARKE_1880 : Ellipsoid code for CLARKE_1880
+ *    BESSEL_1841 : Ellipsoid code for BESSEL_1841
+ *    BESSEL_1841_NAMIBIA : Ellipsoid code for BESSEL 1841 (NAMIBIA)
+ */
+#define CLARKE_1866         "CC"
+#define CLARKE_1880         "CD"
+#define BESSEL_1841         "BR"
+#define BESSEL_1841_NAMIBIA "BN"
+
+#define WGS84_SEMI_MAJOR_AXIS 6378137.0  /* scales roundingPad to radians */
+
+#define AREA_CELL_EDGE 1.0e-10  /* keeps enumerated areas off the north and
+                                   east edges of their zone and band, in
+                                   radians */
+
+
+namespace
+{
+  struct Latitude_Band
+  {
+    long letter;            /* letter representing latitude band  */
+    double min_northing;    /* minimum northing for latitude band */
+    double north;           /* upper latitude for latitude band   */
+    double south;           /* lower latitude for latitude band   */
+    double northing_offset; /* latitude band northing offset      */
+  };
+
+  const Latitude_Band Latitude_Band_Table[20] = {
+    {LETTER_C, 1100000.0, -72.0, -80.5, 0.0},
+    {LETTER_D, 2000000.0, -64.0, -72.0, 2000000.0},
+    {LETTER_E, 2800000.0, -56.0, -64.0, 2000000.0},
+    {LETTER_F, 3700000.0, -48.0, -56.0, 2000000.0},
+    {LETTER_G, 4600000.0, -40.0, -48.0, 4000000.0},
+    {LETTER_H, 5500000.0, -32.0, -40.0, 4000000.0},
+    {LETTER_J, 6400000.0, -24.0, -32.0, 6000000.0},
+    {LETTER_K, 7300000.0, -16.0, -24.0, 6000000.0},
+    {LETTER_L, 8200000.0, -8.0,  -16.0, 8000000.0},
+    {LETTER_M, 9100000.0,  0.0,   -8.0, 8000000.0},
+    {LETTER_N, 0.0,        8.0,    0.0, 0.0},
+    {LETTER_P, 800000.0,  16.0,    8.0, 0.0},
+    {LETTER_Q, 1700000.0, 24.0,   16.0, 0.0},
+    {LETTER_R, 2600000.0, 32.0,   24.0, 2000000.0},
+    {LETTER_S, 3500000.0, 40.0,   32.0, 2000000.0},
+    {LETTER_T, 4400000.0, 48.0,   40.0, 4000000.0},
+    {LETTER_U, 5300000.0, 56.0,   48.0, 4000000.0},
+    {LETTER_V, 6200000.0, 64.0,   56.0, 6000000.0},
+    {LETTER_W, 7000000.0, 72.0,   64.0, 6000000.0},
+    {LETTER_X, 7900000.0, 84.5,   72.0, 6000000.0}};
+
+
+  struct UPS_Constant
+  {
+    long letter;            /* letter representing latitude band      */
+    long ltr2_low_value;    /* 2nd letter range - low number          */
+    long ltr2_high_value;   /* 2nd letter range - high number         */
+    long ltr3_high_value;   /* 3rd letter range - high number (UPS)   */
+    double false_easting;   /* False easting based on 2nd letter      */
+    double false_northing;  /* False northing based on 3rd letter     */
+  };
+
+  const UPS_Constant UPS_Constant_Table[4] =
+    {{LETTER_A, LETTER_J, LETTER_Z, LETTER_Z, 800000.0, 800000.0},
+    {LETTER_B, LETTER_A, LETTER_R, LETTER_Z, 2000000.0, 800000.0},
+    {LETTER_Y, LETTER_J, LETTER_Z, LETTER_P, 800000.0, 1300000.0},
+    {LETTER_Z, LETTER_A, LETTER_J, LETTER_P, 2000000.0, 1300000.0}};
+}
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    /* UTM and UPS projections shared by the grid references of an
+       ellipsoid */
+    class GridReferenceProjections
+    {
+    public:
+      double semiMajorAxis;
+      double flattening;
+      char   ellipsoidCode[3];
+      UPS*   ups;
+      UTM*   utm;
+      long   refCount;
+    };
+  }
+}
+
+
+/************************************************************************/
+/*                              LOCAL FUNCTIONS
+ *
+ */
+
+namespace
+{
+  // Guards the list of shared projections and their reference counts
+  CCSThreadMutex projectionsMutex;
+  std::vector< GridReferenceProjections* > projectionsList;
+
+
+  GridReferenceProjections* acquireProjections(
+     double      semiMajorAxis,
+     double      flattening,
+     const char* ellipsoidCode )
+  {
+    CCSThreadLock lock( &projectionsMutex );
+
+    for( unsigned int i = 0; i < projectionsList.size(); i++ )
+    {
+      GridReferenceProjections* projections = projectionsList[i];
+      if( projections->semiMajorAxis == semiMajorAxis &&
+          projections->flattening == flattening &&
+          strncmp( projections->ellipsoidCode, ellipsoidCode, 2 ) == 0 )
+      {
+        projections->refCount++;
+        return projections;
+      }
+    }
+
+    GridReferenceProjections* projections = new GridReferenceProjections;
+    projections->semiMajorAxis = semiMajorAxis;
+    projections->flattening = flattening;
+    strncpy( projections->ellipsoidCode, ellipsoidCode, 2 );
+    projections->ellipsoidCode[2] = '\0';
+    projections->ups = 0;
+    projections->utm = 0;
+    projections->refCount = 1;
+
+    try
+    {
+      projections->ups = new UPS( semiMajorAxis, flattening );
+      projections->utm = new UTM(
+         semiMajorAxis, flattening, projections->ellipsoidCode, 0 );
+    }
+    catch ( CoordinateConversionException e )
+    {
+      delete projections->ups;
+      delete projections;
+      throw e;
+    }
+
+    projectionsList.push_back( projections );
+    return projections;
+  }
+
+
+  void shareProjections( GridReferenceProjections* projections )
+  {
+    CCSThreadLock lock( &projectionsMutex );
+    projections->refCount++;
+  }
+
+
+  void releaseProjections( GridReferenceProjections* projections )
+  {
+    {
+      CCSThreadLock lock( &projectionsMutex );
+      if( --projections->refCount > 0 )
+        return;
+
+      for( unsigned int i = 0; i < projectionsList.size(); i++ )
+      {
+        if( projectionsList[i] == projections )
+        {
+          projectionsList.erase( projectionsList.begin() + i );
+          break;
+        }
+      }
+    }
+
+    delete projections->utm;
+    delete projections->ups;
+    delete projections;
+  }
+
+
+  double computeScale( int prec )
+  {
+    double scale = 1.0e5;
+    switch( prec )
+    {
+    case 0:
+      scale = 1.0e5;
+      break;
+
+    case 1:
+      scale = 1.0e4;
+      break;
+
+    case 2:
+      scale = 1.0e3;
+      break;
+
+    case 3:
+      scale = 1.0e2;
+      break;
+
+    case 4:
+      scale = 1.0e1;
+      break;
+
+    case 5:
+      scale = 1.0e0;
+      break;
+
+    default:
+      break;
+    }
+    return scale;
+  }
+
+
+  template< class Grid >
+  long naturalZone( double longitude )
+  {
+  /*
+   * The function naturalZone returns the UTM zone of a longitude, without
+   * the special zones.
+   *
+   *   longitude      : Longitude in radians            (input)
+   */
+
+    long natural_zone;
+    double pad = Grid::roundingPad() / WGS84_SEMI_MAJOR_AXIS;
+
+    if (longitude < PI)
+      natural_zone = (long)(31 + ((longitude+pad) / _6));
+    else
+      natural_zone = (long)(((longitude+pad) / _6) - 29);
+
+    if (natural_zone > 60)
+      natural_zone = 1;
+
+    return natural_zone;
+  }
+
+
+  long specialZone( int band, long zone, double easting )
+  {
+  /*
+   * The function specialZone returns the zone a point in its natural zone
+   * belongs to if it is in an extended zone over southern Norway or
+   * Svalbard, or 0.
+   *
+   *   band           : Latitude band letter            (input)
+   *   zone           : Natural zone                    (input)
+   *   easting        : Easting in the natural zone     (input)
+   */
+
+    long override = 0;
+
+    if (band == LETTER_V) // V latitude band
+    {
+      if ((zone == 31) && (easting >= _500000))
+        override = 32;  // extension of zone 32V
+    }
+    else if (band == LETTER_X)
+    {
+      if ((zone == 32) && (easting < _500000)) // extension of zone 31X
+        override = 31;
+      else if (((zone == 32) && (easting >= _500000)) || // western extension of zone 33X
+         ((zone == 34) && (easting < _500000))) // eastern extension of zone 33X
+        override = 33;
+      else if (((zone == 34) && (easting >= _500000)) || // western extension of zone 35X
+         ((zone == 36) && (easting < _500000))) // eastern extension of zone 35X
+        override = 35;
+      else if ((zone == 36) && (easting >= _500000)) // western extension of zone 37X
+        override = 37;
+    }
+
+    return override;
+  }
+
+
+  template< class Grid >
+  void makeString(
+     char*  string,
+     long   zone,
+     int    letters[GRID_REFERENCE_LETTERS],
+     double easting,
+     double northing,
+     long   precision )
+  {
+  /*
+   * The function makeString constructs a coordinate string from its
+   * component parts.
+   *
+   *   string         : Coordinate string               (output)
+   *   zone           : UTM Zone                        (input)
+   *   letters        : Coordinate string letters       (input)
+   *   easting        : Easting value                   (input)
+   *   northing       : Northing value                  (input)
+   *   precision      : Precision level of the string   (input)
+   */
+
+    double divisor = computeScale( precision );
+    long east;
+    long north;
+
+    easting = fmod (easting, 100000.0);
+    if (easting >= 99999.5)
+      easting = 99999.0;
+    east = (long)((easting + Grid::roundingPad()) / divisor);
+    northing = fmod (northing, 100000.0);
+    if (northing >= 99999.5)
+      northing = 99999.0;
+    north = (long)((northing + Grid::roundingPad()) / divisor);
+
+    GridReferenceString::encode(
+       string, zone, letters, east, north, precision );
+  }
+
+
+  template< class Grid >
+  void breakString(
+     const char* string,
+     long*       zone,
+     long        letters[GRID_REFERENCE_LETTERS],
+     double*     easting,
+     double*     northing,
+     long*       precision )
+  {
+  /*
+   * The function breakString breaks down a coordinate string into its
+   * component parts.
+   *
+   *   string         : Coordinate string               (input)
+   *   zone           : UTM Zone                        (output)
+   *   letters        : Coordinate string letters       (output)
+   *   easting        : Easting value                   (output)
+   *   northing       : Northing value                  (output)
+   *   precision      : Precision level of the string   (output)
+   */
+
+    long east;
+    long north;
+
+    if( !GridReferenceString::decode( string, Grid::ignoreSpaces(),
+           *zone, letters, east, north, *precision ) )
+      throw CoordinateConversionException( Grid::stringError() );
+
+    if (*precision > 0)
+    {
+      double multiplier = computeScale( *precision );
+
+      *easting  = east  * multiplier;
+      *northing = north * multiplier;
+    }
+    else
+    {
+      *easting = 0.0;
+      *northing = 0.0;
+    }
+  }
+
+
+  template< class Grid >
+  void getLatitudeBandMinNorthing(
+     long    letter,
+     double* min_northing,
+     double* northing_offset )
+  {
+  /*
+   * The function getLatitudeBandMinNorthing receives a latitude band letter
+   * and uses the Latitude_Band_Table to determine the minimum northing
+   * and northing offset for that latitude band letter.
+   *
+   *   letter          : Latitude band letter             (input)
+   *   min_northing    : Minimum northing for that letter (output)
+   *   northing_offset : Latitude band northing offset    (output)
+   */
+
+    if ((letter >= LETTER_C) && (letter <= LETTER_H))
+    {
+      *min_northing = Latitude_Band_Table[letter-2].min_northing;
+      *northing_offset = Latitude_Band_Table[letter-2].northing_offset;
+    }
+    else if ((letter >= LETTER_J) && (letter <= LETTER_N))
+    {
+      *min_northing = Latitude_Band_Table[letter-3].min_northing;
+      *northing_offset = Latitude_Band_Table[letter-3].northing_offset;
+    }
+    else if ((letter >= LETTER_P) && (letter <= LETTER_X))
+    {
+      *min_northing = Latitude_Band_Table[letter-4].min_northing;
+      *northing_offset = Latitude_Band_Table[letter-4].northing_offset;
+    }
+    else
+      throw CoordinateConversionException( Grid::stringError() );
+  }
+
+
+  template< class Grid >
+  bool inLatitudeRange( long letter, double latitude, double border )
+  {
+  /*
+   * The function inLatitudeRange receives a latitude band letter
+   * and uses the Latitude_Band_Table to determine if the latitude
+   * falls within the band boundaries for that latitude band letter.
+   *
+   *   letter   : Latitude band letter                        (input)
+   *   latitude : Latitude to test                            (input)
+   *   border   : Border added to band in radians             (input)
+   */
+
+    double north;
+    double south;
+
+    if ((letter >= LETTER_C) && (letter <= LETTER_H))
+    {
+      north = Latitude_Band_Table[letter-2].north * PI_OVER_180;
+      south = Latitude_Band_Table[letter-2].south * PI_OVER_180;
+    }
+    else if ((letter >= LETTER_J) && (letter <= LETTER_N))
+    {
+      north = Latitude_Band_Table[letter-3].north * PI_OVER_180;
+      south = Latitude_Band_Table[letter-3].south * PI_OVER_180;
+    }
+    else if ((letter >= LETTER_P) && (letter <= LETTER_X))
+    {
+      north = Latitude_Band_Table[letter-4].north * PI_OVER_180;
+      south = Latitude_Band_Table[letter-4].south * PI_OVER_180;
+    }
+    else
+      throw CoordinateConversionException( Grid::stringError() );
+
+    return ((south - border) <= latitude) && (latitude <= (north + border));
+  }
+
+
+  bool getZoneLongitudes( long zone, long letter, double* west, double* east )
+  {
+  /*
+   * The function getZoneLongitudes returns the longitudes, in radians, of
+   * the edges of a UTM zone within a latitude band, with the extended
+   * zones over southern Norway and Svalbard.  It returns false if the zone
+   * does not exist in the band.
+   *
+   *   zone       : UTM zone                          (input)
+   *   letter     : Latitude band letter              (input)
+   *   west       : West edge in radians             (output)
+   *   east       : East edge in radians             (output)
+   */
+
+    *west = (zone - 31) * _6;
+    *east = (zone - 30) * _6;
+
+    if (letter == LETTER_V)
+    {
+      if (zone == 31)
+        *east = 3.0 * PI_OVER_180;
+      else if (zone == 32)
+        *west = 3.0 * PI_OVER_180;
+    }
+    else if (letter == LETTER_X)
+    {
+      if ((zone == 32) || (zone == 34) || (zone == 36))
+        return false;
+      else if (zone == 31)
+        *east = 9.0 * PI_OVER_180;
+      else if (zone == 33)
+      {
+        *west = 9.0 * PI_OVER_180;
+        *east = 21.0 * PI_OVER_180;
+      }
+      else if (zone == 35)
+      {
+        *west = 21.0 * PI_OVER_180;
+        *east = 33.0 * PI_OVER_180;
+      }
+      else if (zone == 37)
+        *west = 33.0 * PI_OVER_180;
+    }
+
+    return true;
+  }
+
+
+  void getLatitudeLetter( double latitude, int* letter )
+  {
+  /*
+   * The function getLatitudeLetter receives a latitude value
+   * and uses the Latitude_Band_Table to determine the latitude band
+   * letter for that latitude.
+   *
+   *   latitude   : Latitude              (input)
+   *   letter     : Latitude band letter  (output)
+   */
+
+    long band = 0;
+
+    if (latitude >= _72 && latitude < _84_5)
+      *letter = LETTER_X;
+    else if (latitude > -_80_5 && latitude < _72)
+    {
+      band = (long)(((latitude + _80) / _8) + 1.0e-12);
+      if(band < 0)
+        band = 0;
+      *letter = Latitude_Band_Table[band].letter;
+    }
+    else
+      throw CoordinateConversionException( ErrorMessages::latitude );
+  }
+}
+
+
+/************************************************************************/
+/*                              FUNCTIONS
+ *
+ */
+
+template< class Grid >
+GridReference< Grid >::GridReference(
+   double      ellipsoidSemiMajorAxis,
+   double      ellipsoidFlattening,
+   const char* ellipsoidCode ) :
+   projections( 0 ),
+   ups( 0 ),
+   utm( 0 ),
+   aaPattern( true )
+{
+/*
+ * The constructor receives the ellipsoid parameters and shares the UTM and
+ * UPS projections of that ellipsoid.
+ *
+ *   ellipsoidSemiMajorAxis     : Semi-major axis of ellipsoid in meters (input)
+ *   ellipsoidFlattening        : Flattening of ellipsoid                (input)
+ *   ellipsoidCode              : 2-letter code for ellipsoid            (input)
+ */
+
+  projections = acquireProjections(
+     ellipsoidSemiMajorAxis, ellipsoidFlattening, ellipsoidCode );
+  ups = projections->ups;
+  utm = projections->utm;
+
+  const char* code = projections->ellipsoidCode;
+  if( Grid::ellipsoidPattern() &&
+      ( !strcmp( code, CLARKE_1866 ) ||
+        !strcmp( code, CLARKE_1880 ) ||
+        !strcmp( code, BESSEL_1841 ) ||
+        !strcmp( code, BESSEL_1841_NAMIBIA ) ) )
+    aaPattern = false;
+}
+
+
+template< class Grid >
+GridReference< Grid >::GridReference( const GridReference &g ) :
+   projections( g.projections ),
+   ups( g.ups ),
+   utm( g.utm ),
+   aaPattern( g.aaPattern )
+{
+  shareProjections( projections );
+}
+
+
+template< class Grid >
+GridReference< Grid >::~GridReference()
+{
+  releaseProjections( projections );
+  projections = 0;
+  ups = 0;
+  utm = 0;
+}
+
+
+template< class Grid >
+GridReference< Grid >& GridReference< Grid >::operator=(
+   const GridReference &g )
+{
+  if( this != &g )
+  {
+    shareProjections( g.projections );
+    releaseProjections( projections );
+
+    projections = g.projections;
+    ups = g.ups;
+    utm = g.utm;
+    aaPattern = g.aaPattern;
+  }
+
+  return *this;
+}
+
+
+template< class Grid >
+MGRSorUSNGCoordinates* GridReference< Grid >::convertFromGeodetic(
+   GeodeticCoordinates* geodeticCoordinates,
+   long precision )
+{
+/*
+ * The function convertFromGeodetic converts Geodetic (latitude and
+ * longitude) coordinates to a coordinate string.  If any errors occur,
+ * an exception is thrown with a description of the error.
+ *
+ *    latitude      : Latitude in radians              (input)
+ *    longitude     : Longitude in radians             (input)
+ *    precision     : Precision level of the string    (input)
+ */
+
+  MGRSorUSNGCoordinates* mgrsorUSNGCoordinates = 0;
+  UTMCoordinates*        utmCoordinates = 0;
+  UPSCoordinates*        upsCoordinates = 0;
+
+  double latitude  = geodeticCoordinates->latitude();
+  double longitude = geodeticCoordinates->longitude();
+  double border    = Grid::geodeticBorder();
+
+  if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
+  { /* latitude out of range */
+    throw CoordinateConversionException( ErrorMessages::latitude  );
+  }
+  if ((longitude < (-PI - border)) || (longitude > (2*PI + border)))
+  { /* longitude out of range */
+    throw CoordinateConversionException( ErrorMessages::longitude  );
+  }
+  if ((precision < 0) || (precision > MAX_PRECISION))
+    throw CoordinateConversionException( ErrorMessages::precision  );
+
+  try
+  {
+     // If the latitude is within the valid non polar range [-80, 84),
+     // convert using the utm path, otherwise using the ups path
+     if((latitude >= MIN_NON_POLAR_LAT - border) &&
+        (latitude <  MAX_NON_POLAR_LAT + border))
+     {
+        utmCoordinates = utm->convertFromGeodetic( geodeticCoordinates );
+        mgrsorUSNGCoordinates = fromUTM(
+           utmCoordinates, longitude, latitude, precision );
+        delete utmCoordinates;
+        utmCoordinates = 0;
+     }
+     else
+     {
+        upsCoordinates = ups->convertFromGeodetic( geodeticCoordinates );
+        mgrsorUSNGCoordinates = fromUPS( upsCoordinates, precision );
+        delete upsCoordinates;
+        upsCoordinates = 0;
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     delete upsCoordinates;
+     throw e;
+  }
+
+  return mgrsorUSNGCoordinates;
+}
+
+
+template< class Grid >
+GeodeticCoordinates* GridReference< Grid >::convertToGeodetic(
+   MGRSorUSNGCoordinates* mgrsorUSNGCoordinates )
+{
+/*
+ * The function convertToGeodetic converts a coordinate string to Geodetic
+ * (latitude and longitude) coordinates.  If any errors occur, an
+ * exception is thrown with a description of the error.
+ *
+ *    string     : Coordinate string                (input)
+ *    latitude   : Latitude in radians              (output)
+ *    longitude  : Longitude in radians             (output)
+ */
+
+  long zone;
+  long letters[GRID_REFERENCE_LETTERS];
+  double grid_easting;
+  double grid_northing;
+  long precision;
+  GeodeticCoordinates* geodeticCoordinates = 0;
+  UTMCoordinates* utmCoordinates = 0;
+  UPSCoordinates* upsCoordinates = 0;
+
+  breakString< Grid >(
+     mgrsorUSNGCoordinates->MGRSString(), &zone, letters,
+     &grid_easting, &grid_northing, &precision );
+
+  try
+  {
+     if( zone )
+     {
+        utmCoordinates = toUTM(
+           zone, letters, grid_easting, grid_northing, precision );
+        geodeticCoordinates = utm->convertToGeodetic( utmCoordinates );
+        if( Grid::geodeticWarning() &&
+            strlen( utmCoordinates->warningMessage() ) > 0 )
+        {
+           geodeticCoordinates->setWarningMessage(
+              utmCoordinates->warningMessage() );
+        }
+        delete utmCoordinates;
+        utmCoordinates = 0;
+     }
+     else
+     {
+        upsCoordinates = toUPS( letters, grid_easting, grid_northing );
+        geodeticCoordinates = ups->convertToGeodetic( upsCoordinates );
+        delete upsCoordinates;
+        upsCoordinates = 0;
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     delete upsCoordinates;
+     throw e;
+  }
+
+  return geodeticCoordinates;
+}
+
+
+template< class Grid >
+MGRSorUSNGCoordinates* GridReference< Grid >::convertFromUTM(
+   UTMCoordinates* utmCoordinates,
+   long precision )
+{
+/*
+ * The function convertFromUTM converts UTM (zone, easting, and
+ * northing) coordinates to a coordinate string.  If any errors occur, an
+ * exception is thrown with a description of the error.
+ *
+ *    zone       : UTM zone                         (input)
+ *    hemisphere : North or South hemisphere        (input)
+ *    easting    : Easting (X) in meters            (input)
+ *    northing   : Northing (Y) in meters           (input)
+ *    precision  : Precision level of the string    (input)
+ */
+
+  long zone       = utmCoordinates->zone();
+  char hemisphere = utmCoordinates->hemisphere();
+  double easting  = utmCoordinates->easting();
+  double northing = utmCoordinates->northing();
+
+  GeodeticCoordinates*   geodeticCoordinates = 0;
+  UPSCoordinates*        upsCoordinates = 0;
+  MGRSorUSNGCoordinates* mgrsorUSNGCoordinates = 0;
+
+  if ((zone < 1) || (zone > 60))
+    throw CoordinateConversionException( ErrorMessages::zone  );
+  if ((hemisphere != 'S') && (hemisphere != 'N'))
+    throw CoordinateConversionException( ErrorMessages::hemisphere  );
+  if ((easting < MIN_EASTING) || (easting > MAX_EASTING))
+    throw CoordinateConversionException( ErrorMessages::easting  );
+  if ((northing < MIN_NORTHING) || (northing > MAX_NORTHING))
+    throw CoordinateConversionException( ErrorMessages::northing  );
+  if ((precision < 0) || (precision > MAX_PRECISION))
+    throw CoordinateConversionException( ErrorMessages::precision  );
+
+  try
+  {
+     geodeticCoordinates = utm->convertToGeodetic( utmCoordinates );
+
+     // If the latitude is within the valid non polar range [-80, 84),
+     // convert using the utm path, otherwise using the ups path
+     double latitude = geodeticCoordinates->latitude();
+
+     if((latitude >= (MIN_NON_POLAR_LAT - EPSILON)) &&
+        (latitude <  (MAX_NON_POLAR_LAT + EPSILON)))
+        mgrsorUSNGCoordinates = fromUTM(
+           utmCoordinates,
+           geodeticCoordinates->longitude(), latitude, precision );
+     else
+     {
+        upsCoordinates = ups->convertFromGeodetic( geodeticCoordinates );
+        mgrsorUSNGCoordinates = fromUPS( upsCoordinates, precision );
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete upsCoordinates;
+     delete geodeticCoordinates;
+     throw e;
+  }
+
+  delete upsCoordinates;
+  delete geodeticCoordinates;
+
+  return mgrsorUSNGCoordinates;
+}
+
+
+template< class Grid >
+UTMCoordinates* GridReference< Grid >::convertToUTM(
+   MGRSorUSNGCoordinates* mgrsorUSNGCoordinates )
+{
+/*
+ * The function convertToUTM converts a coordinate string to UTM
+ * projection (zone, hemisphere, easting and northing) coordinates.  If
+ * any errors occur, an exception is thrown with a description of the
+ * error.
+ *
+ *    string     : Coordinate string                (input)
+ *    zone       : UTM zone                         (output)
+ *    hemisphere : North or South hemisphere        (output)
+ *    easting    : Easting (X) in meters            (output)
+ *    northing   : Northing (Y) in meters           (output)
+ */
+
+  long zone;
+  long letters[GRID_REFERENCE_LETTERS];
+  double grid_easting, grid_northing;
+  long precision;
+  UTMCoordinates* utmCoordinates = 0;
+  GeodeticCoordinates* geodeticCoordinates = 0;
+  UPSCoordinates* upsCoordinates = 0;
+
+  try
+  {
+     breakString< Grid >(
+        mgrsorUSNGCoordinates->MGRSString(), &zone, letters,
+        &grid_easting, &grid_northing, &precision );
+     if (zone)
+     {
+        utmCoordinates = toUTM(
+           zone, letters, grid_easting, grid_northing, precision );
+        // Convert to geodetic to make sure that
+        // the coordinates are in the valid utm range
+        geodeticCoordinates = utm->convertToGeodetic( utmCoordinates );
+     }
+     else
+     {
+        upsCoordinates = toUPS( letters, grid_easting, grid_northing );
+        geodeticCoordinates = ups->convertToGeodetic( upsCoordinates );
+        utmCoordinates = utm->convertFromGeodetic( geodeticCoordinates );
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     delete upsCoordinates;
+     delete geodeticCoordinates;
+     throw e;
+  }
+
+  delete upsCoordinates;
+  delete geodeticCoordinates;
+
+  return utmCoordinates;
+}
+
+
+template< class Grid >
+MGRSorUSNGCoordinates* GridReference< Grid >::convertFromUPS(
+   UPSCoordinates* upsCoordinates,
+   long precision )
+{
+/*
+ * The function convertFromUPS converts UPS (hemisphere, easting,
+ * and northing) coordinates to a coordinate string.  If any errors occur,
+ * an exception is thrown with a description of the error.
+ *
+ *    hemisphere    : Hemisphere either 'N' or 'S'     (input)
+ *    easting       : Easting/X in meters              (input)
+ *    northing      : Northing/Y in meters             (input)
+ *    precision     : Precision level of the string    (input)
+ */
+
+  char hemisphere = upsCoordinates->hemisphere();
+  double easting  = upsCoordinates->easting();
+  double northing = upsCoordinates->northing();
+
+  UTMCoordinates*        utmCoordinates = 0;
+  GeodeticCoordinates*   geodeticCoordinates = 0;
+  MGRSorUSNGCoordinates* mgrsorUSNGCoordinates = 0;
+
+  if ((hemisphere != 'N') && (hemisphere != 'S'))
+    throw CoordinateConversionException( ErrorMessages::hemisphere  );
+  if ((easting < MIN_EAST_NORTH) || (easting > MAX_EAST_NORTH))
+    throw CoordinateConversionException( ErrorMessages::easting  );
+  if ((northing < MIN_EAST_NORTH) || (northing > MAX_EAST_NORTH))
+    throw CoordinateConversionException( ErrorMessages::northing  );
+  if ((precision < 0) || (precision > MAX_PRECISION))
+    throw CoordinateConversionException( ErrorMessages::precision  );
+
+  try
+  {
+     geodeticCoordinates = ups->convertToGeodetic( upsCoordinates );
+
+     // If the latitude is within the valid polar range [-90, -80) or
+     // [84, 90], widened by the grid's border, convert using the ups path,
+     // otherwise using the utm path
+     double latitude = geodeticCoordinates->latitude();
+     double border   = Grid::upsPolarBorder();
+
+     if((latitude <  (MIN_NON_POLAR_LAT + border)) ||
+        (latitude >= (MAX_NON_POLAR_LAT - border)))
+        mgrsorUSNGCoordinates = fromUPS( upsCoordinates, precision );
+     else
+     {
+        utmCoordinates = utm->convertFromGeodetic( geodeticCoordinates );
+        double longitude = geodeticCoordinates->longitude();
+        mgrsorUSNGCoordinates = fromUTM(
+           utmCoordinates, longitude, latitude, precision );
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     delete geodeticCoordinates;
+     throw e;
+  }
+
+  delete utmCoordinates;
+  delete geodeticCoordinates;
+
+  return mgrsorUSNGCoordinates;
+}
+
+
+template< class Grid >
+UPSCoordinates* GridReference< Grid >::convertToUPS(
+   MGRSorUSNGCoordinates* mgrsorUSNGCoordinates )
+{
+/*
+ * The function convertToUPS converts a coordinate string to UPS
+ * (hemisphere, easting, and northing) coordinates.  If any errors occur,
+ * an exception is thrown with a description of the error.
+ *
+ *    string        : Coordinate string                (input)
+ *    hemisphere    : Hemisphere either 'N' or 'S'     (output)
+ *    easting       : Easting/X in meters              (output)
+ *    northing      : Northing/Y in meters             (output)
+ */
+
+  long zone;
+  long letters[GRID_REFERENCE_LETTERS];
+  long precision;
+  double grid_easting;
+  double grid_northing;
+  UPSCoordinates* upsCoordinates = 0;
+  GeodeticCoordinates* geodeticCoordinates = 0;
+  UTMCoordinates* utmCoordinates = 0;
+
+  try
+  {
+     breakString< Grid >(
+        mgrsorUSNGCoordinates->MGRSString(),
+        &zone, letters, &grid_easting, &grid_northing, &precision );
+
+     if( !zone )
+     {
+        upsCoordinates = toUPS( letters, grid_easting, grid_northing );
+        // Convert to geodetic to make sure that
+        // the coordinates are in the valid ups range
+        geodeticCoordinates = ups->convertToGeodetic( upsCoordinates );
+     }
+     else
+     {
+        utmCoordinates = toUTM(
+           zone, letters, grid_easting, grid_northing, precision );
+        geodeticCoordinates = utm->convertToGeodetic( utmCoordinates );
+        upsCoordinates = ups->convertFromGeodetic( geodeticCoordinates );
+     }
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     delete upsCoordinates;
+     delete geodeticCoordinates;
+     throw e;
+  }
+
+  delete utmCoordinates;
+  delete geodeticCoordinates;
+
+  return upsCoordinates;
+}
+
+
+template< class Grid >
+void GridReference< Grid >::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   long          precision,
+   char*         strings,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts count geodetic
+ * coordinates to coordinate strings, written GRID_REFERENCE_STRING_SIZE
+ * characters apart.  Points outside the polar regions are converted to
+ * UTM in their natural zones, grouped by zone; the points in the extended
+ * zones over southern Norway and Svalbard are then converted again,
+ * together, in those zones.
+ *
+ *    longitudes    : Longitudes in radians            (input)
+ *    latitudes     : Latitudes in radians             (input)
+ *    precision     : Precision level of the strings   (input)
+ *    strings       : Coordinate strings               (output)
+ *    status        : Error message of each point, or 0 (output)
+ */
+
+  std::vector<long>   index;     /* points converted through UTM */
+  std::vector<double> longitude;
+  std::vector<double> latitude;
+  std::vector<long>   zone;
+  double border = Grid::geodeticBorder();
+  long i, k;
+
+  for( i = 0; i < count; i++ )
+  {
+    long natural_zone = naturalZone< Grid >( longitudes[i] );
+
+    status[i] = 0;
+
+    if ((precision >= 0) && (precision <= MAX_PRECISION) &&
+        (longitudes[i] >= (-PI - border)) &&
+        (longitudes[i] <= (2*PI + border)) &&
+        (latitudes[i] >= MIN_NON_POLAR_LAT - border) &&
+        (latitudes[i] <  MAX_NON_POLAR_LAT + border) &&
+        natural_zone )
+    {
+      index.push_back( i );
+      longitude.push_back( longitudes[i] );
+      latitude.push_back( latitudes[i] );
+      zone.push_back( natural_zone );
+    }
+    else
+    {
+      // polar points, points west of 180 degrees W, which are left in the
+      // zone UTM gives them, and points in error are converted one at a time
+      MGRSorUSNGCoordinates* mgrsorUSNGCoordinates = 0;
+      try
+      {
+        GeodeticCoordinates geodeticCoordinates(
+           CoordinateType::geodetic, longitudes[i], latitudes[i] );
+        mgrsorUSNGCoordinates =
+           convertFromGeodetic( &geodeticCoordinates, precision );
+        strcpy( strings + i * GRID_REFERENCE_STRING_SIZE,
+           mgrsorUSNGCoordinates->MGRSString() );
+      }
+      catch ( CoordinateConversionException e )
+      {
+        status[i] = CoordinateSystem::errorStatus( e.getMessage() );
+      }
+      delete mgrsorUSNGCoordinates;
+    }
+  }
+
+  long num = index.size();
+  if( num == 0 )
+    return;
+
+  std::vector<char>        hemisphere( num );
+  std::vector<double>      easting( num );
+  std::vector<double>      northing( num );
+  std::vector<const char*> error( num );
+  std::vector<int>         band( num );
+
+  utm->convertFromGeodeticInZones( num, &longitude[0], &latitude[0],
+     &zone[0], &hemisphere[0], &easting[0], &northing[0], &error[0] );
+
+  /* UTM special cases, converted again together */
+  std::vector<long>   special;
+  std::vector<double> specialLongitude;
+  std::vector<double> specialLatitude;
+  std::vector<long>   specialZones;
+  for( k = 0; k < num; k++ )
+  {
+    if( error[k] )
+      continue;
+
+    getLatitudeLetter( latitude[k], &band[k] );
+    long override = specialZone( band[k], zone[k], easting[k] );
+    if( override )
+    {
+      special.push_back( k );
+      specialLongitude.push_back( longitude[k] );
+      specialLatitude.push_back( latitude[k] );
+      specialZones.push_back( override );
+    }
+  }
+
+  long numSpecial = special.size();
+  if( numSpecial > 0 )
+  {
+    std::vector<char>        specialHemisphere( numSpecial );
+    std::vector<double>      specialEasting( numSpecial );
+    std::vector<double>      specialNorthing( numSpecial );
+    std::vector<const char*> specialError( numSpecial );
+
+    utm->convertFromGeodeticInZones( numSpecial,
+       &specialLongitude[0], &specialLatitude[0], &specialZones[0],
+       &specialHemisphere[0], &specialEasting[0], &specialNorthing[0],
+       &specialError[0] );
+
+    for( long j = 0; j < numSpecial; j++ )
+    {
+      k = special[j];
+      zone[k]     = specialZones[j];
+      easting[k]  = specialEasting[j];
+      northing[k] = specialNorthing[j];
+      error[k]    = specialError[j];
+    }
+  }
+
+  for( k = 0; k < num; k++ )
+  {
+    i = index[k];
+    if( error[k] )
+      status[i] = error[k];
+    else
+    {
+      makeUTMString( zone[k], band[k], latitude[k], easting[k], northing[k],
+         precision, strings + i * GRID_REFERENCE_STRING_SIZE );
+    }
+  }
+}
+
+
+template< class Grid >
+void GridReference< Grid >::convertToGeodeticBatch(
+   long          count,
+   const char*   strings,
+   double*       longitudes,
+   double*       latitudes,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts count coordinate strings,
+ * held GRID_REFERENCE_STRING_SIZE characters apart, to geodetic
+ * coordinates.  The points in UTM zones are converted together, grouped
+ * by zone, and then checked against their latitude bands.
+ *
+ *    strings       : Coordinate strings               (input)
+ *    longitudes    : Longitudes in radians            (output)
+ *    latitudes     : Latitudes in radians             (output)
+ *    status        : Error message of each point, or 0 (output)
+ */
+
+  std::vector<long>   index;     /* points converted through UTM */
+  std::vector<long>   zone;
+  std::vector<char>   hemisphere;
+  std::vector<double> easting;
+  std::vector<double> northing;
+  std::vector<long>   band;
+  std::vector<long>   bandPrecision;
+  long i, k;
+
+  if( count <= 0 )
+    return;
+
+  std::vector<long> zones( count );
+  std::vector<long> letters( count * GRID_REFERENCE_LETTERS );
+  std::vector<long> easts( count );
+  std::vector<long> norths( count );
+  std::vector<long> precisions( count );
+
+  GridReferenceString::decodeBatch( count, strings,
+     GRID_REFERENCE_STRING_SIZE, Grid::ignoreSpaces(),
+     &zones[0], &letters[0], &easts[0], &norths[0], &precisions[0] );
+
+  for( i = 0; i < count; i++ )
+  {
+    long*  pointLetters = &letters[i * GRID_REFERENCE_LETTERS];
+    long   precision = precisions[i];
+    UPSCoordinates*      upsCoordinates = 0;
+    GeodeticCoordinates* geodeticCoordinates = 0;
+
+    status[i] = 0;
+    if( precision < 0 )
+    {
+      status[i] = Grid::stringError();
+      continue;
+    }
+
+    double multiplier = computeScale( precision );
+    double grid_easting  = easts[i]  * multiplier;
+    double grid_northing = norths[i] * multiplier;
+
+    try
+    {
+      if( zones[i] )
+      {
+        char   utmHemisphere;
+        double utmEasting;
+        double utmNorthing;
+
+        gridToUTM( zones[i], pointLetters, grid_easting, grid_northing,
+           utmHemisphere, utmEasting, utmNorthing );
+
+        index.push_back( i );
+        zone.push_back( zones[i] );
+        hemisphere.push_back( utmHemisphere );
+        easting.push_back( utmEasting );
+        northing.push_back( utmNorthing );
+        band.push_back( pointLetters[0] );
+        bandPrecision.push_back( precision );
+      }
+      else
+      {
+        upsCoordinates = toUPS( pointLetters, grid_easting, grid_northing );
+        geodeticCoordinates = ups->convertToGeodetic( upsCoordinates );
+        longitudes[i] = geodeticCoordinates->longitude();
+        latitudes[i]  = geodeticCoordinates->latitude();
+      }
+    }
+    catch ( CoordinateConversionException e )
+    {
+      status[i] = CoordinateSystem::errorStatus( e.getMessage() );
+    }
+    delete upsCoordinates;
+    delete geodeticCoordinates;
+  }
+
+  long num = index.size();
+  if( num == 0 )
+    return;
+
+  std::vector<double>      longitude( num );
+  std::vector<double>      latitude( num );
+  std::vector<const char*> error( num );
+
+  utm->convertToGeodeticBatch( num, &zone[0], &hemisphere[0],
+     &easting[0], &northing[0], &longitude[0], &latitude[0], &error[0] );
+
+  for( k = 0; k < num; k++ )
+  {
+    i = index[k];
+    if( error[k] )
+    {
+      status[i] = error[k];
+      continue;
+    }
+
+    try
+    {
+      /* check that point is within Zone Letter bounds */
+      checkLatitudeBand( band[k], latitude[k], bandPrecision[k] );
+      longitudes[i] = longitude[k];
+      latitudes[i]  = latitude[k];
+    }
+    catch ( CoordinateConversionException e )
+    {
+      status[i] = CoordinateSystem::errorStatus( e.getMessage() );
+    }
+  }
+}
+
+
+template< class Grid >
+MGRSorUSNGCoordinates* GridReference< Grid >::fromUTM(
+   UTMCoordinates* utmCoordinates,
+   double longitude,
+   double latitude,
+   long precision )
+{
+/*
+ * The function fromUTM calculates a coordinate string based on the zone,
+ * latitude, easting and northing.  A point outside its natural zone, or
+ * in an extended zone, is converted again in the shared UTM projection
+ * with that zone as override.
+ *
+ *    zone       : Zone number             (input)
+ *    hemisphere : Hemisphere              (input)
+ *    longitude  : Longitude in radians    (input)
+ *    latitude   : Latitude in radians     (input)
+ *    easting    : Easting                 (input)
+ *    northing   : Northing                (input)
+ *    precision  : Precision               (input)
+ */
+
+  int  band;                  /* Latitude band letter                        */
+  char string[GRID_REFERENCE_STRING_SIZE];
+  long override = 0;
+  long natural_zone;
+
+  long zone       = utmCoordinates->zone();
+  double easting  = utmCoordinates->easting();
+  double northing = utmCoordinates->northing();
+
+  getLatitudeLetter( latitude, &band );
+
+  // Check if the point is within it's natural zone
+  // If it is not, put it there
+  natural_zone = naturalZone< Grid >( longitude );
+  if (zone != natural_zone)
+  { // reconvert to override zone
+    GeodeticCoordinates geodeticCoordinates(
+       CoordinateType::geodetic, longitude, latitude );
+    UTMCoordinates* utmCoordinatesOverride =
+       utm->convertFromGeodetic( &geodeticCoordinates, natural_zone );
+
+    zone       = utmCoordinatesOverride->zone();
+    easting    = utmCoordinatesOverride->easting();
+    northing   = utmCoordinatesOverride->northing();
+
+    delete utmCoordinatesOverride;
+    utmCoordinatesOverride = 0;
+  }
+
+  /* UTM special cases */
+  override = specialZone( band, zone, easting );
+
+  if (override)
+  { // reconvert to override zone
+    GeodeticCoordinates geodeticCoordinates(
+       CoordinateType::geodetic, longitude, latitude );
+    UTMCoordinates* utmCoordinatesOverride =
+       utm->convertFromGeodetic( &geodeticCoordinates, override );
+
+    zone       = utmCoordinatesOverride->zone();
+    easting    = utmCoordinatesOverride->easting();
+    northing   = utmCoordinatesOverride->northing();
+
+    delete utmCoordinatesOverride;
+    utmCoordinatesOverride = 0;
+  }
+
+  makeUTMString(
+     zone, band, latitude, easting, northing, precision, string );
+
+  return new MGRSorUSNGCoordinates(
+     Grid::coordinateType(), string, Grid::stringPrecision( precision ) );
+}
+
+
+template< class Grid >
+UTMCoordinates* GridReference< Grid >::toUTM(
+   long   zone,
+   long   letters[GRID_REFERENCE_LETTERS],
+   double easting,
+   double northing,
+   long   precision )
+{
+/*
+ * The function toUTM converts the parts of a coordinate string in a UTM
+ * zone to UTM projection (zone, hemisphere, easting and northing)
+ * coordinates.  If any errors occur, an exception is thrown with a
+ * description of the error.
+ *
+ *    zone       : UTM zone                         (input)
+ *    letters    : Coordinate string letters        (input)
+ *    easting    : Easting within the square        (input)
+ *    northing   : Northing within the square       (input)
+ *    precision  : Precision                        (input)
+ */
+
+  char   hemisphere;
+  double utmEasting;
+  double utmNorthing;
+  const char* warning;
+  UTMCoordinates* utmCoordinates = 0;
+
+  gridToUTM( zone, letters, easting, northing,
+     hemisphere, utmEasting, utmNorthing );
+
+  utmCoordinates = new UTMCoordinates(
+     CoordinateType::universalTransverseMercator,
+     zone, hemisphere, utmEasting, utmNorthing );
+
+  /* check that point is within Zone Letter bounds */
+  GeodeticCoordinates* geodeticCoordinates;
+  try
+  {
+     geodeticCoordinates = utm->convertToGeodetic( utmCoordinates );
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     throw e;
+  }
+
+  double latitude = geodeticCoordinates->latitude();
+
+  delete geodeticCoordinates;
+  geodeticCoordinates = 0;
+
+  try
+  {
+     warning = checkLatitudeBand( letters[0], latitude, precision );
+  }
+  catch ( CoordinateConversionException e )
+  {
+     delete utmCoordinates;
+     throw e;
+  }
+
+  if( warning )
+     utmCoordinates->setWarningMessage( warning );
+
+  return utmCoordinates;
+}
+
+
+template< class Grid >
+void GridReference< Grid >::makeUTMString(
+   long   zone,
+   int    band,
+   double latitude,
+   double easting,
+   double northing,
+   long   precision,
+   char*  string )
+{
+/*
+ * The function makeUTMString makes the coordinate string of UTM
+ * coordinates in the zone of the point's grid.
+ *
+ *    zone       : Zone number             (input)
+ *    band       : Latitude band letter    (input)
+ *    latitude   : Latitude in radians     (input)
+ *    easting    : Easting                 (input)
+ *    northing   : Northing                (input)
+ *    precision  : Precision               (input)
+ *    string     : Coordinate string      (output)
+ */
+
+  double pattern_offset;      /* Pattern offset for 3rd letter               */
+  double grid_northing;       /* Northing used to derive 3rd letter          */
+  long ltr2_low_value;        /* 2nd letter range - low number               */
+  long ltr2_high_value;       /* 2nd letter range - high number              */
+  int  letters[GRID_REFERENCE_LETTERS]; /* Alphabet positions of 3 letters   */
+
+  letters[0] = band;
+
+  /* Truncate easting and northing values */
+  double divisor = computeScale( precision );
+
+  easting  = ( long )( (easting +Grid::roundingPad()) /divisor ) * divisor;
+  northing = ( long )( (northing+Grid::roundingPad()) /divisor ) * divisor;
+
+  if( latitude <= 0.0 && northing == 1.0e7 )
+  {
+    latitude = 0.0;
+    northing = 0.0;
+  }
+
+  getGridValues( zone, &ltr2_low_value, &ltr2_high_value, &pattern_offset );
+
+  grid_northing = northing;
+
+  while (grid_northing >= TWOMIL)
+  {
+    grid_northing = grid_northing - TWOMIL;
+  }
+  grid_northing = grid_northing + pattern_offset;
+  if(grid_northing >= TWOMIL)
+     grid_northing = grid_northing - TWOMIL;
+
+  letters[2] = (long)(grid_northing / ONEHT);
+  if (letters[2] > LETTER_H)
+     letters[2] = letters[2] + 1;
+
+  if (letters[2] > LETTER_N)
+     letters[2] = letters[2] + 1;
+
+  letters[1] = ltr2_low_value + ((long)(easting / ONEHT) - 1);
+  if ((ltr2_low_value == LETTER_J) && (letters[1] > LETTER_N))
+     letters[1] = letters[1] + 1;
+
+  makeString< Grid >( string, zone, letters, easting, northing, precision );
+}
+
+
+template< class Grid >
+void GridReference< Grid >::gridToUTM(
+   long   zone,
+   long   letters[GRID_REFERENCE_LETTERS],
+   double easting,
+   double northing,
+   char   &hemisphere,
+   double &utmEasting,
+   double &utmNorthing )
+{
+/*
+ * The function gridToUTM computes the UTM coordinates of the parts of a
+ * coordinate string in a UTM zone.  If the letters are not valid, an
+ * exception is thrown.
+ *
+ *    zone        : Zone number                     (input)
+ *    letters     : Coordinate string letters       (input)
+ *    easting     : Easting within the square       (input)
+ *    northing    : Northing within the square      (input)
+ *    hemisphere  : North or South hemisphere      (output)
+ *    utmEasting  : Easting (X) in meters          (output)
+ *    utmNorthing : Northing (Y) in meters         (output)
+ */
+
+  double min_northing;
+  double northing_offset;
+  long   ltr2_low_value;
+  long   ltr2_high_value;
+  double pattern_offset;
+  double grid_easting;        /* Easting for 100,000 meter grid square      */
+  double grid_northing;       /* Northing for 100,000 meter grid square     */
+
+  if((letters[0] == LETTER_X) && ((zone == 32) || (zone == 34) || (zone == 36)))
+     throw CoordinateConversionException( Grid::stringError() );
+  else if ((letters[0] == LETTER_V) && (zone == 31) && (letters[1] > LETTER_D))
+     throw CoordinateConversionException( Grid::stringError() );
+
+  if (letters[0] < LETTER_N)
+     hemisphere = 'S';
+  else
+     hemisphere = 'N';
+
+  getGridValues(zone, &ltr2_low_value, &ltr2_high_value, &pattern_offset);
+
+  /* Check that the second letter of the string is within
+   * the range of valid second letter values
+   * Also check that the third letter is valid */
+  if((letters[1] < ltr2_low_value)  ||
+     (letters[1] > ltr2_high_value) ||
+     (letters[2] > LETTER_V) )
+     throw CoordinateConversionException( Grid::stringError() );
+
+  grid_easting = (double)((letters[1]) - ltr2_low_value + 1) * ONEHT;
+  if ((ltr2_low_value == LETTER_J) && (letters[1] > LETTER_O))
+     grid_easting = grid_easting - ONEHT;
+
+  double row_letter_northing = (double)(letters[2]) * ONEHT;
+  if (letters[2] > LETTER_O)
+     row_letter_northing = row_letter_northing - ONEHT;
+
+  if (letters[2] > LETTER_I)
+     row_letter_northing = row_letter_northing - ONEHT;
+
+  if (row_letter_northing >= TWOMIL)
+     row_letter_northing = row_letter_northing - TWOMIL;
+
+  getLatitudeBandMinNorthing< Grid >(
+     letters[0], &min_northing, &northing_offset );
+
+  grid_northing = row_letter_northing - pattern_offset;
+  if(grid_northing < 0)
+     grid_northing += TWOMIL;
+
+  grid_northing += northing_offset;
+
+  if(grid_northing < min_northing)
+     grid_northing += TWOMIL;
+
+  utmEasting  = grid_easting  + easting;
+  utmNorthing = grid_northing + northing;
+}
+
+
+template< class Grid >
+const char* GridReference< Grid >::checkLatitudeBand(
+   long letter, double latitude, long precision )
+{
+/*
+ * The function checkLatitudeBand checks that the latitude of a point is in
+ * its latitude band, give or take the precision of the string.  It returns
+ * 0, or a warning if the grid accepts the band the point is in; otherwise
+ * an exception is thrown.
+ *
+ *    letter     : Latitude band letter    (input)
+ *    latitude   : Latitude in radians     (input)
+ *    precision  : Precision               (input)
+ */
+
+  double divisor = ONEHT / computeScale( precision );
+  double border  = PI_OVER_180 / divisor;
+
+  if( inLatitudeRange< Grid >( letter, latitude, border ) )
+     return 0;
+
+  if( !Grid::adjacentBands() )
+     return MSP::CCS::WarningMessages::latitude;
+
+  // check adjacent bands
+  long prevBand = letter - 1;
+  long nextBand = letter + 1;
+
+  if( letter == LETTER_C ) // if last band, do not go off list
+     prevBand = letter;
+
+  if( letter == LETTER_X )
+     nextBand = letter;
+
+  if( prevBand == LETTER_I || prevBand == LETTER_O )
+     prevBand--;
+
+  if( nextBand == LETTER_I || nextBand == LETTER_O )
+     nextBand++;
+
+  if( inLatitudeRange< Grid >( prevBand, latitude, border ) ||
+      inLatitudeRange< Grid >( nextBand, latitude, border ) )
+     return MSP::CCS::WarningMessages::latitude;
+
+  throw CoordinateConversionException( Grid::stringError() );
+}
+
+
+template< class Grid >
+MGRSorUSNGCoordinates* GridReference< Grid >::fromUPS(
+   UPSCoordinates* upsCoordinates,
+   long precision )
+{
+/*
+ * The function fromUPS converts UPS (hemisphere, easting,
+ * and northing) coordinates to a coordinate string.
+ *
+ *    hemisphere    : Hemisphere either 'N' or 'S'     (input)
+ *    easting       : Easting/X in meters              (input)
+ *    northing      : Northing/Y in meters             (input)
+ *    precision     : Precision level of the string    (input)
+ */
+
+  double false_easting;       /* False easting for 2nd letter                 */
+  double false_northing;      /* False northing for 3rd letter                */
+  double grid_easting;        /* Easting used to derive 2nd letter            */
+  double grid_northing;       /* Northing used to derive 3rd letter           */
+  long ltr2_low_value;        /* 2nd letter range - low number                */
+  int letters[GRID_REFERENCE_LETTERS]; /* Alphabet positions of 3 letters     */
+  double divisor;
+  int index = 0;
+  char string[GRID_REFERENCE_STRING_SIZE];
+
+  char hemisphere = upsCoordinates->hemisphere();
+  double easting  = upsCoordinates->easting();
+  double northing = upsCoordinates->northing();
+
+  divisor = computeScale( precision );
+
+  easting  = (long)((easting +Grid::roundingPad()) /divisor) * divisor;
+  northing = (long)((northing+Grid::roundingPad()) /divisor) * divisor;
+
+  if (hemisphere == 'N')
+  {
+    if (easting >= TWOMIL)
+      letters[0] = LETTER_Z;
+    else
+      letters[0] = LETTER_Y;
+
+    index = letters[0] - 22;
+  }
+  else
+  {
+    if (easting >= TWOMIL)
+      letters[0] = LETTER_B;
+    else
+      letters[0] = LETTER_A;
+
+    index = letters[0];
+  }
+
+  ltr2_low_value = UPS_Constant_Table[index].ltr2_low_value;
+  false_easting = UPS_Constant_Table[index].false_easting;
+  false_northing = UPS_Constant_Table[index].false_northing;
+
+  grid_northing = northing;
+  grid_northing = grid_northing - false_northing;
+  letters[2] = (long)(grid_northing / ONEHT);
+
+  if (letters[2] > LETTER_H)
+    letters[2] = letters[2] + 1;
+
+  if (letters[2] > LETTER_N)
+    letters[2] = letters[2] + 1;
+
+  grid_easting = easting;
+  grid_easting = grid_easting - false_easting;
+  letters[1] = ltr2_low_value + ((long)(grid_easting / ONEHT));
+
+  if (easting < TWOMIL)
+  {
+    if (letters[1] > LETTER_L)
+      letters[1] = letters[1] + 3;
+
+    if (letters[1] > LETTER_U)
+      letters[1] = letters[1] + 2;
+  }
+  else
+  {
+    if (letters[1] > LETTER_C)
+      letters[1] = letters[1] + 2;
+
+    if (letters[1] > LETTER_H)
+      letters[1] = letters[1] + 1;
+
+    if (letters[1] > LETTER_L)
+      letters[1] = letters[1] + 3;
+  }
+
+  makeString< Grid >( string, 0, letters, easting, northing, precision );
+
+  return new MGRSorUSNGCoordinates(
+     Grid::coordinateType(), string, Grid::stringPrecision( precision ) );
+}
+
+
+template< class Grid >
+UPSCoordinates* GridReference< Grid >::toUPS(
+   long   letters[GRID_REFERENCE_LETTERS],
+   double easting,
+   double northing )
+{
+/*
+ * The function toUPS converts the polar parts of a coordinate string to
+ * UPS (hemisphere, easting, and northing) coordinates.  If any errors
+ * occur, an exception is thrown with a description of the error.
+ *
+ *    letters       : Coordinate string letters        (input)
+ *    easting       : Easting within the square        (input)
+ *    northing      : Northing within the square       (input)
+ */
+
+  long ltr2_high_value;       /* 2nd letter range - high number             */
+  long ltr3_high_value;       /* 3rd letter range - high number (UPS)       */
+  long ltr2_low_value;        /* 2nd letter range - low number              */
+  double false_easting;       /* False easting for 2nd letter               */
+  double false_northing;      /* False northing for 3rd letter              */
+  double grid_easting;        /* easting for 100,000 meter grid square      */
+  double grid_northing;       /* northing for 100,000 meter grid square     */
+  char hemisphere;
+  int index = 0;
+
+  if ((letters[0] == LETTER_Y) || (letters[0] == LETTER_Z))
+  {
+    hemisphere = 'N';
+    index = letters[0] - 22;
+  }
+  else if ((letters[0] == LETTER_A) || (letters[0] == LETTER_B))
+  {
+    hemisphere = 'S';
+    index = letters[0];
+  }
+  else
+    throw CoordinateConversionException( Grid::stringError() );
+
+  ltr2_low_value  = UPS_Constant_Table[index].ltr2_low_value;
+  ltr2_high_value = UPS_Constant_Table[index].ltr2_high_value;
+  ltr3_high_value = UPS_Constant_Table[index].ltr3_high_value;
+  false_easting   = UPS_Constant_Table[index].false_easting;
+  false_northing  = UPS_Constant_Table[index].false_northing;
+
+  /* Check that the second letter of the string is within
+   * the range of valid second letter values
+   * Also check that the third letter is valid */
+  if ((letters[1] < ltr2_low_value) || (letters[1] > ltr2_high_value) ||
+      ((letters[1] == LETTER_D) || (letters[1] == LETTER_E)  ||
+      ( letters[1] == LETTER_M) || (letters[1] == LETTER_N)  ||
+      ( letters[1] == LETTER_V) || (letters[1] == LETTER_W)) ||
+      ( letters[2] > ltr3_high_value))
+    throw CoordinateConversionException( Grid::stringError() );
+
+  grid_northing = (double)letters[2] * ONEHT + false_northing;
+  if (letters[2] > LETTER_I)
+    grid_northing = grid_northing - ONEHT;
+
+  if (letters[2] > LETTER_O)
+    grid_northing = grid_northing - ONEHT;
+
+  grid_easting = (double)((letters[1]) - ltr2_low_value) *ONEHT + false_easting;
+  if (ltr2_low_value != LETTER_A)
+  {
+    if (letters[1] > LETTER_L)
+      grid_easting = grid_easting - 300000.0;
+
+    if (letters[1] > LETTER_U)
+      grid_easting = grid_easting - 200000.0;
+  }
+  else
+  {
+    if (letters[1] > LETTER_C)
+      grid_easting = grid_easting - 200000.0;
+
+    if (letters[1] > LETTER_I)
+      grid_easting = grid_easting - ONEHT;
+
+    if (letters[1] > LETTER_L)
+      grid_easting = grid_easting - 300000.0;
+  }
+
+  easting = grid_easting + easting;
+  northing = grid_northing + northing;
+
+  return new UPSCoordinates(
+    CoordinateType::universalPolarStereographic, hemisphere, easting, northing);
+}
+
+
+template< class Grid >
+long GridReference< Grid >::enumerateSquares(
+   double westLongitude,
+   double southLatitude,
+   double eastLongitude,
+   double northLatitude,
+   long   precision,
+   char*  strings,
+   long   maxStrings )
+{
+/*
+ * The function enumerateSquares writes the coordinate strings of the
+ * squares covering the UTM part of an area, zone by zone within each
+ * latitude band, and returns their number.
+ *
+ *    westLongitude : West edge in radians                  (input)
+ *    southLatitude : South edge in radians                 (input)
+ *    eastLongitude : East edge in radians                  (input)
+ *    northLatitude : North edge in radians                 (input)
+ *    precision     : Precision level of the strings        (input)
+ *    strings       : Coordinate strings                   (output)
+ *    maxStrings    : Number of strings that fit           (input)
+ */
+
+  double span_west[2];
+  double span_east[2];
+  long spans = 1;
+  long count = 0;
+
+  if ((southLatitude < -PI_OVER_2) || (northLatitude > PI_OVER_2) ||
+      (southLatitude > northLatitude))
+    throw CoordinateConversionException( ErrorMessages::latitude );
+  if ((westLongitude < -PI) || (westLongitude > 2*PI) ||
+      (eastLongitude < -PI) || (eastLongitude > 2*PI))
+    throw CoordinateConversionException( ErrorMessages::longitude );
+  if ((precision < 0) || (precision > MAX_PRECISION))
+    throw CoordinateConversionException( ErrorMessages::precision );
+
+  // The area runs east from its west edge, across 180 degrees if its east
+  // edge is west of its west edge; it is split there into two spans, the
+  // second from 180 degrees W, which is also that of an area ending at
+  // 180 degrees E
+  double width = eastLongitude - westLongitude;
+  if (width < 0.0)
+    width += 2*PI;
+  span_west[0] = westLongitude;
+  if (span_west[0] >= PI)
+    span_west[0] -= 2*PI;
+  if (width >= 2*PI)
+  {
+    span_west[0] = -PI;
+    width = 2*PI;
+  }
+  span_east[0] = span_west[0] + width;
+  if (span_east[0] >= PI)
+  {
+    span_west[1] = -PI;
+    span_east[1] = span_east[0] - 2*PI;
+    span_east[0] = PI;
+    spans = 2;
+  }
+
+  for (long band = 0; band < 20; band++)
+  {
+    long letter = Latitude_Band_Table[band].letter;
+    double band_south = Latitude_Band_Table[band].south * PI_OVER_180;
+    double band_north = Latitude_Band_Table[band].north * PI_OVER_180;
+    if (band_south < MIN_NON_POLAR_LAT)
+      band_south = MIN_NON_POLAR_LAT;
+    if (band_north > MAX_NON_POLAR_LAT)
+      band_north = MAX_NON_POLAR_LAT;
+
+    double south = (southLatitude > band_south) ? southLatitude : band_south;
+    double north = band_north - AREA_CELL_EDGE;
+    if (northLatitude < north)
+      north = northLatitude;
+    if (south > north)
+      continue;
+
+    for (long zone = 1; zone <= 60; zone++)
+    {
+      double zone_west;
+      double zone_east;
+      if (!getZoneLongitudes( zone, letter, &zone_west, &zone_east ))
+        continue;
+
+      for (long span = 0; span < spans; span++)
+      {
+        double west = (span_west[span] > zone_west) ? span_west[span] : zone_west;
+        double east = zone_east - AREA_CELL_EDGE;
+        if (span_east[span] < east)
+          east = span_east[span];
+        if (west > east)
+          continue;
+
+        count += enumerateZoneSquares( zone, letter, west, south, east,
+           north, precision, strings, maxStrings, count );
+      }
+    }
+  }
+
+  return count;
+}
+
+
+template< class Grid >
+long GridReference< Grid >::enumerateZoneSquares(
+   long   zone,
+   long   letter,
+   double west,
+   double south,
+   double east,
+   double north,
+   long   precision,
+   char*  strings,
+   long   maxStrings,
+   long   written )
+{
+/*
+ * The function enumerateZoneSquares writes the coordinate strings of the
+ * squares covering an area within one zone and latitude band, after the
+ * written strings, and returns their number.  The squares crossed by the
+ * edges of the area are found from points along them, at most half a
+ * square apart; the squares within it from the square corners inside it.
+ *
+ *    zone          : UTM zone                              (input)
+ *    letter        : Latitude band letter                  (input)
+ *    west          : West edge in radians                  (input)
+ *    south         : South edge in radians                 (input)
+ *    east          : East edge in radians                  (input)
+ *    north         : North edge in radians                 (input)
+ *    precision     : Precision level of the strings        (input)
+ *    strings       : Coordinate strings                   (output)
+ *    maxStrings    : Number of strings that fit           (input)
+ *    written       : Number of strings already written    (input)
+ */
+
+  double size = computeScale( precision );
+  bool southern = (letter < LETTER_N);
+  long i, row, column;
+
+  /* Points along the edges of the area */
+  double step = size / (2.0 * WGS84_SEMI_MAJOR_AXIS);
+  long across = (long)((east - west) / step) + 2;
+  long up = (long)((north - south) / step) + 2;
+  long num = 2 * (across + up);
+
+  std::vector<double>      longitude( num );
+  std::vector<double>      latitude( num );
+  std::vector<long>        zones( num, zone );
+  std::vector<char>        hemisphere( num );
+  std::vector<double>      easting( num );
+  std::vector<double>      northing( num );
+  std::vector<const char*> error( num );
+
+  for (i = 0; i < across; i++)
+  {
+    double lon = west + (east - west) * i / (across - 1);
+    longitude[2*i] = lon;
+    latitude[2*i] = south;
+    longitude[2*i + 1] = lon;
+    latitude[2*i + 1] = north;
+  }
+  for (i = 0; i < up; i++)
+  {
+    double lat = south + (north - south) * i / (up - 1);
+    longitude[2*(across + i)] = west;
+    latitude[2*(across + i)] = lat;
+    longitude[2*(across + i) + 1] = east;
+    latitude[2*(across + i) + 1] = lat;
+  }
+
+  utm->convertFromGeodeticInZones( num, &longitude[0], &latitude[0],
+     &zones[0], &hemisphere[0], &easting[0], &northing[0], &error[0] );
+
+  /* Northings run on from the southern hemisphere's, below 0 */
+  double min_x = 0.0, max_x = 0.0, min_y = 0.0, max_y = 0.0;
+  bool found = false;
+  for (i = 0; i < num; i++)
+  {
+    if (error[i])
+      continue;
+    if (hemisphere[i] == 'S')
+      northing[i] -= MAX_NORTHING;
+    if (!found || (easting[i] < min_x))
+      min_x = easting[i];
+    if (!found || (easting[i] > max_x))
+      max_x = easting[i];
+    if (!found || (northing[i] < min_y))
+      min_y = northing[i];
+    if (!found || (northing[i] > max_y))
+      max_y = northing[i];
+    found = true;
+  }
+  if (!found)
+    return 0;
+
+  /* Squares around the points, with a square more on each side */
+  long first_column = (long)floor( min_x / size ) - 1;
+  long first_row = (long)floor( min_y / size ) - 1;
+  long last_row = (long)floor( max_y / size ) + 1;
+  long columns = (long)floor( max_x / size ) + 2 - first_column;
+  if (southern && (last_row > -1))
+    last_row = -1;
+  if (!southern && (first_row < 0))
+    first_row = 0;
+  long rows = last_row - first_row + 1;
+  if (rows <= 0)
+    return 0;
+
+  std::vector<char> covered( rows * columns, 0 );
+
+  for (i = 0; i < num; i++)
+  {
+    if (error[i])
+      continue;
+    column = (long)floor( easting[i] / size ) - first_column;
+    row = (long)floor( northing[i] / size ) - first_row;
+    if ((row >= 0) && (row < rows))
+      covered[row * columns + column] = 1;
+  }
+
+  /* Square corners inside the area, a row at a time */
+  zones.resize( columns );
+  hemisphere.resize( columns );
+  easting.resize( columns );
+  northing.resize( columns );
+  longitude.resize( columns );
+  latitude.resize( columns );
+  error.resize( columns );
+  for (row = 1; row < rows; row++)
+  {
+    double y = (first_row + row) * size;
+    for (column = 0; column < columns; column++)
+    {
+      hemisphere[column] = (y < 0.0) ? 'S' : 'N';
+      easting[column] = (first_column + column) * size;
+      northing[column] = (y < 0.0) ? y + MAX_NORTHING : y;
+    }
+
+    utm->convertToGeodeticBatch( columns, &zones[0], &hemisphere[0],
+       &easting[0], &northing[0], &longitude[0], &latitude[0], &error[0] );
+
+    for (column = 1; column < columns; column++)
+    {
+      if (!error[column] &&
+          (longitude[column] >= west) && (longitude[column] <= east) &&
+          (latitude[column] >= south) && (latitude[column] <= north))
+      {
+        covered[(row - 1) * columns + column - 1] = 1;
+        covered[(row - 1) * columns + column] = 1;
+        covered[row * columns + column - 1] = 1;
+        covered[row * columns + column] = 1;
+      }
+    }
+  }
+
+  long count = 0;
+  for (row = 0; row < rows; row++)
+  {
+    double y = (first_row + row) * size;
+    for (column = 0; column < columns; column++)
+    {
+      if (!covered[row * columns + column])
+        continue;
+      if (written + count < maxStrings)
+      {
+        makeUTMString( zone, (int)letter, south,
+           (first_column + column) * size,
+           (y < 0.0) ? y + MAX_NORTHING : y, precision,
+           strings + (written + count) * GRID_REFERENCE_STRING_SIZE );
+      }
+      count++;
+    }
+  }
+
+  return count;
+}
+
+
+template< class Grid >
+void GridReference< Grid >::getGridValues(
+   long    zone,
+   long*   ltr2_low_value,
+   long*   ltr2_high_value,
+   double* pattern_offset )
+{
+/*
+ * The function getGridValues sets the letter range used for
+ * the 2nd letter in the coordinate string, based on the set
+ * number of the utm zone. It also sets the pattern offset using a
+ * value of A for the second letter of the grid square, based on
+ * the grid pattern and set number of the utm zone.
+ *
+ *    zone            : Zone number             (input)
+ *    ltr2_low_value  : 2nd letter low number   (output)
+ *    ltr2_high_value : 2nd letter high number  (output)
+ *    pattern_offset  : Pattern offset          (output)
+ */
+
+  long set_number;    /* Set number (1-6) based on UTM zone number */
+
+  set_number = zone % 6;
+
+  if (!set_number)
+    set_number = 6;
+
+  if ((set_number == 1) || (set_number == 4))
+  {
+     *ltr2_low_value  = LETTER_A;
+     *ltr2_high_value = LETTER_H;
+  }
+  else if ((set_number == 2) || (set_number == 5))
+  {
+     *ltr2_low_value  = LETTER_J;
+     *ltr2_high_value = LETTER_R;
+  }
+  else if ((set_number == 3) || (set_number == 6))
+  {
+     *ltr2_low_value  = LETTER_S;
+     *ltr2_high_value = LETTER_Z;
+  }
+
+  /* False northing at A for second letter of grid square */
+  if (aaPattern)
+  {
+     if ((set_number % 2) ==  0)
+        *pattern_offset = 500000.0;
+     else
+        *pattern_offset = 0.0;
+  }
+  else
+  {
+     if ((set_number % 2) == 0)
+        *pattern_offset =  1500000.0;
+     else
+        *pattern_offset = 1000000.00;
+  }
+}
+
+
+/* The grid references of MGRS and USNG */
+template class MSP::CCS::GridReference< MSP::CCS::MGRSGrid >;
+template class MSP::CCS::GridReference< MSP::CCS::USNGGrid >;
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,416 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef GridReference_H
+#define GridReference_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Grid Reference
+ *
+ * ABSTRACT
+ *
+ *    This component converts between geodetic, UTM and UPS coordinates and
+ *    the coordinate strings of MGRS and USNG, which share their latitude
+ *    bands, 100,000 meter square letters and polar letters.  It is the
+ *    implementation of both MGRS and USNG: a class template whose
+ *    parameter, MGRSGrid or USNGGrid, gives at compile time the rules in
+ *    which the two differ:
+ *
+ *       - rounding of eastings and northings to the string precision
+ *       - tolerances at the longitude range and polar region limits
+ *       - letter pattern of the Clarke and Bessel ellipsoids (MGRS only)
+ *       - points outside their latitude band (MGRS accepts the adjacent
+ *         bands, USNG any band, both with a warning)
+ *       - spaces within strings (skipped by MGRS)
+ *       - error message, coordinate type and precision of strings
+ *
+ *    The UTM and UPS projections are shared by all grid references on the
+ *    same ellipsoid, MGRS and USNG alike, and deleted with the last one.
+ *
+ * ERROR HANDLING
+ *
+ *    Errors throw CoordinateConversionException with a description of the
+ *    error.  The batch conversions report them through status arrays, as
+ *    for CoordinateSystem's batch conversions.
+ *
+ * REUSE NOTES
+ *
+ *    GridReference is used through MGRS and USNG, which check the
+ *    ellipsoid parameters before they make one.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code, from the implementations of MGRS and USNG
+ *    10-19-26    Added enumeration of the squares covering an area
+ */
+
+
+#include "CoordinateType.h"
+#include "Precision.h"
+#include "ErrorMessages.h"
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class UPS;
+    class UTM;
+    class MGRSorUSNGCoordinates;
+    class GeodeticCoordinates;
+    class UPSCoordinates;
+    class UTMCoordinates;
+    class GridReferenceProjections;
+
+    #define GRID_REFERENCE_LETTERS 3
+
+
+    /*
+     * Rules of MGRS
+     */
+
+    struct MGRSGrid
+    {
+      static CoordinateType::Enum coordinateType()
+      {
+        return CoordinateType::militaryGridReferenceSystem;
+      }
+
+      static const char* stringError() { return ErrorMessages::mgrsString; }
+
+      static Precision::Enum stringPrecision( long precision )
+      {
+        return Precision::toPrecision( precision );
+      }
+
+      /* Added to eastings and northings before they are truncated */
+      static double roundingPad() { return 4.99e-4; }
+
+      /* Widening of the longitude range and of the non polar latitude
+         range of geodetic coordinates, in radians (about 1 meter) */
+      static double geodeticBorder() { return 1.75e-7; }
+
+      /* Widening of the polar regions for UPS coordinates, in radians */
+      static double upsPolarBorder() { return -1.75e-7; }
+
+      /* Clarke and Bessel ellipsoids use the AL letter pattern */
+      static bool ellipsoidPattern() { return true; }
+
+      /* Points outside their latitude band must be in an adjacent band */
+      static bool adjacentBands() { return true; }
+
+      /* The latitude band warning is passed on to geodetic coordinates */
+      static bool geodeticWarning() { return true; }
+
+      /* Spaces within strings are skipped */
+      static bool ignoreSpaces() { return true; }
+    };
+
+
+    /*
+     * Rules of USNG
+     */
+
+    struct USNGGrid
+    {
+      static CoordinateType::Enum coordinateType()
+      {
+        return CoordinateType::usNationalGrid;
+      }
+
+      static const char* stringError() { return ErrorMessages::usngString; }
+
+      static Precision::Enum stringPrecision( long )
+      {
+        return Precision::tenthOfSecond;
+      }
+
+      static double roundingPad() { return 0.0; }
+
+      static double geodeticBorder() { return 0.0; }
+
+      static double upsPolarBorder() { return 1.75e-7; }
+
+      static bool ellipsoidPattern() { return false; }
+
+      static bool adjacentBands() { return false; }
+
+      static bool geodeticWarning() { return false; }
+
+      static bool ignoreSpaces() { return false; }
+    };
+
+
+    template< class Grid >
+    class GridReference
+    {
+    public:
+
+      /*
+       * The constructor receives the ellipsoid parameters, which must be
+       * valid, and shares the UTM and UPS projections of that ellipsoid.
+       *
+       *   ellipsoidSemiMajorAxis : Semi-major axis of ellipsoid (m)    (input)
+       *   ellipsoidFlattening    : Flattening of ellipsoid             (input)
+       *   ellipsoidCode          : 2-letter code for ellipsoid         (input)
+       */
+
+      GridReference(
+         double      ellipsoidSemiMajorAxis,
+         double      ellipsoidFlattening,
+         const char* ellipsoidCode );
+
+
+      GridReference( const GridReference &g );
+
+
+      ~GridReference( void );
+
+
+      GridReference& operator=( const GridReference &g );
+
+
+      /*
+       * The conversions below are those of MGRS and USNG, which document
+       * them.
+       */
+
+      MGRSorUSNGCoordinates* convertFromGeodetic(
+         GeodeticCoordinates* geodeticCoordinates, long precision );
+
+      GeodeticCoordinates* convertToGeodetic(
+         MGRSorUSNGCoordinates* mgrsorUSNGCoordinates );
+
+      MGRSorUSNGCoordinates* convertFromUTM(
+         UTMCoordinates* utmCoordinates, long precision );
+
+      UTMCoordinates* convertToUTM(
+         MGRSorUSNGCoordinates* mgrsorUSNGCoordinates );
+
+      MGRSorUSNGCoordinates* convertFromUPS(
+         UPSCoordinates* upsCoordinates, long precision );
+
+      UPSCoordinates* convertToUPS(
+         MGRSorUSNGCoordinates* mgrsorUSNGCoordinates );
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         long          precision,
+         char*         strings,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const char*   strings,
+         double*       longitudes,
+         double*       latitudes,
+         const char**  status );
+
+      long enumerateSquares(
+         double westLongitude,
+         double southLatitude,
+         double eastLongitude,
+         double northLatitude,
+         long   precision,
+         char*  strings,
+         long   maxStrings );
+
+    private:
+
+      GridReferenceProjections* projections;
+
+      UPS* ups;
+      UTM* utm;
+
+      /* Letter pattern of the 100,000 meter squares: AA, or AL for the
+         Clarke and Bessel ellipsoids in MGRS */
+      bool aaPattern;
+
+
+      /*
+       * The function fromUTM calculates a coordinate string based on the
+       * zone, latitude, easting and northing.
+       *
+       *    utmCoordinates : UTM coordinates          (input)
+       *    longitude      : Longitude in radians     (input)
+       *    latitude       : Latitude in radians      (input)
+       *    precision      : Precision                (input)
+       */
+
+      MGRSorUSNGCoordinates* fromUTM(
+         UTMCoordinates* utmCoordinates,
+         double          longitude,
+         double          latitude,
+         long            precision );
+
+
+      /*
+       * The function toUTM converts the parts of a coordinate string in a
+       * UTM zone to UTM coordinates, with a warning if the point is
+       * outside its latitude band.  If any errors occur, an exception is
+       * thrown with a description of the error.
+       *
+       *    zone       : Zone number                     (input)
+       *    letters    : Coordinate string letters       (input)
+       *    easting    : Easting within the square       (input)
+       *    northing   : Northing within the square      (input)
+       *    precision  : Precision                       (input)
+       */
+
+      UTMCoordinates* toUTM(
+         long   zone,
+         long   letters[GRID_REFERENCE_LETTERS],
+         double easting,
+         double northing,
+         long   precision );
+
+
+      /*
+       * The function makeUTMString makes the coordinate string of UTM
+       * coordinates in the zone of the point's grid.
+       *
+       *    zone       : Zone number                      (input)
+       *    band       : Latitude band letter             (input)
+       *    latitude   : Latitude in radians              (input)
+       *    easting    : Easting                          (input)
+       *    northing   : Northing                         (input)
+       *    precision  : Precision                        (input)
+       *    string     : Coordinate string               (output)
+       */
+
+      void makeUTMString(
+         long   zone,
+         int    band,
+         double latitude,
+         double easting,
+         double northing,
+         long   precision,
+         char*  string );
+
+
+      /*
+       * The function gridToUTM computes the UTM coordinates of the parts
+       * of a coordinate string in a UTM zone.  If the letters are not
+       * valid, an exception is thrown.
+       *
+       *    zone         : Zone number                    (input)
+       *    letters      : Coordinate string letters      (input)
+       *    easting      : Easting within the square      (input)
+       *    northing     : Northing within the square     (input)
+       *    hemisphere   : North or South hemisphere     (output)
+       *    utmEasting   : Easting (X) in meters         (output)
+       *    utmNorthing  : Northing (Y) in meters        (output)
+       */
+
+      void gridToUTM(
+         long   zone,
+         long   letters[GRID_REFERENCE_LETTERS],
+         double easting,
+         double northing,
+         char   &hemisphere,
+         double &utmEasting,
+         double &utmNorthing );
+
+
+      /*
+       * The function checkLatitudeBand checks that the latitude of a point
+       * is in its latitude band, give or take the precision of the string.
+       * It returns 0, or a warning if the point is in another band that
+       * the grid accepts; otherwise an exception is thrown.
+       *
+       *    letter     : Latitude band letter             (input)
+       *    latitude   : Latitude in radians              (input)
+       *    precision  : Precision                        (input)
+       */
+
+      const char* checkLatitudeBand(
+         long letter, double latitude, long precision );
+
+
+      /*
+       * The function fromUPS converts UPS (hemisphere, easting, and
+       * northing) coordinates to a coordinate string.
+       *
+       *    upsCoordinates : UPS coordinates              (input)
+       *    precision      : Precision                    (input)
+       */
+
+      MGRSorUSNGCoordinates* fromUPS(
+         UPSCoordinates* upsCoordinates, long precision );
+
+
+      /*
+       * The function toUPS converts the polar parts of a coordinate string
+       * to UPS (hemisphere, easting, and northing) coordinates.  If the
+       * letters are not valid, an exception is thrown.
+       *
+       *    letters    : Coordinate string letters       (input)
+       *    easting    : Easting within the square       (input)
+       *    northing   : Northing within the square      (input)
+       */
+
+      UPSCoordinates* toUPS(
+         long letters[GRID_REFERENCE_LETTERS],
+         double easting,
+         double northing );
+
+
+      /*
+       * The function enumerateZoneSquares writes the strings of the
+       * squares covering an area within one zone and latitude band, after
+       * the strings already written, and returns their number.
+       *
+       *    zone       : UTM zone                          (input)
+       *    letter     : Latitude band letter              (input)
+       *    west       : West edge in radians              (input)
+       *    south      : South edge in radians             (input)
+       *    east       : East edge in radians              (input)
+       *    north      : North edge in radians             (input)
+       *    precision  : Precision                         (input)
+       *    strings    : Coordinate strings               (output)
+       *    maxStrings : Number of strings that fit        (input)
+       *    written    : Number of strings written         (input)
+       */
+
+      long enumerateZoneSquares(
+         long   zone,
+         long   letter,
+         double west,
+         double south,
+         double east,
+         double north,
+         long   precision,
+         char*  strings,
+         long   maxStrings,
+         long   written );
+
+
+      /*
+       * The function getGridValues sets the letter range used for the 2nd
+       * letter in the coordinate string, based on the set number of the
+       * utm zone. It also sets the pattern offset using a value of A for
+       * the second letter of the grid square, based on the grid pattern
+       * and set number of the utm zone.
+       *
+       *    zone            : Zone number             (input)
+       *    ltr2_low_value  : 2nd letter low number   (output)
+       *    ltr2_high_value : 2nd letter high number  (output)
+       *    pattern_offset  : Pattern offset          (output)
+       */
+
+      void getGridValues(
+         long    zone,
+         long*   ltr2_low_value,
+         long*   ltr2_high_value,
+         double* pattern_offset );
+    };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,284 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Grid Reference String
+ *
+ * ABSTRACT
+ *
+ *    This component builds and breaks down MGRS and USNG coordinate
+ *    strings in caller supplied buffers, without sprintf, sscanf or the
+ *    ctype functions.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code
+ */
+
+#include "GridReferenceString.h"
+
+
+using namespace MSP::CCS;
+
+
+/***************************************************************************/
+/*
+ *                              DEFINES
+ */
+
+#define SP   36   /* space                        */
+#define XX   37   /* not a digit, letter or space */
+#define LETTER_A   10
+#define LETTER_I   ( LETTER_A + 8 )
+#define LETTER_O   ( LETTER_A + 14 )
+#define LETTER_Z   ( LETTER_A + 25 )
+
+namespace
+{
+  /* Code of each character: 0-9 for digits, 10-35 for letters of either
+     case, SP for a space and XX for any other character */
+  const unsigned char characterCode[256] = {
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   SP, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9, XX, XX, XX, XX, XX, XX,
+   XX, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+   25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, XX, XX, XX, XX, XX,
+   XX, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+   25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+   XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX
+  };
+
+  const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const char digitCharacters[] = "0123456789";
+
+
+  /* Index of the next character to read after index i */
+  long nextCharacter( const unsigned char* string, long i, bool ignoreSpaces )
+  {
+    if( ignoreSpaces )
+    {
+      while( characterCode[string[i]] == SP )
+        i++;
+    }
+    return i;
+  }
+}
+
+
+/************************************************************************/
+/*                              FUNCTIONS
+ *
+ */
+
+long GridReferenceString::encode(
+   char*      string,
+   long       zone,
+   const int* letters,
+   long       east,
+   long       north,
+   long       precision )
+{
+/*
+ * The function encode writes a coordinate string and returns its length.
+ *
+ *    string     : Coordinate string                        (output)
+ *    zone       : UTM zone, or 0 for UPS                    (input)
+ *    letters    : Alphabet positions of the 3 letters       (input)
+ *    east       : Easting in units of the precision         (input)
+ *    north      : Northing in units of the precision        (input)
+ *    precision  : Number of digits of east and north, 0-5   (input)
+ */
+
+  char* end = string;
+
+  if( zone )
+    end = putNumber( end, zone, 2 );
+
+  *end++ = alphabet[letters[0]];
+  *end++ = alphabet[letters[1]];
+  *end++ = alphabet[letters[2]];
+
+  end = putNumber( end, east, precision );
+  end = putNumber( end, north, precision );
+  *end = '\0';
+
+  return end - string;
+}
+
+
+bool GridReferenceString::decode(
+   const char* string,
+   bool        ignoreSpaces,
+   long        &zone,
+   long*       letters,
+   long        &east,
+   long        &north,
+   long        &precision )
+{
+/*
+ * The function decode breaks down a coordinate string and returns true,
+ * or false if the string is not valid.
+ *
+ *    string       : Coordinate string                       (input)
+ *    ignoreSpaces : Skip spaces within the string           (input)
+ *    zone         : UTM zone, or 0 if none                 (output)
+ *    letters      : Alphabet positions of the 3 letters    (output)
+ *    east         : Easting in units of the precision      (output)
+ *    north        : Northing in units of the precision     (output)
+ *    precision    : Number of digits of east and north     (output)
+ */
+
+  const unsigned char* s = (const unsigned char*)string;
+  unsigned char code;
+  unsigned char numbers[10];
+  long num_digits;
+  long num_letters;
+  long i = 0;
+  long n;
+
+  if( ignoreSpaces )
+  {
+    for( i = 0; s[i]; i++ )
+    {
+      if( characterCode[s[i]] == XX )
+        return false;
+    }
+    i = 0;
+  }
+
+  while( characterCode[s[i]] == SP )
+    i++;  /* skip any leading blanks */
+
+  /* get zone */
+  zone = 0;
+  for( num_digits = 0; ( code = characterCode[s[i]] ) < LETTER_A; num_digits++ )
+  {
+    if( num_digits < 2 )
+      zone = zone * 10 + code;
+    i = nextCharacter( s, i + 1, ignoreSpaces );
+  }
+  if( num_digits > 2 )
+    return false;
+  if( ( num_digits > 0 ) && ( ( zone < 1 ) || ( zone > 60 ) ) )
+    return false;
+
+  /* get letters */
+  for( num_letters = 0; ( ( code = characterCode[s[i]] ) >= LETTER_A ) &&
+       ( code <= LETTER_Z ); num_letters++ )
+  {
+    if( num_letters < 3 )
+    {
+      if( ( code == LETTER_I ) || ( code == LETTER_O ) )
+        return false;
+      letters[num_letters] = code - LETTER_A;
+    }
+    i = nextCharacter( s, i + 1, ignoreSpaces );
+  }
+  if( num_letters != 3 )
+    return false;
+
+  /* get easting & northing */
+  for( num_digits = 0; ( code = characterCode[s[i]] ) < LETTER_A; num_digits++ )
+  {
+    if( num_digits < 10 )
+      numbers[num_digits] = code;
+    i = nextCharacter( s, i + 1, ignoreSpaces );
+  }
+  if( ( num_digits > 10 ) || ( num_digits % 2 != 0 ) )
+    return false;
+
+  precision = num_digits / 2;
+  east = 0;
+  north = 0;
+  for( n = 0; n < precision; n++ )
+  {
+    east  = east  * 10 + numbers[n];
+    north = north * 10 + numbers[precision + n];
+  }
+
+  return true;
+}
+
+
+void GridReferenceString::encodeBatch(
+   long        count,
+   const long* zones,
+   const int*  letters,
+   const long* easts,
+   const long* norths,
+   long        precision,
+   char*       strings,
+   long        stride )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    encode( strings + i * stride, zones[i], letters + 3 * i,
+       easts[i], norths[i], precision );
+  }
+}
+
+
+void GridReferenceString::decodeBatch(
+   long        count,
+   const char* strings,
+   long        stride,
+   bool        ignoreSpaces,
+   long*       zones,
+   long*       letters,
+   long*       easts,
+   long*       norths,
+   long*       precisions )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    if( !decode( strings + i * stride, ignoreSpaces, zones[i],
+           letters + 3 * i, easts[i], norths[i], precisions[i] ) )
+      precisions[i] = -1;
+  }
+}
+
+
+char* GridReferenceString::putNumber( char* string, long value, long digits )
+{
+/*
+ * The function putNumber writes value with at least digits digits,
+ * padded with leading zeros, as "%*.*ld" does, and returns the end of the
+ * number.  A value of 0 with 0 digits writes nothing.
+ */
+
+  char reversed[24];
+  int num = 0;
+  unsigned long magnitude = value;
+
+  if( value < 0 )
+  {
+    magnitude = 0UL - magnitude;
+    *string++ = '-';
+  }
+
+  while( magnitude > 0 )
+  {
+    reversed[num++] = digitCharacters[magnitude % 10];
+    magnitude /= 10;
+  }
+
+  for( long i = num; i < digits; i++ )
+    *string++ = '0';
+
+  while( num > 0 )
+    *string++ = reversed[--num];
+
+  return string;
+}
+
+
+// CLASSIFICATION: UNCLASSIFIED
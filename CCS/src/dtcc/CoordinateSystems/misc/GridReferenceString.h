@@ -0,0 +1,148 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef GridReferenceString_H
+#define GridReferenceString_H
+
+/***************************************************************************/
+/* RSC IDENTIFIER: Grid Reference String
+ *
+ * ABSTRACT
+ *
+ *    This component builds and breaks down the coordinate strings of MGRS
+ *    and USNG: a zone of up to two digits (none in the polar regions),
+ *    three letters, and an easting and a northing of precision digits
+ *    each.
+ *
+ *    Strings are written to and read from caller supplied buffers of
+ *    GRID_REFERENCE_STRING_SIZE characters.  Characters are classified
+ *    and converted through tables, so the results do not depend on the
+ *    locale, and nothing is allocated.
+ *
+ * ERROR HANDLING
+ *
+ *    decode returns false if a string is not valid; the caller throws its
+ *    own error message.  Nothing is thrown.
+ *
+ * REUSE NOTES
+ *
+ *    Rounding the easting and northing to precision digits is left to the
+ *    caller, since MGRS and USNG round differently.
+ *
+ * MODIFICATIONS
+ *
+ *    Date        Description
+ *    ----        -----------
+ *    10-19-26    Original Code, replacing the sprintf and sscanf based
+ *                string handling of MGRS and USNG
+ */
+
+#include "DtccApi.h"
+
+
+/* Characters of a string buffer, including the terminating null */
+#define GRID_REFERENCE_STRING_SIZE 21
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class MSP_DTCC_API GridReferenceString
+    {
+    public:
+
+      /*
+       * The function encode writes a coordinate string and returns its
+       * length.  Each of east and north is written with precision digits,
+       * with leading zeros.
+       *
+       *    string     : Coordinate string                        (output)
+       *    zone       : UTM zone, or 0 for UPS                    (input)
+       *    letters    : Alphabet positions of the 3 letters       (input)
+       *    east       : Easting in units of the precision         (input)
+       *    north      : Northing in units of the precision        (input)
+       *    precision  : Number of digits of east and north, 0-5   (input)
+       */
+
+      static long encode(
+         char*      string,
+         long       zone,
+         const int* letters,
+         long       east,
+         long       north,
+         long       precision );
+
+
+      /*
+       * The function decode breaks down a coordinate string and returns
+       * true, or false if the string is not valid.  Leading blanks are
+       * skipped.  With ignoreSpaces, as for MGRS, spaces anywhere in the
+       * string are skipped and any other character that is not a letter or
+       * digit makes the string invalid.  Characters after the easting and
+       * northing are not read.
+       *
+       *    string       : Coordinate string                       (input)
+       *    ignoreSpaces : Skip spaces within the string           (input)
+       *    zone         : UTM zone, or 0 if none                 (output)
+       *    letters      : Alphabet positions of the 3 letters    (output)
+       *    east         : Easting in units of the precision      (output)
+       *    north        : Northing in units of the precision     (output)
+       *    precision    : Number of digits of east and north     (output)
+       */
+
+      static bool decode(
+         const char* string,
+         bool        ignoreSpaces,
+         long        &zone,
+         long*       letters,
+         long        &east,
+         long        &north,
+         long        &precision );
+
+
+      /*
+       * The function encodeBatch writes count coordinate strings, stride
+       * characters apart, from arrays of their parts, as encode does.
+       * letters holds 3 letters per string.
+       */
+
+      static void encodeBatch(
+         long        count,
+         const long* zones,
+         const int*  letters,
+         const long* easts,
+         const long* norths,
+         long        precision,
+         char*       strings,
+         long        stride );
+
+
+      /*
+       * The function decodeBatch breaks down count coordinate strings,
+       * stride characters apart, into arrays of their parts, as decode
+       * does.  letters receives 3 letters per string.  The precision of a
+       * string that is not valid is set to -1.
+       */
+
+      static void decodeBatch(
+         long        count,
+         const char* strings,
+         long        stride,
+         bool        ignoreSpaces,
+         long*       zones,
+         long*       letters,
+         long*       easts,
+         long*       norths,
+         long*       precisions );
+
+    private:
+
+      static char* putNumber( char* string, long value, long digits );
+    };
+  }
+}
+
+#endif
+
+
+// CLASSIFICATION: UNCLASSIFIED
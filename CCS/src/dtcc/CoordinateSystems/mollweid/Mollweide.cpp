@@ -71,6 +71,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions seed Newton's method from a
+ *                      table, with a fixed number of iterations
  *
  */
 
@@ -111,6 +113,50 @@ const double PI_OVER_2 = ( PI / 2.0);
 const double MAX_LAT = ( (PI * 90) / 180.0 ); /* 90 degrees in radians  */
 const double TWO_PI = (2.0 * PI);                  
 
+const int MOLL_SEEDS = 32;                /* Intervals of the seed table      */
+const int MOLL_ITERATIONS = 3;            /* Newton iterations of the batch   */
+const double MOLL_SERIES_LIMIT = 1.0e-3;  /* Cube root of 1 - sin(latitude)
+                                             below which the batch uses a
+                                             series                          */
+
+
+namespace
+{
+  /*
+   * The seeds of the batch conversion from geodetic.  For w, the cube root
+   * of 1 - sin(|latitude|), the half angle h = (PI - theta_primed) / 2
+   * solves 2h - sin(2h) = PI * w^3.  Unlike theta_primed as a function of
+   * latitude, h is smooth in w up to the poles, so it interpolates well.
+   * Node k holds h for w = k / MOLL_SEEDS, found by bisection.
+   */
+  struct MollweideSeeds
+  {
+    double h[MOLL_SEEDS + 1];
+
+    MollweideSeeds()
+    {
+      for( int k = 0; k <= MOLL_SEEDS; k++ )
+      {
+        double w = (double)k / MOLL_SEEDS;
+        double c = PI * w * w * w;
+        double low = 0.0;
+        double high = PI_OVER_2;
+        for( int n = 0; n < 64; n++ )
+        {
+          double mid = (low + high) / 2.0;
+          if( 2.0 * mid - sin(2.0 * mid) > c )
+            high = mid;
+          else
+            low = mid;
+        }
+        h[k] = (low + high) / 2.0;
+      }
+    }
+  };
+
+  const MollweideSeeds mollweideSeeds;
+}
+
 
 /************************************************************************/
 /*                              FUNCTIONS     
@@ -343,24 +389,142 @@ MSP::CCS::GeodeticCoordinates* Mollweide::convertToGeodetic( MSP::CCS::MapProjec
  *    latitude          : Latitude (phi) in radians              (output)
  */
 
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void Mollweide::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+/*
+ * Instead of iterating each point to a tolerance as convertFromGeodetic
+ * does, the batch takes MOLL_ITERATIONS Newton steps in the half angle h
+ * (see MollweideSeeds) from a seed interpolated in mollweideSeeds, so
+ * every point costs the same.  Where w is below MOLL_SERIES_LIMIT, near the
+ * poles, h is given by the leading terms of its series in w.  The results
+ * agree with convertFromGeodetic to well within a millimeter, except near
+ * the poles, where round off slows its iteration and the batch is the more
+ * accurate.
+ */
+
+  const double Easting_Scale = Sqrt8_Ra / PI;
+  const double Series_Scale = pow(6.0 * PI, 1.0 / 3.0);
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude = latitudes[i];
+    status[i] = 0;
+    if( z )
+      z[i] = 0.0;
+
+    if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
+    {  /* Latitude out of range */
+      status[i] = ErrorMessages::latitude;
+      continue;
+    }
+    if ((longitude < -PI) || (longitude > TWO_PI))
+    {  /* Longitude out of range */
+      status[i] = ErrorMessages::longitude;
+      continue;
+    }
+
+    double dlam = longitude - Moll_Origin_Long;
+    if (dlam > PI)
+      dlam -= TWO_PI;
+    if (dlam < -PI)
+      dlam += TWO_PI;
+
+    /* 1 - sin(|latitude|), without cancellation near the poles */
+    double s = sin(PI / 4.0 - fabs(latitude) / 2.0);
+    double one_Minus_Sin = 2.0 * s * s;
+    double w = pow(one_Minus_Sin, 1.0 / 3.0);
+
+    double position = w * MOLL_SEEDS;
+    int k = (int)position;
+    if (k > MOLL_SEEDS - 1)
+      k = MOLL_SEEDS - 1;
+    double h = mollweideSeeds.h[k] +
+               (position - k) * (mollweideSeeds.h[k + 1] - mollweideSeeds.h[k]);
+
+    double c = PI * one_Minus_Sin;
+    for( int n = 0; n < MOLL_ITERATIONS; n++ )
+    {
+      double sin_h = sin(h);
+      double derivative = 4.0 * sin_h * sin_h;
+      if (derivative > 0.0)
+        h -= (2.0 * h - 2.0 * sin_h * cos(h) - c) / derivative;
+    }
+
+    if (w < MOLL_SERIES_LIMIT)
+    {
+      double t = Series_Scale * w;
+      h = t * (1.0 + t * t / 60.0) / 2.0;
+    }
+
+    double cos_h = cos(h);
+    if (latitude < 0.0)
+      cos_h = -cos_h;
+    x[i] = Easting_Scale * dlam * sin(h) + Moll_False_Easting;
+    y[i] = Sqrt2_Ra * cos_h + Moll_False_Northing;
+  }
+}
+
+
+void Mollweide::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* Mollweide::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
+{
   double dx, dy;
   double theta = 0.0;
   double two_theta;
   double i;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if(   (easting < (Moll_False_Easting + Moll_Min_Easting))
      || (easting > (Moll_False_Easting + Moll_Max_Easting)))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if((northing < (Moll_False_Northing - Moll_Delta_Northing)) || 
      (northing > (Moll_False_Northing + Moll_Delta_Northing) ))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Moll_False_Northing;
@@ -401,9 +565,8 @@ MSP::CCS::GeodeticCoordinates* Mollweide::convertToGeodetic( MSP::CCS::MapProjec
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -74,6 +74,8 @@
  *    ----              -----------
  *    04-16-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions seed Newton's method from a
+ *                      table, with a fixed number of iterations
  *
  */
 
@@ -175,6 +177,36 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.  convertFromGeodeticBatch
+       * takes a fixed number of Newton iterations from tabulated seeds, and
+       * never reports that the iteration failed to converge.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
     private:
     
       /* Ellipsoid Parameters, default to WGS 84 */
@@ -192,6 +224,17 @@ namespace MSP
       double Moll_Max_Easting;
       double Moll_Min_Easting;
 
+      /*
+       * The function toGeodetic converts one point as convertToGeodetic
+       * does, returning the error message, or 0 if the point was converted.
+       */
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &longitude,
+         double &latitude );
+
     };
   }
 }
@@ -129,7 +129,7 @@ const double MAX_LAT = (89.999444444444444 * PI_OVER_180); /* 89 59 58.0 degrees
  */
 
 Neys::Neys( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double standardParallel, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Neys, MapProjectionCoordinates >(),
   lambertConformalConic2( 0 ),
   Neys_Std_Parallel_1( SEVENTY_ONE ),
   Neys_Std_Parallel_2( MAX_LAT ),
@@ -347,5 +347,4 @@ MSP::CCS::GeodeticCoordinates* Neys::convertToGeodetic(
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
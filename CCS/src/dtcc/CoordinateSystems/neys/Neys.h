@@ -83,7 +83,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -101,7 +101,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class Neys : public CoordinateSystem
+    class Neys : public PointBatchCoordinateSystem< Neys, MapProjectionCoordinates >
     {
     public:
 
@@ -67,7 +67,8 @@
  *    ----              -----------
  *    09-14-00          Original Code
  *    03-2-07           Original C++ Code
- *
+ *    10-19-26          Batch conversions evaluate the complex series
+ *                      for blocks of points at a time
  *
  */
 
@@ -127,6 +128,10 @@ const double NZMG_Max_Northing = 6900000.0;
 const double NZMG_Min_Easting = 1810000.0;
 const double NZMG_Min_Northing = 5160000.0;
 
+const long BATCH_BLOCK_SIZE = 256;     /* Points per complex series block */
+
+#define NZMG_ITERATIONS 2              /* Newton iterations of the inverse */
+
 struct Complex
 {
   double real;
@@ -365,7 +370,7 @@ MSP::CCS::GeodeticCoordinates* NZMG::convertToGeodetic( MSP::CCS::MapProjectionC
   }
   Zeta = multiply(Zeta, z);
 
-  for (i = 0; i < 2; i++)
+  for (i = 0; i < NZMG_ITERATIONS; i++)
   {
     Zeta_Numer.real = 5.0 * B[5].real;
     Zeta_Numer.imag = 5.0 * B[5].imag;
@@ -414,5 +419,252 @@ MSP::CCS::GeodeticCoordinates* NZMG::convertToGeodetic( MSP::CCS::MapProjectionC
 }
 
 
+void NZMG::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts geodetic coordinates to
+ * New Zealand Map Grid coordinates a block of points at a time.  The
+ * series are evaluated by Horner's scheme one coefficient at a time over
+ * the whole block, holding the real and imaginary parts of the points in
+ * separate arrays, so the loops over the points are free of branches and
+ * calls.  The arithmetic is that of convertFromGeodetic, point by point.
+ */
+
+  double Zeta_real[BATCH_BLOCK_SIZE];
+  double Zeta_imag[BATCH_BLOCK_SIZE];
+  double z_real[BATCH_BLOCK_SIZE];
+  double z_imag[BATCH_BLOCK_SIZE];
+  long j;
+  int n;
+
+  for( long start = 0; start < count; start += BATCH_BLOCK_SIZE )
+  {
+    long size = count - start;
+    if( size > BATCH_BLOCK_SIZE )
+      size = BATCH_BLOCK_SIZE;
+
+    const double* longitude = longitudes + start;
+    const double* latitude = latitudes + start;
+
+    /* dphi, then du, in Zeta_real */
+    for( j = 0; j < size; j++ )
+    {
+      Zeta_real[j] = (latitude[j] * (180.0 / PI) - NZMG_Origin_Lat) * 3600.0 * 1.0e-5;
+      z_real[j] = A[9];
+      Zeta_imag[j] = longitude[j] - NZMG_Origin_Long;
+    }
+    for( n = 8; n >= 0; n-- )
+    {
+      for( j = 0; j < size; j++ )
+        z_real[j] = z_real[j] * Zeta_real[j] + A[n];
+    }
+    for( j = 0; j < size; j++ )
+    {
+      Zeta_real[j] *= z_real[j];
+      z_real[j] = B[5].real;
+      z_imag[j] = B[5].imag;
+    }
+
+    for( n = 4; n >= 0; n-- )
+    {
+      for( j = 0; j < size; j++ )
+      {
+        double real = z_real[j] * Zeta_real[j] - z_imag[j] * Zeta_imag[j];
+        double imag = z_imag[j] * Zeta_real[j] + z_real[j] * Zeta_imag[j];
+        z_real[j] = B[n].real + real;
+        z_imag[j] = B[n].imag + imag;
+      }
+    }
+
+    for( j = 0; j < size; j++ )
+    {
+      long i = start + j;
+      double real = z_real[j] * Zeta_real[j] - z_imag[j] * Zeta_imag[j];
+      double imag = z_imag[j] * Zeta_real[j] + z_real[j] * Zeta_imag[j];
+      double easting = (imag * semiMajorAxis) + NZMG_False_Easting;
+      double northing = (real * semiMajorAxis) + NZMG_False_Northing;
+
+      if ((latitude[j] < MIN_LAT) || (latitude[j] > MAX_LAT))
+        status[i] = ErrorMessages::latitude;
+      else if ((longitude[j] < MIN_LON) || (longitude[j] > MAX_LON))
+        status[i] = ErrorMessages::longitude;
+      else if ((easting < NZMG_Min_Easting) || (easting > NZMG_Max_Easting))
+        status[i] = ErrorMessages::easting;
+      else if ((northing < NZMG_Min_Northing) || (northing > NZMG_Max_Northing))
+        status[i] = ErrorMessages::northing;
+      else
+      {
+        status[i] = 0;
+        x[i] = easting;
+        y[i] = northing;
+      }
+      if( z )
+        z[i] = 0.0;
+    }
+  }
+}
+
+
+void NZMG::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts New Zealand Map Grid
+ * coordinates to geodetic coordinates a block of points at a time, as
+ * convertFromGeodeticBatch does, taking NZMG_ITERATIONS Newton iterations
+ * for every point.  The arithmetic is that of convertToGeodetic, point by
+ * point.
+ */
+
+  double z_real[BATCH_BLOCK_SIZE];
+  double z_imag[BATCH_BLOCK_SIZE];
+  double Zeta_real[BATCH_BLOCK_SIZE];
+  double Zeta_imag[BATCH_BLOCK_SIZE];
+  double Numer_real[BATCH_BLOCK_SIZE];
+  double Numer_imag[BATCH_BLOCK_SIZE];
+  double Denom_real[BATCH_BLOCK_SIZE];
+  double Denom_imag[BATCH_BLOCK_SIZE];
+  long j;
+  int i, n;
+
+  for( long start = 0; start < count; start += BATCH_BLOCK_SIZE )
+  {
+    long size = count - start;
+    if( size > BATCH_BLOCK_SIZE )
+      size = BATCH_BLOCK_SIZE;
+
+    const double* easting = x + start;
+    const double* northing = y + start;
+
+    for( j = 0; j < size; j++ )
+    {
+      z_real[j] = (northing[j] - NZMG_False_Northing) / semiMajorAxis;
+      z_imag[j] = (easting[j] - NZMG_False_Easting) / semiMajorAxis;
+      Zeta_real[j] = C[5].real;
+      Zeta_imag[j] = C[5].imag;
+    }
+    for( n = 4; n >= 0; n-- )
+    {
+      for( j = 0; j < size; j++ )
+      {
+        double real = Zeta_real[j] * z_real[j] - Zeta_imag[j] * z_imag[j];
+        double imag = Zeta_imag[j] * z_real[j] + Zeta_real[j] * z_imag[j];
+        Zeta_real[j] = C[n].real + real;
+        Zeta_imag[j] = C[n].imag + imag;
+      }
+    }
+    for( j = 0; j < size; j++ )
+    {
+      double real = Zeta_real[j] * z_real[j] - Zeta_imag[j] * z_imag[j];
+      double imag = Zeta_imag[j] * z_real[j] + Zeta_real[j] * z_imag[j];
+      Zeta_real[j] = real;
+      Zeta_imag[j] = imag;
+    }
+
+    for( i = 0; i < NZMG_ITERATIONS; i++ )
+    {
+      for( j = 0; j < size; j++ )
+      {
+        Numer_real[j] = 5.0 * B[5].real;
+        Numer_imag[j] = 5.0 * B[5].imag;
+        Denom_real[j] = 6.0 * B[5].real;
+        Denom_imag[j] = 6.0 * B[5].imag;
+      }
+      for( n = 4; n >= 1; n-- )
+      {
+        double numer_coeff_real = n * B[n].real;
+        double numer_coeff_imag = n * B[n].imag;
+        double denom_coeff_real = (n+1) * B[n].real;
+        double denom_coeff_imag = (n+1) * B[n].imag;
+
+        for( j = 0; j < size; j++ )
+        {
+          double real = Numer_real[j] * Zeta_real[j] - Numer_imag[j] * Zeta_imag[j];
+          double imag = Numer_imag[j] * Zeta_real[j] + Numer_real[j] * Zeta_imag[j];
+          Numer_real[j] = numer_coeff_real + real;
+          Numer_imag[j] = numer_coeff_imag + imag;
+
+          real = Denom_real[j] * Zeta_real[j] - Denom_imag[j] * Zeta_imag[j];
+          imag = Denom_imag[j] * Zeta_real[j] + Denom_real[j] * Zeta_imag[j];
+          Denom_real[j] = denom_coeff_real + real;
+          Denom_imag[j] = denom_coeff_imag + imag;
+        }
+      }
+      for( j = 0; j < size; j++ )
+      {
+        double sqr_real = Zeta_real[j] * Zeta_real[j] - Zeta_imag[j] * Zeta_imag[j];
+        double sqr_imag = Zeta_imag[j] * Zeta_real[j] + Zeta_real[j] * Zeta_imag[j];
+
+        double real = Numer_real[j] * sqr_real - Numer_imag[j] * sqr_imag;
+        double imag = Numer_imag[j] * sqr_real + Numer_real[j] * sqr_imag;
+        double numer_real = z_real[j] + real;
+        double numer_imag = z_imag[j] + imag;
+
+        real = Denom_real[j] * Zeta_real[j] - Denom_imag[j] * Zeta_imag[j];
+        imag = Denom_imag[j] * Zeta_real[j] + Denom_real[j] * Zeta_imag[j];
+        double denom_real = B[0].real + real;
+        double denom_imag = B[0].imag + imag;
+
+        double denom = denom_real * denom_real + denom_imag * denom_imag;
+        Zeta_real[j] = (numer_real * denom_real + numer_imag * denom_imag) / denom;
+        Zeta_imag[j] = (numer_imag * denom_real - numer_real * denom_imag) / denom;
+      }
+    }
+
+    /* dphi in Numer_real */
+    for( j = 0; j < size; j++ )
+      Numer_real[j] = D[8];
+    for( n = 7; n >= 0; n-- )
+    {
+      for( j = 0; j < size; j++ )
+        Numer_real[j] = Numer_real[j] * Zeta_real[j] + D[n];
+    }
+
+    for( j = 0; j < size; j++ )
+    {
+      long k = start + j;
+      double dphi = Numer_real[j] * Zeta_real[j];
+      double latitude = NZMG_Origin_Lat + (dphi * 1.0e5 / 3600.0);
+      latitude *= PI / 180.0;
+      double longitude = NZMG_Origin_Long + Zeta_imag[j];
+
+      if ((longitude > PI) && (longitude - PI < 1.0e-6))
+        longitude = PI;
+
+      if ((easting[j] < NZMG_Min_Easting) || (easting[j] > NZMG_Max_Easting))
+        status[k] = ErrorMessages::easting;
+      else if ((northing[j] < NZMG_Min_Northing) || (northing[j] > NZMG_Max_Northing))
+        status[k] = ErrorMessages::northing;
+      else if ((latitude < MIN_LAT) || (latitude > MAX_LAT))
+        status[k] = ErrorMessages::latitude;
+      else if ((longitude < MIN_LON) || (longitude > MAX_LON))
+        status[k] = ErrorMessages::longitude;
+      else
+      {
+        status[k] = 0;
+        longitudes[k] = longitude;
+        latitudes[k] = latitude;
+      }
+      if( heights )
+        heights[k] = 0.0;
+    }
+  }
+}
+
 
 // CLASSIFICATION: UNCLASSIFIED
@@ -70,7 +70,8 @@
  *    ----              -----------
  *    09-14-00          Original Code
  *    03-2-07           Original C++ Code
- *
+ *    10-19-26          Batch conversions evaluate the complex series
+ *                      for blocks of points at a time
  *
  */
 
@@ -156,6 +157,36 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.  The complex series
+       * are evaluated for blocks of points at a time, with the results of
+       * convertFromGeodetic and convertToGeodetic.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
     private:
     
       /* Ellipsoid Parameters, must be International  */
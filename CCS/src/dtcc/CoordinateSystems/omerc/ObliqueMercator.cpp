@@ -84,6 +84,7 @@
  *    06-07-00          Original Code
  *    03-02-07          Original C++ Code
  *    05-11-11          BAEts28017 - Fix Oblique Mercator near poles
+ *    10-19-26          Added warm-started batch inverse
  *
  */
 
@@ -135,7 +136,7 @@ const double MAX_SCALE_FACTOR = 3.0;
  */
 
 ObliqueMercator::ObliqueMercator( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double originLatitude, double longitude1, double latitude1, double longitude2, double latitude2, double falseEasting, double falseNorthing, double scaleFactor ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< ObliqueMercator, MapProjectionCoordinates >(),
   es( 0.08181919084262188000 ),
   es_OVER_2( .040909595421311 ),
   OMerc_A( 6383471.9177251 ),
@@ -556,6 +557,112 @@ MSP::CCS::GeodeticCoordinates* ObliqueMercator::convertToGeodetic( MSP::CCS::Map
  *    northing          : Northing (Y), in meters                 (input)
  *    longitude         : Longitude (lambda), in radians          (output)
  *    latitude          : Latitude (phi), in radians              (output)
+ */
+
+  double longitude, latitude;
+  double correction = 0.0;
+  long iterations = 0;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     correction, longitude, latitude, iterations );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  char warning[256];
+  warning[0] = '\0';
+  if (fabs(longitude - OMerc_Origin_Long) >= PI_OVER_2)
+  { /* Distortion results if Longitude > 90 degrees from the Central Meridian */
+    strcat( warning, MSP::CCS::WarningMessages::longitude );
+  }
+
+  return new GeodeticCoordinates(
+     CoordinateType::geodetic, warning, longitude, latitude );
+}
+
+
+double ObliqueMercator::omercT( double lat, double e_sinlat, double e_over_2 )
+{  
+  return (tan(PI_OVER_4 - lat / 2.0)) / (pow((1 - e_sinlat) / (1 + e_sinlat), e_over_2));
+}
+
+
+void ObliqueMercator::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  convertToGeodeticBatch(
+     count, x, y, z, longitudes, latitudes, heights, status, 0 );
+}
+
+
+void ObliqueMercator::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status,
+   long*         iterations )
+{
+/*
+ * The function convertToGeodeticBatch converts Oblique Mercator
+ * coordinates to geodetic coordinates.  The latitude iteration of each
+ * point is seeded with the previous point's correction to the spherical
+ * initial guess, so nearby points converge in fewer iterations.  A point
+ * that fails from that seed is retried from the initial guess.
+ *
+ *    iterations : Latitude iterations of each point, or 0 if not wanted (output)
+ */
+
+  double correction = 0.0;
+
+  for( long i = 0; i < count; i++ )
+  {
+    long pointIterations = 0;
+    double seed = correction;
+
+    status[i] = toGeodetic( x[i], y[i], correction,
+       longitudes[i], latitudes[i], pointIterations );
+    if( status[i] && seed != 0.0 )
+    {
+      correction = 0.0;
+      status[i] = toGeodetic( x[i], y[i], correction,
+         longitudes[i], latitudes[i], pointIterations );
+    }
+    if( status[i] )
+      correction = 0.0;
+
+    if( heights )
+      heights[i] = 0.0;
+    if( iterations )
+      iterations[i] = pointIterations;
+  }
+}
+
+
+const char* ObliqueMercator::toGeodetic(
+   double  easting,
+   double  northing,
+   double &correction,
+   double &longitude,
+   double &latitude,
+   long   &iterations )
+{
+/*
+ * The function toGeodetic converts one point to geodetic coordinates,
+ * returning the error message, or 0 if the point was converted.  The
+ * latitude iteration starts from the spherical initial guess plus
+ * correction; correction returns the converged latitude minus the guess.
+ * iterations is increased by the number of iterations taken.
  */
 
   double dx, dy;
@@ -569,21 +676,18 @@ MSP::CCS::GeodeticCoordinates* ObliqueMercator::convertToGeodetic( MSP::CCS::Map
   double u_B_over_A;
   double phi;
   double temp_phi = 0.0;
+  double guess;
   int count = 60;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if ((easting < (OMerc_False_Easting - OMerc_Delta_Easting)) 
       || (easting > (OMerc_False_Easting + OMerc_Delta_Easting)))
   { /* Easting out of range  */
-    throw CoordinateConversionException( ErrorMessages::easting );
+    return ErrorMessages::easting;
   }
   if ((northing < (OMerc_False_Northing - OMerc_Delta_Northing)) 
       || (northing > (OMerc_False_Northing + OMerc_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing );
+    return ErrorMessages::northing;
   }
 
   dy = northing - OMerc_False_Northing;
@@ -609,9 +713,11 @@ MSP::CCS::GeodeticCoordinates* ObliqueMercator::convertToGeodetic( MSP::CCS::Map
   else
   {
     t = pow(OMerc_E / sqrt((1.0 + U_prime) / (1.0 - U_prime)), 1.0 / OMerc_B);
-    phi = PI_OVER_2 - 2.0 * atan(t);
+    guess = PI_OVER_2 - 2.0 * atan(t);
+    phi = guess + correction;
     while (fabs(phi - temp_phi) > 1.0e-10 && count)
     {
+      iterations++;
       temp_phi = phi;
       es_sin = es * sin(phi);
       phi = PI_OVER_2 - 2.0 * atan(t * pow((1.0 - es_sin) / (1.0 + es_sin), es_OVER_2));
@@ -619,8 +725,9 @@ MSP::CCS::GeodeticCoordinates* ObliqueMercator::convertToGeodetic( MSP::CCS::Map
     }
 
     if(!count)
-      throw CoordinateConversionException( ErrorMessages::northing );
+      return ErrorMessages::northing;
 
+    correction = phi - guess;
     latitude = phi;
     longitude = OMerc_Origin_Long - atan2((S_prime * cos_gamma - V_prime * sin_gamma), cos(u_B_over_A)) / OMerc_B;
   }
@@ -644,21 +751,7 @@ MSP::CCS::GeodeticCoordinates* ObliqueMercator::convertToGeodetic( MSP::CCS::Map
   else if (longitude < -PI)
     longitude = -PI;
 
-  char warning[256];
-  warning[0] = '\0';
-  if (fabs(longitude - OMerc_Origin_Long) >= PI_OVER_2)
-  { /* Distortion results if Longitude > 90 degrees from the Central Meridian */
-    strcat( warning, MSP::CCS::WarningMessages::longitude );
-  }
-
-  return new GeodeticCoordinates(
-     CoordinateType::geodetic, warning, longitude, latitude );
-}
-
-
-double ObliqueMercator::omercT( double lat, double e_sinlat, double e_over_2 )
-{  
-  return (tan(PI_OVER_4 - lat / 2.0)) / (pow((1 - e_sinlat) / (1 + e_sinlat), e_over_2));
+  return 0;
 }
 
 
@@ -86,12 +86,13 @@
  *    ----              -----------
  *    06-07-00          Original Code
  *    03-02-07          Original C++ Code
+ *    10-19-26          Added warm-started batch inverse
  *    
  *
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -108,7 +109,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class ObliqueMercator : public CoordinateSystem
+    class ObliqueMercator : public PointBatchCoordinateSystem< ObliqueMercator, MapProjectionCoordinates >
     {
     public:
 
@@ -211,6 +212,45 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The function convertToGeodeticBatch converts an array of easting and
+       * northing coordinates to geodetic coordinates, reporting errors per
+       * point through status instead of exceptions, as described in
+       * CoordinateSystem.
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
+
+      /*
+       * Same as convertToGeodeticBatch, also returning the number of
+       * latitude iterations taken for each point.  The iteration of each
+       * point is seeded from the previous point's solution, so runs of
+       * nearby points, such as tracks, converge in fewer iterations.
+       *
+       *    iterations : Iterations of each point, or 0 if not wanted  (output)
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status,
+         long*         iterations );
+
     private:
     
       /* Ellipsoid Parameters, default to WGS 84 */
@@ -246,6 +286,14 @@ namespace MSP
 
       double omercT( double lat, double e_sinlat, double e_over_2 );
 
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &correction,
+         double &longitude,
+         double &latitude,
+         long   &iterations );
     };
   }
 }
@@ -123,7 +123,7 @@ const double TWO_PI = (2.0 * PI);
  */
 
 Orthographic::Orthographic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Orthographic, MapProjectionCoordinates >(),
   es2( 0.0066943799901413800 ),
   es4( 4.4814723452405e-005 ),
   es6( 3.0000678794350e-007 ),
@@ -412,5 +412,4 @@ MSP::CCS::GeodeticCoordinates* Orthographic::convertToGeodetic( MSP::CCS::MapPro
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -83,6 +83,9 @@
  *    Date              Description
  *    ----              -----------
  *    2-27-07          Original Code
+ *    10-19-26         Added warm-started batch inverse, and bounded the
+ *                     latitude iteration
+ *    10-19-26         Forward conversions share one fromGeodetic core
  *
  *
  */
@@ -511,6 +514,147 @@ MSP::CCS::MapProjectionCoordinates* PolarStereographic::convertFromGeodetic( MSP
  *    latitude   :  Latitude, in radians                      (input)
  *    easting    :  Easting (X), in meters                    (output)
  *    northing   :  Northing (Y), in meters                   (output)
+ */
+
+  double longitude = geodeticCoordinates->longitude();
+  double latitude = geodeticCoordinates->latitude();
+  double easting, northing;
+  const char* errorMessage = fromGeodetic(
+     longitude, latitude, easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( coordinateType, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Polar
+ * Stereographic coordinates (easting and northing) to geodetic
+ * coordinates (latitude and longitude) according to the current ellipsoid
+ * and Polar Stereographic projection Parameters. If any errors occur, 
+ * an exception is thrown with a description of the error.
+ *
+ *  easting          : Easting (X), in meters                   (input)
+ *  northing         : Northing (Y), in meters                  (input)
+ *  longitude        : Longitude, in radians                    (output)
+ *  latitude         : Latitude, in radians                     (output)
+ *
+ */
+
+  double longitude, latitude;
+  double correction = 0.0;
+  long iterations = 0;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     correction, longitude, latitude, iterations );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates(
+     CoordinateType::geodetic, longitude, latitude );
+}
+
+
+double PolarStereographic::polarPow( double esSin )
+{
+  return pow((1.0 - esSin) / (1.0 + esSin), es_OVER_2);
+}
+
+
+void PolarStereographic::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void PolarStereographic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  convertToGeodeticBatch(
+     count, x, y, z, longitudes, latitudes, heights, status, 0 );
+}
+
+
+void PolarStereographic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status,
+   long*         iterations )
+{
+/*
+ * The function convertToGeodeticBatch converts Polar Stereographic
+ * coordinates to geodetic coordinates.  The latitude iteration of each
+ * point is seeded with the previous point's correction to the spherical
+ * initial guess, so nearby points converge in fewer iterations.  A point
+ * that fails from that seed is retried from the initial guess.
+ *
+ *    iterations : Latitude iterations of each point, or 0 if not wanted (output)
+ */
+
+  double correction = 0.0;
+
+  for( long i = 0; i < count; i++ )
+  {
+    long pointIterations = 0;
+    double seed = correction;
+
+    status[i] = toGeodetic( x[i], y[i], correction,
+       longitudes[i], latitudes[i], pointIterations );
+    if( status[i] && seed != 0.0 )
+    {
+      correction = 0.0;
+      status[i] = toGeodetic( x[i], y[i], correction,
+         longitudes[i], latitudes[i], pointIterations );
+    }
+    if( status[i] )
+      correction = 0.0;
+
+    if( heights )
+      heights[i] = 0.0;
+    if( iterations )
+      iterations[i] = pointIterations;
+  }
+}
+
+
+const char* PolarStereographic::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double &easting,
+   double &northing )
+{
+/*
+ * The function fromGeodetic converts one point to easting and northing,
+ * returning the error message, or 0 if the point was converted.
  */
 
   double dlam;
@@ -519,26 +663,22 @@ MSP::CCS::MapProjectionCoordinates* PolarStereographic::convertFromGeodetic( MSP
   double t;
   double rho;
   double pow_es;
-  double easting, northing;
-
-  double longitude = geodeticCoordinates->longitude();
-  double latitude = geodeticCoordinates->latitude();
 
   if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
   {   /* latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   else if ((latitude < 0) && (Southern_Hemisphere == 0))
   {   /* latitude and Origin Latitude in different hemispheres */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   else if ((latitude > 0) && (Southern_Hemisphere == 1))
   {   /* latitude and Origin Latitude in different hemispheres */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   {  /* longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
+    return ErrorMessages::longitude;
   }
 
   if (fabs(fabs(latitude) - PI_OVER_2) < 1.0e-10)
@@ -585,24 +725,24 @@ MSP::CCS::MapProjectionCoordinates* PolarStereographic::convertFromGeodetic( MSP
     }
   }
 
-  return new MapProjectionCoordinates( coordinateType, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* PolarStereographic::toGeodetic(
+   double  easting,
+   double  northing,
+   double &correction,
+   double &longitude,
+   double &latitude,
+   long   &iterations )
 {
 /*
- * The function convertToGeodetic converts Polar
- * Stereographic coordinates (easting and northing) to geodetic
- * coordinates (latitude and longitude) according to the current ellipsoid
- * and Polar Stereographic projection Parameters. If any errors occur, 
- * an exception is thrown with a description of the error.
- *
- *  easting          : Easting (X), in meters                   (input)
- *  northing         : Northing (Y), in meters                  (input)
- *  longitude        : Longitude, in radians                    (output)
- *  latitude         : Latitude, in radians                     (output)
- *
+ * The function toGeodetic converts one point to geodetic coordinates,
+ * returning the error message, or 0 if the point was converted.  The
+ * latitude iteration starts from the spherical initial guess plus
+ * correction; correction returns the converged latitude minus the guess.
+ * iterations is increased by the number of iterations taken.
  */
 
   double dy = 0, dx = 0;
@@ -610,13 +750,11 @@ MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::
   double t;
   double PHI, sin_PHI;
   double tempPHI = 0.0;
+  double guess;
+  int count = 30;
   double essin;
   double pow_es;
   double delta_radius;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   double min_easting  = Polar_False_Easting  - Polar_Delta_Easting;
   double max_easting  = Polar_False_Easting  + Polar_Delta_Easting;
@@ -625,11 +763,11 @@ MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::
 
   if (easting > max_easting || easting < min_easting)
   { /* easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if (northing > max_northing || northing < min_northing)
   { /* northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Polar_False_Northing;
@@ -644,7 +782,7 @@ MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::
 
   if(rho > delta_radius)
   { /* Point is outside of projection area */
-     throw CoordinateConversionException( ErrorMessages::radius );
+     return ErrorMessages::radius;
   }
 
   if ((dy == 0.0) && (dx == 0.0))
@@ -664,15 +802,25 @@ MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::
         t = rho * Polar_tc / (Polar_a_mc);
      else
         t = rho * Polar_k90 / (two_Polar_a);
-     PHI = PI_OVER_2 - 2.0 * atan(t);
-     while (fabs(PHI - tempPHI) > 1.0e-10)
+     guess = PI_OVER_2 - 2.0 * atan(t);
+     PHI = guess + correction;
+     while (fabs(PHI - tempPHI) > 1.0e-10 && count)
      {
+        iterations++;
+        count--;
         tempPHI = PHI;
         sin_PHI = sin(PHI);
         essin =  es * sin_PHI;
         pow_es = polarPow(essin);
         PHI = PI_OVER_2 - 2.0 * atan(t * pow_es);
      }
+
+     if (fabs(PHI - tempPHI) > 1.0e-10)
+     { /* latitude did not converge */
+        return ErrorMessages::northing;
+     }
+
+     correction = PHI - guess;
      latitude = PHI;
      longitude = Polar_Central_Meridian + atan2(dx, -dy);
 
@@ -699,14 +847,7 @@ MSP::CCS::GeodeticCoordinates* PolarStereographic::convertToGeodetic( MSP::CCS::
      longitude *= -1.0;
   }
 
-  return new GeodeticCoordinates(
-     CoordinateType::geodetic, longitude, latitude );
-}
-
-
-double PolarStereographic::polarPow( double esSin )
-{
-  return pow((1.0 - esSin) / (1.0 + esSin), es_OVER_2);
+  return 0;
 }
 
 
@@ -86,6 +86,8 @@
  *    Date              Description
  *    ----              -----------
  *    2-27-07          Original Code
+ *    10-19-26         Added warm-started batch inverse
+ *    10-19-26         Forward conversions share one fromGeodetic core
  *
  *
  */
@@ -219,6 +221,55 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
+
+      /*
+       * Same as convertToGeodeticBatch, also returning the number of
+       * latitude iterations taken for each point.  The iteration of each
+       * point is seeded from the previous point's solution, so runs of
+       * nearby points, such as tracks, converge in fewer iterations.
+       *
+       *    iterations : Iterations of each point, or 0 if not wanted  (output)
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status,
+         long*         iterations );
+
     private:
 
       CoordinateType::Enum coordinateType;
@@ -244,6 +295,20 @@ namespace MSP
       double Polar_Scale_Factor;
 
       double polarPow( double esSin);
+
+      const char* fromGeodetic(
+         double  longitude,
+         double  latitude,
+         double &easting,
+         double &northing );
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &correction,
+         double &longitude,
+         double &latitude,
+         long   &iterations );
     };
   }
 }
@@ -74,6 +74,9 @@
  *    ----              -----------
  *    10-06-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Added warm-started batch inverse
+ *    10-19-26          Warm seeds that pass the pole fall back to the
+ *                      cold guess
  *
  */
 
@@ -91,6 +94,7 @@
 #include "CoordinateConversionException.h"
 #include "ErrorMessages.h"
 #include "WarningMessages.h"
+#include "EllipsoidConstants.h"
 
 /*
  *    math.h     - Standard C math library
@@ -129,7 +133,7 @@ double polyCoeffTimesSine( double coeff,  double x,  double latit )
  */
 
 Polyconic::Polyconic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening, double centralMeridian, double originLatitude, double falseEasting, double falseNorthing ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< Polyconic, MapProjectionCoordinates >(),
   es2( 0.0066943799901413800 ),
   es4( 4.4814723452405e-005 ),
   es6( 3.0000678794350e-007 ),
@@ -165,7 +169,6 @@ Polyconic::Polyconic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening,
  *                              origin latitude of the projection         (input)
  */
 
-  double j, three_es4;
   double lat, sin2lat, sin4lat, sin6lat;
   double inv_f = 1 / ellipsoidFlattening;
 
@@ -195,16 +198,15 @@ Polyconic::Polyconic( double ellipsoidSemiMajorAxis, double ellipsoidFlattening,
   Poly_Origin_Long = centralMeridian;
   Poly_False_Northing = falseNorthing;
   Poly_False_Easting = falseEasting;
-  es2 = 2 * flattening - flattening * flattening;
-  es4 = es2 * es2;
-  es6 = es4 * es2;
+  const EllipsoidConstants constants( semiMajorAxis, flattening );
+  es2 = constants.es2;
+  es4 = constants.es4;
+  es6 = constants.es6;
 
-  j = 45.0 * es6 / 1024.0;
-  three_es4 = 3.0 * es4;
-  c0 = 1.0 - es2 / 4.0 - three_es4 / 64.0 - 5.0 * es6 / 256.0;
-  c1 = 3.0 * es2 / 8.0 + three_es4 / 32.0 + j;
-  c2 = 15.0 * es4 / 256.0 + j;
-  c3 = 35.0 * es6 / 3072.0;
+  c0 = constants.c0;
+  c1 = constants.c1;
+  c2 = constants.c2;
+  c3 = constants.c3;
 
   lat = c0 * Poly_Origin_Lat;
   sin2lat = polyCoeffTimesSine(c1, 2.0, Poly_Origin_Lat);
@@ -433,6 +435,112 @@ MSP::CCS::GeodeticCoordinates* Polyconic::convertToGeodetic( MSP::CCS::MapProjec
  *    northing          : Northing (Y) in meters                 (input)
  *    longitude         : Longitude (lambda) in radians          (output)
  *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
+  double correction = 0.0;
+  long iterations = 0;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     correction, longitude, latitude, iterations );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+double Polyconic::polyM( double c0lat, double c1s2lat, double c2s4lat, double c3s6lat )
+{
+  return semiMajorAxis * (c0lat - c1s2lat + c2s4lat - c3s6lat);
+}
+
+
+double Polyconic::floatEq( double x, double v, double epsilon )
+{
+  return ((v - epsilon) < x) && (x < (v + epsilon));
+}
+
+
+void Polyconic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* z,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  convertToGeodeticBatch(
+     count, x, y, z, longitudes, latitudes, heights, status, 0 );
+}
+
+
+void Polyconic::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status,
+   long*         iterations )
+{
+/*
+ * The function convertToGeodeticBatch converts Polyconic projection
+ * coordinates to geodetic coordinates.  The latitude iteration of each
+ * point is seeded with the previous point's correction to the initial
+ * guess, so nearby points converge in fewer iterations.  A point that
+ * fails from that seed, or whose iteration from it leaves for a root
+ * beyond the pole, is retried from the initial guess.
+ *
+ *    iterations : Latitude iterations of each point, or 0 if not wanted (output)
+ */
+
+  double correction = 0.0;
+
+  for( long i = 0; i < count; i++ )
+  {
+    long pointIterations = 0;
+    double seed = correction;
+
+    status[i] = toGeodetic( x[i], y[i], correction,
+       longitudes[i], latitudes[i], pointIterations );
+    if( status[i] && seed != 0.0 )
+    {
+      correction = 0.0;
+      status[i] = toGeodetic( x[i], y[i], correction,
+         longitudes[i], latitudes[i], pointIterations );
+    }
+    if( status[i] )
+      correction = 0.0;
+
+    if( heights )
+      heights[i] = 0.0;
+    if( iterations )
+      iterations[i] = pointIterations;
+  }
+}
+
+
+const char* Polyconic::toGeodetic(
+   double  easting,
+   double  northing,
+   double &correction,
+   double &longitude,
+   double &latitude,
+   long   &iterations )
+{
+/*
+ * The function toGeodetic converts one point to geodetic coordinates,
+ * returning the error message, or 0 if the point was converted.  The
+ * latitude iteration starts from (M0 + dy) / a plus correction;
+ * correction returns the converged latitude minus that guess.  An
+ * iteration from a nonzero correction fails if it passes the pole.
+ * iterations is increased by the number of iterations taken.
  */
 
   double dx;     /* Delta easting - Difference in easting (easting-FE)      */
@@ -450,21 +558,17 @@ MSP::CCS::GeodeticCoordinates* Polyconic::convertToGeodetic( MSP::CCS::MapProjec
   double AA_MINUS_Ma;
   double tolerance = 1.0e-12;        /* approximately 1/1000th of
                                an arc second or 1/10th meter */
-  double longitude, latitude;
   int count = 45000;
 
-  double easting = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
-
   if ((easting < (Poly_False_Easting + Poly_Min_Easting))
       || (easting > (Poly_False_Easting + Poly_Max_Easting)))
   { /* Easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting );
+    return ErrorMessages::easting;
   }
   if ((northing < (Poly_False_Northing + Poly_Min_Northing))
       || (northing > (Poly_False_Northing + Poly_Max_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Poly_False_Northing;
@@ -479,10 +583,11 @@ MSP::CCS::GeodeticCoordinates* Polyconic::convertToGeodetic( MSP::CCS::MapProjec
   {
     AA = (M0 + dy) / semiMajorAxis;
     BB = dx_OVER_Poly_a * dx_OVER_Poly_a + (AA * AA);
-    PHIn = AA;
+    PHIn = AA + correction;
 
     while (fabs(Delta_PHI) > tolerance && count)
     {
+      iterations++;
       sin_PHIn = sin(PHIn);
       CC = sqrt(1.0 - es2 * sin_PHIn * sin_PHIn) * tan(PHIn);
       PHI = c0 * PHIn;
@@ -501,11 +606,17 @@ MSP::CCS::GeodeticCoordinates* Polyconic::convertToGeodetic( MSP::CCS::MapProjec
                    4.0 * CC + (AA_MINUS_Ma) * (CC * Mn_prime - 2.0 / sin2PHI) - Mn_prime);
       PHIn -= Delta_PHI;
       count --;
+
+      /* A seed far from the solution can lead to a spurious root beyond
+         the pole, which would be forced to 90 degrees below */
+      if ((correction != 0.0) && (fabs(PHIn) > PI_OVER_2))
+        return ErrorMessages::northing;
     }
 
     if(!count)
-      throw CoordinateConversionException( ErrorMessages::northing );
+      return ErrorMessages::northing;
 
+    correction = PHIn - AA;
     latitude = PHIn;
 
     if (latitude > PI_OVER_2)  /* force distorted values to 90, -90 degrees */
@@ -532,21 +643,8 @@ MSP::CCS::GeodeticCoordinates* Polyconic::convertToGeodetic( MSP::CCS::MapProjec
   else if (longitude < -PI)
     longitude = -PI;
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
-}
-
-
-double Polyconic::polyM( double c0lat, double c1s2lat, double c2s4lat, double c3s6lat )
-{
-  return semiMajorAxis * (c0lat - c1s2lat + c2s4lat - c3s6lat);
+  return 0;
 }
 
 
-double Polyconic::floatEq( double x, double v, double epsilon )
-{
-  return ((v - epsilon) < x) && (x < (v + epsilon));
-}
-
-
-
 // CLASSIFICATION: UNCLASSIFIED
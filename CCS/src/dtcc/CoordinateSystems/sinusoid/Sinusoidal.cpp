@@ -68,6 +68,8 @@
  *    ----              -----------
  *    07-15-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions no longer create coordinate
+ *                      objects for each point
  *
  */
 
@@ -84,6 +86,7 @@
 #include "GeodeticCoordinates.h"
 #include "CoordinateConversionException.h"
 #include "ErrorMessages.h"
+#include "EllipsoidConstants.h"
 
 /*
  *    math.h     - Standard C math library
@@ -161,8 +164,6 @@ Sinusoidal::Sinusoidal( double ellipsoidSemiMajorAxis, double ellipsoidFlattenin
  *                               origin latitude of the projection       (input)
  */
 
-  double j;
-  double One_MINUS_es2, Sqrt_One_MINUS_es2, e1, e2, e3, e4;
   double inv_f = 1 / ellipsoidFlattening;
 
   if (ellipsoidSemiMajorAxis <= 0.0)
@@ -181,24 +182,18 @@ Sinusoidal::Sinusoidal( double ellipsoidSemiMajorAxis, double ellipsoidFlattenin
   semiMajorAxis = ellipsoidSemiMajorAxis;
   flattening    = ellipsoidFlattening;
 
-  es2 = 2 * flattening - flattening * flattening;
-  es4 = es2 * es2;
-  es6 = es4 * es2;
-  j   = 45.0 * es6 / 1024.0;
-  c0  = 1.0 - es2 / 4.0 - 3.0 * es4 / 64.0 - 5.0 * es6 / 256.0;
-  c1  = 3.0 * es2 / 8.0 + 3.0 * es4 / 32.0 + j;
-  c2  = 15.0 * es4 / 256.0 + j;
-  c3  = 35.0 * es6 / 3072.0;
-  One_MINUS_es2 = 1.0 - es2;
-  Sqrt_One_MINUS_es2 = sqrt(One_MINUS_es2);
-  e1  = (1.0 - Sqrt_One_MINUS_es2) / (1.0 + Sqrt_One_MINUS_es2);
-  e2  = e1 * e1;
-  e3  = e2 * e1;
-  e4  = e3 * e1;
-  a0  = 3.0 * e1 / 2.0 - 27.0 * e3 / 32.0 ;
-  a1  = 21.0 * e2 / 16.0 - 55.0 * e4 / 32.0;
-  a2  = 151.0 * e3 / 96.0;
-  a3  = 1097.0 * e4 / 512.0;
+  const EllipsoidConstants constants( semiMajorAxis, flattening );
+  es2 = constants.es2;
+  es4 = constants.es4;
+  es6 = constants.es6;
+  c0  = constants.c0;
+  c1  = constants.c1;
+  c2  = constants.c2;
+  c3  = constants.c3;
+  a0  = constants.a0;
+  a1  = constants.a1;
+  a2  = constants.a2;
+  a3  = constants.a3;
   if (centralMeridian > PI)
     centralMeridian -= TWO_PI;
   Sinu_Origin_Long    = centralMeridian;
@@ -321,22 +316,103 @@ MSP::CCS::MapProjectionCoordinates* Sinusoidal::convertFromGeodetic(
  *    northing          : Northing (Y) in meters              (output)
  */
 
+  double easting, northing;
+
+  const char* errorMessage = fromGeodetic(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+     easting, northing );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new MapProjectionCoordinates( CoordinateType::sinusoidal, easting, northing );
+}
+
+
+MSP::CCS::GeodeticCoordinates* Sinusoidal::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+{
+/*
+ * The function convertToGeodetic converts Sinusoidal projection
+ * (easting and northing) coordinates to geodetic (latitude and longitude)
+ * coordinates, according to the current ellipsoid and Sinusoidal projection
+ * coordinates.  If any errors occur, an exception is thrown with a description 
+ * of the error.
+ *
+ *    easting           : Easting (X) in meters                  (input)
+ *    northing          : Northing (Y) in meters                 (input)
+ *    longitude         : Longitude (lambda) in radians          (output)
+ *    latitude          : Latitude (phi) in radians              (output)
+ */
+
+  double longitude, latitude;
+
+  const char* errorMessage = toGeodetic(
+     mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+     longitude, latitude );
+  if( errorMessage )
+    throw CoordinateConversionException( errorMessage );
+
+  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+}
+
+
+void Sinusoidal::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = fromGeodetic( longitudes[i], latitudes[i], x[i], y[i] );
+    if( z )
+      z[i] = 0.0;
+  }
+}
+
+
+void Sinusoidal::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = toGeodetic( x[i], y[i], longitudes[i], latitudes[i] );
+    if( heights )
+      heights[i] = 0.0;
+  }
+}
+
+
+const char* Sinusoidal::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double &easting,
+   double &northing )
+{
   double sin2lat, sin4lat, sin6lat;
   double dlam;                      /* Longitude - Central Meridan */
   double mm;
   double MM;
 
-  double longitude = geodeticCoordinates->longitude();
-  double latitude  = geodeticCoordinates->latitude();
   double slat      = sin(latitude);
 
   if ((latitude < -PI_OVER_2) || (latitude > PI_OVER_2))
   { /* Latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude  );
+    return ErrorMessages::latitude;
   }
   if ((longitude < -PI) || (longitude > TWO_PI))
   { /* Longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude  );
+    return ErrorMessages::longitude;
   }
 
   dlam = longitude - Sinu_Origin_Long;
@@ -355,47 +431,34 @@ MSP::CCS::MapProjectionCoordinates* Sinusoidal::convertFromGeodetic(
   sin6lat = sinuCoeffTimesSine(c3, 6.0, latitude);
   MM = semiMajorAxis * (c0 * latitude - sin2lat + sin4lat - sin6lat);
 
-  double easting = semiMajorAxis * dlam * cos(latitude) / mm + Sinu_False_Easting;
-  double northing = MM + Sinu_False_Northing;
+  easting = semiMajorAxis * dlam * cos(latitude) / mm + Sinu_False_Easting;
+  northing = MM + Sinu_False_Northing;
 
-  return new MapProjectionCoordinates( CoordinateType::sinusoidal, easting, northing );
+  return 0;
 }
 
 
-MSP::CCS::GeodeticCoordinates* Sinusoidal::convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
+const char* Sinusoidal::toGeodetic(
+   double  easting,
+   double  northing,
+   double &longitude,
+   double &latitude )
 {
-/*
- * The function convertToGeodetic converts Sinusoidal projection
- * (easting and northing) coordinates to geodetic (latitude and longitude)
- * coordinates, according to the current ellipsoid and Sinusoidal projection
- * coordinates.  If any errors occur, an exception is thrown with a description 
- * of the error.
- *
- *    easting           : Easting (X) in meters                  (input)
- *    northing          : Northing (Y) in meters                 (input)
- *    longitude         : Longitude (lambda) in radians          (output)
- *    latitude          : Latitude (phi) in radians              (output)
- */
-
   double dx;     /* Delta easting - Difference in easting (easting-FE)      */
   double dy;     /* Delta northing - Difference in northing (northing-FN)   */
   double mu;
   double sin2mu, sin4mu, sin6mu, sin8mu;
   double sin_lat;
-  double longitude, latitude;
-
-  double easting  = mapProjectionCoordinates->easting();
-  double northing = mapProjectionCoordinates->northing();
 
   if ((easting < (Sinu_False_Easting + Sinu_Min_Easting))
       || (easting > (Sinu_False_Easting + Sinu_Max_Easting)))
   { /* Easting out of range */
-    throw CoordinateConversionException( ErrorMessages::easting  );
+    return ErrorMessages::easting;
   }
   if ((northing < (Sinu_False_Northing - Sinu_Delta_Northing))
       || (northing > (Sinu_False_Northing + Sinu_Delta_Northing)))
   { /* Northing out of range */
-    throw CoordinateConversionException( ErrorMessages::northing  );
+    return ErrorMessages::northing;
   }
 
   dy = northing - Sinu_False_Northing;
@@ -421,7 +484,6 @@ MSP::CCS::GeodeticCoordinates* Sinusoidal::convertToGeodetic( MSP::CCS::MapProje
     longitude = Sinu_Origin_Long + dx * sqrt(1.0 - es2 *
                                               sin_lat * sin_lat) / (semiMajorAxis * cos(latitude));
 
-
     if (longitude > PI)
       longitude -= TWO_PI;
     if (longitude < -PI)
@@ -433,9 +495,8 @@ MSP::CCS::GeodeticCoordinates* Sinusoidal::convertToGeodetic( MSP::CCS::MapProje
       longitude = -PI;
   }
 
-  return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude );
+  return 0;
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
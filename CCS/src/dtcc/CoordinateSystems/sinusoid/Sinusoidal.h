@@ -71,6 +71,10 @@
  *    ----              -----------
  *    07-15-99          Original Code
  *    03-05-07          Original C++ Code
+ *    10-19-26          Batch conversions no longer create coordinate
+ *                      objects for each point
+ *    10-19-26          Ellipsoid constants are computed by
+ *                      EllipsoidConstants
  *
  */
 
@@ -172,6 +176,34 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+      /*
+       * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+       * convert arrays of points between geodetic and easting and northing
+       * coordinates, reporting errors per point through status instead of
+       * exceptions, as described in CoordinateSystem.
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         const double* heights,
+         double*       x,
+         double*       y,
+         double*       z,
+         const char**  status );
+
+      void convertToGeodeticBatch(
+         long          count,
+         const double* x,
+         const double* y,
+         const double* z,
+         double*       longitudes,
+         double*       latitudes,
+         double*       heights,
+         const char**  status );
+
     private:
     
       /* Ellipsoid Parameters, default to WGS 84 */
@@ -197,6 +229,24 @@ namespace MSP
       double Sinu_Min_Easting;
       double Sinu_Delta_Northing;
 
+      /*
+       * The functions fromGeodetic and toGeodetic convert one point as
+       * convertFromGeodetic and convertToGeodetic do, returning the error
+       * message, or 0 if the point was converted.
+       */
+
+      const char* fromGeodetic(
+         double  longitude,
+         double  latitude,
+         double &easting,
+         double &northing );
+
+      const char* toGeodetic(
+         double  easting,
+         double  northing,
+         double &longitude,
+         double &latitude );
+
     };
   }
 }
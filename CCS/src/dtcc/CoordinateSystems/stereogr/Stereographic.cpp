@@ -491,5 +491,4 @@ MSP::CCS::GeodeticCoordinates* Stereographic::convertToGeodetic( MSP::CCS::MapPr
 }
 
 
-
 // CLASSIFICATION: UNCLASSIFIED
@@ -89,7 +89,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -106,7 +106,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class Stereographic : public CoordinateSystem
+    class Stereographic : public PointBatchCoordinateSystem< Stereographic, MapProjectionCoordinates >
     {
     public:
 
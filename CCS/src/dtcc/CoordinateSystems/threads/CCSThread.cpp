@@ -0,0 +1,86 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifdef WIN32
+#  include <windows.h>
+#endif
+
+#include "CCSThread.h"
+
+using MSP::CCSThread;
+
+CCSThread::CCSThread() :
+   function( 0 ),
+   argument( 0 ),
+   running( false )
+{
+#ifdef WIN32
+   thread = 0;
+#endif
+}
+
+CCSThread::~CCSThread()
+{
+   join();
+}
+
+bool
+CCSThread::start( Function theFunction, void* theArgument )
+{
+   if( running )
+      return false;
+
+   function = theFunction;
+   argument = theArgument;
+
+#ifdef WIN32
+   thread = (void*)CreateThread( NULL, 0, entry, this, 0, NULL );
+   running = ( thread != 0 );
+#elif NDK_BUILD
+   // the mutex is a no-op for Android, so run on the calling thread
+   function( argument );
+   return true;
+#else
+   running = ( pthread_create( &thread, NULL, entry, this ) == 0 );
+#endif
+
+   return running;
+}
+
+void
+CCSThread::join()
+{
+   if( !running )
+      return;
+
+#ifdef WIN32
+   WaitForSingleObject( (HANDLE)thread, INFINITE );
+   CloseHandle( (HANDLE)thread );
+   thread = 0;
+#elif NDK_BUILD
+   // nothing was started
+#else
+   pthread_join( thread, NULL );
+#endif
+
+   running = false;
+}
+
+#ifdef WIN32
+unsigned long __stdcall
+CCSThread::entry( void* thread )
+{
+   CCSThread* self = (CCSThread*)thread;
+   self->function( self->argument );
+   return 0;
+}
+#else
+void*
+CCSThread::entry( void* thread )
+{
+   CCSThread* self = (CCSThread*)thread;
+   self->function( self->argument );
+   return 0;
+}
+#endif
+
+// CLASSIFICATION: UNCLASSIFIED
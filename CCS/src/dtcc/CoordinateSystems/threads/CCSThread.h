@@ -0,0 +1,58 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef MSP_CCSTHREAD_H
+#define MSP_CCSTHREAD_H
+
+#ifndef WIN32
+#   include <pthread.h>
+#endif
+
+#include "DtccApi.h"
+
+namespace MSP
+{
+    class MSP_DTCC_API CCSThread
+    {
+    public:
+        /// Thread entry point; receives the argument given to start().
+        typedef void (*Function)( void* argument );
+
+        /// Default Constructor.
+        CCSThread();
+
+        /// Destructor. Joins the thread if it is still running.
+        ~CCSThread();
+
+        /// Runs function( argument ) on a new thread.
+        /// Returns false if the thread could not be created.
+        bool start( Function function, void* argument );
+
+        /// Waits for the thread started by start() to finish.
+        void join();
+
+    private:
+        // no copy operators
+        CCSThread(const CCSThread&);
+        CCSThread &operator=( const CCSThread&);
+
+#ifdef WIN32
+        static unsigned long __stdcall entry( void* thread );
+#else
+        static void* entry( void* thread );
+#endif
+
+        Function function;
+        void*    argument;
+        bool     running;
+
+#ifdef WIN32
+        void *thread;
+#else
+        pthread_t thread;
+#endif
+
+    };
+}
+#endif
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,130 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifdef WIN32
+#  include <windows.h>
+#else
+#  include <errno.h>
+#  include <sys/time.h>
+#endif
+
+#include "CCSThreadCondition.h"
+
+using MSP::CCSThreadCondition;
+
+CCSThreadCondition::CCSThreadCondition()
+{
+#ifdef WIN32
+   CRITICAL_SECTION* criticalSection = new CRITICAL_SECTION;
+   InitializeCriticalSection( criticalSection );
+   mutex = criticalSection;
+
+   CONDITION_VARIABLE* conditionVariable = new CONDITION_VARIABLE;
+   InitializeConditionVariable( conditionVariable );
+   condition = conditionVariable;
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_mutex_init( &mutex, NULL );
+   pthread_cond_init( &condition, NULL );
+#endif
+}
+
+CCSThreadCondition::~CCSThreadCondition()
+{
+#ifdef WIN32
+   DeleteCriticalSection( (CRITICAL_SECTION*)mutex );
+   delete (CRITICAL_SECTION*)mutex;
+   delete (CONDITION_VARIABLE*)condition;
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_cond_destroy( &condition );
+   pthread_mutex_destroy( &mutex );
+#endif
+}
+
+void
+CCSThreadCondition::lock() const
+{
+#ifdef WIN32
+   EnterCriticalSection( (CRITICAL_SECTION*)mutex );
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_mutex_lock( &mutex );
+#endif
+}
+
+void
+CCSThreadCondition::unlock() const
+{
+#ifdef WIN32
+   LeaveCriticalSection( (CRITICAL_SECTION*)mutex );
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_mutex_unlock( &mutex );
+#endif
+}
+
+void
+CCSThreadCondition::wait() const
+{
+#ifdef WIN32
+   SleepConditionVariableCS(
+      (CONDITION_VARIABLE*)condition, (CRITICAL_SECTION*)mutex, INFINITE );
+#elif NDK_BUILD
+   // threads run synchronously for Android, nothing can signal
+#else
+   pthread_cond_wait( &condition, &mutex );
+#endif
+}
+
+bool
+CCSThreadCondition::timedWait( long milliseconds ) const
+{
+#ifdef WIN32
+   return SleepConditionVariableCS(
+      (CONDITION_VARIABLE*)condition, (CRITICAL_SECTION*)mutex,
+      milliseconds ) != 0;
+#elif NDK_BUILD
+   return false;
+#else
+   struct timeval now;
+   gettimeofday( &now, NULL );
+
+   long microseconds = now.tv_usec + ( milliseconds % 1000 ) * 1000;
+
+   struct timespec timeout;
+   timeout.tv_sec  = now.tv_sec + milliseconds / 1000 + microseconds / 1000000;
+   timeout.tv_nsec = ( microseconds % 1000000 ) * 1000;
+
+   return pthread_cond_timedwait( &condition, &mutex, &timeout ) != ETIMEDOUT;
+#endif
+}
+
+void
+CCSThreadCondition::signal() const
+{
+#ifdef WIN32
+   WakeConditionVariable( (CONDITION_VARIABLE*)condition );
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_cond_signal( &condition );
+#endif
+}
+
+void
+CCSThreadCondition::broadcast() const
+{
+#ifdef WIN32
+   WakeAllConditionVariable( (CONDITION_VARIABLE*)condition );
+#elif NDK_BUILD
+   // do nothing for Android
+#else
+   pthread_cond_broadcast( &condition );
+#endif
+}
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -0,0 +1,59 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+#ifndef MSP_CCSTHREADCONDITION_H
+#define MSP_CCSTHREADCONDITION_H
+
+#ifndef WIN32
+#   include <pthread.h>
+#endif
+
+#include "DtccApi.h"
+
+namespace MSP
+{
+    /// Condition variable with its own (non-recursive) mutex.
+    /// wait() and timedWait() must be called with the mutex locked.
+    class MSP_DTCC_API CCSThreadCondition
+    {
+    public:
+        /// Default Constructor.
+        CCSThreadCondition();
+
+        /// Destructor.
+        ~CCSThreadCondition();
+
+        void lock() const;
+
+        void unlock() const;
+
+        /// Releases the mutex, waits to be signalled and relocks it.
+        void wait() const;
+
+        /// Same as wait(), giving up after milliseconds.
+        /// Returns false on timeout.
+        bool timedWait( long milliseconds ) const;
+
+        /// Wakes one waiting thread.
+        void signal() const;
+
+        /// Wakes all waiting threads.
+        void broadcast() const;
+
+    private:
+        // no copy operators
+        CCSThreadCondition(const CCSThreadCondition&);
+        CCSThreadCondition &operator=( const CCSThreadCondition&);
+
+#ifdef WIN32
+        void *mutex;
+        void *condition;
+#else
+        mutable pthread_mutex_t   mutex;
+        mutable pthread_cond_t    condition;
+#endif
+
+    };
+}
+#endif
+
+// CLASSIFICATION: UNCLASSIFIED
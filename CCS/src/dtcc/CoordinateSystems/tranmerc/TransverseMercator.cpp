@@ -25,6 +25,8 @@
  *    1/19/16  A. Layne MSP_DR30125 Updated generateCoefficients to use book values for 
  *			   coefficients based on supplied ellipsoid code. If user defined, use old default computation.
  *             
+ *    10/19/26 Added convertFromGeodeticBatch and convertToGeodeticBatch;
+ *             checkLatLon returns the error message instead of throwing.
  *             
  */
 #include <iostream>
@@ -169,9 +171,39 @@ MSP::CCS::MapProjection5Parameters* TransverseMercator::getParameters() const
 MSP::CCS::MapProjectionCoordinates* TransverseMercator::convertFromGeodetic(
    MSP::CCS::GeodeticCoordinates* geodeticCoordinates )
 {
-   double longitude = geodeticCoordinates->longitude();
-   double latitude  = geodeticCoordinates->latitude();
+   // The origin may move form (0,0) and this is represented by 
+   // a change in the false Northing/Easting values. 
+   double falseEasting, falseNorthing;
+   latLonToNorthingEasting(
+      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
+
+   double easting, northing;
+   const char* errorMessage = fromGeodetic(
+      geodeticCoordinates->longitude(), geodeticCoordinates->latitude(),
+      falseEasting, falseNorthing, easting, northing );
+   if( errorMessage )
+      throw CoordinateConversionException( errorMessage );
+
+   char warning[256] = "";
+   warning[0] = '\0';
+   double invFlattening = 1.0 / flattening;
+   if( invFlattening < 290.0 || invFlattening > 301.0 )
+      strcat( warning,
+         "Eccentricity is outside range that algorithm accuracy has been tested." );
+
+   return new MapProjectionCoordinates(
+      CoordinateType::transverseMercator, warning, easting, northing );
+}
 
+
+const char* TransverseMercator::fromGeodetic(
+   double  longitude,
+   double  latitude,
+   double  falseEasting,
+   double  falseNorthing,
+   double &easting,
+   double &northing )
+{
    if (longitude > PI)
       longitude -= (2 * PI);
    if (longitude < -PI)
@@ -179,35 +211,21 @@ MSP::CCS::MapProjectionCoordinates* TransverseMercator::convertFromGeodetic(
 
    //  Convert longitude (Greenwhich) to longitude from the central meridian
    //  (-Pi, Pi] equivalent needed for checkLatLon.
-   //  Compute its cosine and sine.
    double lambda  = longitude - TranMerc_Origin_Long;
    if (lambda > PI)
       lambda -= (2 * PI);
    if (lambda < -PI)
       lambda += (2 * PI);
-   checkLatLon( latitude, lambda );
+   const char* errorMessage = checkLatLon( latitude, lambda );
+   if( errorMessage )
+      return errorMessage;
 
-   double easting, northing;
    latLonToNorthingEasting( latitude, longitude, northing, easting );
 
-   // The origin may move form (0,0) and this is represented by 
-   // a change in the false Northing/Easting values. 
-   double falseEasting, falseNorthing;
-   latLonToNorthingEasting(
-      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
-
    easting  += TranMerc_False_Easting  - falseEasting;
    northing += TranMerc_False_Northing - falseNorthing;
 
-   char warning[256] = "";
-   warning[0] = '\0';
-   double invFlattening = 1.0 / flattening;
-   if( invFlattening < 290.0 || invFlattening > 301.0 )
-      strcat( warning,
-         "Eccentricity is outside range that algorithm accuracy has been tested." );
-
-   return new MapProjectionCoordinates(
-      CoordinateType::transverseMercator, warning, easting, northing );
+   return 0;
 }
 
 
@@ -218,14 +236,13 @@ void TransverseMercator::latLonToNorthingEasting(
    double       &easting )
 {
    //  Convert longitude (Greenwhich) to longitude from the central meridian
-   //  (-Pi, Pi] equivalent needed for checkLatLon.
-   //  Compute its cosine and sine.
+   //  (-Pi, Pi] equivalent.  The caller has checked the range with
+   //  checkLatLon.  Compute its cosine and sine.
    double lambda  = longitude - TranMerc_Origin_Long;
    if (lambda > PI)
       lambda -= (2 * PI);
    if (lambda < -PI)
       lambda += (2 * PI);
-   checkLatLon( latitude, lambda );
 
    double cosLam = cos(lambda);
    double sinLam = sin(lambda);
@@ -283,28 +300,51 @@ void TransverseMercator::latLonToNorthingEasting(
 MSP::CCS::GeodeticCoordinates* TransverseMercator::convertToGeodetic(
    MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates )
 {
-   double easting  = mapProjectionCoordinates->easting();
-   double northing = mapProjectionCoordinates->northing();
+   // The origin may move form (0,0) and this is represented by 
+   // a change in the false Northing/Easting values. 
+   double falseEasting, falseNorthing;
+   latLonToNorthingEasting(
+      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
 
+   double longitude, latitude;
+   const char* errorMessage = toGeodetic(
+      mapProjectionCoordinates->easting(), mapProjectionCoordinates->northing(),
+      falseEasting, falseNorthing, longitude, latitude );
+   if( errorMessage )
+      throw CoordinateConversionException( errorMessage );
+
+   char warning[256];
+   warning[0] = '\0';
+   double invFlattening = 1.0 / flattening;
+   if( invFlattening < 290.0 || invFlattening > 301.0 )
+      strcat( warning,
+         "Eccentricity is outside range that algorithm accuracy has been tested." );
+
+   return new GeodeticCoordinates(
+      CoordinateType::geodetic, warning, longitude, latitude );
+}
+
+
+const char* TransverseMercator::toGeodetic(
+   double  easting,
+   double  northing,
+   double  falseEasting,
+   double  falseNorthing,
+   double &longitude,
+   double &latitude )
+{
    if (  (easting < (TranMerc_False_Easting - TranMerc_Delta_Easting))
        ||(easting > (TranMerc_False_Easting + TranMerc_Delta_Easting)))
    { // easting out of range
-      throw CoordinateConversionException( ErrorMessages::easting );
+      return ErrorMessages::easting;
    }
 
    if (   (northing < (TranMerc_False_Northing - TranMerc_Delta_Northing))
        || (northing > (TranMerc_False_Northing + TranMerc_Delta_Northing)))
    { // northing out of range
-      throw CoordinateConversionException( ErrorMessages::northing );
+      return ErrorMessages::northing;
    }
 
-   double longitude, latitude;
-   // The origin may move form (0,0) and this is represented by 
-   // a change in the false Northing/Easting values. 
-   double falseEasting, falseNorthing;
-   latLonToNorthingEasting(
-      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
-
    easting  -= (TranMerc_False_Easting  - falseEasting);
    northing -= (TranMerc_False_Northing - falseNorthing);
 
@@ -315,30 +355,22 @@ MSP::CCS::GeodeticCoordinates* TransverseMercator::convertToGeodetic(
 
    if(fabs(latitude) > (90.0 * PI / 180.0))
    {
-      throw CoordinateConversionException( ErrorMessages::northing );
+      return ErrorMessages::northing;
    }
    if((longitude) > (PI))
    {
       longitude -= (2 * PI);
       if(fabs(longitude) > PI)
-         throw CoordinateConversionException( ErrorMessages::easting );
+         return ErrorMessages::easting;
    }
    else if((longitude) < (-PI))
    {
       longitude += (2 * PI);
       if(fabs(longitude) > PI)
-         throw CoordinateConversionException( ErrorMessages::easting );
+         return ErrorMessages::easting;
    }
 
-   char warning[256];
-   warning[0] = '\0';
-   double invFlattening = 1.0 / flattening;
-   if( invFlattening < 290.0 || invFlattening > 301.0 )
-      strcat( warning,
-         "Eccentricity is outside range that algorithm accuracy has been tested." );
-
-   return new GeodeticCoordinates(
-      CoordinateType::geodetic, warning, longitude, latitude );
+   return 0;
 }
 
 void TransverseMercator::northingEastingToLatLon( 
@@ -862,7 +894,7 @@ void TransverseMercator::generateCoefficients(
 }
 
 
-void TransverseMercator::checkLatLon( double latitude, double deltaLon )
+const char* TransverseMercator::checkLatLon( double latitude, double deltaLon )
 {
    // test is based on distance from central meridian = deltaLon
    if (deltaLon > PI)
@@ -891,8 +923,10 @@ void TransverseMercator::checkLatLon( double latitude, double deltaLon )
 
    if( testAngle > MAX_DELTA_LONG )
    {
-      throw CoordinateConversionException( ErrorMessages::longitude );
+      return ErrorMessages::longitude;
    }
+
+   return 0;
 }
 
 
@@ -979,4 +1013,54 @@ void TransverseMercator::computeTrigSeries(
    s2ky[7] = 2.0 * c2ky[3] * s2ky[3];
 }
 
+
+void TransverseMercator::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const double* ,
+   double*       x,
+   double*       y,
+   double*       z,
+   const char**  status )
+{
+   // The false easting and northing of the origin are computed once
+   double falseEasting, falseNorthing;
+   latLonToNorthingEasting(
+      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
+
+   for( long i = 0; i < count; i++ )
+   {
+      status[i] = fromGeodetic( longitudes[i], latitudes[i],
+         falseEasting, falseNorthing, x[i], y[i] );
+      if( z )
+         z[i] = 0.0;
+   }
+}
+
+
+void TransverseMercator::convertToGeodeticBatch(
+   long          count,
+   const double* x,
+   const double* y,
+   const double* ,
+   double*       longitudes,
+   double*       latitudes,
+   double*       heights,
+   const char**  status )
+{
+   double falseEasting, falseNorthing;
+   latLonToNorthingEasting(
+      TranMerc_Origin_Lat, TranMerc_Origin_Long, falseNorthing, falseEasting );
+
+   for( long i = 0; i < count; i++ )
+   {
+      status[i] = toGeodetic( x[i], y[i],
+         falseEasting, falseNorthing, longitudes[i], latitudes[i] );
+      if( heights )
+         heights[i] = 0.0;
+   }
+}
+
+
 // CLASSIFICATION: UNCLASSIFIED
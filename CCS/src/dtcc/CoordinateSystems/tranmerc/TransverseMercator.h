@@ -37,6 +37,7 @@
  *    ----         -----------
  *    2-26-07      Original C++ Code
  *    7-01-14      Updated algorithm in NGA.SIG.0012_2.0.0_UTMUPS.
+ *    10-19-26     Added batch conversions.
  *
  */
 
@@ -135,6 +136,34 @@ namespace MSP
          MSP::CCS::GeodeticCoordinates* convertToGeodetic(
             MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+         /*
+          * The functions convertFromGeodeticBatch and convertToGeodeticBatch
+          * convert arrays of points between geodetic and easting and northing
+          * coordinates, reporting errors per point through status instead of
+          * exceptions, as described in CoordinateSystem.
+          */
+
+         void convertFromGeodeticBatch(
+            long          count,
+            const double* longitudes,
+            const double* latitudes,
+            const double* heights,
+            double*       x,
+            double*       y,
+            double*       z,
+            const char**  status );
+
+         void convertToGeodeticBatch(
+            long          count,
+            const double* x,
+            const double* y,
+            const double* z,
+            double*       longitudes,
+            double*       latitudes,
+            double*       heights,
+            const char**  status );
+
       private:
     
          /* Ellipsoid Parameters */
@@ -189,11 +218,38 @@ namespace MSP
             double &R4oa,
             char *ellipsoidCode);
 
+         /**
+          * Converts one point to easting and northing, given the false
+          * easting and northing of the origin.  Returns the error
+          * message, or 0 if the point was converted.
+          */
+         const char* fromGeodetic(
+            double  longitude,
+            double  latitude,
+            double  falseEasting,
+            double  falseNorthing,
+            double &easting,
+            double &northing );
+
+         /**
+          * Converts one point to longitude and latitude, given the false
+          * easting and northing of the origin.  Returns the error
+          * message, or 0 if the point was converted.
+          */
+         const char* toGeodetic(
+            double  easting,
+            double  northing,
+            double  falseEasting,
+            double  falseNorthing,
+            double &longitude,
+            double &latitude );
+
          /**
           * Check if latitude and longitude are in valid range.
           * Note that deltaLon is longitude - longitude of central meridian
+          * Returns the error message, or 0 if they are valid.
           */
-         static void checkLatLon( double latitude, double deltaLon );
+         static const char* checkLatLon( double latitude, double deltaLon );
 
          /**
           * Hyperbolic arc tangent.
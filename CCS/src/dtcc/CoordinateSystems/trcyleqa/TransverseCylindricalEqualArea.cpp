@@ -133,7 +133,7 @@ TransverseCylindricalEqualArea::TransverseCylindricalEqualArea(
    double falseEasting,
    double falseNorthing,
    double scaleFactor ) :
-  CoordinateSystem(),
+  PointBatchCoordinateSystem< TransverseCylindricalEqualArea, MapProjectionCoordinates >(),
   es2( 0.0066943799901413800 ),      
   es4( 4.4814723452405e-005 ),        
   es6( 3.0000678794350e-007 ),        
@@ -632,4 +632,5 @@ double TransverseCylindricalEqualArea::TCEA_L(
   return Beta + c0lat + c1lat + c2lat;
 }
 
+
 // CLASSIFICATION: UNCLASSIFIED
@@ -83,7 +83,7 @@
  */
 
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 
 namespace MSP
@@ -100,7 +100,7 @@ namespace MSP
      *                              DEFINES
      */
 
-    class TransverseCylindricalEqualArea : public CoordinateSystem
+    class TransverseCylindricalEqualArea : public PointBatchCoordinateSystem< TransverseCylindricalEqualArea, MapProjectionCoordinates >
     {
     public:
 
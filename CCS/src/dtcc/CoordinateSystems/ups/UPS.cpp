@@ -74,6 +74,7 @@
  *    Date              Description
  *    ----              -----------
  *    2-27-07          Original Code
+ *    10-19-26         Added batch conversions
  *
  *
  */
@@ -85,6 +86,7 @@
  */
 
 #include <math.h>
+#include <vector>
 #include "UPS.h"
 #include "PolarStereographic.h"
 #include "PolarStereographicScaleFactorParameters.h"
@@ -318,4 +320,181 @@ MSP::CCS::GeodeticCoordinates* UPS::convertToGeodetic( MSP::CCS::UPSCoordinates*
   return geodeticCoordinates;
 }
 
+
+void UPS::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   char*         hemispheres,
+   double*       eastings,
+   double*       northings,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts count geodetic
+ * coordinates to UPS coordinates.  The points of each hemisphere are
+ * converted by one Polar Stereographic batch conversion.
+ *
+ *    longitudes    : Longitudes in radians                     (input)
+ *    latitudes     : Latitudes in radians                      (input)
+ *    hemispheres   : Hemispheres either 'N' or 'S'            (output)
+ *    eastings      : Eastings/X in meters                     (output)
+ *    northings     : Northings/Y in meters                    (output)
+ *    status        : Error message of each point, or 0        (output)
+ */
+
+  long i, k;
+
+  for( i = 0; i < count; i++ )
+  {
+    double latitude = latitudes[i];
+
+    if ((latitude < -MAX_LAT) || (latitude > MAX_LAT))
+      status[i] = ErrorMessages::latitude;
+    else if ((latitude < 0) && (latitude >= (MAX_SOUTH_LAT + EPSILON)))
+      status[i] = ErrorMessages::latitude;
+    else if ((latitude >= 0) && (latitude < (MIN_NORTH_LAT - EPSILON)))
+      status[i] = ErrorMessages::latitude;
+    else if ((longitudes[i] < -PI) || (longitudes[i] > (2 * PI)))
+      status[i] = ErrorMessages::longitude;
+    else
+    {
+      status[i] = 0;
+      hemispheres[i] = (latitude < 0) ? 'S' : 'N';
+    }
+  }
+
+  if( count <= 0 )
+    return;
+
+  std::vector<long>        index( count );
+  std::vector<double>      lon( count );
+  std::vector<double>      lat( count );
+  std::vector<double>      x( count );
+  std::vector<double>      y( count );
+  std::vector<const char*> error( count );
+
+  for( int h = 0; h < 2; h++ )
+  {
+    char hemisphere = (h == 0) ? 'N' : 'S';
+    long num = 0;
+
+    for( i = 0; i < count; i++ )
+    {
+      if( !status[i] && ( hemispheres[i] == hemisphere ) )
+      {
+        index[num] = i;
+        lon[num] = longitudes[i];
+        lat[num] = latitudes[i];
+        num++;
+      }
+    }
+
+    if( num == 0 )
+      continue;
+
+    polarStereographicMap[hemisphere]->convertFromGeodeticBatch(
+       num, &lon[0], &lat[0], 0, &x[0], &y[0], 0, &error[0] );
+
+    for( k = 0; k < num; k++ )
+    {
+      i = index[k];
+      if( error[k] )
+        status[i] = error[k];
+      else
+      {
+        eastings[i] = x[k];
+        northings[i] = y[k];
+      }
+    }
+  }
+}
+
+
+void UPS::convertToGeodeticBatch(
+   long          count,
+   const char*   hemispheres,
+   const double* eastings,
+   const double* northings,
+   double*       longitudes,
+   double*       latitudes,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts count UPS coordinates to
+ * geodetic coordinates.  The points of each hemisphere are converted by
+ * one Polar Stereographic batch conversion.
+ *
+ *    hemispheres   : Hemispheres either 'N' or 'S'             (input)
+ *    eastings      : Eastings/X in meters                      (input)
+ *    northings     : Northings/Y in meters                     (input)
+ *    longitudes    : Longitudes in radians                    (output)
+ *    latitudes     : Latitudes in radians                     (output)
+ *    status        : Error message of each point, or 0        (output)
+ */
+
+  long i, k;
+
+  for( i = 0; i < count; i++ )
+  {
+    if ((hemispheres[i] != 'N') && (hemispheres[i] != 'S'))
+      status[i] = ErrorMessages::hemisphere;
+    else if ((eastings[i] < MIN_EAST_NORTH) || (eastings[i] > MAX_EAST_NORTH))
+      status[i] = ErrorMessages::easting;
+    else if ((northings[i] < MIN_EAST_NORTH) || (northings[i] > MAX_EAST_NORTH))
+      status[i] = ErrorMessages::northing;
+    else
+      status[i] = 0;
+  }
+
+  if( count <= 0 )
+    return;
+
+  std::vector<long>        index( count );
+  std::vector<double>      x( count );
+  std::vector<double>      y( count );
+  std::vector<double>      lon( count );
+  std::vector<double>      lat( count );
+  std::vector<const char*> error( count );
+
+  for( int h = 0; h < 2; h++ )
+  {
+    char hemisphere = (h == 0) ? 'N' : 'S';
+    long num = 0;
+
+    for( i = 0; i < count; i++ )
+    {
+      if( !status[i] && ( hemispheres[i] == hemisphere ) )
+      {
+        index[num] = i;
+        x[num] = eastings[i];
+        y[num] = northings[i];
+        num++;
+      }
+    }
+
+    if( num == 0 )
+      continue;
+
+    polarStereographicMap[hemisphere]->convertToGeodeticBatch(
+       num, &x[0], &y[0], 0, &lon[0], &lat[0], 0, &error[0] );
+
+    for( k = 0; k < num; k++ )
+    {
+      i = index[k];
+      if( error[k] )
+        status[i] = error[k];
+      else if ((lat[k] < 0) && (lat[k] >= (MAX_SOUTH_LAT + EPSILON)))
+        status[i] = ErrorMessages::latitude;
+      else if ((lat[k] >= 0) && (lat[k] < (MIN_NORTH_LAT - EPSILON)))
+        status[i] = ErrorMessages::latitude;
+      else
+      {
+        longitudes[i] = lon[k];
+        latitudes[i] = lat[k];
+      }
+    }
+  }
+}
+
 // CLASSIFICATION: UNCLASSIFIED
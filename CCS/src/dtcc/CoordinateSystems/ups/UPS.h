@@ -77,6 +77,7 @@
  *    Date              Description
  *    ----              -----------
  *    2-27-07          Original Code
+ *    10-19-26         Added batch conversions
  *
  *
  */
@@ -156,6 +157,62 @@ namespace MSP
 
       MSP::CCS::GeodeticCoordinates* convertToGeodetic( MSP::CCS::UPSCoordinates* upsCoordinates );
 
+
+      /*
+       * The function convertFromGeodeticBatch converts count geodetic
+       * coordinates, held in contiguous arrays, to UPS coordinates
+       * according to the current ellipsoid parameters.  The hemisphere of
+       * every point is found first, and the points of each hemisphere are
+       * then converted together by its Polar Stereographic batch
+       * conversion.  Errors are reported through status as for
+       * CoordinateSystem's batch conversions.
+       *
+       *    count       : Number of points                          (input)
+       *    longitudes  : Longitudes in radians                     (input)
+       *    latitudes   : Latitudes in radians                      (input)
+       *    hemispheres : Hemispheres either 'N' or 'S'            (output)
+       *    eastings    : Eastings/X in meters                     (output)
+       *    northings   : Northings/Y in meters                    (output)
+       *    status      : Error message of each point, or 0        (output)
+       */
+
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         char*         hemispheres,
+         double*       eastings,
+         double*       northings,
+         const char**  status );
+
+
+      /*
+       * The function convertToGeodeticBatch converts count UPS
+       * coordinates, held in contiguous arrays, to geodetic coordinates,
+       * converting the points of each hemisphere together.  Errors are
+       * reported through status as for convertFromGeodeticBatch.
+       *
+       *    count       : Number of points                          (input)
+       *    hemispheres : Hemispheres either 'N' or 'S'             (input)
+       *    eastings    : Eastings/X in meters                      (input)
+       *    northings   : Northings/Y in meters                     (input)
+       *    longitudes  : Longitudes in radians                    (output)
+       *    latitudes   : Latitudes in radians                     (output)
+       *    status      : Error message of each point, or 0        (output)
+       */
+
+      void convertToGeodeticBatch(
+         long          count,
+         const char*   hemispheres,
+         const double* eastings,
+         const double* northings,
+         double*       longitudes,
+         double*       latitudes,
+         const char**  status );
+
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
+
     private:
 
       std::map< char, PolarStereographic* > polarStereographicMap;
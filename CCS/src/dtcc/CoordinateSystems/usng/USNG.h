@@ -72,18 +72,20 @@
  *    Date              Description
  *    ----              -----------
  *    3-1-07          Original Code (cloned from MGRS)
+ *    10-19-26        Conversions are made by GridReference, shared with
+ *                    MGRS; added batch conversions
  */
 
 
 #include "CoordinateSystem.h"
+#include "GridReference.h"
+#include "GridReferenceString.h"
 
 
 namespace MSP
 {
   namespace CCS
   {
-    class UPS;
-    class UTM;
     class EllipsoidParameters;
     class MGRSorUSNGCoordinates;
     class GeodeticCoordinates;
@@ -91,6 +93,7 @@ namespace MSP
     class UTMCoordinates;
 
     #define USNG_LETTERS 3
+    #define USNG_STRING_SIZE GRID_REFERENCE_STRING_SIZE  /* batch strings */
 
     /**********************************************************************/
     /*
@@ -229,126 +232,58 @@ namespace MSP
 
       MSP::CCS::UPSCoordinates* convertToUPS( MSP::CCS::MGRSorUSNGCoordinates* mgrsorUSNGCoordinates );
 
-    private:
-    
-      UPS* ups;
-      UTM* utm;
-
-      char USNGEllipsoidCode[3];
-
-
       /*
-       * The function fromUTM calculates an USNG coordinate string
-       * based on the zone, latitude, easting and northing.
+       * The function convertFromGeodeticBatch converts count geodetic
+       * coordinates, held in contiguous arrays, to USNG coordinate strings,
+       * according to the current ellipsoid parameters, as MGRS's
+       * convertFromGeodeticBatch does.  The strings are written
+       * USNG_STRING_SIZE characters apart, null terminated.
        *
-       *    zone       : Zone number             (input)
-       *    latitude   : Latitude in radians     (input)
-       *    easting    : Easting                 (input)
-       *    northing   : Northing                (input)
-       *    precision  : Precision               (input)
-       *    USNGString : USNG coordinate string  (output)
+       *    count       : Number of points                          (input)
+       *    longitudes  : Longitudes in radians                     (input)
+       *    latitudes   : Latitudes in radians                      (input)
+       *    precision   : Precision level of USNG strings           (input)
+       *    USNGStrings : USNG coordinate strings                  (output)
+       *    status      : Error message of each point, or 0        (output)
        */
 
-      MSP::CCS::MGRSorUSNGCoordinates* fromUTM( MSP::CCS::UTMCoordinates* utmCoordinates, double longitude, double latitude, long precision );
+      void convertFromGeodeticBatch(
+         long          count,
+         const double* longitudes,
+         const double* latitudes,
+         long          precision,
+         char*         USNGStrings,
+         const char**  status );
 
 
       /*
-       * The function toUTM converts an USNG coordinate string
-       * to UTM projection (zone, hemisphere, easting and northing) coordinates
-       * according to the current ellipsoid parameters.  If any errors occur,
-       * an exception is thrown with a description of the error.
+       * The function convertToGeodeticBatch converts count USNG coordinate
+       * strings, held USNG_STRING_SIZE characters apart, to geodetic
+       * coordinates according to the current ellipsoid parameters.  Errors
+       * are reported through status; warnings are not reported.
        *
-       *    USNGString : USNG coordinate string           (input)
-       *    zone       : UTM zone                         (output)
-       *    hemisphere : North or South hemisphere        (output)
-       *    easting    : Easting (X) in meters            (output)
-       *    northing   : Northing (Y) in meters           (output)
+       *    count       : Number of points                          (input)
+       *    USNGStrings : USNG coordinate strings                   (input)
+       *    longitudes  : Longitudes in radians                    (output)
+       *    latitudes   : Latitudes in radians                     (output)
+       *    status      : Error message of each point, or 0        (output)
        */
 
-      UTMCoordinates* toUTM( long zone, long letters[USNG_LETTERS], double easting, double northing, long in_precision );
+      void convertToGeodeticBatch(
+         long          count,
+         const char*   USNGStrings,
+         double*       longitudes,
+         double*       latitudes,
+         const char**  status );
 
+      using CoordinateSystem::convertFromGeodeticBatch;
+      using CoordinateSystem::convertToGeodeticBatch;
 
-      /*
-       * The function fromUPS converts UPS (hemisphere, easting, 
-       * and northing) coordinates to an USNG coordinate string according to 
-       * the current ellipsoid parameters.  
-       *
-       *    hemisphere    : Hemisphere either 'N' or 'S'     (input)
-       *    easting       : Easting/X in meters              (input)
-       *    northing      : Northing/Y in meters             (input)
-       *    precision     : Precision level of USNG string   (input)
-       *    USNGString    : USNG coordinate string           (output)
-       */
-
-      MSP::CCS::MGRSorUSNGCoordinates* fromUPS( MSP::CCS::UPSCoordinates* upsCoordinates, long precision );
-
-      /*
-       * The function toUPS converts an USNG coordinate string
-       * to UPS (hemisphere, easting, and northing) coordinates, according
-       * to the current ellipsoid parameters. If any errors occur, an
-       * exception is thrown with a description of the error.
-       *
-       *    USNGString    : USNG coordinate string           (input)
-       *    hemisphere    : Hemisphere either 'N' or 'S'     (output)
-       *    easting       : Easting/X in meters              (output)
-       *    northing      : Northing/Y in meters             (output)
-       */
-
-      MSP::CCS::UPSCoordinates* toUPS( long letters[USNG_LETTERS], double easting, double northing );
-
-  
-      /*
-       * The function getGridValues sets the letter range used for 
-       * the 2nd letter in the USNG coordinate string, based on the set 
-       * number of the utm zone. It also sets the pattern offset using a
-       * value of A for the second letter of the grid square, based on 
-       * the grid pattern and set number of the utm zone.
-       *
-       *    zone            : Zone number             (input)
-       *    ltr2_low_value  : 2nd letter low number   (output)
-       *    ltr2_high_value : 2nd letter high number  (output)
-       *    pattern_offset  : Pattern offset          (output)
-       */
-
-      void getGridValues( long zone, long* ltr2_low_value, long* ltr2_high_value, double* pattern_offset );
-
-
-      /*
-       * The function getLatitudeBandMinNorthing receives a latitude band letter
-       * and uses the Latitude_Band_Table to determine the minimum northing and northing offset
-       * for that latitude band letter.
-       *
-       *   letter          : Latitude band letter             (input)
-       *   min_northing    : Minimum northing for that letter	(output)
-       *   northing_offset : Latitude band northing offset  	(output)
-       */
-
-      void getLatitudeBandMinNorthing( long letter, double* min_northing, double* northing_offset );
-
-
-      /*
-       * The function getLatitudeRange receives a latitude band letter
-       * and uses the Latitude_Band_Table to determine the latitude band 
-       * boundaries for that latitude band letter.
-       *
-       *   letter   : Latitude band letter                        (input)
-       *   north    : Northern latitude boundary for that letter	(output)
-       *   north    : Southern latitude boundary for that letter	(output)
-       */
-
-      void getLatitudeRange( long letter, double* north, double* south );
+    private:
 
-    
-      /*
-       * The function getLatitudeLetter receives a latitude value
-       * and uses the Latitude_Band_Table to determine the latitude band 
-       * letter for that latitude.
-       *
-       *   latitude   : Latitude              (input)
-       *   letter     : Latitude band letter  (output)
-       */
+      GridReference< USNGGrid >* grid;
 
-      void getLatitudeLetter( double latitude, int* letter );
+      char USNGEllipsoidCode[3];
     };
   }
 }
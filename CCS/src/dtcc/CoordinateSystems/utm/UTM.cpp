@@ -75,6 +75,8 @@
  *						and passes ellipsoid code to TransMercator
  *	  1-21-16	  KC	BAE_MSP00030211, removed the shift from longitude.
  *						Shift is applied when determining the zone. 
+ *    10-19-26          Added zone-grouped batch conversions; the zone
+ *                      selection is shared with convertFromGeodetic.
  *
  */
 
@@ -85,6 +87,7 @@
  */
 
 #include <math.h>
+#include <vector>
 #include "UTM.h"
 #include "TransverseMercator.h"
 #include "UTMParameters.h"
@@ -291,6 +294,24 @@ UTMParameters* UTM::getParameters() const
 }
 
 
+const char* UTM::checkGeodetic(
+   const MSP::CCS::GeodeticCoordinates* geodeticCoordinates ) const
+{
+/*
+ * The function checkGeodetic checks that geodetic coordinates are within
+ * the latitude and longitude range of convertFromGeodetic, without
+ * throwing.  It returns the message of the error convertFromGeodetic would
+ * throw, or 0 if the coordinates are in range.
+ *
+ *    longitude         : Longitude in radians                (input)
+ *    latitude          : Latitude in radians                 (input)
+ */
+
+  return checkLatLon(
+     geodeticCoordinates->longitude(), geodeticCoordinates->latitude() );
+}
+
+
 MSP::CCS::UTMCoordinates* UTM::convertFromGeodetic(
    MSP::CCS::GeodeticCoordinates* geodeticCoordinates,
    int                            utmZoneOverride )
@@ -310,8 +331,6 @@ MSP::CCS::UTMCoordinates* UTM::convertFromGeodetic(
  *    northing          : Northing (Y) in meters              (output)
  */
 
-  long Lat_Degrees;
-  long Long_Degrees;
   long temp_zone;
   char hemisphere;
   double False_Northing = 0;
@@ -319,75 +338,14 @@ MSP::CCS::UTMCoordinates* UTM::convertFromGeodetic(
   double longitude = geodeticCoordinates->longitude();
   double latitude  = geodeticCoordinates->latitude();
 
-  if ((latitude < (MIN_LAT - EPSILON)) || (latitude >= (MAX_LAT + EPSILON)))
-  { /* latitude out of range */
-    throw CoordinateConversionException( ErrorMessages::latitude );
-  }
-  if ((longitude < (-PI - EPSILON)) || (longitude > (2*PI + EPSILON)))
-  { /* longitude out of range */
-    throw CoordinateConversionException( ErrorMessages::longitude );
-  }
-
-  if((latitude > -1.0e-9) && (latitude < 0))
-    latitude = 0.0;
-
-  if (longitude < 0)
-    longitude += (2*PI);
-
-  Lat_Degrees = (long)(latitude * 180.0 / PI);
-  Long_Degrees = (long)(longitude * 180.0 / PI);
-
-  if (longitude < PI)
-    temp_zone = (long)(31 + (((longitude+1.0e-10) * 180.0 / PI) / 6.0));
-  else
-    temp_zone = (long)((((longitude+1.0e-10) * 180.0 / PI) / 6.0) - 29);
+  const char* error = checkGeodetic( geodeticCoordinates );
+  if( error )
+    throw CoordinateConversionException( error );
 
-  if (temp_zone > 60)
-    temp_zone = 1;
-
-  /* allow UTM zone override up to +/- one zone of the calculated zone */  
-  if( utmZoneOverride )
-  {
-    if ((temp_zone == 1) && (utmZoneOverride == 60))
-      temp_zone = utmZoneOverride;
-    else if ((temp_zone == 60) && (utmZoneOverride == 1))
-      temp_zone = utmZoneOverride;
-    else if (((temp_zone-1) <= utmZoneOverride) &&
-              (utmZoneOverride <= (temp_zone+1)))
-      temp_zone = utmZoneOverride;
-    else
-      throw CoordinateConversionException( ErrorMessages::zoneOverride );
-  }
-  else if( UTM_Override )
-  {
-    if ((temp_zone == 1) && (UTM_Override == 60))
-      temp_zone = UTM_Override;
-    else if ((temp_zone == 60) && (UTM_Override == 1))
-      temp_zone = UTM_Override;
-    else if (((temp_zone-1) <= UTM_Override) &&
-              (UTM_Override <= (temp_zone+1)))
-      temp_zone = UTM_Override;
-    else
-      throw CoordinateConversionException( ErrorMessages::zoneOverride );
-  }
-  else /* not UTM zone override */
-  {
-    /* check for special zone cases over southern Norway and Svalbard */
-    if ((Lat_Degrees > 55) && (Lat_Degrees < 64) && (Long_Degrees > -1)
-        && (Long_Degrees < 3))
-      temp_zone = 31;
-    if ((Lat_Degrees > 55) && (Lat_Degrees < 64) && (Long_Degrees > 2)
-        && (Long_Degrees < 12))
-      temp_zone = 32;
-    if ((Lat_Degrees > 71) && (Long_Degrees > -1) && (Long_Degrees < 9))
-      temp_zone = 31;
-    if ((Lat_Degrees > 71) && (Long_Degrees > 8) && (Long_Degrees < 21))
-      temp_zone = 33;
-    if ((Lat_Degrees > 71) && (Long_Degrees > 20) && (Long_Degrees < 33))
-      temp_zone = 35;
-    if ((Lat_Degrees > 71) && (Long_Degrees > 32) && (Long_Degrees < 42))
-      temp_zone = 37;
-  }
+  error = selectZone( longitude, latitude,
+     utmZoneOverride ? utmZoneOverride : UTM_Override, temp_zone );
+  if( error )
+    throw CoordinateConversionException( error );
  
   TransverseMercator *transverseMercator = transverseMercatorMap[temp_zone];
 
@@ -482,4 +440,384 @@ MSP::CCS::GeodeticCoordinates* UTM::convertToGeodetic(
   return geodeticCoordinates;
 }
 
+
+void UTM::convertFromGeodeticBatch(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   long*         zones,
+   char*         hemispheres,
+   double*       eastings,
+   double*       northings,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticBatch converts count geodetic coordinates
+ * to UTM coordinates according to the current ellipsoid and UTM zone
+ * override parameters.  The zone of every point is found first, then the
+ * points of each zone are converted together.
+ *
+ *    longitudes        : Longitudes in radians               (input)
+ *    latitudes         : Latitudes in radians                (input)
+ *    zones             : UTM zones                           (output)
+ *    hemispheres       : North or South hemispheres          (output)
+ *    eastings          : Eastings (X) in meters              (output)
+ *    northings         : Northings (Y) in meters             (output)
+ *    status            : Error message of each point, or 0   (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude  = latitudes[i];
+
+    status[i] = checkLatLon( longitude, latitude );
+    if( !status[i] )
+      status[i] = selectZone( longitude, latitude, UTM_Override, zones[i] );
+  }
+
+  convertInZones( count, longitudes, latitudes, zones,
+     hemispheres, eastings, northings, status );
+}
+
+
+void UTM::convertFromGeodeticInZones(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const long*   zones,
+   char*         hemispheres,
+   double*       eastings,
+   double*       northings,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticInZones converts count geodetic
+ * coordinates to UTM coordinates in the given zones.
+ *
+ *    longitudes        : Longitudes in radians               (input)
+ *    latitudes         : Latitudes in radians                (input)
+ *    zones             : UTM zones                           (input)
+ *    hemispheres       : North or South hemispheres          (output)
+ *    eastings          : Eastings (X) in meters              (output)
+ *    northings         : Northings (Y) in meters             (output)
+ *    status            : Error message of each point, or 0   (output)
+ */
+
+  for( long i = 0; i < count; i++ )
+  {
+    status[i] = checkLatLon( longitudes[i], latitudes[i] );
+    if( !status[i] && ( ( zones[i] < 1 ) || ( zones[i] > 60 ) ) )
+      status[i] = ErrorMessages::zone;
+  }
+
+  convertInZones( count, longitudes, latitudes, zones,
+     hemispheres, eastings, northings, status );
+}
+
+
+void UTM::convertToGeodeticBatch(
+   long          count,
+   const long*   zones,
+   const char*   hemispheres,
+   const double* eastings,
+   const double* northings,
+   double*       longitudes,
+   double*       latitudes,
+   const char**  status )
+{
+/*
+ * The function convertToGeodeticBatch converts count UTM coordinates to
+ * geodetic coordinates.  The points are sorted by zone, with a counting
+ * sort, and the points of each zone are converted by one Transverse
+ * Mercator batch conversion.
+ *
+ *    zones             : UTM zones                           (input)
+ *    hemispheres       : North or South hemispheres          (input)
+ *    eastings          : Eastings (X) in meters              (input)
+ *    northings         : Northings (Y) in meters             (input)
+ *    longitudes        : Longitudes in radians               (output)
+ *    latitudes         : Latitudes in radians                (output)
+ *    status            : Error message of each point, or 0   (output)
+ */
+
+  long first[62];   /* first[zone] is the first sorted point of the zone */
+  long zone;
+  long i, k;
+
+  for( zone = 0; zone < 62; zone++ )
+    first[zone] = 0;
+
+  for( i = 0; i < count; i++ )
+  {
+    if ((zones[i] < 1) || (zones[i] > 60))
+      status[i] = ErrorMessages::zone;
+    else if ((hemispheres[i] != 'S') && (hemispheres[i] != 'N'))
+      status[i] = ErrorMessages::hemisphere;
+    else if ((eastings[i] < MIN_EASTING) || (eastings[i] > MAX_EASTING))
+      status[i] = ErrorMessages::easting;
+    else if ((northings[i] < MIN_NORTHING) || (northings[i] > MAX_NORTHING))
+      status[i] = ErrorMessages::northing;
+    else
+    {
+      status[i] = 0;
+      first[zones[i] + 1]++;
+    }
+  }
+
+  for( zone = 1; zone < 62; zone++ )
+    first[zone] += first[zone - 1];
+
+  long num = first[61];
+  if( num == 0 )
+    return;
+
+  std::vector<long>        index( num );
+  std::vector<double>      x( num );
+  std::vector<double>      y( num );
+  std::vector<double>      lon( num );
+  std::vector<double>      lat( num );
+  std::vector<const char*> error( num );
+
+  long next[62];
+  for( zone = 0; zone < 62; zone++ )
+    next[zone] = first[zone];
+
+  for( i = 0; i < count; i++ )
+  {
+    if( status[i] )
+      continue;
+
+    k = next[zones[i]]++;
+    index[k] = i;
+    x[k] = eastings[i];
+    y[k] = northings[i];
+    if (hemispheres[i] == 'S')
+      y[k] -= 10000000;
+  }
+
+  for( zone = 1; zone <= 60; zone++ )
+  {
+    long start = first[zone];
+    if( first[zone + 1] > start )
+    {
+      transverseMercatorMap[zone]->convertToGeodeticBatch(
+         first[zone + 1] - start, &x[start], &y[start], 0,
+         &lon[start], &lat[start], 0, &error[start] );
+    }
+  }
+
+  for( k = 0; k < num; k++ )
+  {
+    i = index[k];
+    if( error[k] )
+      status[i] = error[k];
+    else if ((lat[k] < (MIN_LAT - EPSILON)) || (lat[k] >= (MAX_LAT + EPSILON)))
+      status[i] = ErrorMessages::northing;
+    else
+    {
+      longitudes[i] = lon[k];
+      latitudes[i]  = lat[k];
+    }
+  }
+}
+
+
+const char* UTM::checkLatLon( double longitude, double latitude )
+{
+  if ((latitude < (MIN_LAT - EPSILON)) || (latitude >= (MAX_LAT + EPSILON)))
+  { /* latitude out of range */
+    return ErrorMessages::latitude;
+  }
+  if ((longitude < (-PI - EPSILON)) || (longitude > (2*PI + EPSILON)))
+  { /* longitude out of range */
+    return ErrorMessages::longitude;
+  }
+
+  return 0;
+}
+
+
+const char* UTM::selectZone(
+   double &longitude,
+   double &latitude,
+   long   zoneOverride,
+   long   &zone ) const
+{
+/*
+ * The function selectZone returns in zone the UTM zone of a point, the
+ * natural zone, the override zone, or the special zone over southern
+ * Norway or Svalbard, and shifts the longitude and latitude as they are
+ * converted.  It returns ErrorMessages::zoneOverride if the override zone
+ * is not next to the natural zone, or 0.
+ *
+ *    longitude         : Longitude in radians         (input/output)
+ *    latitude          : Latitude in radians          (input/output)
+ *    zoneOverride      : UTM zone override, or 0             (input)
+ *    zone              : UTM zone                           (output)
+ */
+
+  long Lat_Degrees;
+  long Long_Degrees;
+  long temp_zone;
+
+  if((latitude > -1.0e-9) && (latitude < 0))
+    latitude = 0.0;
+
+  if (longitude < 0)
+    longitude += (2*PI);
+
+  Lat_Degrees = (long)(latitude * 180.0 / PI);
+  Long_Degrees = (long)(longitude * 180.0 / PI);
+
+  if (longitude < PI)
+    temp_zone = (long)(31 + (((longitude+1.0e-10) * 180.0 / PI) / 6.0));
+  else
+    temp_zone = (long)((((longitude+1.0e-10) * 180.0 / PI) / 6.0) - 29);
+
+  if (temp_zone > 60)
+    temp_zone = 1;
+
+  /* allow UTM zone override up to +/- one zone of the calculated zone */  
+  if( zoneOverride )
+  {
+    if ((temp_zone == 1) && (zoneOverride == 60))
+      temp_zone = zoneOverride;
+    else if ((temp_zone == 60) && (zoneOverride == 1))
+      temp_zone = zoneOverride;
+    else if (((temp_zone-1) <= zoneOverride) &&
+              (zoneOverride <= (temp_zone+1)))
+      temp_zone = zoneOverride;
+    else
+      return ErrorMessages::zoneOverride;
+  }
+  else /* not UTM zone override */
+  {
+    /* check for special zone cases over southern Norway and Svalbard */
+    if ((Lat_Degrees > 55) && (Lat_Degrees < 64) && (Long_Degrees > -1)
+        && (Long_Degrees < 3))
+      temp_zone = 31;
+    if ((Lat_Degrees > 55) && (Lat_Degrees < 64) && (Long_Degrees > 2)
+        && (Long_Degrees < 12))
+      temp_zone = 32;
+    if ((Lat_Degrees > 71) && (Long_Degrees > -1) && (Long_Degrees < 9))
+      temp_zone = 31;
+    if ((Lat_Degrees > 71) && (Long_Degrees > 8) && (Long_Degrees < 21))
+      temp_zone = 33;
+    if ((Lat_Degrees > 71) && (Long_Degrees > 20) && (Long_Degrees < 33))
+      temp_zone = 35;
+    if ((Lat_Degrees > 71) && (Long_Degrees > 32) && (Long_Degrees < 42))
+      temp_zone = 37;
+  }
+
+  zone = temp_zone;
+  return 0;
+}
+
+
+void UTM::convertInZones(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   const long*   zones,
+   char*         hemispheres,
+   double*       eastings,
+   double*       northings,
+   const char**  status )
+{
+/*
+ * The function convertInZones converts the points whose status is 0 in
+ * the zones given, as convertToGeodeticBatch does, sorting them by zone
+ * and converting the points of each zone by one Transverse Mercator batch
+ * conversion.
+ */
+
+  long first[62];   /* first[zone] is the first sorted point of the zone */
+  long zone;
+  long i, k;
+
+  for( zone = 0; zone < 62; zone++ )
+    first[zone] = 0;
+
+  for( i = 0; i < count; i++ )
+  {
+    if( !status[i] )
+      first[zones[i] + 1]++;
+  }
+
+  for( zone = 1; zone < 62; zone++ )
+    first[zone] += first[zone - 1];
+
+  long num = first[61];
+  if( num == 0 )
+    return;
+
+  std::vector<long>        index( num );
+  std::vector<double>      lon( num );
+  std::vector<double>      lat( num );
+  std::vector<double>      x( num );
+  std::vector<double>      y( num );
+  std::vector<const char*> error( num );
+
+  long next[62];
+  for( zone = 0; zone < 62; zone++ )
+    next[zone] = first[zone];
+
+  for( i = 0; i < count; i++ )
+  {
+    if( status[i] )
+      continue;
+
+    k = next[zones[i]]++;
+    index[k] = i;
+    lon[k] = longitudes[i];
+    lat[k] = latitudes[i];
+    if((lat[k] > -1.0e-9) && (lat[k] < 0))
+      lat[k] = 0.0;
+    if (lon[k] < 0)
+      lon[k] += (2*PI);
+  }
+
+  for( zone = 1; zone <= 60; zone++ )
+  {
+    long start = first[zone];
+    if( first[zone + 1] > start )
+    {
+      transverseMercatorMap[zone]->convertFromGeodeticBatch(
+         first[zone + 1] - start, &lon[start], &lat[start], 0,
+         &x[start], &y[start], 0, &error[start] );
+    }
+  }
+
+  for( k = 0; k < num; k++ )
+  {
+    i = index[k];
+    if( error[k] )
+    {
+      status[i] = error[k];
+      continue;
+    }
+
+    double northing = y[k];
+    char hemisphere = 'N';
+    if (lat[k] < 0)
+    {
+      northing += 10000000;
+      hemisphere = 'S';
+    }
+
+    if ((x[k] < MIN_EASTING) || (x[k] > MAX_EASTING))
+      status[i] = ErrorMessages::easting;
+    else if ((northing < MIN_NORTHING) || (northing > MAX_NORTHING))
+      status[i] = ErrorMessages::northing;
+    else
+    {
+      hemispheres[i] = hemisphere;
+      eastings[i]    = x[k];
+      northings[i]   = northing;
+    }
+  }
+}
+
+
 // CLASSIFICATION: UNCLASSIFIED
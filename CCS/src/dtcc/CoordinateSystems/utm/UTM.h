@@ -74,6 +74,8 @@
  *                for each fromGeodetic call.  The override in the call has
  *                precedence over what is set in the class constructor.
  *    5-09-11     DR 28908, add default constructor
+ *    10-19-26    Added checkGeodetic, a non-throwing range check
+ *    10-19-26    Added zone-grouped batch conversions
  * 
  *    1/16/2016   A. Layne MSP_DR30125 Updated constructor to receive ellipsoid 
  *				  code from callers
@@ -166,6 +168,20 @@ namespace MSP
                int                            utmZoneOverride = 0 );
 
 
+            /*
+             * The function checkGeodetic checks that geodetic coordinates
+             * are within the latitude and longitude range of
+             * convertFromGeodetic, without throwing.  It returns the message
+             * of the error convertFromGeodetic would throw, or 0.
+             *
+             *    longitude       : Longitude in radians              (input)
+             *    latitude        : Latitude in radians               (input)
+             */
+
+            const char* checkGeodetic(
+               const MSP::CCS::GeodeticCoordinates* geodeticCoordinates ) const;
+
+
             /*
              * The function convertToGeodetic converts UTM projection (zone, 
              * hemisphere, easting and northing) coordinates to geodetic
@@ -184,7 +200,115 @@ namespace MSP
             MSP::CCS::GeodeticCoordinates* convertToGeodetic(
                MSP::CCS::UTMCoordinates* utmCoordinates );
 
+
+            /*
+             * The function convertFromGeodeticBatch converts count geodetic
+             * coordinates, held in contiguous arrays, to UTM coordinates
+             * according to the current ellipsoid and UTM zone override
+             * parameters.  The zone of every point is found first, and the
+             * points of each zone are then converted together by the zone's
+             * Transverse Mercator batch conversion.  Errors are reported
+             * through status as for CoordinateSystem's batch conversions.
+             *
+             *    count       : Number of points                        (input)
+             *    longitudes  : Longitudes in radians                   (input)
+             *    latitudes   : Latitudes in radians                    (input)
+             *    zones       : UTM zones                              (output)
+             *    hemispheres : North or South hemispheres             (output)
+             *    eastings    : Eastings (X) in meters                 (output)
+             *    northings   : Northings (Y) in meters                (output)
+             *    status      : Error message of each point, or 0      (output)
+             */
+
+            void convertFromGeodeticBatch(
+               long          count,
+               const double* longitudes,
+               const double* latitudes,
+               long*         zones,
+               char*         hemispheres,
+               double*       eastings,
+               double*       northings,
+               const char**  status );
+
+
+            /*
+             * The function convertFromGeodeticInZones converts count
+             * geodetic coordinates to UTM coordinates in the zones given
+             * for each point, as convertFromGeodeticBatch does once it has
+             * found the zones.  Zones are not checked against the natural
+             * zone of the point.
+             *
+             *    count       : Number of points                        (input)
+             *    longitudes  : Longitudes in radians                   (input)
+             *    latitudes   : Latitudes in radians                    (input)
+             *    zones       : UTM zones, 1 to 60                      (input)
+             *    hemispheres : North or South hemispheres             (output)
+             *    eastings    : Eastings (X) in meters                 (output)
+             *    northings   : Northings (Y) in meters                (output)
+             *    status      : Error message of each point, or 0      (output)
+             */
+
+            void convertFromGeodeticInZones(
+               long          count,
+               const double* longitudes,
+               const double* latitudes,
+               const long*   zones,
+               char*         hemispheres,
+               double*       eastings,
+               double*       northings,
+               const char**  status );
+
+
+            /*
+             * The function convertToGeodeticBatch converts count UTM
+             * coordinates, held in contiguous arrays, to geodetic
+             * coordinates, converting the points of each zone together.
+             * Errors are reported through status as for
+             * convertFromGeodeticBatch.
+             *
+             *    count       : Number of points                        (input)
+             *    zones       : UTM zones                               (input)
+             *    hemispheres : North or South hemispheres              (input)
+             *    eastings    : Eastings (X) in meters                  (input)
+             *    northings   : Northings (Y) in meters                 (input)
+             *    longitudes  : Longitudes in radians                  (output)
+             *    latitudes   : Latitudes in radians                   (output)
+             *    status      : Error message of each point, or 0      (output)
+             */
+
+            void convertToGeodeticBatch(
+               long          count,
+               const long*   zones,
+               const char*   hemispheres,
+               const double* eastings,
+               const double* northings,
+               double*       longitudes,
+               double*       latitudes,
+               const char**  status );
+
+            using CoordinateSystem::convertFromGeodeticBatch;
+            using CoordinateSystem::convertToGeodeticBatch;
+
          private:
+
+            static const char* checkLatLon( double longitude, double latitude );
+
+            const char* selectZone(
+               double &longitude,
+               double &latitude,
+               long   zoneOverride,
+               long   &zone ) const;
+
+            void convertInZones(
+               long          count,
+               const double* longitudes,
+               const double* latitudes,
+               const long*   zones,
+               char*         hemispheres,
+               double*       eastings,
+               double*       northings,
+               const char**  status );
+
             char   ellipsCode[3];
 
             std::map< int, TransverseMercator* > transverseMercatorMap;
@@ -22,6 +22,8 @@
  *    Date              Description
  *    ----              -----------
  *    06-14-14          Original Code
+ *    10-19-26          Added conversions to and from the tiles of the
+ *                      Web Mercator tile pyramid, tile bounds and quadkeys
  *
  */
 
@@ -50,10 +52,15 @@ using namespace MSP::CCS;
 
 //                               DEFINES
 const double PI = 3.14159265358979323e0;
+const double TWO_PI = 2.0 * PI;
+
+// Latitude of the north edge of the tile pyramid, where northing is PI
+// times the semi-major axis
+const double MAX_TILE_LAT = 2.0 * atan( exp( PI ) ) - PI/2.0;
 
 
 WebMercator::WebMercator( char* ellipsoidCode ) :
-  CoordinateSystem( 6378137.0, 0.0 )
+  PointBatchCoordinateSystem< WebMercator, MapProjectionCoordinates >( 6378137.0, 0.0 )
 {
    /*
     * The constructor receives the ellipsoid code which must be "WE"
@@ -110,4 +117,265 @@ MSP::CCS::GeodeticCoordinates* WebMercator::convertToGeodetic(
      CoordinateType::geodetic, longitude, latitude );
 }
 
+
+void WebMercator::convertFromGeodeticToTiles(
+   long          count,
+   const double* longitudes,
+   const double* latitudes,
+   long          zoom,
+   long*         tileX,
+   long*         tileY,
+   double*       pixelX,
+   double*       pixelY,
+   const char**  status )
+{
+/*
+ * The function convertFromGeodeticToTiles converts count geodetic
+ * coordinates to tiles and pixel positions at a zoom level, setting the
+ * status of each point.  Positions are first found in tiles, easting and
+ * northing divided by the width of a tile.
+ *
+ *    count      : Number of points                       (input)
+ *    longitudes : Longitudes in radians                  (input)
+ *    latitudes  : Latitudes in radians                   (input)
+ *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+ *    tileX      : Tile columns                          (output)
+ *    tileY      : Tile rows                             (output)
+ *    pixelX     : Pixels east of the tile's west edge   (output)
+ *    pixelY     : Pixels south of the tile's north edge (output)
+ *    status     : Error message of each point, or 0     (output)
+ */
+
+  if( (zoom < 0) || (zoom > WEBM_MAX_ZOOM) )
+  {
+    for( long i = 0; i < count; i++ )
+      status[i] = ErrorMessages::webmZoom;
+    return;
+  }
+
+  const double tiles = ldexp( 1.0, (int)zoom );  // Tiles along each side
+  const double tilesPerRadian = tiles / TWO_PI;
+
+  for( long i = 0; i < count; i++ )
+  {
+    double longitude = longitudes[i];
+    double latitude  = latitudes[i];
+
+    if( (latitude < -MAX_TILE_LAT) || (latitude > MAX_TILE_LAT) )
+    {
+      status[i] = ErrorMessages::latitude;
+      continue;
+    }
+    if( (longitude < -PI) || (longitude > TWO_PI) )
+    {
+      status[i] = ErrorMessages::longitude;
+      continue;
+    }
+    if( longitude > PI )
+      longitude -= TWO_PI;
+
+    double x = (longitude + PI) * tilesPerRadian;
+    double y = (PI - log( tan( PI/4.0 + latitude / 2.0 ) )) * tilesPerRadian;
+    if( x > tiles )
+      x = tiles;
+    if( y < 0.0 )
+      y = 0.0;
+    else if( y > tiles )
+      y = tiles;
+
+    double column = floor( x );
+    double row    = floor( y );
+    if( column > tiles - 1.0 )
+      column = tiles - 1.0;
+    if( row > tiles - 1.0 )
+      row = tiles - 1.0;
+
+    tileX[i]  = (long)column;
+    tileY[i]  = (long)row;
+    pixelX[i] = (x - column) * WEBM_TILE_SIZE;
+    pixelY[i] = (y - row) * WEBM_TILE_SIZE;
+    status[i] = 0;
+  }
+}
+
+
+void WebMercator::convertFromTilesToGeodetic(
+   long          count,
+   long          zoom,
+   const long*   tileX,
+   const long*   tileY,
+   const double* pixelX,
+   const double* pixelY,
+   double*       longitudes,
+   double*       latitudes,
+   const char**  status )
+{
+/*
+ * The function convertFromTilesToGeodetic converts count pixel positions
+ * in tiles at a zoom level to geodetic coordinates, setting the status of
+ * each point.
+ *
+ *    count      : Number of points                       (input)
+ *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+ *    tileX      : Tile columns                           (input)
+ *    tileY      : Tile rows                              (input)
+ *    pixelX     : Pixels east of the tile's west edge    (input)
+ *    pixelY     : Pixels south of the tile's north edge  (input)
+ *    longitudes : Longitudes in radians                 (output)
+ *    latitudes  : Latitudes in radians                  (output)
+ *    status     : Error message of each point, or 0     (output)
+ */
+
+  if( (zoom < 0) || (zoom > WEBM_MAX_ZOOM) )
+  {
+    for( long i = 0; i < count; i++ )
+      status[i] = ErrorMessages::webmZoom;
+    return;
+  }
+
+  const long tiles = 1L << zoom;
+  const double radiansPerTile = TWO_PI / tiles;
+
+  for( long i = 0; i < count; i++ )
+  {
+    if( (tileX[i] < 0) || (tileX[i] >= tiles)
+        || (tileY[i] < 0) || (tileY[i] >= tiles)
+        || !(pixelX[i] >= 0.0) || (pixelX[i] > WEBM_TILE_SIZE)
+        || !(pixelY[i] >= 0.0) || (pixelY[i] > WEBM_TILE_SIZE) )
+    {
+      status[i] = ErrorMessages::webmTile;
+      continue;
+    }
+
+    double x = tileX[i] + pixelX[i] / WEBM_TILE_SIZE;
+    double y = tileY[i] + pixelY[i] / WEBM_TILE_SIZE;
+
+    longitudes[i] = x * radiansPerTile - PI;
+    latitudes[i]  = 2.0 * atan( exp( PI - y * radiansPerTile ) ) - PI/2.0;
+    status[i] = 0;
+  }
+}
+
+
+long WebMercator::computeTileBounds(
+   long    zoom,
+   long    westTileX,
+   long    northTileY,
+   long    eastTileX,
+   long    southTileY,
+   double* westLongitudes,
+   double* southLatitudes,
+   double* eastLongitudes,
+   double* northLatitudes,
+   long    maxTiles )
+{
+/*
+ * The function computeTileBounds returns the number of tiles in a range of
+ * columns and rows at a zoom level, and writes the bounds of the first
+ * maxTiles of them row by row from the north west.
+ *
+ *    zoom           : Zoom level, 0 to WEBM_MAX_ZOOM      (input)
+ *    westTileX      : First tile column                  (input)
+ *    northTileY     : First tile row                     (input)
+ *    eastTileX      : Last tile column                   (input)
+ *    southTileY     : Last tile row                      (input)
+ *    westLongitudes : West edges in radians             (output)
+ *    southLatitudes : South edges in radians            (output)
+ *    eastLongitudes : East edges in radians             (output)
+ *    northLatitudes : North edges in radians            (output)
+ *    maxTiles       : Number of bounds that fit          (input)
+ */
+
+  if( (zoom < 0) || (zoom > WEBM_MAX_ZOOM) )
+    throw CoordinateConversionException( ErrorMessages::webmZoom );
+
+  const long tiles = 1L << zoom;
+  const double radiansPerTile = TWO_PI / tiles;
+
+  if( (westTileX < 0) || (eastTileX >= tiles) || (westTileX > eastTileX)
+      || (northTileY < 0) || (southTileY >= tiles) || (northTileY > southTileY) )
+    throw CoordinateConversionException( ErrorMessages::webmTile );
+
+  long columns = eastTileX - westTileX + 1;
+  long rows = southTileY - northTileY + 1;
+  long written = 0;
+
+  double north = 2.0 * atan( exp( PI - northTileY * radiansPerTile ) ) - PI/2.0;
+  for( long row = northTileY; (row <= southTileY) && (written < maxTiles); row++ )
+  {
+    double south = 2.0 * atan( exp( PI - (row + 1) * radiansPerTile ) ) - PI/2.0;
+
+    for( long column = westTileX; (column <= eastTileX) && (written < maxTiles); column++ )
+    {
+      westLongitudes[written] = column * radiansPerTile - PI;
+      eastLongitudes[written] = (column + 1) * radiansPerTile - PI;
+      southLatitudes[written] = south;
+      northLatitudes[written] = north;
+      written++;
+    }
+
+    north = south;
+  }
+
+  return columns * rows;
+}
+
+
+void WebMercator::convertTilesToQuadkeys(
+   long          count,
+   long          zoom,
+   const long*   tileX,
+   const long*   tileY,
+   char*         quadkeys,
+   const char**  status )
+{
+/*
+ * The function convertTilesToQuadkeys writes the quadkeys of count tiles
+ * at a zoom level WEBM_QUADKEY_SIZE characters apart, setting the status
+ * of each tile.  The digit for each level, from the first, is the bit of
+ * the column at that level plus twice the bit of the row.
+ *
+ *    count      : Number of tiles                        (input)
+ *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+ *    tileX      : Tile columns                           (input)
+ *    tileY      : Tile rows                              (input)
+ *    quadkeys   : Quadkey strings                       (output)
+ *    status     : Error message of each tile, or 0      (output)
+ */
+
+  const char* zoomError = 0;
+  if( (zoom < 0) || (zoom > WEBM_MAX_ZOOM) )
+    zoomError = ErrorMessages::webmZoom;
+
+  const long tiles = zoomError ? 0 : (1L << zoom);
+
+  for( long i = 0; i < count; i++ )
+  {
+    char* quadkey = quadkeys + i * WEBM_QUADKEY_SIZE;
+    quadkey[0] = '\0';
+
+    if( zoomError )
+    {
+      status[i] = zoomError;
+      continue;
+    }
+    if( (tileX[i] < 0) || (tileX[i] >= tiles)
+        || (tileY[i] < 0) || (tileY[i] >= tiles) )
+    {
+      status[i] = ErrorMessages::webmTile;
+      continue;
+    }
+
+    for( long level = 0; level < zoom; level++ )
+    {
+      long shift = zoom - 1 - level;
+      quadkey[level] = (char)('0' + ((tileX[i] >> shift) & 1)
+                                  + 2 * ((tileY[i] >> shift) & 1));
+    }
+    quadkey[zoom] = '\0';
+    status[i] = 0;
+  }
+}
+
+
 // CLASSIFICATION: UNCLASSIFIED
@@ -37,10 +37,12 @@
  *    Date              Description
  *    ----              -----------
  *    06-14-14          Original Code
+ *    10-19-26          Added conversions to and from the tiles of the
+ *                      Web Mercator tile pyramid, tile bounds and quadkeys
  *
  */
 
-#include "CoordinateSystem.h"
+#include "CoordinateSystemBatch.h"
 
 namespace MSP
 {
@@ -54,7 +56,11 @@ namespace MSP
      *                              DEFINES
      */
 
-      class WebMercator : public CoordinateSystem
+      #define WEBM_TILE_SIZE    256                  /* Pixels along a tile side */
+      #define WEBM_MAX_ZOOM     30
+      #define WEBM_QUADKEY_SIZE (WEBM_MAX_ZOOM + 1)  /* batch quadkeys */
+
+      class WebMercator : public PointBatchCoordinateSystem< WebMercator, MapProjectionCoordinates >
       {
       public:
 
@@ -110,6 +116,133 @@ namespace MSP
          MSP::CCS::GeodeticCoordinates* convertToGeodetic(
             MSP::CCS::MapProjectionCoordinates* mapProjectionCoordinates );
 
+
+         /*
+          * The tile pyramid divides the square of Web Mercator coordinates
+          * between latitudes of about 85.05 degrees S and N into 2^zoom by
+          * 2^zoom tiles of WEBM_TILE_SIZE by WEBM_TILE_SIZE pixels at each
+          * zoom level.  Tiles are numbered east from 180 degrees W and
+          * south from the north edge; pixels are measured from the north
+          * west corner of their tile.  The positions are those of the
+          * easting and northing of convertFromGeodetic and
+          * convertToGeodetic.
+          */
+
+         /*
+          * The function convertFromGeodeticToTiles converts count geodetic
+          * coordinates, held in contiguous arrays, to the tiles containing
+          * them at a zoom level, and their pixel positions in those tiles.
+          * Points on the east or south edge of the pyramid are given to the
+          * last tile.  Points that cannot be converted are not thrown as
+          * exceptions: status[i] is set to the error message, or to 0 when
+          * point i was converted.
+          *
+          *    count      : Number of points                       (input)
+          *    longitudes : Longitudes in radians                  (input)
+          *    latitudes  : Latitudes in radians                   (input)
+          *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+          *    tileX      : Tile columns                          (output)
+          *    tileY      : Tile rows                             (output)
+          *    pixelX     : Pixels east of the tile's west edge   (output)
+          *    pixelY     : Pixels south of the tile's north edge (output)
+          *    status     : Error message of each point, or 0     (output)
+          */
+
+         void convertFromGeodeticToTiles(
+            long          count,
+            const double* longitudes,
+            const double* latitudes,
+            long          zoom,
+            long*         tileX,
+            long*         tileY,
+            double*       pixelX,
+            double*       pixelY,
+            const char**  status );
+
+         /*
+          * The function convertFromTilesToGeodetic converts count pixel
+          * positions in tiles at a zoom level to geodetic coordinates.
+          * Pixel positions run from 0 to WEBM_TILE_SIZE, the far edges of
+          * their tiles.  Errors are reported through status as for
+          * convertFromGeodeticToTiles.
+          *
+          *    count      : Number of points                       (input)
+          *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+          *    tileX      : Tile columns                           (input)
+          *    tileY      : Tile rows                              (input)
+          *    pixelX     : Pixels east of the tile's west edge    (input)
+          *    pixelY     : Pixels south of the tile's north edge  (input)
+          *    longitudes : Longitudes in radians                 (output)
+          *    latitudes  : Latitudes in radians                  (output)
+          *    status     : Error message of each point, or 0     (output)
+          */
+
+         void convertFromTilesToGeodetic(
+            long          count,
+            long          zoom,
+            const long*   tileX,
+            const long*   tileY,
+            const double* pixelX,
+            const double* pixelY,
+            double*       longitudes,
+            double*       latitudes,
+            const char**  status );
+
+         /*
+          * The function computeTileBounds returns the number of tiles at a
+          * zoom level from column westTileX to eastTileX and from row
+          * northTileY to southTileY, inclusive, and writes the bounds of
+          * the first maxTiles of them row by row from the north west.  Each
+          * column and row is converted once.  If any errors occur, an
+          * exception is thrown with a description of the error.
+          *
+          *    zoom           : Zoom level, 0 to WEBM_MAX_ZOOM      (input)
+          *    westTileX      : First tile column                  (input)
+          *    northTileY     : First tile row                     (input)
+          *    eastTileX      : Last tile column                   (input)
+          *    southTileY     : Last tile row                      (input)
+          *    westLongitudes : West edges in radians             (output)
+          *    southLatitudes : South edges in radians            (output)
+          *    eastLongitudes : East edges in radians             (output)
+          *    northLatitudes : North edges in radians            (output)
+          *    maxTiles       : Number of bounds that fit          (input)
+          */
+
+         long computeTileBounds(
+            long    zoom,
+            long    westTileX,
+            long    northTileY,
+            long    eastTileX,
+            long    southTileY,
+            double* westLongitudes,
+            double* southLatitudes,
+            double* eastLongitudes,
+            double* northLatitudes,
+            long    maxTiles );
+
+         /*
+          * The function convertTilesToQuadkeys writes the quadkeys of count
+          * tiles at a zoom level, strings of zoom digits from 0 to 3 naming
+          * the quarter of the tile taken at each level, WEBM_QUADKEY_SIZE
+          * characters apart and null terminated.  Errors are reported
+          * through status as for convertFromGeodeticToTiles.
+          *
+          *    count      : Number of tiles                        (input)
+          *    zoom       : Zoom level, 0 to WEBM_MAX_ZOOM         (input)
+          *    tileX      : Tile columns                           (input)
+          *    tileY      : Tile rows                              (input)
+          *    quadkeys   : Quadkey strings                       (output)
+          *    status     : Error message of each tile, or 0      (output)
+          */
+
+         void convertTilesToQuadkeys(
+            long          count,
+            long          zoom,
+            const long*   tileX,
+            const long*   tileY,
+            char*         quadkeys,
+            const char**  status );
+
       private:
          
       /* Ellipsoid Parameters, must be WGS84  */
@@ -0,0 +1,48 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+/****************************************************************************
+* FILE:           CollectionOrder.h
+*  
+*
+* DESCRIPTION:  This file contains an enum with the orders in which the
+*               points of a collection can be converted.
+*
+* LIMITATIONS/ASSUMPTIONS:  hilbert is slower than input, except for
+*               conversions that reload gridded data such as EGM2008
+*               heights (see CoordinateConversionService::setCollectionOrder).
+*
+* MODIFICATION HISTORY:
+*
+* PROGRAMMER: 
+*
+* DATE        NAME              DR#               DESCRIPTION
+* 
+* 10/19/26                                        Original Code
+* 
+*****************************************************************************/
+
+#ifndef CollectionOrder_H
+#define CollectionOrder_H
+
+
+namespace MSP
+{
+  namespace CCS
+  {
+    class CollectionOrder
+    {
+    public:
+
+      enum Enum
+      {
+        input,
+        hilbert
+      };
+    };
+  }
+}
+	
+#endif 
+
+
+// CLASSIFICATION: UNCLASSIFIED
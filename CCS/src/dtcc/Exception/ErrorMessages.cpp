@@ -44,6 +44,8 @@ const char* ErrorMessages::nzmgEllipsoid    = "New Zealand Map Grid ellipsoid mu
 const char* ErrorMessages::webmEllipsoid    = "Web Mercator ellipsoid must be WGS84\n";
 const char* ErrorMessages::webmConversionTo = "GeoTrans does not allow conversion to Web Mercator\n";
 const char* ErrorMessages::webmInvalidTargetCS = "Web Mercator can only be converted to Geodetic.\n";
+const char* ErrorMessages::webmZoom         = "Web Mercator zoom level must be between 0 and 30\n";
+const char* ErrorMessages::webmTile         = "Web Mercator tile or pixel is outside the tile pyramid\n";
 const char* ErrorMessages::latitude1        = "Latitude 1 out of range\n";
 const char* ErrorMessages::latitude2        = "Latitude 2 out of range\n";
 const char* ErrorMessages::latitude1_2      = "Latitude 1 and Latitude 2 cannot be equal\n";
@@ -70,6 +72,10 @@ const char* ErrorMessages::usngString   = "Invalid USNG String\n";
 const char* ErrorMessages::invalidIndex = "Index value outside of valid range\n";
 const char* ErrorMessages::invalidName  = "Invalid name\n";
 const char* ErrorMessages::invalidType  = "Invalid coordinate system type\n";
+const char* ErrorMessages::collectionSize = "Coordinate and accuracy lists differ in size\n";
+const char* ErrorMessages::batchConversion = "Batch conversion is not supported by this coordinate system\n";
+const char* ErrorMessages::approximation = "Invalid approximation area, error bound, degree or depth\n";
+const char* ErrorMessages::rasterWarp = "Invalid raster size, node spacing or tolerance\n";
 
 const char* ErrorMessages::longitude_min = "The longitude minute part of the string is greater than 60\n";
 const char* ErrorMessages::latitude_min  = "The latitude minute part of the string is greater than 60\n";
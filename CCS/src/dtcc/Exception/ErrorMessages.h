@@ -62,6 +62,8 @@ namespace MSP
          static const char* webmEllipsoid;
          static const char* webmConversionTo;
          static const char* webmInvalidTargetCS;
+         static const char* webmZoom;
+         static const char* webmTile;
          static const char* latitude1;
          static const char* latitude2;
          static const char* latitude1_2;
@@ -99,6 +101,10 @@ namespace MSP
          static const char* invalidIndex;
          static const char* invalidName;
          static const char* invalidType;
+         static const char* collectionSize;
+         static const char* batchConversion;
+         static const char* approximation;
+         static const char* rasterWarp;
          static const char* latitude_min;
          static const char* longitude_min;
       };
@@ -29,1175 +29,513 @@
 #include "UTMCoordinates.h"
 #include "CoordinateSystemParameters.h"
 #include "ThrowException.h"
+#include "JNICCSObjectTranslator.h"
 
 
 using namespace MSP::CCS;
 
 
+/*
+ *  Class, field and method IDs used by the translator.  They are resolved
+ *  once by JNI_OnLoad; the classes are held as global references so the
+ *  IDs stay valid until JNI_OnUnload.
+ */
+static JNICCSClassCache classCache;
+
+
+static jclass findGlobalClass( JNIEnv *env, const char* name )
+{
+  jclass localClass = env->FindClass( name );
+  if( localClass == NULL )
+    return NULL;
+
+  jclass globalClass = (jclass)env->NewGlobalRef( localClass );
+  env->DeleteLocalRef( localClass );
+
+  return globalClass;
+}
+
+
+static bool initClassCache( JNIEnv *env )
+{
+  JNICCSClassCache& c = classCache;
+
+  // Parameters
+  if( !( c.coordinateSystemParametersClass = findGlobalClass( env, "geotrans3/parameters/CoordinateSystemParameters" ) ) ||
+      !( c.equidistantCylindricalParametersClass = findGlobalClass( env, "geotrans3/parameters/EquidistantCylindricalParameters" ) ) ||
+      !( c.geodeticParametersClass = findGlobalClass( env, "geotrans3/parameters/GeodeticParameters" ) ) ||
+      !( c.localCartesianParametersClass = findGlobalClass( env, "geotrans3/parameters/LocalCartesianParameters" ) ) ||
+      !( c.mapProjection3ParametersClass = findGlobalClass( env, "geotrans3/parameters/MapProjection3Parameters" ) ) ||
+      !( c.mapProjection4ParametersClass = findGlobalClass( env, "geotrans3/parameters/MapProjection4Parameters" ) ) ||
+      !( c.mapProjection5ParametersClass = findGlobalClass( env, "geotrans3/parameters/MapProjection5Parameters" ) ) ||
+      !( c.mapProjection6ParametersClass = findGlobalClass( env, "geotrans3/parameters/MapProjection6Parameters" ) ) ||
+      !( c.mercatorStandardParallelParametersClass = findGlobalClass( env, "geotrans3/parameters/MercatorStandardParallelParameters" ) ) ||
+      !( c.mercatorScaleFactorParametersClass = findGlobalClass( env, "geotrans3/parameters/MercatorScaleFactorParameters" ) ) ||
+      !( c.neysParametersClass = findGlobalClass( env, "geotrans3/parameters/NeysParameters" ) ) ||
+      !( c.obliqueMercatorParametersClass = findGlobalClass( env, "geotrans3/parameters/ObliqueMercatorParameters" ) ) ||
+      !( c.polarStereographicStandardParallelParametersClass = findGlobalClass( env, "geotrans3/parameters/PolarStereographicStandardParallelParameters" ) ) ||
+      !( c.polarStereographicScaleFactorParametersClass = findGlobalClass( env, "geotrans3/parameters/PolarStereographicScaleFactorParameters" ) ) ||
+      !( c.utmParametersClass = findGlobalClass( env, "geotrans3/parameters/UTMParameters" ) ) )
+    return false;
+
+  // Coordinates
+  if( !( c.coordinateTupleClass = findGlobalClass( env, "geotrans3/coordinates/CoordinateTuple" ) ) ||
+      !( c.bngCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/BNGCoordinates" ) ) ||
+      !( c.cartesianCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/CartesianCoordinates" ) ) ||
+      !( c.garsCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/GARSCoordinates" ) ) ||
+      !( c.geodeticCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/GeodeticCoordinates" ) ) ||
+      !( c.georefCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/GEOREFCoordinates" ) ) ||
+      !( c.mapProjectionCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/MapProjectionCoordinates" ) ) ||
+      !( c.mgrsOrUSNGCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/MGRSorUSNGCoordinates" ) ) ||
+      !( c.stringCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/StringCoordinates" ) ) ||
+      !( c.upsCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/UPSCoordinates" ) ) ||
+      !( c.utmCoordinatesClass = findGlobalClass( env, "geotrans3/coordinates/UTMCoordinates" ) ) ||
+      !( c.accuracyClass = findGlobalClass( env, "geotrans3/coordinates/Accuracy" ) ) ||
+      !( c.convertResultsClass = findGlobalClass( env, "geotrans3/coordinates/ConvertResults" ) ) ||
+      !( c.convertCollectionResultsClass = findGlobalClass( env, "geotrans3/coordinates/ConvertCollectionResults" ) ) ||
+      !( c.vectorClass = findGlobalClass( env, "java/util/Vector" ) ) )
+    return false;
+
+  // Parameter fields
+  if( !( c.parametersCoordinateTypeField = env->GetFieldID( c.coordinateSystemParametersClass, "coordinateType", "I" ) ) ||
+      !( c.geodeticHeightTypeField = env->GetFieldID( c.geodeticParametersClass, "heightType", "I" ) ) ||
+      !( c.eqdcylCentralMeridianField = env->GetFieldID( c.equidistantCylindricalParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.eqdcylStandardParallelField = env->GetFieldID( c.equidistantCylindricalParametersClass, "standardParallel", "D" ) ) ||
+      !( c.eqdcylFalseEastingField = env->GetFieldID( c.equidistantCylindricalParametersClass, "falseEasting", "D" ) ) ||
+      !( c.eqdcylFalseNorthingField = env->GetFieldID( c.equidistantCylindricalParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.locCartLongitudeField = env->GetFieldID( c.localCartesianParametersClass, "longitude", "D" ) ) ||
+      !( c.locCartLatitudeField = env->GetFieldID( c.localCartesianParametersClass, "latitude", "D" ) ) ||
+      !( c.locCartHeightField = env->GetFieldID( c.localCartesianParametersClass, "height", "D" ) ) ||
+      !( c.locCartOrientationField = env->GetFieldID( c.localCartesianParametersClass, "orientation", "D" ) ) ||
+      !( c.mp3CentralMeridianField = env->GetFieldID( c.mapProjection3ParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mp3FalseEastingField = env->GetFieldID( c.mapProjection3ParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mp3FalseNorthingField = env->GetFieldID( c.mapProjection3ParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.mp4CentralMeridianField = env->GetFieldID( c.mapProjection4ParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mp4OriginLatitudeField = env->GetFieldID( c.mapProjection4ParametersClass, "originLatitude", "D" ) ) ||
+      !( c.mp4FalseEastingField = env->GetFieldID( c.mapProjection4ParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mp4FalseNorthingField = env->GetFieldID( c.mapProjection4ParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.mp5CentralMeridianField = env->GetFieldID( c.mapProjection5ParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mp5OriginLatitudeField = env->GetFieldID( c.mapProjection5ParametersClass, "originLatitude", "D" ) ) ||
+      !( c.mp5ScaleFactorField = env->GetFieldID( c.mapProjection5ParametersClass, "scaleFactor", "D" ) ) ||
+      !( c.mp5FalseEastingField = env->GetFieldID( c.mapProjection5ParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mp5FalseNorthingField = env->GetFieldID( c.mapProjection5ParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.mp6CentralMeridianField = env->GetFieldID( c.mapProjection6ParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mp6OriginLatitudeField = env->GetFieldID( c.mapProjection6ParametersClass, "originLatitude", "D" ) ) ||
+      !( c.mp6StandardParallel1Field = env->GetFieldID( c.mapProjection6ParametersClass, "standardParallel1", "D" ) ) ||
+      !( c.mp6StandardParallel2Field = env->GetFieldID( c.mapProjection6ParametersClass, "standardParallel2", "D" ) ) ||
+      !( c.mp6FalseEastingField = env->GetFieldID( c.mapProjection6ParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mp6FalseNorthingField = env->GetFieldID( c.mapProjection6ParametersClass, "falseNorthing", "D" ) ) )
+    return false;
+
+  if( !( c.mercSPCentralMeridianField = env->GetFieldID( c.mercatorStandardParallelParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mercSPStandardParallelField = env->GetFieldID( c.mercatorStandardParallelParametersClass, "standardParallel", "D" ) ) ||
+      !( c.mercSPScaleFactorField = env->GetFieldID( c.mercatorStandardParallelParametersClass, "scaleFactor", "D" ) ) ||
+      !( c.mercSPFalseEastingField = env->GetFieldID( c.mercatorStandardParallelParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mercSPFalseNorthingField = env->GetFieldID( c.mercatorStandardParallelParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.mercSFCentralMeridianField = env->GetFieldID( c.mercatorScaleFactorParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.mercSFScaleFactorField = env->GetFieldID( c.mercatorScaleFactorParametersClass, "scaleFactor", "D" ) ) ||
+      !( c.mercSFFalseEastingField = env->GetFieldID( c.mercatorScaleFactorParametersClass, "falseEasting", "D" ) ) ||
+      !( c.mercSFFalseNorthingField = env->GetFieldID( c.mercatorScaleFactorParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.neysCentralMeridianField = env->GetFieldID( c.neysParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.neysOriginLatitudeField = env->GetFieldID( c.neysParametersClass, "originLatitude", "D" ) ) ||
+      !( c.neysStandardParallel1Field = env->GetFieldID( c.neysParametersClass, "standardParallel1", "D" ) ) ||
+      !( c.neysFalseEastingField = env->GetFieldID( c.neysParametersClass, "falseEasting", "D" ) ) ||
+      !( c.neysFalseNorthingField = env->GetFieldID( c.neysParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.omercOriginLatitudeField = env->GetFieldID( c.obliqueMercatorParametersClass, "originLatitude", "D" ) ) ||
+      !( c.omercLongitude1Field = env->GetFieldID( c.obliqueMercatorParametersClass, "longitude1", "D" ) ) ||
+      !( c.omercLatitude1Field = env->GetFieldID( c.obliqueMercatorParametersClass, "latitude1", "D" ) ) ||
+      !( c.omercLongitude2Field = env->GetFieldID( c.obliqueMercatorParametersClass, "longitude2", "D" ) ) ||
+      !( c.omercLatitude2Field = env->GetFieldID( c.obliqueMercatorParametersClass, "latitude2", "D" ) ) ||
+      !( c.omercFalseEastingField = env->GetFieldID( c.obliqueMercatorParametersClass, "falseEasting", "D" ) ) ||
+      !( c.omercFalseNorthingField = env->GetFieldID( c.obliqueMercatorParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.omercScaleFactorField = env->GetFieldID( c.obliqueMercatorParametersClass, "scaleFactor", "D" ) ) ||
+      !( c.polarSPCentralMeridianField = env->GetFieldID( c.polarStereographicStandardParallelParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.polarSPStandardParallelField = env->GetFieldID( c.polarStereographicStandardParallelParametersClass, "standardParallel", "D" ) ) ||
+      !( c.polarSPFalseEastingField = env->GetFieldID( c.polarStereographicStandardParallelParametersClass, "falseEasting", "D" ) ) ||
+      !( c.polarSPFalseNorthingField = env->GetFieldID( c.polarStereographicStandardParallelParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.polarSFCentralMeridianField = env->GetFieldID( c.polarStereographicScaleFactorParametersClass, "centralMeridian", "D" ) ) ||
+      !( c.polarSFScaleFactorField = env->GetFieldID( c.polarStereographicScaleFactorParametersClass, "scaleFactor", "D" ) ) ||
+      !( c.polarSFHemisphereField = env->GetFieldID( c.polarStereographicScaleFactorParametersClass, "hemisphere", "C" ) ) ||
+      !( c.polarSFFalseEastingField = env->GetFieldID( c.polarStereographicScaleFactorParametersClass, "falseEasting", "D" ) ) ||
+      !( c.polarSFFalseNorthingField = env->GetFieldID( c.polarStereographicScaleFactorParametersClass, "falseNorthing", "D" ) ) ||
+      !( c.utmParamsZoneField = env->GetFieldID( c.utmParametersClass, "zone", "J" ) ) ||
+      !( c.utmParamsOverrideField = env->GetFieldID( c.utmParametersClass, "override", "J" ) ) )
+    return false;
+
+  // Coordinate and accuracy fields
+  if( !( c.coordinatesCoordinateTypeField = env->GetFieldID( c.coordinateTupleClass, "coordinateType", "I" ) ) ||
+      !( c.geodeticLongitudeField = env->GetFieldID( c.geodeticCoordinatesClass, "longitude", "D" ) ) ||
+      !( c.geodeticLatitudeField = env->GetFieldID( c.geodeticCoordinatesClass, "latitude", "D" ) ) ||
+      !( c.geodeticHeightField = env->GetFieldID( c.geodeticCoordinatesClass, "height", "D" ) ) ||
+      !( c.cartesianXField = env->GetFieldID( c.cartesianCoordinatesClass, "x", "D" ) ) ||
+      !( c.cartesianYField = env->GetFieldID( c.cartesianCoordinatesClass, "y", "D" ) ) ||
+      !( c.cartesianZField = env->GetFieldID( c.cartesianCoordinatesClass, "z", "D" ) ) ||
+      !( c.mapProjectionEastingField = env->GetFieldID( c.mapProjectionCoordinatesClass, "easting", "D" ) ) ||
+      !( c.mapProjectionNorthingField = env->GetFieldID( c.mapProjectionCoordinatesClass, "northing", "D" ) ) ||
+      !( c.stringCoordinateStringField = env->GetFieldID( c.stringCoordinatesClass, "coordinateString", "Ljava/lang/String;" ) ) ||
+      !( c.stringPrecisionField = env->GetFieldID( c.stringCoordinatesClass, "precision", "I" ) ) ||
+      !( c.upsHemisphereField = env->GetFieldID( c.upsCoordinatesClass, "hemisphere", "C" ) ) ||
+      !( c.upsEastingField = env->GetFieldID( c.upsCoordinatesClass, "easting", "D" ) ) ||
+      !( c.upsNorthingField = env->GetFieldID( c.upsCoordinatesClass, "northing", "D" ) ) ||
+      !( c.utmZoneField = env->GetFieldID( c.utmCoordinatesClass, "zone", "J" ) ) ||
+      !( c.utmHemisphereField = env->GetFieldID( c.utmCoordinatesClass, "hemisphere", "C" ) ) ||
+      !( c.utmEastingField = env->GetFieldID( c.utmCoordinatesClass, "easting", "D" ) ) ||
+      !( c.utmNorthingField = env->GetFieldID( c.utmCoordinatesClass, "northing", "D" ) ) ||
+      !( c.accuracyCE90Field = env->GetFieldID( c.accuracyClass, "ce90", "D" ) ) ||
+      !( c.accuracyLE90Field = env->GetFieldID( c.accuracyClass, "le90", "D" ) ) ||
+      !( c.accuracySE90Field = env->GetFieldID( c.accuracyClass, "se90", "D" ) ) )
+    return false;
+
+  // Constructors and methods
+  if( !( c.bngCoordinatesInit = env->GetMethodID( c.bngCoordinatesClass, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" ) ) ||
+      !( c.cartesianCoordinatesInit = env->GetMethodID( c.cartesianCoordinatesClass, "<init>", "(ILjava/lang/String;DDD)V" ) ) ||
+      !( c.garsCoordinatesInit = env->GetMethodID( c.garsCoordinatesClass, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" ) ) ||
+      !( c.geodeticCoordinatesInit = env->GetMethodID( c.geodeticCoordinatesClass, "<init>", "(ILjava/lang/String;DDD)V" ) ) ||
+      !( c.georefCoordinatesInit = env->GetMethodID( c.georefCoordinatesClass, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" ) ) ||
+      !( c.mapProjectionCoordinatesInit = env->GetMethodID( c.mapProjectionCoordinatesClass, "<init>", "(ILjava/lang/String;DD)V" ) ) ||
+      !( c.mgrsOrUSNGCoordinatesInit = env->GetMethodID( c.mgrsOrUSNGCoordinatesClass, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" ) ) ||
+      !( c.upsCoordinatesInit = env->GetMethodID( c.upsCoordinatesClass, "<init>", "(ILjava/lang/String;CDD)V" ) ) ||
+      !( c.utmCoordinatesInit = env->GetMethodID( c.utmCoordinatesClass, "<init>", "(ILjava/lang/String;JCDD)V" ) ) ||
+      !( c.accuracyInit = env->GetMethodID( c.accuracyClass, "<init>", "(DDD)V" ) ) ||
+      !( c.convertResultsInit = env->GetMethodID( c.convertResultsClass, "<init>", "(Lgeotrans3/coordinates/CoordinateTuple;Lgeotrans3/coordinates/Accuracy;)V" ) ) ||
+      !( c.convertCollectionResultsInit = env->GetMethodID( c.convertCollectionResultsClass, "<init>", "(Ljava/util/Vector;Ljava/util/Vector;)V" ) ) ||
+      !( c.vectorInit = env->GetMethodID( c.vectorClass, "<init>", "()V" ) ) ||
+      !( c.vectorSize = env->GetMethodID( c.vectorClass, "size", "()I" ) ) ||
+      !( c.vectorGet = env->GetMethodID( c.vectorClass, "get", "(I)Ljava/lang/Object;" ) ) ||
+      !( c.vectorAddElement = env->GetMethodID( c.vectorClass, "addElement", "(Ljava/lang/Object;)V" ) ) )
+    return false;
+
+  return true;
+}
+
+
+static void releaseClassCache( JNIEnv *env )
+{
+  jclass* classes[] =
+  {
+    &classCache.coordinateSystemParametersClass,
+    &classCache.equidistantCylindricalParametersClass,
+    &classCache.geodeticParametersClass,
+    &classCache.localCartesianParametersClass,
+    &classCache.mapProjection3ParametersClass,
+    &classCache.mapProjection4ParametersClass,
+    &classCache.mapProjection5ParametersClass,
+    &classCache.mapProjection6ParametersClass,
+    &classCache.mercatorStandardParallelParametersClass,
+    &classCache.mercatorScaleFactorParametersClass,
+    &classCache.neysParametersClass,
+    &classCache.obliqueMercatorParametersClass,
+    &classCache.polarStereographicStandardParallelParametersClass,
+    &classCache.polarStereographicScaleFactorParametersClass,
+    &classCache.utmParametersClass,
+    &classCache.coordinateTupleClass,
+    &classCache.bngCoordinatesClass,
+    &classCache.cartesianCoordinatesClass,
+    &classCache.garsCoordinatesClass,
+    &classCache.geodeticCoordinatesClass,
+    &classCache.georefCoordinatesClass,
+    &classCache.mapProjectionCoordinatesClass,
+    &classCache.mgrsOrUSNGCoordinatesClass,
+    &classCache.stringCoordinatesClass,
+    &classCache.upsCoordinatesClass,
+    &classCache.utmCoordinatesClass,
+    &classCache.accuracyClass,
+    &classCache.convertResultsClass,
+    &classCache.convertCollectionResultsClass,
+    &classCache.vectorClass
+  };
+
+  for( unsigned int i = 0; i < sizeof( classes ) / sizeof( classes[0] ); i++ )
+  {
+    if( *classes[i] )
+    {
+      env->DeleteGlobalRef( *classes[i] );
+      *classes[i] = NULL;
+    }
+  }
+
+  memset( &classCache, 0, sizeof( classCache ) );
+}
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-CoordinateSystemParameters* translateFromJNIParameters( JNIEnv *env, jobject parameters )
+JNIEXPORT jint JNICALL JNI_OnLoad( JavaVM *vm, void *reserved )
 {
-    jclass geodeticParametersClazz = env->FindClass( "geotrans3/parameters/GeodeticParameters" );
+  JNIEnv *env;
+  if( vm->GetEnv( (void**)&env, JNI_VERSION_1_4 ) != JNI_OK )
+    return JNI_ERR;
 
-    if( env->IsInstanceOf( parameters, geodeticParametersClazz ) )
-    {
-      jclass clazz = env->GetObjectClass( parameters );
+  if( !initClassCache( env ) )
+  {
+    releaseClassCache( env );
+    return JNI_ERR;
+  }
 
-      jfieldID fid = env->GetFieldID( clazz, "heightType", "I");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Height type field ID error." );
-          return 0;
-      }
+  return JNI_VERSION_1_4;
+}
 
-      return new GeodeticParameters( CoordinateType::geodetic, ( HeightType::Enum )env->GetIntField( parameters, fid ) );
-    }
-    else
-    {
-      jclass equidistantCylindricalParametersClazz = env->FindClass( "geotrans3/parameters/EquidistantCylindricalParameters" );
-
-      if( env->IsInstanceOf( parameters, equidistantCylindricalParametersClazz ) )
-      {
-        jclass clazz = env->GetObjectClass( parameters );
-
-        // Central Meridian
-        jfieldID fid = env->GetFieldID( clazz, "centralMeridian", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-            return 0;
-        }
-        double centralMeridian = env->GetDoubleField( parameters, fid );
-
-        // Standard Parallel
-        fid = env->GetFieldID( clazz, "standardParallel", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel field ID error." );
-            return 0;
-        }
-        double standardParallel = env->GetDoubleField( parameters, fid );
-
-        // False Easting
-        fid = env->GetFieldID( clazz, "falseEasting", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-            return 0;
-        }
-        double falseEasting = env->GetDoubleField( parameters, fid );
-
-        // False Northing
-        fid = env->GetFieldID( clazz, "falseNorthing", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-            return 0;
-        }
-        double falseNorthing = env->GetDoubleField( parameters, fid );
-
-        return new EquidistantCylindricalParameters( CoordinateType::equidistantCylindrical, centralMeridian, standardParallel, falseEasting, falseNorthing );
-      }
-      else
-      {
-        jclass localCartesianParametersClazz = env->FindClass( "geotrans3/parameters/LocalCartesianParameters" );
-
-        if( env->IsInstanceOf( parameters, localCartesianParametersClazz ) )
-        {
-          jclass clazz = env->GetObjectClass( parameters );
-
-          // Longitude
-          jfieldID fid = env->GetFieldID( clazz, "longitude", "D");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: longitude field ID error." );
-              return 0;
-          }
-          double longitude = env->GetDoubleField( parameters, fid );
-
-          // Latitude
-          fid = env->GetFieldID( clazz, "latitude", "D");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: latitude field ID error." );
-              return 0;
-          }
-          double latitude = env->GetDoubleField( parameters, fid );
-
-          // Height
-          fid = env->GetFieldID( clazz, "height", "D");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: height field ID error." );
-              return 0;
-          }
-          double height = env->GetDoubleField( parameters, fid );
-
-          // Orientation
-          fid = env->GetFieldID( clazz, "orientation", "D");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: orientation field ID error." );
-              return 0;
-          }
-          double orientation = env->GetDoubleField( parameters, fid );
-
-          return new LocalCartesianParameters( CoordinateType::localCartesian, longitude, latitude, height, orientation );
-        }
-        else
-        {
-          jclass mapProjection3ParametersClazz = env->FindClass( "geotrans3/parameters/MapProjection3Parameters" );
-
-          if( env->IsInstanceOf( parameters, mapProjection3ParametersClazz ) )
-          {
-            jclass clazz = env->GetObjectClass( parameters );
-
-            // Coordinate Type
-            jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                return 0;
-            }
-            CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-            // Central Meridian
-            fid = env->GetFieldID( clazz, "centralMeridian", "D");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                return 0;
-            }
-            double centralMeridian = env->GetDoubleField( parameters, fid );
-
-            // False Easting
-            fid = env->GetFieldID( clazz, "falseEasting", "D");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                return 0;
-            }
-            double falseEasting = env->GetDoubleField( parameters, fid );
-
-            // False Northing
-            fid = env->GetFieldID( clazz, "falseNorthing", "D");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                return 0;
-            }
-            double falseNorthing = env->GetDoubleField( parameters, fid );
-
-            return new MapProjection3Parameters( coordinateType, centralMeridian, falseEasting, falseNorthing );
-          }
-          else
-          {
-            jclass mapProjection4ParametersClazz = env->FindClass( "geotrans3/parameters/MapProjection4Parameters" );
-
-            if( env->IsInstanceOf( parameters, mapProjection4ParametersClazz ) )
-            {
-              jclass clazz = env->GetObjectClass( parameters );
-
-              // Coordinate Type
-              jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                  return 0;
-              }
-              CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-              // Central Meridian
-              fid = env->GetFieldID( clazz, "centralMeridian", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                  return 0;
-              }
-              double centralMeridian = env->GetDoubleField( parameters, fid );
-
-              // Origin Latitude
-              fid = env->GetFieldID( clazz, "originLatitude", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: originLatitude field ID error." );
-                  return 0;
-              }
-              double originLatitude = env->GetDoubleField( parameters, fid );
-
-              // False Easting
-              fid = env->GetFieldID( clazz, "falseEasting", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                  return 0;
-              }
-              double falseEasting = env->GetDoubleField( parameters, fid );
-
-              // False Northing
-              fid = env->GetFieldID( clazz, "falseNorthing", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                  return 0;
-              }
-              double falseNorthing = env->GetDoubleField( parameters, fid );
-
-              return new MapProjection4Parameters( coordinateType, centralMeridian, originLatitude, falseEasting, falseNorthing );
-            }
-            else
-            {
-              jclass mapProjection5ParametersClazz = env->FindClass( "geotrans3/parameters/MapProjection5Parameters" );
-
-              if( env->IsInstanceOf( parameters, mapProjection5ParametersClazz ) )
-              {
-                jclass clazz = env->GetObjectClass( parameters );
-
-                // Coordinate Type
-                jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                    return 0;
-                }
-                CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                // Central Meridian
-                fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                    return 0;
-                }
-                double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                // Origin Latitude
-                fid = env->GetFieldID( clazz, "originLatitude", "D");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: originLatitude field ID error." );
-                    return 0;
-                }
-                double originLatitude = env->GetDoubleField( parameters, fid );
-
-                // Scale Factor
-                fid = env->GetFieldID( clazz, "scaleFactor", "D");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: scaleFactor field ID error." );
-                    return 0;
-                }
-                double scaleFactor = env->GetDoubleField( parameters, fid );
-
-                // False Easting
-                fid = env->GetFieldID( clazz, "falseEasting", "D");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                    return 0;
-                }
-                double falseEasting = env->GetDoubleField( parameters, fid );
-
-                // False Northing
-                fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                if (fid == NULL)
-                {
-                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                    return 0;
-                }
-                double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                return new MapProjection5Parameters( coordinateType, centralMeridian, originLatitude, scaleFactor, falseEasting, falseNorthing );
-              }
-              else
-              {
-                jclass mapProjection6ParametersClazz = env->FindClass( "geotrans3/parameters/MapProjection6Parameters" );
-
-                if( env->IsInstanceOf( parameters, mapProjection6ParametersClazz ) )
-                {
-                  jclass clazz = env->GetObjectClass( parameters );
-
-                  // Coordinate Type
-                  jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                      return 0;
-                  }
-                  CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                  // Central Meridian
-                  fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                      return 0;
-                  }
-                  double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                  // Origin Latitude
-                  fid = env->GetFieldID( clazz, "originLatitude", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: originLatitude field ID error." );
-                      return 0;
-                  }
-                  double originLatitude = env->GetDoubleField( parameters, fid );
-
-                  // Standard Parallel 1
-                  fid = env->GetFieldID( clazz, "standardParallel1", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel1 field ID error." );
-                      return 0;
-                  }
-                  double standardParallel1 = env->GetDoubleField( parameters, fid );
-
-                  // Standard Parallel 2
-                  fid = env->GetFieldID( clazz, "standardParallel2", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel2 field ID error." );
-                      return 0;
-                  }
-                  double standardParallel2 = env->GetDoubleField( parameters, fid );
-
-                  // False Easting
-                  fid = env->GetFieldID( clazz, "falseEasting", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                      return 0;
-                  }
-                  double falseEasting = env->GetDoubleField( parameters, fid );
-
-                  // False Northing
-                  fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                  if (fid == NULL)
-                  {
-                      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                      return 0;
-                  }
-                  double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                  return new MapProjection6Parameters( coordinateType, centralMeridian, originLatitude, standardParallel1, standardParallel2, falseEasting, falseNorthing );
-                }
-                else
-                {
-                  jclass mercatorStandardParallelParametersClazz = env->FindClass( "geotrans3/parameters/MercatorStandardParallelParameters" );
-
-                  if( env->IsInstanceOf( parameters, mercatorStandardParallelParametersClazz ) )
-                  {
-                    jclass clazz = env->GetObjectClass( parameters );
-
-                    // Coordinate Type
-                    jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                        return 0;
-                    }
-                    CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                    // Central Meridian
-                    fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                        return 0;
-                    }
-                    double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                    // Latitude Of True Scale
-                    fid = env->GetFieldID( clazz, "standardParallel", "D");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel field ID error." );
-                        return 0;
-                    }
-                    double standardParallel = env->GetDoubleField( parameters, fid );
-
-                    // Scale Factor
-                    fid = env->GetFieldID( clazz, "scaleFactor", "D");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: scaleFactor field ID error." );
-                        return 0;
-                    }
-                    double scaleFactor = env->GetDoubleField( parameters, fid );
-
-                    // False Easting
-                    fid = env->GetFieldID( clazz, "falseEasting", "D");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                        return 0;
-                    }
-                    double falseEasting = env->GetDoubleField( parameters, fid );
-
-                    // False Northing
-                    fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                    if (fid == NULL)
-                    {
-                        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                        return 0;
-                    }
-                    double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                    return new MercatorStandardParallelParameters( coordinateType, centralMeridian, standardParallel, scaleFactor, falseEasting, falseNorthing );
-                  }
-                  else
-                  {
-                    jclass mercatorScaleFactorParametersClazz = env->FindClass( "geotrans3/parameters/MercatorScaleFactorParameters" );
-
-                    if( env->IsInstanceOf( parameters, mercatorScaleFactorParametersClazz ) )
-                    {
-                      jclass clazz = env->GetObjectClass( parameters );
-
-                      // Coordinate Type
-                      jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                      if (fid == NULL)
-                      {
-                          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                          return 0;
-                      }
-                      CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                      // Central Meridian
-                      fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                      if (fid == NULL)
-                      {
-                          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                          return 0;
-                      }
-                      double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                      // Scale Factor
-                      fid = env->GetFieldID( clazz, "scaleFactor", "D");
-                      if (fid == NULL)
-                      {
-                          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: scaleFactor field ID error." );
-                          return 0;
-                      }
-                      double scaleFactor = env->GetDoubleField( parameters, fid );
-
-                      // False Easting
-                      fid = env->GetFieldID( clazz, "falseEasting", "D");
-                      if (fid == NULL)
-                      {
-                          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                          return 0;
-                      }
-                      double falseEasting = env->GetDoubleField( parameters, fid );
-
-                      // False Northing
-                      fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                      if (fid == NULL)
-                      {
-                          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                          return 0;
-                      }
-                      double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                      return new MercatorScaleFactorParameters( coordinateType, centralMeridian, scaleFactor, falseEasting, falseNorthing );
-                    }
-                    else
-                    {
-                      jclass neysParametersClazz = env->FindClass( "geotrans3/parameters/NeysParameters" );
-
-                      if( env->IsInstanceOf( parameters, neysParametersClazz ) )
-                      {
-                        jclass clazz = env->GetObjectClass( parameters );
-
-                        // Coordinate Type
-                        jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                            return 0;
-                        }
-                        CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                        // Central Meridian
-                        fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                            return 0;
-                        }
-                        double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                        // Origin Latitude
-                        fid = env->GetFieldID( clazz, "originLatitude", "D");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: originLatitude field ID error." );
-                            return 0;
-                        }
-                        double originLatitude = env->GetDoubleField( parameters, fid );
-
-                        // Standard Parallel 1
-                        fid = env->GetFieldID( clazz, "standardParallel1", "D");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel1 field ID error." );
-                            return 0;
-                        }
-                        double standardParallel1 = env->GetDoubleField( parameters, fid );
-
-                        // False Easting
-                        fid = env->GetFieldID( clazz, "falseEasting", "D");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                            return 0;
-                        }
-                        double falseEasting = env->GetDoubleField( parameters, fid );
-
-                        // False Northing
-                        fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                        if (fid == NULL)
-                        {
-                            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                            return 0;
-                        }
-                        double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                        return new NeysParameters( coordinateType, centralMeridian, originLatitude, standardParallel1, falseEasting, falseNorthing );
-                      }
-                      else
-                      {
-                        jclass obliqueMercatorParametersClazz = env->FindClass( "geotrans3/parameters/ObliqueMercatorParameters" );
-
-                        if( env->IsInstanceOf( parameters, obliqueMercatorParametersClazz ) )
-                        {
-                          jclass clazz = env->GetObjectClass( parameters );
-
-                          // Coordinate Type
-                          jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                              return 0;
-                          }
-                          CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                          // Origin Latitude
-                          fid = env->GetFieldID( clazz, "originLatitude", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: originLatitude field ID error." );
-                              return 0;
-                          }
-                          double originLatitude = env->GetDoubleField( parameters, fid );
-
-                          // Longitude 1
-                          fid = env->GetFieldID( clazz, "longitude1", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: longitude1 field ID error." );
-                              return 0;
-                          }
-                          double longitude1 = env->GetDoubleField( parameters, fid );
-
-                          // Latitude 1
-                          fid = env->GetFieldID( clazz, "latitude1", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: latitude1 field ID error." );
-                              return 0;
-                          }
-                          double latitude1 = env->GetDoubleField( parameters, fid );
-
-                          // Longitude 2
-                          fid = env->GetFieldID( clazz, "longitude2", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: longitude2 field ID error." );
-                              return 0;
-                          }
-                          double longitude2 = env->GetDoubleField( parameters, fid );
-
-                          // Latitude 2
-                          fid = env->GetFieldID( clazz, "latitude2", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: latitude2 field ID error." );
-                              return 0;
-                          }
-                          double latitude2 = env->GetDoubleField( parameters, fid );
-
-                          // False Easting
-                          fid = env->GetFieldID( clazz, "falseEasting", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                              return 0;
-                          }
-                          double falseEasting = env->GetDoubleField( parameters, fid );
-
-                          // False Northing
-                          fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                              return 0;
-                          }
-                          double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                          // Scale Factor
-                          fid = env->GetFieldID( clazz, "scaleFactor", "D");
-                          if (fid == NULL)
-                          {
-                              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: scaleFactor field ID error." );
-                              return 0;
-                          }
-                          double scaleFactor = env->GetDoubleField( parameters, fid );
-
-                          return new ObliqueMercatorParameters( coordinateType, originLatitude, longitude1, latitude1, longitude2, latitude2, falseEasting, falseNorthing, scaleFactor );
-                        }
-                        else
-                        {
-                          jclass polarStereographicStandardParallelParametersClazz = env->FindClass( "geotrans3/parameters/PolarStereographicStandardParallelParameters" );
-
-                          if( env->IsInstanceOf( parameters, polarStereographicStandardParallelParametersClazz ) )
-                          {
-                            jclass clazz = env->GetObjectClass( parameters );
-
-                            // Coordinate Type
-                            jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                            if (fid == NULL)
-                            {
-                                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                                return 0;
-                            }
-                            CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                            // Central Meridian
-                            fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                            if (fid == NULL)
-                            {
-                                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                                return 0;
-                            }
-                            double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                            // Standard Parallel
-                            fid = env->GetFieldID( clazz, "standardParallel", "D");
-                            if (fid == NULL)
-                            {
-                                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: standardParallel field ID error." );
-                                return 0;
-                            }
-                            double standardParallel = env->GetDoubleField( parameters, fid );
-
-                            // False Easting
-                            fid = env->GetFieldID( clazz, "falseEasting", "D");
-                            if (fid == NULL)
-                            {
-                                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                                return 0;
-                            }
-                            double falseEasting = env->GetDoubleField( parameters, fid );
-
-                            // False Northing
-                            fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                            if (fid == NULL)
-                            {
-                                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                                return 0;
-                            }
-                            double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                            return new PolarStereographicStandardParallelParameters( coordinateType, centralMeridian, standardParallel, falseEasting, falseNorthing );
-                          }
-                          else
-                          {
-                            jclass polarStereographicScaleFactorParametersClazz = env->FindClass( "geotrans3/parameters/PolarStereographicScaleFactorParameters" );
-
-                            if( env->IsInstanceOf( parameters, polarStereographicScaleFactorParametersClazz ) )
-                            {
-                              jclass clazz = env->GetObjectClass( parameters );
-
-                              // Coordinate Type
-                              jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                                  return 0;
-                              }
-                              CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                              // Central Meridian
-                              fid = env->GetFieldID( clazz, "centralMeridian", "D");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: centralMeridian field ID error." );
-                                  return 0;
-                              }
-                              double centralMeridian = env->GetDoubleField( parameters, fid );
-
-                              // Scale Factor
-                              fid = env->GetFieldID( clazz, "scaleFactor", "D");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: scaleFactor field ID error." );
-                                  return 0;
-                              }
-                              double scaleFactor = env->GetDoubleField( parameters, fid );
-
-                              // Hemisphere
-                              fid = env->GetFieldID( clazz, "hemisphere", "C");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: hemisphere field ID error." );
-                                  return 0;
-                              }
-                              char hemisphere = (char)env->GetCharField( parameters, fid );
-
-                              // False Easting
-                              fid = env->GetFieldID( clazz, "falseEasting", "D");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseEasting field ID error." );
-                                  return 0;
-                              }
-                              double falseEasting = env->GetDoubleField( parameters, fid );
-
-                              // False Northing
-                              fid = env->GetFieldID( clazz, "falseNorthing", "D");
-                              if (fid == NULL)
-                              {
-                                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: falseNorthing field ID error." );
-                                  return 0;
-                              }
-                              double falseNorthing = env->GetDoubleField( parameters, fid );
-
-                              return new PolarStereographicScaleFactorParameters( coordinateType, centralMeridian, scaleFactor, hemisphere, falseEasting, falseNorthing );
-                            }
-                            else
-                            {
-                              jclass utmParametersClazz = env->FindClass( "geotrans3/parameters/UTMParameters" );
-
-                              if( env->IsInstanceOf( parameters, utmParametersClazz ) )
-                              {
-                                jclass clazz = env->GetObjectClass( parameters );
-
-                                // Coordinate Type
-                                jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                                if (fid == NULL)
-                                {
-                                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                                    return 0;
-                                }
-                                CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, fid );
-
-                                // Zone
-                                fid = env->GetFieldID( clazz, "zone", "J");
-                                if (fid == NULL)
-                                {
-                                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: zone field ID error." );
-                                    return 0;
-                                }
-                                long zone = env->GetLongField( parameters, fid );
-
-                                // Override
-                                fid = env->GetFieldID( clazz, "override", "J");
-                                if (fid == NULL)
-                                {
-                                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: override field ID error." );
-                                    return 0;
-                                }
-                                long override = env->GetLongField( parameters, fid );
-
-                                return new UTMParameters( coordinateType, zone, override );
-                              }
-                              else
-                              {
-                                jclass clazz = env->GetObjectClass( parameters );
-
-                                // Coordinate Type
-                                jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-                                if (fid == NULL)
-                                {
-                                    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                                    return 0;
-                                }
-
-                                return new CoordinateSystemParameters( ( CoordinateType::Enum )env->GetIntField( parameters, fid ) );
-                              }
-                            }
-                          }
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+
+JNIEXPORT void JNICALL JNI_OnUnload( JavaVM *vm, void *reserved )
+{
+  JNIEnv *env;
+  if( vm->GetEnv( (void**)&env, JNI_VERSION_1_4 ) != JNI_OK )
+    return;
+
+  releaseClassCache( env );
 }
 
 
-CoordinateTuple* translateFromJNICoordinates( JNIEnv *env, jobject coordinates )
+const JNICCSClassCache* getJNICCSClassCache()
 {
-  jclass geodeticCoordinatesClazz = env->FindClass( "geotrans3/coordinates/GeodeticCoordinates" );
+  return &classCache;
+}
 
-  if( env->IsInstanceOf( coordinates, geodeticCoordinatesClazz ) )
-  { 
-    jclass clazz = env->GetObjectClass( coordinates );
 
-    // Longitude
-    jfieldID fid = env->GetFieldID( clazz, "longitude", "D");
-    if (fid == NULL)
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Longitude field ID error." );
-        return 0;
-    }
-    double longitude = env->GetDoubleField( coordinates, fid );
+CoordinateSystemParameters* translateFromJNIParameters( JNIEnv *env, jobject parameters )
+{
+  const JNICCSClassCache& c = classCache;
 
-    // Latitude
-    fid = env->GetFieldID( clazz, "latitude", "D");
-    if (fid == NULL)
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Latitude field ID error." );
-        return 0;
-    }
-    double latitude = env->GetDoubleField( coordinates, fid );
+  if( env->IsInstanceOf( parameters, c.geodeticParametersClass ) )
+  {
+    return new GeodeticParameters( CoordinateType::geodetic, ( HeightType::Enum )env->GetIntField( parameters, c.geodeticHeightTypeField ) );
+  }
+  else if( env->IsInstanceOf( parameters, c.equidistantCylindricalParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.eqdcylCentralMeridianField );
+    double standardParallel = env->GetDoubleField( parameters, c.eqdcylStandardParallelField );
+    double falseEasting = env->GetDoubleField( parameters, c.eqdcylFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.eqdcylFalseNorthingField );
 
-    // Height
-    fid = env->GetFieldID( clazz, "height", "D");
-    if (fid == NULL)
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Height field ID error." );
-        return 0;
-    }
-    double height = env->GetDoubleField( coordinates, fid );
+    return new EquidistantCylindricalParameters( CoordinateType::equidistantCylindrical, centralMeridian, standardParallel, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.localCartesianParametersClass ) )
+  {
+    double longitude = env->GetDoubleField( parameters, c.locCartLongitudeField );
+    double latitude = env->GetDoubleField( parameters, c.locCartLatitudeField );
+    double height = env->GetDoubleField( parameters, c.locCartHeightField );
+    double orientation = env->GetDoubleField( parameters, c.locCartOrientationField );
+
+    return new LocalCartesianParameters( CoordinateType::localCartesian, longitude, latitude, height, orientation );
+  }
+
+  CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( parameters, c.parametersCoordinateTypeField );
+
+  if( env->IsInstanceOf( parameters, c.mapProjection3ParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.mp3CentralMeridianField );
+    double falseEasting = env->GetDoubleField( parameters, c.mp3FalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mp3FalseNorthingField );
 
-    return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude, height ); 
+    return new MapProjection3Parameters( coordinateType, centralMeridian, falseEasting, falseNorthing );
   }
-  else
+  else if( env->IsInstanceOf( parameters, c.mapProjection4ParametersClass ) )
   {
-    jclass cartesianCoordinatesClazz = env->FindClass( "geotrans3/coordinates/CartesianCoordinates" );
+    double centralMeridian = env->GetDoubleField( parameters, c.mp4CentralMeridianField );
+    double originLatitude = env->GetDoubleField( parameters, c.mp4OriginLatitudeField );
+    double falseEasting = env->GetDoubleField( parameters, c.mp4FalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mp4FalseNorthingField );
 
-    if( env->IsInstanceOf( coordinates, cartesianCoordinatesClazz ) )
-    {
-      jclass clazz = env->GetObjectClass( coordinates );
-
-      // Coordinate Type
-      jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-          return 0;
-      }
-      CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, fid );
-
-      // X
-      fid = env->GetFieldID( clazz, "x", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: x field ID error." );
-          return 0;
-      }
-      double x = env->GetDoubleField( coordinates, fid );
-
-      // Y
-      fid = env->GetFieldID( clazz, "y", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: y field ID error." );
-          return 0;
-      }
-      double y = env->GetDoubleField( coordinates, fid );
-
-      // Z
-      fid = env->GetFieldID( clazz, "z", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: z field ID error." );
-          return 0;
-      }
-      double z = env->GetDoubleField( coordinates, fid );
-
-      return new CartesianCoordinates( coordinateType, x, y, z ); 
-    }
-    else
-    {
-      jclass mapProjectionCoordinatesClazz = env->FindClass( "geotrans3/coordinates/MapProjectionCoordinates" );
-
-      if( env->IsInstanceOf( coordinates, mapProjectionCoordinatesClazz ) )
-      {
-        jclass clazz = env->GetObjectClass( coordinates );
-
-        // Coordinate Type
-        jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-            return 0;
-        }
-        CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, fid );
-        
-        // Easting
-        fid = env->GetFieldID( clazz, "easting", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: easting field ID error." );
-            return 0;
-        }
-        double easting = env->GetDoubleField( coordinates, fid );
-
-        // Northing
-        fid = env->GetFieldID( clazz, "northing", "D");
-        if (fid == NULL)
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: northing field ID error." );
-            return 0;
-        }
-        double northing = env->GetDoubleField( coordinates, fid );
-
-        return new MapProjectionCoordinates( coordinateType, easting, northing ); 
-      }
-      else
-      {
-        jclass stringCoordinatesClazz = env->FindClass( "geotrans3/coordinates/StringCoordinates" );
-
-        if( env->IsInstanceOf( coordinates, stringCoordinatesClazz ) )
-        {
-          jclass clazz = env->GetObjectClass( coordinates );
-
-          // Coordinate Type
-          jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-              return 0;
-          }
-          CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, fid );
-
-          // Coordinate String
-          fid = env->GetFieldID( clazz, "coordinateString", "Ljava/lang/String;");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateString field ID error." );
-              return 0;
-          }
-          jstring jStr = (jstring)env->GetObjectField( coordinates, fid );
-          const char* str = env->GetStringUTFChars( jStr, NULL );
-          if (str == NULL)
-          {
-              throwException(env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Out of memory.");
-              return 0;
-          }
-
-          // Precision
-          fid = env->GetFieldID( clazz, "precision", "I");
-          if (fid == NULL)
-          {
-              throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: precision field ID error." );
-              return 0;
-          }
-          Precision::Enum precision = ( Precision::Enum )env->GetIntField( coordinates, fid );
-
-          switch( coordinateType )
-          {
-            case CoordinateType::britishNationalGrid:
-            {
-              BNGCoordinates* bngCoordinates = new BNGCoordinates( coordinateType, str, precision );
-              env->ReleaseStringUTFChars( jStr, str );
-              return bngCoordinates;
-            }
-            case CoordinateType::georef:
-            {
-              GEOREFCoordinates* georefCoordinates = new GEOREFCoordinates( coordinateType, str, precision );
-              env->ReleaseStringUTFChars( jStr, str );
-              return georefCoordinates;
-            }
-            case CoordinateType::globalAreaReferenceSystem:
-            {
-              GARSCoordinates* garsCoordinates = new GARSCoordinates( coordinateType, str, precision );
-              env->ReleaseStringUTFChars( jStr, str );
-              return garsCoordinates;
-            }
-            case CoordinateType::militaryGridReferenceSystem:
-            case CoordinateType::usNationalGrid:
-            {
-              MGRSorUSNGCoordinates* mgrsorUSNGCoordinates = new MGRSorUSNGCoordinates( coordinateType, str, precision );
-              env->ReleaseStringUTFChars( jStr, str );
-              return mgrsorUSNGCoordinates;
-            }
-          }
-        }
-        else
-        {
-          jclass upsCoordinatesClazz = env->FindClass( "geotrans3/coordinates/UPSCoordinates" );
-
-          if( env->IsInstanceOf( coordinates, upsCoordinatesClazz ) )
-          {
-            jclass clazz = env->GetObjectClass( coordinates );
-
-            // Coordinate Type
-            jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                return 0;
-            }
-            CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, fid );
-
-            // Hemisphere
-            fid = env->GetFieldID( clazz, "hemisphere", "C");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: hemisphere field ID error." );
-                return 0;
-            }
-            char hemisphere = (char)env->GetCharField( coordinates, fid );
-
-            // Easting
-            fid = env->GetFieldID( clazz, "easting", "D");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: easting field ID error." );
-                return 0;
-            }
-            double easting = env->GetDoubleField( coordinates, fid );
-
-            // Northing
-            fid = env->GetFieldID( clazz, "northing", "D");
-            if (fid == NULL)
-            {
-                throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: northing field ID error." );
-                return 0;
-            }
-            double northing = env->GetDoubleField( coordinates, fid );
-
-            return new UPSCoordinates( coordinateType, hemisphere, easting, northing ); 
-          }
-          else
-          {
-            jclass utmCoordinatesClazz = env->FindClass( "geotrans3/coordinates/UTMCoordinates" );
-
-            if( env->IsInstanceOf( coordinates, utmCoordinatesClazz ) )
-            {
-              jclass clazz = env->GetObjectClass( coordinates );
-
-              // Coordinate Type
-              jfieldID fid = env->GetFieldID( clazz, "coordinateType", "I");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: coordinateType field ID error." );
-                  return 0;
-              }
-              CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, fid );
-
-              // Zone
-              fid = env->GetFieldID( clazz, "zone", "J");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: zone field ID error." );
-                  return 0;
-              }
-              long zone = env->GetLongField( coordinates, fid );
-
-              // Hemisphere
-              fid = env->GetFieldID( clazz, "hemisphere", "C");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: hemisphere field ID error." );
-                  return 0;
-              }
-              char hemisphere = (char)env->GetCharField( coordinates, fid );
-
-              // Easting
-              fid = env->GetFieldID( clazz, "easting", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: easting field ID error." );
-                  return 0;
-              }
-              double easting = env->GetDoubleField( coordinates, fid );
-
-              // Northing
-              fid = env->GetFieldID( clazz, "northing", "D");
-              if (fid == NULL)
-              {
-                  throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: northing field ID error." );
-                  return 0;
-              }
-              double northing = env->GetDoubleField( coordinates, fid );
-
-              return new UTMCoordinates( coordinateType, zone, hemisphere, easting, northing ); 
-            }
-          }
-        }
-      }
-    }
+    return new MapProjection4Parameters( coordinateType, centralMeridian, originLatitude, falseEasting, falseNorthing );
   }
+  else if( env->IsInstanceOf( parameters, c.mapProjection5ParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.mp5CentralMeridianField );
+    double originLatitude = env->GetDoubleField( parameters, c.mp5OriginLatitudeField );
+    double scaleFactor = env->GetDoubleField( parameters, c.mp5ScaleFactorField );
+    double falseEasting = env->GetDoubleField( parameters, c.mp5FalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mp5FalseNorthingField );
 
-  return 0;
+    return new MapProjection5Parameters( coordinateType, centralMeridian, originLatitude, scaleFactor, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.mapProjection6ParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.mp6CentralMeridianField );
+    double originLatitude = env->GetDoubleField( parameters, c.mp6OriginLatitudeField );
+    double standardParallel1 = env->GetDoubleField( parameters, c.mp6StandardParallel1Field );
+    double standardParallel2 = env->GetDoubleField( parameters, c.mp6StandardParallel2Field );
+    double falseEasting = env->GetDoubleField( parameters, c.mp6FalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mp6FalseNorthingField );
+
+    return new MapProjection6Parameters( coordinateType, centralMeridian, originLatitude, standardParallel1, standardParallel2, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.mercatorStandardParallelParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.mercSPCentralMeridianField );
+    double standardParallel = env->GetDoubleField( parameters, c.mercSPStandardParallelField );
+    double scaleFactor = env->GetDoubleField( parameters, c.mercSPScaleFactorField );
+    double falseEasting = env->GetDoubleField( parameters, c.mercSPFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mercSPFalseNorthingField );
+
+    return new MercatorStandardParallelParameters( coordinateType, centralMeridian, standardParallel, scaleFactor, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.mercatorScaleFactorParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.mercSFCentralMeridianField );
+    double scaleFactor = env->GetDoubleField( parameters, c.mercSFScaleFactorField );
+    double falseEasting = env->GetDoubleField( parameters, c.mercSFFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.mercSFFalseNorthingField );
+
+    return new MercatorScaleFactorParameters( coordinateType, centralMeridian, scaleFactor, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.neysParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.neysCentralMeridianField );
+    double originLatitude = env->GetDoubleField( parameters, c.neysOriginLatitudeField );
+    double standardParallel1 = env->GetDoubleField( parameters, c.neysStandardParallel1Field );
+    double falseEasting = env->GetDoubleField( parameters, c.neysFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.neysFalseNorthingField );
+
+    return new NeysParameters( coordinateType, centralMeridian, originLatitude, standardParallel1, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.obliqueMercatorParametersClass ) )
+  {
+    double originLatitude = env->GetDoubleField( parameters, c.omercOriginLatitudeField );
+    double longitude1 = env->GetDoubleField( parameters, c.omercLongitude1Field );
+    double latitude1 = env->GetDoubleField( parameters, c.omercLatitude1Field );
+    double longitude2 = env->GetDoubleField( parameters, c.omercLongitude2Field );
+    double latitude2 = env->GetDoubleField( parameters, c.omercLatitude2Field );
+    double falseEasting = env->GetDoubleField( parameters, c.omercFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.omercFalseNorthingField );
+    double scaleFactor = env->GetDoubleField( parameters, c.omercScaleFactorField );
+
+    return new ObliqueMercatorParameters( coordinateType, originLatitude, longitude1, latitude1, longitude2, latitude2, falseEasting, falseNorthing, scaleFactor );
+  }
+  else if( env->IsInstanceOf( parameters, c.polarStereographicStandardParallelParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.polarSPCentralMeridianField );
+    double standardParallel = env->GetDoubleField( parameters, c.polarSPStandardParallelField );
+    double falseEasting = env->GetDoubleField( parameters, c.polarSPFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.polarSPFalseNorthingField );
+
+    return new PolarStereographicStandardParallelParameters( coordinateType, centralMeridian, standardParallel, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.polarStereographicScaleFactorParametersClass ) )
+  {
+    double centralMeridian = env->GetDoubleField( parameters, c.polarSFCentralMeridianField );
+    double scaleFactor = env->GetDoubleField( parameters, c.polarSFScaleFactorField );
+    char hemisphere = (char)env->GetCharField( parameters, c.polarSFHemisphereField );
+    double falseEasting = env->GetDoubleField( parameters, c.polarSFFalseEastingField );
+    double falseNorthing = env->GetDoubleField( parameters, c.polarSFFalseNorthingField );
+
+    return new PolarStereographicScaleFactorParameters( coordinateType, centralMeridian, scaleFactor, hemisphere, falseEasting, falseNorthing );
+  }
+  else if( env->IsInstanceOf( parameters, c.utmParametersClass ) )
+  {
+    long zone = env->GetLongField( parameters, c.utmParamsZoneField );
+    long override = env->GetLongField( parameters, c.utmParamsOverrideField );
+
+    return new UTMParameters( coordinateType, zone, override );
+  }
+
+  return new CoordinateSystemParameters( coordinateType );
 }
 
 
-Accuracy* translateFromJNIAccuracy( JNIEnv *env, jobject _accuracy )
+CoordinateTuple* translateFromJNICoordinates( JNIEnv *env, jobject coordinates )
 {
-    jclass clazz = env->GetObjectClass( _accuracy );
+  const JNICCSClassCache& c = classCache;
 
-    // CE90
-    jfieldID fid = env->GetFieldID( clazz, "ce90", "D" );
-    if (fid == NULL)
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: CE90 field ID error." );
-        return 0;
-    }
-    double ce90 = env->GetDoubleField( _accuracy, fid );
+  if( env->IsInstanceOf( coordinates, c.geodeticCoordinatesClass ) )
+  {
+    double longitude = env->GetDoubleField( coordinates, c.geodeticLongitudeField );
+    double latitude = env->GetDoubleField( coordinates, c.geodeticLatitudeField );
+    double height = env->GetDoubleField( coordinates, c.geodeticHeightField );
+
+    return new GeodeticCoordinates( CoordinateType::geodetic, longitude, latitude, height );
+  }
+
+  CoordinateType::Enum coordinateType = ( CoordinateType::Enum )env->GetIntField( coordinates, c.coordinatesCoordinateTypeField );
 
-    // LE90
-    fid = env->GetFieldID( clazz, "le90", "D" );
-    if (fid == NULL)
+  if( env->IsInstanceOf( coordinates, c.cartesianCoordinatesClass ) )
+  {
+    double x = env->GetDoubleField( coordinates, c.cartesianXField );
+    double y = env->GetDoubleField( coordinates, c.cartesianYField );
+    double z = env->GetDoubleField( coordinates, c.cartesianZField );
+
+    return new CartesianCoordinates( coordinateType, x, y, z );
+  }
+  else if( env->IsInstanceOf( coordinates, c.mapProjectionCoordinatesClass ) )
+  {
+    double easting = env->GetDoubleField( coordinates, c.mapProjectionEastingField );
+    double northing = env->GetDoubleField( coordinates, c.mapProjectionNorthingField );
+
+    return new MapProjectionCoordinates( coordinateType, easting, northing );
+  }
+  else if( env->IsInstanceOf( coordinates, c.stringCoordinatesClass ) )
+  {
+    jstring jStr = (jstring)env->GetObjectField( coordinates, c.stringCoordinateStringField );
+    const char* str = env->GetStringUTFChars( jStr, NULL );
+    if (str == NULL)
     {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: LE90 field ID error." );
+        throwException(env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Out of memory.");
         return 0;
     }
-    double le90 = env->GetDoubleField( _accuracy, fid );
 
-    // SE90
-    fid = env->GetFieldID(  clazz, "se90", "D");
-    if (fid == NULL)
+    Precision::Enum precision = ( Precision::Enum )env->GetIntField( coordinates, c.stringPrecisionField );
+
+    CoordinateTuple* stringCoordinates = 0;
+    switch( coordinateType )
     {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: SE90 field ID error." );
-        return 0;
+      case CoordinateType::britishNationalGrid:
+        stringCoordinates = new BNGCoordinates( coordinateType, str, precision );
+        break;
+      case CoordinateType::georef:
+        stringCoordinates = new GEOREFCoordinates( coordinateType, str, precision );
+        break;
+      case CoordinateType::globalAreaReferenceSystem:
+        stringCoordinates = new GARSCoordinates( coordinateType, str, precision );
+        break;
+      case CoordinateType::militaryGridReferenceSystem:
+      case CoordinateType::usNationalGrid:
+        stringCoordinates = new MGRSorUSNGCoordinates( coordinateType, str, precision );
+        break;
+      default:
+        break;
     }
-    double se90 = env->GetDoubleField( _accuracy, fid );
-
-    return new Accuracy( ce90, le90, se90 ); 
-}
 
+    env->ReleaseStringUTFChars( jStr, str );
+    env->DeleteLocalRef( jStr );
 
-jobject translateToJNIAccuracy( JNIEnv *env, Accuracy* _accuracy )
-{
-  jclass cls = env->FindClass( "geotrans3/coordinates/Accuracy" );
-  if( cls == NULL )
-  {
-      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy class not found." );
-      return NULL;
+    return stringCoordinates;
   }
+  else if( env->IsInstanceOf( coordinates, c.upsCoordinatesClass ) )
+  {
+    char hemisphere = (char)env->GetCharField( coordinates, c.upsHemisphereField );
+    double easting = env->GetDoubleField( coordinates, c.upsEastingField );
+    double northing = env->GetDoubleField( coordinates, c.upsNorthingField );
 
-  jmethodID cid = env->GetMethodID( cls, "<init>", "(DDD)V" );
-  if( cid == NULL )
+    return new UPSCoordinates( coordinateType, hemisphere, easting, northing );
+  }
+  else if( env->IsInstanceOf( coordinates, c.utmCoordinatesClass ) )
   {
-      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy method id not found." );
-      return NULL;
+    long zone = env->GetLongField( coordinates, c.utmZoneField );
+    char hemisphere = (char)env->GetCharField( coordinates, c.utmHemisphereField );
+    double easting = env->GetDoubleField( coordinates, c.utmEastingField );
+    double northing = env->GetDoubleField( coordinates, c.utmNorthingField );
+
+    return new UTMCoordinates( coordinateType, zone, hemisphere, easting, northing );
   }
 
-  jobject jAccuracy = env->NewObject( cls, cid, (jdouble)_accuracy->circularError90(), (jdouble)_accuracy->linearError90(), (jdouble)_accuracy->sphericalError90() );
+  return 0;
+}
+
+
+Accuracy* translateFromJNIAccuracy( JNIEnv *env, jobject _accuracy )
+{
+  double ce90 = env->GetDoubleField( _accuracy, classCache.accuracyCE90Field );
+  double le90 = env->GetDoubleField( _accuracy, classCache.accuracyLE90Field );
+  double se90 = env->GetDoubleField( _accuracy, classCache.accuracySE90Field );
+
+  return new Accuracy( ce90, le90, se90 );
+}
+
+
+jobject translateToJNIAccuracy( JNIEnv *env, Accuracy* _accuracy )
+{
+  jobject jAccuracy = env->NewObject( classCache.accuracyClass, classCache.accuracyInit, (jdouble)_accuracy->circularError90(), (jdouble)_accuracy->linearError90(), (jdouble)_accuracy->sphericalError90() );
   if( jAccuracy == NULL )
       throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy object could not be created." );
 
@@ -1207,276 +545,259 @@ jobject translateToJNIAccuracy( JNIEnv *env, Accuracy* _accuracy )
 
 jobject translateToJNICoordinates( JNIEnv *env, CoordinateTuple* coordinates )
 {
-  jobject jCoordinates;// = 0;
-  jclass cls;
-  jmethodID cid;
+  const JNICCSClassCache& c = classCache;
+
+  jobject jCoordinates = NULL;
+  jstring jWarningStr = env->NewStringUTF( coordinates->warningMessage() );
+  jstring jStr = NULL;
 
-    switch( coordinates->coordinateType() )
+  switch( coordinates->coordinateType() )
+  {
+    case CoordinateType::albersEqualAreaConic:
+    case CoordinateType::azimuthalEquidistant:
+    case CoordinateType::bonne:
+    case CoordinateType::cassini:
+    case CoordinateType::cylindricalEqualArea:
+    case CoordinateType::eckert4:
+    case CoordinateType::eckert6:
+    case CoordinateType::equidistantCylindrical:
+    case CoordinateType::gnomonic:
+    case CoordinateType::lambertConformalConic1Parallel:
+    case CoordinateType::lambertConformalConic2Parallels:
+    case CoordinateType::mercatorStandardParallel:
+    case CoordinateType::mercatorScaleFactor:
+    case CoordinateType::millerCylindrical:
+    case CoordinateType::mollweide:
+    case CoordinateType::newZealandMapGrid:
+    case CoordinateType::neys:
+    case CoordinateType::obliqueMercator:
+    case CoordinateType::orthographic:
+    case CoordinateType::polarStereographicStandardParallel:
+    case CoordinateType::polarStereographicScaleFactor:
+    case CoordinateType::polyconic:
+    case CoordinateType::sinusoidal:
+    case CoordinateType::stereographic:
+    case CoordinateType::transverseCylindricalEqualArea:
+    case CoordinateType::transverseMercator:
+    case CoordinateType::vanDerGrinten:
+    case CoordinateType::webMercator:
     {
-      case CoordinateType::albersEqualAreaConic:
-      case CoordinateType::azimuthalEquidistant:
-      case CoordinateType::bonne:
-      case CoordinateType::cassini:
-      case CoordinateType::cylindricalEqualArea:
-      case CoordinateType::eckert4:
-      case CoordinateType::eckert6:
-      case CoordinateType::equidistantCylindrical:
-      case CoordinateType::gnomonic:
-      case CoordinateType::lambertConformalConic1Parallel:
-      case CoordinateType::lambertConformalConic2Parallels:
-      case CoordinateType::mercatorStandardParallel:
-      case CoordinateType::mercatorScaleFactor:
-      case CoordinateType::millerCylindrical:
-      case CoordinateType::mollweide:
-      case CoordinateType::newZealandMapGrid:
-      case CoordinateType::neys:
-      case CoordinateType::obliqueMercator:
-      case CoordinateType::orthographic:
-      case CoordinateType::polarStereographicStandardParallel:
-      case CoordinateType::polarStereographicScaleFactor:
-      case CoordinateType::polyconic:
-      case CoordinateType::sinusoidal:
-      case CoordinateType::stereographic:
-      case CoordinateType::transverseCylindricalEqualArea:
-      case CoordinateType::transverseMercator:
-      case CoordinateType::vanDerGrinten:
-      case CoordinateType::webMercator:
-      {
-        MapProjectionCoordinates _coordinates = ( *dynamic_cast< MapProjectionCoordinates* >( coordinates ) );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/MapProjectionCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MapProjectionCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;DD)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MapProjectionCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, (jdouble)_coordinates.easting(), (jdouble)_coordinates.northing() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MapProjectionCoordinates object could not be created." );
-        break;
-      }
-      case CoordinateType::britishNationalGrid:
-      {
-        BNGCoordinates _coordinates = ( *dynamic_cast< BNGCoordinates* >( coordinates ) );
-        jstring jStr = env->NewStringUTF( _coordinates.BNGString() );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/BNGCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: BNGCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: BNGCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates.precision() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: BNGCoordinates object could not be created." );
+      MapProjectionCoordinates* _coordinates = dynamic_cast< MapProjectionCoordinates* >( coordinates );
 
-        break;
-      }
-      case CoordinateType::georef:
-      {
-        GEOREFCoordinates _coordinates = ( *dynamic_cast< GEOREFCoordinates* >( coordinates ) );
-        jstring jStr = env->NewStringUTF( _coordinates.GEOREFString() );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/GEOREFCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GEOREFCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GEOREFCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates.precision() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GEOREFCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.mapProjectionCoordinatesClass, c.mapProjectionCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, (jdouble)_coordinates->easting(), (jdouble)_coordinates->northing() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MapProjectionCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::britishNationalGrid:
+    {
+      BNGCoordinates* _coordinates = dynamic_cast< BNGCoordinates* >( coordinates );
+      jStr = env->NewStringUTF( _coordinates->BNGString() );
 
-        break;
-      }
-      case CoordinateType::globalAreaReferenceSystem:
-      {
-        GARSCoordinates _coordinates = ( *dynamic_cast< GARSCoordinates* >( coordinates ) );
-        jstring jStr = env->NewStringUTF( _coordinates.GARSString() );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/GARSCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GARSCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GARSCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates.precision() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GARSCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.bngCoordinatesClass, c.bngCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates->precision() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: BNGCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::georef:
+    {
+      GEOREFCoordinates* _coordinates = dynamic_cast< GEOREFCoordinates* >( coordinates );
+      jStr = env->NewStringUTF( _coordinates->GEOREFString() );
 
-        break;
-      }
-      case CoordinateType::militaryGridReferenceSystem:
-      case CoordinateType::usNationalGrid:
-      {
-        MGRSorUSNGCoordinates _coordinates = ( *dynamic_cast< MGRSorUSNGCoordinates* >( coordinates ) );
-        jstring jStr = env->NewStringUTF( _coordinates.MGRSString() );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/MGRSorUSNGCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MGRSorUSNGCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;Ljava/lang/String;I)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MGRSorUSNGCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates.precision() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MGRSorUSNGCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.georefCoordinatesClass, c.georefCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates->precision() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GEOREFCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::globalAreaReferenceSystem:
+    {
+      GARSCoordinates* _coordinates = dynamic_cast< GARSCoordinates* >( coordinates );
+      jStr = env->NewStringUTF( _coordinates->GARSString() );
 
-        break;
-      }
-      case CoordinateType::geocentric:
-      case CoordinateType::localCartesian:
-      {
-        CartesianCoordinates _coordinates = ( *dynamic_cast< CartesianCoordinates* >( coordinates ) );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/CartesianCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: CartesianCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;DDD)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: CartesianCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, (jdouble)_coordinates.x(), (jdouble)_coordinates.y(), (jdouble)_coordinates.z() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: CartesianCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.garsCoordinatesClass, c.garsCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates->precision() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GARSCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::militaryGridReferenceSystem:
+    case CoordinateType::usNationalGrid:
+    {
+      MGRSorUSNGCoordinates* _coordinates = dynamic_cast< MGRSorUSNGCoordinates* >( coordinates );
+      jStr = env->NewStringUTF( _coordinates->MGRSString() );
 
-        break;
-      }
-      case CoordinateType::geodetic:
-      {
-        GeodeticCoordinates _coordinates = ( *dynamic_cast< GeodeticCoordinates* >( coordinates ) );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/GeodeticCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GeodeticCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;DDD)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GeodeticCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, coordinates->coordinateType(), jWarningStr, _coordinates.longitude(), _coordinates.latitude(), _coordinates.height() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GeodeticCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.mgrsOrUSNGCoordinatesClass, c.mgrsOrUSNGCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, jStr, (jint)_coordinates->precision() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: MGRSorUSNGCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::geocentric:
+    case CoordinateType::localCartesian:
+    {
+      CartesianCoordinates* _coordinates = dynamic_cast< CartesianCoordinates* >( coordinates );
 
-        break;
-      }
-      case CoordinateType::universalPolarStereographic:
-      {
-        UPSCoordinates _coordinates = ( *dynamic_cast< UPSCoordinates* >( coordinates ) );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/UPSCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UPSCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;CDD)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UPSCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, (jchar)_coordinates.hemisphere(), (jdouble)_coordinates.easting(), (jdouble)_coordinates.northing() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UPSCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.cartesianCoordinatesClass, c.cartesianCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, (jdouble)_coordinates->x(), (jdouble)_coordinates->y(), (jdouble)_coordinates->z() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: CartesianCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::geodetic:
+    {
+      GeodeticCoordinates* _coordinates = dynamic_cast< GeodeticCoordinates* >( coordinates );
 
-        break;
-      }
-      case CoordinateType::universalTransverseMercator:
-      {
-        UTMCoordinates _coordinates = ( *dynamic_cast< UTMCoordinates* >( coordinates ) );
-        jstring jWarningStr = env->NewStringUTF( _coordinates.warningMessage() );
-
-        cls = env->FindClass( "geotrans3/coordinates/UTMCoordinates" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UTMCoordinates class not found." );
-            return NULL;
-        }
-
-        cid = env->GetMethodID( cls, "<init>", "(ILjava/lang/String;JCDD)V" );
-        if( cid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UTMCoordinates method id not found." );
-            return NULL;
-        }
-
-        jCoordinates = env->NewObject( cls, cid, (jint)coordinates->coordinateType(), jWarningStr, (jlong)_coordinates.zone(), (jchar)_coordinates.hemisphere(), (jdouble)_coordinates.easting(), (jdouble)_coordinates.northing() );
-        if( jCoordinates == NULL )
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UTMCoordinates object could not be created." );
+      jCoordinates = env->NewObject( c.geodeticCoordinatesClass, c.geodeticCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, (jdouble)_coordinates->longitude(), (jdouble)_coordinates->latitude(), (jdouble)_coordinates->height() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: GeodeticCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::universalPolarStereographic:
+    {
+      UPSCoordinates* _coordinates = dynamic_cast< UPSCoordinates* >( coordinates );
 
-        break;
-      }
-      default:
-        break;
+      jCoordinates = env->NewObject( c.upsCoordinatesClass, c.upsCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, (jchar)_coordinates->hemisphere(), (jdouble)_coordinates->easting(), (jdouble)_coordinates->northing() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UPSCoordinates object could not be created." );
+      break;
+    }
+    case CoordinateType::universalTransverseMercator:
+    {
+      UTMCoordinates* _coordinates = dynamic_cast< UTMCoordinates* >( coordinates );
+
+      jCoordinates = env->NewObject( c.utmCoordinatesClass, c.utmCoordinatesInit, (jint)coordinates->coordinateType(), jWarningStr, (jlong)_coordinates->zone(), (jchar)_coordinates->hemisphere(), (jdouble)_coordinates->easting(), (jdouble)_coordinates->northing() );
+      if( jCoordinates == NULL )
+          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: UTMCoordinates object could not be created." );
+      break;
     }
+    default:
+      break;
+  }
+
+  env->DeleteLocalRef( jWarningStr );
+  if( jStr )
+    env->DeleteLocalRef( jStr );
 
   return jCoordinates;
 }
 
+
+int packedCoordinateSize( CoordinateType::Enum coordinateType )
+{
+  switch( coordinateType )
+  {
+    case CoordinateType::geodetic:
+    case CoordinateType::geocentric:
+    case CoordinateType::localCartesian:
+    case CoordinateType::universalPolarStereographic:
+      return 3;
+    case CoordinateType::universalTransverseMercator:
+      return 4;
+    case CoordinateType::britishNationalGrid:
+    case CoordinateType::georef:
+    case CoordinateType::globalAreaReferenceSystem:
+    case CoordinateType::militaryGridReferenceSystem:
+    case CoordinateType::usNationalGrid:
+      return 0;
+    default:
+      return 2;
+  }
+}
+
+
+CoordinateTuple* createPackedCoordinates( CoordinateType::Enum coordinateType )
+{
+  switch( coordinateType )
+  {
+    case CoordinateType::geodetic:
+      return new GeodeticCoordinates( coordinateType );
+    case CoordinateType::geocentric:
+    case CoordinateType::localCartesian:
+      return new CartesianCoordinates( coordinateType );
+    case CoordinateType::universalPolarStereographic:
+      return new UPSCoordinates( coordinateType );
+    case CoordinateType::universalTransverseMercator:
+      return new UTMCoordinates( coordinateType );
+    default:
+      if( packedCoordinateSize( coordinateType ) == 2 )
+        return new MapProjectionCoordinates( coordinateType );
+      return 0;
+  }
+}
+
+
+void unpackCoordinates( const double* packed, CoordinateTuple* coordinates )
+{
+  coordinates->setErrorMessage( "" );
+  coordinates->setWarningMessage( "" );
+
+  switch( coordinates->coordinateType() )
+  {
+    case CoordinateType::geodetic:
+      ( ( GeodeticCoordinates* )coordinates )->set( packed[0], packed[1], packed[2] );
+      break;
+    case CoordinateType::geocentric:
+    case CoordinateType::localCartesian:
+      ( ( CartesianCoordinates* )coordinates )->set( packed[0], packed[1], packed[2] );
+      break;
+    case CoordinateType::universalPolarStereographic:
+      ( ( UPSCoordinates* )coordinates )->set( (char)packed[0], packed[1], packed[2] );
+      break;
+    case CoordinateType::universalTransverseMercator:
+      ( ( UTMCoordinates* )coordinates )->set( (long)packed[0], (char)packed[1], packed[2], packed[3] );
+      break;
+    default:
+      ( ( MapProjectionCoordinates* )coordinates )->set( packed[0], packed[1] );
+      break;
+  }
+}
+
+
+void packCoordinates( CoordinateTuple* coordinates, double* packed )
+{
+  switch( coordinates->coordinateType() )
+  {
+    case CoordinateType::geodetic:
+    {
+      GeodeticCoordinates* _coordinates = ( GeodeticCoordinates* )coordinates;
+      packed[0] = _coordinates->longitude();
+      packed[1] = _coordinates->latitude();
+      packed[2] = _coordinates->height();
+      break;
+    }
+    case CoordinateType::geocentric:
+    case CoordinateType::localCartesian:
+    {
+      CartesianCoordinates* _coordinates = ( CartesianCoordinates* )coordinates;
+      packed[0] = _coordinates->x();
+      packed[1] = _coordinates->y();
+      packed[2] = _coordinates->z();
+      break;
+    }
+    case CoordinateType::universalPolarStereographic:
+    {
+      UPSCoordinates* _coordinates = ( UPSCoordinates* )coordinates;
+      packed[0] = _coordinates->hemisphere();
+      packed[1] = _coordinates->easting();
+      packed[2] = _coordinates->northing();
+      break;
+    }
+    case CoordinateType::universalTransverseMercator:
+    {
+      UTMCoordinates* _coordinates = ( UTMCoordinates* )coordinates;
+      packed[0] = _coordinates->zone();
+      packed[1] = _coordinates->hemisphere();
+      packed[2] = _coordinates->easting();
+      packed[3] = _coordinates->northing();
+      break;
+    }
+    default:
+    {
+      MapProjectionCoordinates* _coordinates = ( MapProjectionCoordinates* )coordinates;
+      packed[0] = _coordinates->easting();
+      packed[1] = _coordinates->northing();
+      break;
+    }
+  }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,9 @@
 
 #ifndef _Included_JNICCSObjectTranslator
 #define _Included_JNICCSObjectTranslator
+
+#include "CoordinateType.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,6 +18,154 @@ class MSP::CCS::CoordinateSystemParameters;
 class MSP::CCS::CoordinateTuple;
 class MSP::CCS::Accuracy;
 
+  /*
+   *  Java classes, fields and methods used by the translator and the
+   *  conversion service.  Resolved once when the library is loaded
+   *  (JNI_OnLoad); the classes are global references.
+   */
+  struct JNICCSClassCache
+  {
+    // Parameter classes
+    jclass coordinateSystemParametersClass;
+    jclass equidistantCylindricalParametersClass;
+    jclass geodeticParametersClass;
+    jclass localCartesianParametersClass;
+    jclass mapProjection3ParametersClass;
+    jclass mapProjection4ParametersClass;
+    jclass mapProjection5ParametersClass;
+    jclass mapProjection6ParametersClass;
+    jclass mercatorStandardParallelParametersClass;
+    jclass mercatorScaleFactorParametersClass;
+    jclass neysParametersClass;
+    jclass obliqueMercatorParametersClass;
+    jclass polarStereographicStandardParallelParametersClass;
+    jclass polarStereographicScaleFactorParametersClass;
+    jclass utmParametersClass;
+
+    // Coordinate classes
+    jclass coordinateTupleClass;
+    jclass bngCoordinatesClass;
+    jclass cartesianCoordinatesClass;
+    jclass garsCoordinatesClass;
+    jclass geodeticCoordinatesClass;
+    jclass georefCoordinatesClass;
+    jclass mapProjectionCoordinatesClass;
+    jclass mgrsOrUSNGCoordinatesClass;
+    jclass stringCoordinatesClass;
+    jclass upsCoordinatesClass;
+    jclass utmCoordinatesClass;
+    jclass accuracyClass;
+    jclass convertResultsClass;
+    jclass convertCollectionResultsClass;
+    jclass vectorClass;
+
+    // Parameter fields
+    jfieldID parametersCoordinateTypeField;
+    jfieldID geodeticHeightTypeField;
+    jfieldID eqdcylCentralMeridianField;
+    jfieldID eqdcylStandardParallelField;
+    jfieldID eqdcylFalseEastingField;
+    jfieldID eqdcylFalseNorthingField;
+    jfieldID locCartLongitudeField;
+    jfieldID locCartLatitudeField;
+    jfieldID locCartHeightField;
+    jfieldID locCartOrientationField;
+    jfieldID mp3CentralMeridianField;
+    jfieldID mp3FalseEastingField;
+    jfieldID mp3FalseNorthingField;
+    jfieldID mp4CentralMeridianField;
+    jfieldID mp4OriginLatitudeField;
+    jfieldID mp4FalseEastingField;
+    jfieldID mp4FalseNorthingField;
+    jfieldID mp5CentralMeridianField;
+    jfieldID mp5OriginLatitudeField;
+    jfieldID mp5ScaleFactorField;
+    jfieldID mp5FalseEastingField;
+    jfieldID mp5FalseNorthingField;
+    jfieldID mp6CentralMeridianField;
+    jfieldID mp6OriginLatitudeField;
+    jfieldID mp6StandardParallel1Field;
+    jfieldID mp6StandardParallel2Field;
+    jfieldID mp6FalseEastingField;
+    jfieldID mp6FalseNorthingField;
+    jfieldID mercSPCentralMeridianField;
+    jfieldID mercSPStandardParallelField;
+    jfieldID mercSPScaleFactorField;
+    jfieldID mercSPFalseEastingField;
+    jfieldID mercSPFalseNorthingField;
+    jfieldID mercSFCentralMeridianField;
+    jfieldID mercSFScaleFactorField;
+    jfieldID mercSFFalseEastingField;
+    jfieldID mercSFFalseNorthingField;
+    jfieldID neysCentralMeridianField;
+    jfieldID neysOriginLatitudeField;
+    jfieldID neysStandardParallel1Field;
+    jfieldID neysFalseEastingField;
+    jfieldID neysFalseNorthingField;
+    jfieldID omercOriginLatitudeField;
+    jfieldID omercLongitude1Field;
+    jfieldID omercLatitude1Field;
+    jfieldID omercLongitude2Field;
+    jfieldID omercLatitude2Field;
+    jfieldID omercFalseEastingField;
+    jfieldID omercFalseNorthingField;
+    jfieldID omercScaleFactorField;
+    jfieldID polarSPCentralMeridianField;
+    jfieldID polarSPStandardParallelField;
+    jfieldID polarSPFalseEastingField;
+    jfieldID polarSPFalseNorthingField;
+    jfieldID polarSFCentralMeridianField;
+    jfieldID polarSFScaleFactorField;
+    jfieldID polarSFHemisphereField;
+    jfieldID polarSFFalseEastingField;
+    jfieldID polarSFFalseNorthingField;
+    jfieldID utmParamsZoneField;
+    jfieldID utmParamsOverrideField;
+
+    // Coordinate and accuracy fields
+    jfieldID coordinatesCoordinateTypeField;
+    jfieldID geodeticLongitudeField;
+    jfieldID geodeticLatitudeField;
+    jfieldID geodeticHeightField;
+    jfieldID cartesianXField;
+    jfieldID cartesianYField;
+    jfieldID cartesianZField;
+    jfieldID mapProjectionEastingField;
+    jfieldID mapProjectionNorthingField;
+    jfieldID stringCoordinateStringField;
+    jfieldID stringPrecisionField;
+    jfieldID upsHemisphereField;
+    jfieldID upsEastingField;
+    jfieldID upsNorthingField;
+    jfieldID utmZoneField;
+    jfieldID utmHemisphereField;
+    jfieldID utmEastingField;
+    jfieldID utmNorthingField;
+    jfieldID accuracyCE90Field;
+    jfieldID accuracyLE90Field;
+    jfieldID accuracySE90Field;
+
+    // Constructors and methods
+    jmethodID bngCoordinatesInit;
+    jmethodID cartesianCoordinatesInit;
+    jmethodID garsCoordinatesInit;
+    jmethodID geodeticCoordinatesInit;
+    jmethodID georefCoordinatesInit;
+    jmethodID mapProjectionCoordinatesInit;
+    jmethodID mgrsOrUSNGCoordinatesInit;
+    jmethodID upsCoordinatesInit;
+    jmethodID utmCoordinatesInit;
+    jmethodID accuracyInit;
+    jmethodID convertResultsInit;
+    jmethodID convertCollectionResultsInit;
+    jmethodID vectorInit;
+    jmethodID vectorSize;
+    jmethodID vectorGet;
+    jmethodID vectorAddElement;
+  };
+
+  const JNICCSClassCache* getJNICCSClassCache();
+
   MSP::CCS::CoordinateSystemParameters* translateFromJNIParameters( JNIEnv *env, jobject parameters );
 
   MSP::CCS::CoordinateTuple* translateFromJNICoordinates( JNIEnv *env, jobject coordinates );
@@ -25,6 +176,25 @@ class MSP::CCS::Accuracy;
 
   jobject translateToJNICoordinates( JNIEnv *env, MSP::CCS::CoordinateTuple* coordinates );
 
+  /*
+   *  Packed coordinates: one point is a run of doubles in a flat array.
+   *
+   *    geodetic                 : longitude, latitude, height (3)
+   *    geocentric, local cart.  : x, y, z (3)
+   *    UTM                      : zone, hemisphere ('N'/'S' code), easting, northing (4)
+   *    UPS                      : hemisphere ('N'/'S' code), easting, northing (3)
+   *    other map projections    : easting, northing (2)
+   *    BNG, GARS, GEOREF, MGRS, USNG : not packable (0)
+   */
+  int packedCoordinateSize( MSP::CCS::CoordinateType::Enum coordinateType );
+
+  /* Returns a tuple to unpack into, or 0 if the type is not packable */
+  MSP::CCS::CoordinateTuple* createPackedCoordinates( MSP::CCS::CoordinateType::Enum coordinateType );
+
+  void unpackCoordinates( const double* packed, MSP::CCS::CoordinateTuple* coordinates );
+
+  void packCoordinates( MSP::CCS::CoordinateTuple* coordinates, double* packed );
+
 #ifdef __cplusplus
 }
 #endif
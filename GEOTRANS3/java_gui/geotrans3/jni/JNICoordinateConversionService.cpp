@@ -1,6 +1,8 @@
 // CLASSIFICATION: UNCLASSIFIED
 
 #include <jni.h>
+#include <limits>
+#include <vector>
 #include "string.h"
 #include "CoordinateConversionService.h"
 #include "Accuracy.h"
@@ -141,21 +143,9 @@ JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniC
        jobject jniTargetAccuracy = translateToJNIAccuracy( env, targetAccuracy );
 
         // Create ConvertResults
-        jclass cls = env->FindClass( "geotrans3/coordinates/ConvertResults" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults class not found." );
-            return NULL;
-        }
-
-        jmethodID mid = env->GetMethodID( cls, "<init>", "(Lgeotrans3/coordinates/CoordinateTuple;Lgeotrans3/coordinates/Accuracy;)V" );
-        if( mid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults method id not found." );
-            return NULL;
-        }
+        const JNICCSClassCache* cache = getJNICCSClassCache();
 
-        convertResults = env->NewObject( cls, mid, jniTargetCoordinateTuple, jniTargetAccuracy );
+        convertResults = env->NewObject( cache->convertResultsClass, cache->convertResultsInit, jniTargetCoordinateTuple, jniTargetAccuracy );
         if( convertResults == NULL )
           throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults object could not be created." );
       }
@@ -210,21 +200,9 @@ JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniC
 
 
         // Create ConvertResults
-        jclass cls = env->FindClass( "geotrans3/coordinates/ConvertResults" );
-        if( cls == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults class not found." );
-            return NULL;
-        }
-
-        jmethodID mid = env->GetMethodID( cls, "<init>", "(Lgeotrans3/coordinates/CoordinateTuple;Lgeotrans3/coordinates/Accuracy;)V" );
-        if( mid == NULL )
-        {
-            throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults method id not found." );
-            return NULL;
-        }
+        const JNICCSClassCache* cache = getJNICCSClassCache();
 
-        convertResults = env->NewObject( cls, mid, jniSourceCoordinateTuple, jniSourceAccuracy );
+        convertResults = env->NewObject( cache->convertResultsClass, cache->convertResultsInit, jniSourceCoordinateTuple, jniSourceAccuracy );
         if( convertResults == NULL )
           throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertResults object could not be created." );
       }
@@ -683,206 +661,143 @@ JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniG
 }
 
 
-JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetCollection(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
-                                                                                        jobject _sourceCoordinates, jobject _sourceAccuracy, 
-                                                                                        jobject _targetCoordinates, jobject _targetAccuracy)
+/*
+ *  Reads a java.util.Vector of coordinates and accuracies into the
+ *  native vectors used by the collection conversions.
+ */
+static void translateFromJNICollection( JNIEnv *env, jobject _coordinates, jobject _accuracy,
+                                        std::vector<CoordinateTuple*>& coordinateVector,
+                                        std::vector<Accuracy*>& accuracyVector )
 {
-  jobject convertCollectionResults = 0;
+  const JNICCSClassCache* cache = getJNICCSClassCache();
 
-  CoordinateConversionService* coordinateConversionService = ( CoordinateConversionService* )coordinateConversionPtr;
+  jint numCoordinates = env->CallIntMethod( _coordinates, cache->vectorSize );
+  coordinateVector.reserve( numCoordinates );
 
-  if( coordinateConversionService )
+  int i;
+  for( i = 0; i < numCoordinates; i++ )
   {
-    jclass jVectorClass = env->FindClass( "java/util/Vector" );
+    jobject coordinate = env->CallObjectMethod( _coordinates, cache->vectorGet, i );
 
-    jmethodID sizeMid = env->GetMethodID( jVectorClass, "size", "()I" );
-    if( sizeMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: size method id not found." );
-        return NULL;
-    }
+    coordinateVector.push_back( translateFromJNICoordinates( env, coordinate ) );
 
-    jmethodID getMid = env->GetMethodID( jVectorClass, "get", "(I)Ljava/lang/Object;" );
-    if( getMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: get method id not found." );
-        return NULL;
-    }
+    env->DeleteLocalRef( coordinate );
+  }
 
+  jint numAccuracies = env->CallIntMethod( _accuracy, cache->vectorSize );
+  accuracyVector.reserve( numAccuracies );
 
-    // Create source coordinates vector
-    jint numSourceCoordinates = env->CallIntMethod( _sourceCoordinates, sizeMid );
-    std::vector<CoordinateTuple*> sourceCoordinateVector;
-    sourceCoordinateVector.reserve( numSourceCoordinates );
+  for( i = 0; i < numAccuracies; i++ )
+  {
+    jobject accuracy = env->CallObjectMethod( _accuracy, cache->vectorGet, i );
 
-    int i;
-    for( i = 0; i < numSourceCoordinates; i++ )
-    {
-      jobject coordinate = env->CallObjectMethod( _sourceCoordinates, getMid, i );
+    accuracyVector.push_back( new Accuracy(
+       env->GetDoubleField( accuracy, cache->accuracyCE90Field ),
+       env->GetDoubleField( accuracy, cache->accuracyLE90Field ),
+       env->GetDoubleField( accuracy, cache->accuracySE90Field ) ) );
 
-      CoordinateTuple* sourceCoordinateTuple = translateFromJNICoordinates( env, coordinate );
+    env->DeleteLocalRef( accuracy );
+  }
+}
 
-      sourceCoordinateVector.push_back( sourceCoordinateTuple );
-    }
 
+/*
+ *  Builds the ConvertCollectionResults returned by the collection
+ *  conversions from the converted native vectors.
+ */
+static jobject translateToJNICollectionResults( JNIEnv *env,
+                                                std::vector<CoordinateTuple*>& coordinateVector,
+                                                std::vector<Accuracy*>& accuracyVector )
+{
+  const JNICCSClassCache* cache = getJNICCSClassCache();
 
-    // Create source accuracy vector
-    jint numSourceAccuracies = env->CallIntMethod( _sourceAccuracy, sizeMid );
-    std::vector<Accuracy*> sourceAccuracyVector;
-    sourceAccuracyVector.reserve( numSourceAccuracies );
+  // Create coordinates vector
+  jobject jCoordinateVectorObj = env->NewObject( cache->vectorClass, cache->vectorInit );
+  if( jCoordinateVectorObj == NULL )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Vector object could not be created." );
+    return NULL;
+  }
 
-    for( i = 0; i < numSourceAccuracies; i++ )
-    {
-      jobject accuracy = env->CallObjectMethod( _sourceAccuracy, getMid, i );
+  int num = coordinateVector.size();
+  int i;
+  for( i = 0; i < num; i++ )
+  {
+    jobject jCoordinates = translateToJNICoordinates( env, coordinateVector[i] );
+    if( jCoordinates == NULL )
+      return NULL;
 
-      Accuracy* sourceAccuracy = new Accuracy();
-      jclass clazz = env->GetObjectClass( accuracy );
+    env->CallVoidMethod( jCoordinateVectorObj, cache->vectorAddElement, jCoordinates );
+    env->DeleteLocalRef( jCoordinates );
+  }
 
-      // CE90
-      jfieldID fid = env->GetFieldID( clazz, "ce90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ce90 field ID error." );
-          return 0;
-      }
-      sourceAccuracy->setCircularError90( env->GetDoubleField( accuracy, fid ) );
+  // Create accuracy vector
+  jobject jAccuracyVectorObj = env->NewObject( cache->vectorClass, cache->vectorInit );
+  if( jAccuracyVectorObj == NULL )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Vector object could not be created." );
+    return NULL;
+  }
 
-      // LE90
-      fid = env->GetFieldID( clazz, "le90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: le90 field ID error." );
-          return 0;
-      }
-      sourceAccuracy->setLinearError90( env->GetDoubleField( accuracy, fid ) );
+  num = accuracyVector.size();
+  for( i = 0; i < num; i++ )
+  {
+    jobject jAccuracy = translateToJNIAccuracy( env, accuracyVector[i] );
+    if( jAccuracy == NULL )
+      return NULL;
 
-      // SE90
-      fid = env->GetFieldID( clazz, "se90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: se90 field ID error." );
-          return 0;
-      }
-      sourceAccuracy->setSphericalError90( env->GetDoubleField( accuracy, fid ) );
+    env->CallVoidMethod( jAccuracyVectorObj, cache->vectorAddElement, jAccuracy );
+    env->DeleteLocalRef( jAccuracy );
+  }
 
-      sourceAccuracyVector.push_back( sourceAccuracy );
-    }
+  // Create ConvertCollectionResults
+  jobject convertCollectionResults = env->NewObject( cache->convertCollectionResultsClass, cache->convertCollectionResultsInit, jCoordinateVectorObj, jAccuracyVectorObj );
+  if( convertCollectionResults == NULL )
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults object could not be created." );
 
+  return convertCollectionResults;
+}
+
+
+JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetCollection(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
+                                                                                        jobject _sourceCoordinates, jobject _sourceAccuracy, 
+                                                                                        jobject _targetCoordinates, jobject _targetAccuracy)
+{
+  jobject convertCollectionResults = 0;
+
+  CoordinateConversionService* coordinateConversionService = ( CoordinateConversionService* )coordinateConversionPtr;
+
+  if( coordinateConversionService )
+  {
+    std::vector<CoordinateTuple*> sourceCoordinateVector;
+    std::vector<Accuracy*> sourceAccuracyVector;
+    translateFromJNICollection( env, _sourceCoordinates, _sourceAccuracy, sourceCoordinateVector, sourceAccuracyVector );
 
     // Convert
     std::vector<CoordinateTuple*> targetCoordinateVector;
-    targetCoordinateVector.reserve( numSourceCoordinates );
+    targetCoordinateVector.reserve( sourceCoordinateVector.size() );
     std::vector<Accuracy*> targetAccuracyVector;
-    targetAccuracyVector.reserve( numSourceCoordinates );
+    targetAccuracyVector.reserve( sourceCoordinateVector.size() );
 
     coordinateConversionService->convertSourceToTargetCollection( sourceCoordinateVector, sourceAccuracyVector,
                                                                   targetCoordinateVector, targetAccuracyVector );
 
-
-    jmethodID initMid = env->GetMethodID( jVectorClass, "<init>", "()V" );
-    if( initMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: init method id not found." );
-        return NULL;
-    }
-
-    jmethodID addElementMid = env->GetMethodID( jVectorClass, "addElement", "(Ljava/lang/Object;)V" );
-    if( addElementMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: addElement method id not found." );
-        return NULL;
-    }
-
-
-    // Create target coordinates vector
-    jobject jTargetCoordinateVectorObj = env->NewObject( jVectorClass, initMid );
-
-    int num = targetCoordinateVector.size();
-
-    for( i = 0; i < num; i++ )
-    {
-      // Create CoordinateTuple parameter
-      jobject jCoordinates = translateToJNICoordinates( env, targetCoordinateVector[i] );
-
-      env->CallBooleanMethod( jTargetCoordinateVectorObj, addElementMid, jCoordinates );
-    }
-
-
-    // Create target accuracy vector
-    jobject jTargetAccuracyVectorObj = env->NewObject( jVectorClass, initMid );
-
-    num = targetAccuracyVector.size();
-
-    for( i = 0; i < num; i++ )
-    {
-      // Create Accuracy parameter
-      jclass acls = env->FindClass( "geotrans3/coordinates/Accuracy" );
-      if( acls == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy class not found." );
-          return NULL;
-      }
-
-      jmethodID cid = env->GetMethodID( acls, "<init>", "(DDD)V" );
-      if( cid == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy method id not found." );
-          return NULL;
-      }
-
-      Accuracy targetAccuracy = *targetAccuracyVector[i];
-      jobject jAccuracy = env->NewObject( acls, cid, targetAccuracy.circularError90(), targetAccuracy.linearError90(), targetAccuracy.sphericalError90() );
-      if( jAccuracy == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy object could not be created." );
-          return NULL;
-      }
-
-      env->CallBooleanMethod( jTargetAccuracyVectorObj, addElementMid, jAccuracy );
-    }
-
-
-    // Create ConvertCollectionResults
-    jclass cls = env->FindClass( "geotrans3/coordinates/ConvertCollectionResults" );
-    if( cls == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults class not found." );
-        return NULL;
-    }
-
-    jmethodID mid = env->GetMethodID( cls, "<init>", "(Ljava/util/Vector;Ljava/util/Vector;)V" );
-    if( mid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults method id not found." );
-        return NULL;
-    }
-
-    convertCollectionResults = env->NewObject( cls, mid, jTargetCoordinateVectorObj, jTargetAccuracyVectorObj );
-    if( convertCollectionResults == NULL )
-    {
-      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults object could not be created." );
-      return NULL;
-    }
-
+    convertCollectionResults = translateToJNICollectionResults( env, targetCoordinateVector, targetAccuracyVector );
 
     // Release memory
-    for( i = 0; i < numSourceCoordinates; i++ )
-    {
+    unsigned int i;
+    for( i = 0; i < sourceCoordinateVector.size(); i++ )
       delete sourceCoordinateVector[i];
-    }
-    sourceCoordinateVector.clear();
-
-    for( i = 0; i < numSourceAccuracies; i++ )
-    {
+    for( i = 0; i < sourceAccuracyVector.size(); i++ )
       delete sourceAccuracyVector[i];
-    }
-    sourceAccuracyVector.clear();
-
-    for( i = 0; i < numSourceCoordinates; i++ )
-    {
+    for( i = 0; i < targetCoordinateVector.size(); i++ )
       delete targetCoordinateVector[i];
+    // points with no source coordinates pass their source accuracy through
+    for( i = 0; i < targetAccuracyVector.size(); i++ )
+    {
+      if( i >= sourceAccuracyVector.size() || targetAccuracyVector[i] != sourceAccuracyVector[i] )
+        delete targetAccuracyVector[i];
     }
-    targetCoordinateVector.clear();
   }
 
   return convertCollectionResults;
@@ -899,199 +814,235 @@ JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniC
 
   if( coordinateConversionService )
   {
-    jclass jVectorClass = env->FindClass( "java/util/Vector" );
+    std::vector<CoordinateTuple*> targetCoordinateVector;
+    std::vector<Accuracy*> targetAccuracyVector;
+    translateFromJNICollection( env, _targetCoordinates, _targetAccuracy, targetCoordinateVector, targetAccuracyVector );
 
-    jmethodID sizeMid = env->GetMethodID( jVectorClass, "size", "()I" );
-    if( sizeMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: size method id not found." );
-        return NULL;
-    }
+    // Convert
+    std::vector<CoordinateTuple*> sourceCoordinateVector;
+    sourceCoordinateVector.reserve( targetCoordinateVector.size() );
+    std::vector<Accuracy*> sourceAccuracyVector;
+    sourceAccuracyVector.reserve( targetCoordinateVector.size() );
 
-    jmethodID getMid = env->GetMethodID( jVectorClass, "get", "(I)Ljava/lang/Object;" );
-    if( getMid == NULL )
+    coordinateConversionService->convertTargetToSourceCollection( targetCoordinateVector, targetAccuracyVector,
+                                                                  sourceCoordinateVector, sourceAccuracyVector );
+
+    convertCollectionResults = translateToJNICollectionResults( env, sourceCoordinateVector, sourceAccuracyVector );
+
+    // Release memory
+    unsigned int i;
+    for( i = 0; i < targetCoordinateVector.size(); i++ )
+      delete targetCoordinateVector[i];
+    for( i = 0; i < targetAccuracyVector.size(); i++ )
+      delete targetAccuracyVector[i];
+    for( i = 0; i < sourceCoordinateVector.size(); i++ )
+      delete sourceCoordinateVector[i];
+    // points with no target coordinates pass their target accuracy through
+    for( i = 0; i < sourceAccuracyVector.size(); i++ )
     {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: get method id not found." );
-        return NULL;
+      if( i >= targetAccuracyVector.size() || sourceAccuracyVector[i] != targetAccuracyVector[i] )
+        delete sourceAccuracyVector[i];
     }
+  }
 
+  return convertCollectionResults;
+}
 
-    // Create target coordinates vector
-    jint numTargetCoordinates = env->CallIntMethod( _targetCoordinates, sizeMid );
-    std::vector<CoordinateTuple*> targetCoordinateVector;
-    targetCoordinateVector.reserve( numTargetCoordinates );
 
-    int i;
-    for( i = 0; i < numTargetCoordinates; i++ )
-    {
-      jobject coordinate = env->CallObjectMethod( _targetCoordinates, getMid, i );
+/*
+ *  Converts count packed points (see JNICCSObjectTranslator.h) from
+ *  input to output, one status per point:
+ *    0 - converted, 1 - converted with a warning, 2 - error (output is NaN).
+ *  The tuples are reused for every point, so no objects are created per
+ *  point.  Returns the number of points in error.
+ */
+static int convertPacked( CoordinateConversionService* coordinateConversionService, SourceOrTarget::Enum inputDirection,
+                          const double* input, double* output, jint* status, int count )
+{
+  SourceOrTarget::Enum outputDirection = ( inputDirection == SourceOrTarget::source ) ? SourceOrTarget::target : SourceOrTarget::source;
 
-      CoordinateTuple* targetCoordinateTuple = translateFromJNICoordinates( env, coordinate );
+  CoordinateType::Enum inputType = coordinateConversionService->getCoordinateSystem( inputDirection )->coordinateType();
+  CoordinateType::Enum outputType = coordinateConversionService->getCoordinateSystem( outputDirection )->coordinateType();
 
-      targetCoordinateVector.push_back( targetCoordinateTuple );
-    }
+  int inputSize = packedCoordinateSize( inputType );
+  int outputSize = packedCoordinateSize( outputType );
 
+  CoordinateTuple* inputCoordinates = createPackedCoordinates( inputType );
+  CoordinateTuple* outputCoordinates = createPackedCoordinates( outputType );
+  Accuracy inputAccuracy;
+  Accuracy outputAccuracy;
 
-    // Create target accuracy vector
-    jint numTargetAccuracies = env->CallIntMethod( _targetAccuracy, sizeMid );
-    std::vector<Accuracy*> targetAccuracyVector;
-    targetAccuracyVector.reserve( numTargetAccuracies );
+  int numErrors = 0;
+  for( int i = 0; i < count; i++ )
+  {
+    const double* inputPoint = input + (size_t)i * inputSize;
+    double* outputPoint = output + (size_t)i * outputSize;
+
+    unpackCoordinates( inputPoint, inputCoordinates );
+    outputCoordinates->setWarningMessage( "" );
 
-    for( i = 0; i < numTargetAccuracies; i++ )
+    try
     {
-      jobject accuracy = env->CallObjectMethod( _targetAccuracy, getMid, i );
+      if( inputDirection == SourceOrTarget::source )
+        coordinateConversionService->convertSourceToTarget( inputCoordinates, &inputAccuracy, *outputCoordinates, outputAccuracy );
+      else
+        coordinateConversionService->convertTargetToSource( inputCoordinates, &inputAccuracy, *outputCoordinates, outputAccuracy );
 
-      Accuracy* targetAccuracy = new Accuracy();
-      jclass clazz = env->GetObjectClass( accuracy );
+      packCoordinates( outputCoordinates, outputPoint );
+      status[i] = ( strlen( outputCoordinates->warningMessage() ) > 0 ) ? 1 : 0;
+    }
+    catch( CoordinateConversionException e )
+    {
+      for( int j = 0; j < outputSize; j++ )
+        outputPoint[j] = std::numeric_limits<double>::quiet_NaN();
+      status[i] = 2;
+      numErrors++;
+    }
+  }
 
-      // CE90
-      jfieldID fid = env->GetFieldID( clazz, "ce90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ce90 field ID error." );
-          return 0;
-      }
-      targetAccuracy->setCircularError90( env->GetDoubleField( accuracy, fid ) );
+  delete inputCoordinates;
+  delete outputCoordinates;
 
-      // LE90
-      fid = env->GetFieldID( clazz, "le90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: le90 field ID error." );
-          return 0;
-      }
-      targetAccuracy->setLinearError90( env->GetDoubleField( accuracy, fid ) );
+  return numErrors;
+}
 
-      // SE90
-      fid = env->GetFieldID( clazz, "se90", "D");
-      if (fid == NULL)
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: se90 field ID error." );
-          return 0;
-      }
-      targetAccuracy->setSphericalError90( env->GetDoubleField( accuracy, fid ) );
 
-      targetAccuracyVector.push_back( targetAccuracy );
-    }
+/*
+ *  Checks that the service and both coordinate systems can use packed
+ *  coordinates, and returns the number of doubles per input and output
+ *  point.  Throws a Java exception and returns false otherwise.
+ */
+static bool packedSizes( JNIEnv *env, CoordinateConversionService* coordinateConversionService,
+                         SourceOrTarget::Enum inputDirection, int& inputSize, int& outputSize )
+{
+  if( !coordinateConversionService )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Invalid coordinate conversion service." );
+    return false;
+  }
 
+  SourceOrTarget::Enum outputDirection = ( inputDirection == SourceOrTarget::source ) ? SourceOrTarget::target : SourceOrTarget::source;
 
-    // Convert
-    std::vector<CoordinateTuple*> sourceCoordinateVector;
-    sourceCoordinateVector.reserve( numTargetCoordinates );
-    std::vector<Accuracy*> sourceAccuracyVector;
-    sourceAccuracyVector.reserve( numTargetCoordinates );
+  inputSize = packedCoordinateSize( coordinateConversionService->getCoordinateSystem( inputDirection )->coordinateType() );
+  outputSize = packedCoordinateSize( coordinateConversionService->getCoordinateSystem( outputDirection )->coordinateType() );
+  if( inputSize == 0 || outputSize == 0 )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Coordinate system can not be used with packed coordinates." );
+    return false;
+  }
 
-    coordinateConversionService->convertTargetToSourceCollection( targetCoordinateVector, targetAccuracyVector,
-                                                                  sourceCoordinateVector, sourceAccuracyVector );
+  return true;
+}
 
 
-    jmethodID initMid = env->GetMethodID( jVectorClass, "<init>", "()V" );
-    if( initMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: init method id not found." );
-        return NULL;
-    }
+static jint convertArray( JNIEnv *env, jlong coordinateConversionPtr, SourceOrTarget::Enum inputDirection,
+                          jdoubleArray _input, jdoubleArray _output, jintArray _status, jint count )
+{
+  CoordinateConversionService* coordinateConversionService = ( CoordinateConversionService* )coordinateConversionPtr;
 
-    jmethodID addElementMid = env->GetMethodID( jVectorClass, "addElement", "(Ljava/lang/Object;)V" );
-    if( addElementMid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: addElement method id not found." );
-        return NULL;
-    }
+  int inputSize, outputSize;
+  if( !packedSizes( env, coordinateConversionService, inputDirection, inputSize, outputSize ) )
+    return 0;
 
+  if( count < 0 ||
+      env->GetArrayLength( _input ) < (jlong)count * inputSize ||
+      env->GetArrayLength( _output ) < (jlong)count * outputSize ||
+      env->GetArrayLength( _status ) < count )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Array too small for the number of points." );
+    return 0;
+  }
 
-    // Create source coordinates vector
-    jobject jSourceCoordinateVectorObj = env->NewObject( jVectorClass, initMid );
+  // The arrays are held for the whole batch: no JNI calls until released
+  double* input = ( double* )env->GetPrimitiveArrayCritical( _input, NULL );
+  double* output = ( double* )env->GetPrimitiveArrayCritical( _output, NULL );
+  jint* status = ( jint* )env->GetPrimitiveArrayCritical( _status, NULL );
 
-    int num = sourceCoordinateVector.size();
+  int numErrors = 0;
+  if( input && output && status )
+    numErrors = convertPacked( coordinateConversionService, inputDirection, input, output, status, count );
 
-    for( i = 0; i < num; i++ )
-    {
-      // Create CoordinateTuple parameter
-      jobject jCoordinates = translateToJNICoordinates( env, sourceCoordinateVector[i] );
+  if( status )
+    env->ReleasePrimitiveArrayCritical( _status, status, 0 );
+  if( output )
+    env->ReleasePrimitiveArrayCritical( _output, output, 0 );
+  if( input )
+    env->ReleasePrimitiveArrayCritical( _input, input, JNI_ABORT );
 
-      env->CallBooleanMethod( jSourceCoordinateVectorObj, addElementMid, jCoordinates );
-    }
+  if( !input || !output || !status )
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Out of memory." );
 
+  return numErrors;
+}
 
-    // Create source accuracy vector
-    jobject jSourceAccuracyVectorObj = env->NewObject( jVectorClass, initMid );
 
-    num = sourceAccuracyVector.size();
+static jint convertBuffer( JNIEnv *env, jlong coordinateConversionPtr, SourceOrTarget::Enum inputDirection,
+                           jobject _input, jobject _output, jobject _status, jint count )
+{
+  CoordinateConversionService* coordinateConversionService = ( CoordinateConversionService* )coordinateConversionPtr;
 
-    for( i = 0; i < num; i++ )
-    {
-      // Create Accuracy parameter
-      jclass acls = env->FindClass( "geotrans3/coordinates/Accuracy" );
-      if( acls == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy class not found." );
-          return NULL;
-      }
+  int inputSize, outputSize;
+  if( !packedSizes( env, coordinateConversionService, inputDirection, inputSize, outputSize ) )
+    return 0;
 
-      jmethodID cid = env->GetMethodID( acls, "<init>", "(DDD)V" );
-      if( cid == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy method id not found." );
-          return NULL;
-      }
+  double* input = ( double* )env->GetDirectBufferAddress( _input );
+  double* output = ( double* )env->GetDirectBufferAddress( _output );
+  jint* status = ( jint* )env->GetDirectBufferAddress( _status );
+  if( !input || !output || !status )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Buffers must be direct." );
+    return 0;
+  }
 
-      Accuracy sourceAccuracy = *sourceAccuracyVector[i];
-      jobject jAccuracy = env->NewObject( acls, cid, sourceAccuracy.circularError90(), sourceAccuracy.linearError90(), sourceAccuracy.sphericalError90() );
-      if( jAccuracy == NULL )
-      {
-          throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Accuracy object could not be created." );
-          return NULL;
-      }
+  if( count < 0 ||
+      env->GetDirectBufferCapacity( _input ) < (jlong)count * inputSize * (jlong)sizeof( double ) ||
+      env->GetDirectBufferCapacity( _output ) < (jlong)count * outputSize * (jlong)sizeof( double ) ||
+      env->GetDirectBufferCapacity( _status ) < (jlong)count * (jlong)sizeof( jint ) )
+  {
+    throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: Buffer too small for the number of points." );
+    return 0;
+  }
 
-      env->CallBooleanMethod( jSourceAccuracyVectorObj, addElementMid, jAccuracy );
-    }
+  return convertPacked( coordinateConversionService, inputDirection, input, output, status, count );
+}
 
 
-    // Create ConvertCollectionResults
-    jclass cls = env->FindClass( "geotrans3/coordinates/ConvertCollectionResults" );
-    if( cls == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults class not found." );
-        return NULL;
-    }
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniGetPackedCoordinateSize(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr, jint direction)
+{
+  CoordinateConversionService* coordinateConversionService = ( CoordinateConversionService* )coordinateConversionPtr;
 
-    jmethodID mid = env->GetMethodID( cls, "<init>", "(Ljava/util/Vector;Ljava/util/Vector;)V" );
-    if( mid == NULL )
-    {
-        throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults method id not found." );
-        return NULL;
-    }
+  if( coordinateConversionService )
+    return packedCoordinateSize( coordinateConversionService->getCoordinateSystem( ( SourceOrTarget::Enum )direction )->coordinateType() );
 
-    convertCollectionResults = env->NewObject( cls, mid, jSourceCoordinateVectorObj, jSourceAccuracyVectorObj );
-    if( convertCollectionResults == NULL )
-    {
-      throwException( env, "geotrans3/exception/CoordinateConversionException", "JNI Exception: ConvertCollectionResults object could not be created." );
-      return NULL;
-    }
+  return 0;
+}
 
 
-    // Release memory
-    for( i = 0; i < numTargetCoordinates; i++ )
-    {
-      delete targetCoordinateVector[i];
-    }
-    targetCoordinateVector.clear();
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetArray(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
+                                                                                        jdoubleArray _sourceCoordinates, jdoubleArray _targetCoordinates, jintArray _status, jint count)
+{
+  return convertArray( env, coordinateConversionPtr, SourceOrTarget::source, _sourceCoordinates, _targetCoordinates, _status, count );
+}
 
-    for( i = 0; i < numTargetAccuracies; i++ )
-    {
-      delete targetAccuracyVector[i];
-    }
-    targetAccuracyVector.clear();
 
-    for( i = 0; i < numTargetCoordinates; i++ )
-    {
-      delete sourceCoordinateVector[i];
-    }
-    sourceCoordinateVector.clear();
-  }
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertTargetToSourceArray(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
+                                                                                        jdoubleArray _targetCoordinates, jdoubleArray _sourceCoordinates, jintArray _status, jint count)
+{
+  return convertArray( env, coordinateConversionPtr, SourceOrTarget::target, _targetCoordinates, _sourceCoordinates, _status, count );
+}
 
-  return convertCollectionResults;
+
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetBuffer(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
+                                                                                        jobject _sourceCoordinates, jobject _targetCoordinates, jobject _status, jint count)
+{
+  return convertBuffer( env, coordinateConversionPtr, SourceOrTarget::source, _sourceCoordinates, _targetCoordinates, _status, count );
+}
+
+
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertTargetToSourceBuffer(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
+                                                                                        jobject _targetCoordinates, jobject _sourceCoordinates, jobject _status, jint count)
+{
+  return convertBuffer( env, coordinateConversionPtr, SourceOrTarget::target, _targetCoordinates, _sourceCoordinates, _status, count );
 }
 
 /*JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertVector(JNIEnv *env, jobject jobj, jlong coordinateConversionPtr,
@@ -97,6 +97,46 @@ JNIEXPORT jstring JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniG
 JNIEXPORT jobject JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniGetCoordinateSystem
   (JNIEnv *, jobject, jlong, jint);
 
+/*
+ * Class:     geotrans3_jni_JNICoordinateConversionService
+ * Method:    jniGetPackedCoordinateSize
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniGetPackedCoordinateSize
+  (JNIEnv *, jobject, jlong, jint);
+
+/*
+ * Class:     geotrans3_jni_JNICoordinateConversionService
+ * Method:    jniConvertSourceToTargetArray
+ * Signature: (J[D[D[II)I
+ */
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetArray
+  (JNIEnv *, jobject, jlong, jdoubleArray, jdoubleArray, jintArray, jint);
+
+/*
+ * Class:     geotrans3_jni_JNICoordinateConversionService
+ * Method:    jniConvertTargetToSourceArray
+ * Signature: (J[D[D[II)I
+ */
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertTargetToSourceArray
+  (JNIEnv *, jobject, jlong, jdoubleArray, jdoubleArray, jintArray, jint);
+
+/*
+ * Class:     geotrans3_jni_JNICoordinateConversionService
+ * Method:    jniConvertSourceToTargetBuffer
+ * Signature: (JLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;I)I
+ */
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertSourceToTargetBuffer
+  (JNIEnv *, jobject, jlong, jobject, jobject, jobject, jint);
+
+/*
+ * Class:     geotrans3_jni_JNICoordinateConversionService
+ * Method:    jniConvertTargetToSourceBuffer
+ * Signature: (JLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;I)I
+ */
+JNIEXPORT jint JNICALL Java_geotrans3_jni_JNICoordinateConversionService_jniConvertTargetToSourceBuffer
+  (JNIEnv *, jobject, jlong, jobject, jobject, jobject, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 
 package geotrans3.jni;
 
+import java.nio.ByteBuffer;
 import java.util.Collection;
 import geotrans3.coordinates.Accuracy;
 import geotrans3.coordinates.ConvertResults;
@@ -42,6 +43,19 @@ public class JNICoordinateConversionService extends Object
 
   private native String jniGetDatum(long _coordinateConversionPtrService, int direction) throws CoordinateConversionException;
   private native CoordinateSystemParameters jniGetCoordinateSystem(long _coordinateConversionPtrService, int direction) throws CoordinateConversionException;
+
+  private native int jniGetPackedCoordinateSize(long _coordinateConversionPtrService, int direction);
+  private native int jniConvertSourceToTargetArray(long _coordinateConversionPtrService, double[] sourceCoordinates, double[] targetCoordinates, int[] status, int count) throws CoordinateConversionException;
+  private native int jniConvertTargetToSourceArray(long _coordinateConversionPtrService, double[] targetCoordinates, double[] sourceCoordinates, int[] status, int count) throws CoordinateConversionException;
+  private native int jniConvertSourceToTargetBuffer(long _coordinateConversionPtrService, ByteBuffer sourceCoordinates, ByteBuffer targetCoordinates, ByteBuffer status, int count) throws CoordinateConversionException;
+  private native int jniConvertTargetToSourceBuffer(long _coordinateConversionPtrService, ByteBuffer targetCoordinates, ByteBuffer sourceCoordinates, ByteBuffer status, int count) throws CoordinateConversionException;
+
+  /** Packed conversion status: converted */
+  public static final int PACKED_OK = 0;
+  /** Packed conversion status: converted with a warning */
+  public static final int PACKED_WARNING = 1;
+  /** Packed conversion status: not converted, the output point is NaN */
+  public static final int PACKED_ERROR = 2;
  
   // Holds the C++ CoordinateConversionService object pointer
   private long coordinateConversionServicePtr;
@@ -145,6 +159,81 @@ public class JNICoordinateConversionService extends Object
   }
 
 
+  /**
+   * Returns the number of doubles per point in packed coordinates for the
+   * source or target coordinate system:
+   *   Geodetic: longitude, latitude, height (3)
+   *   Geocentric, Local Cartesian: x, y, z (3)
+   *   UTM: zone, hemisphere ('N' or 'S' as a number), easting, northing (4)
+   *   UPS: hemisphere ('N' or 'S' as a number), easting, northing (3)
+   *   other map projections: easting, northing (2)
+   *   BNG, GARS, GEOREF, MGRS and USNG can not be packed (0)
+   */
+  public synchronized int getPackedCoordinateSize(int direction) throws CoordinateConversionException
+  {
+    if (coordinateConversionServicePtr == 0) 
+    {
+        throw new CoordinateConversionException("getPackedCoordinateSize called with null object");
+    }
+    
+    return jniGetPackedCoordinateSize(coordinateConversionServicePtr, direction);
+  }
+
+
+  /**
+   * Converts count packed source points to packed target points in one
+   * native call, setting one PACKED_ status per point.
+   * Returns the number of points that could not be converted.
+   */
+  public synchronized int convertSourceToTarget(double[] sourceCoordinates, double[] targetCoordinates, int[] status, int count) throws CoordinateConversionException
+  {
+    if (coordinateConversionServicePtr == 0) 
+    {
+        throw new CoordinateConversionException("convertSourceToTarget called with null object");
+    }
+    
+    return jniConvertSourceToTargetArray(coordinateConversionServicePtr, sourceCoordinates, targetCoordinates, status, count);
+  }
+
+
+  public synchronized int convertTargetToSource(double[] targetCoordinates, double[] sourceCoordinates, int[] status, int count) throws CoordinateConversionException
+  {
+    if (coordinateConversionServicePtr == 0) 
+    {
+        throw new CoordinateConversionException("convertTargetToSource called with null object");
+    }
+    
+    return jniConvertTargetToSourceArray(coordinateConversionServicePtr, targetCoordinates, sourceCoordinates, status, count);
+  }
+
+
+  /**
+   * Same as the array version, for direct buffers in native byte order
+   * (ByteBuffer.allocateDirect(n).order(ByteOrder.nativeOrder())).
+   * The status buffer holds one int per point.
+   */
+  public synchronized int convertSourceToTarget(ByteBuffer sourceCoordinates, ByteBuffer targetCoordinates, ByteBuffer status, int count) throws CoordinateConversionException
+  {
+    if (coordinateConversionServicePtr == 0) 
+    {
+        throw new CoordinateConversionException("convertSourceToTarget called with null object");
+    }
+    
+    return jniConvertSourceToTargetBuffer(coordinateConversionServicePtr, sourceCoordinates, targetCoordinates, status, count);
+  }
+
+
+  public synchronized int convertTargetToSource(ByteBuffer targetCoordinates, ByteBuffer sourceCoordinates, ByteBuffer status, int count) throws CoordinateConversionException
+  {
+    if (coordinateConversionServicePtr == 0) 
+    {
+        throw new CoordinateConversionException("convertTargetToSource called with null object");
+    }
+    
+    return jniConvertTargetToSourceBuffer(coordinateConversionServicePtr, targetCoordinates, sourceCoordinates, status, count);
+  }
+
+
 /*  public synchronized ConvertCollectionResults convertVector(java.lang.String sourceDatumCode, CoordinateSystemParameters sourceCoordSysParams, 
                                        java.lang.String targetDatumCode, CoordinateSystemParameters targetCoordSysParams,
                                        java.util.Vector sourceCoordinatesVector, java.util.Vector sourceAccuracyVector) throws CoordinateConversionException
@@ -0,0 +1,376 @@
+// CLASSIFICATION: UNCLASSIFIED
+
+// MSPCCS_BatchConverter.cpp : Defines the entry point for the headless
+// file conversion application.
+//
+// Converts one or more GEOTRANS-format input files to the coordinate system
+// and datum described by the header of a target file, without the Java GUI.
+// Input files are converted concurrently by a bounded pool of worker threads,
+// each of which owns its own Fiomeths instance.
+//
+// Usage:
+//    MSPCCS_BatchConverter [-j workers] [-o outputDirectory] [-q]
+//                          targetHeaderFile inputFile [inputFile ...]
+//
+//    targetHeaderFile : GEOTRANS-format file whose header gives the target
+//                       coordinate system and datum (no coordinates needed)
+//    -j workers       : maximum number of files converted at once
+//                       (default: one per processor, at most one per file)
+//    -o directory     : write <directory>/<input file name>; by default the
+//                       output is written next to the input as <input>.out
+//    -q               : only print the totals line
+//
+// Exit status:
+//    0  every file converted without errors
+//    1  every file converted, but some coordinates had errors
+//    2  one or more files could not be converted
+//    3  invalid command line or target header file
+//
+// Note: CoordinateConversionService serializes conversions across threads,
+// so the workers overlap file reading, parsing and formatting.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#  include <windows.h>
+#else
+#  include <sys/time.h>
+#  include <unistd.h>
+#endif
+
+#include "fiomeths.h"
+#include "CoordinateSystemParameters.h"
+#include "CoordinateConversionException.h"
+#include "CCSThread.h"
+#include "CCSThreadMutex.h"
+#include "CCSThreadLock.h"
+
+
+using MSP::CCSThread;
+using MSP::CCSThreadMutex;
+using MSP::CCSThreadLock;
+
+
+namespace
+{
+  const int EXIT_CONVERTED    = 0;
+  const int EXIT_POINT_ERRORS = 1;
+  const int EXIT_FILE_ERRORS  = 2;
+  const int EXIT_USAGE        = 3;
+
+  const int MAX_WORKERS = 64;
+
+  struct FileJob
+  {
+    std::string inputFileName;
+    std::string outputFileName;
+    bool   converted;
+    long   numProcessed;
+    long   numErrors;
+    long   numWarnings;
+    double elapsedTime;
+    char   message[256];
+  };
+
+  struct BatchState
+  {
+    std::vector<FileJob> jobs;
+    const char*                 targetDatumCode;
+    CoordinateSystemParameters* targetParameters;
+    bool                        quiet;
+    unsigned int                nextJob;
+    CCSThreadMutex              mutex;
+  };
+
+
+  double wallClock()
+  {
+#ifdef WIN32
+    return GetTickCount() / 1000.0;
+#else
+    struct timeval now;
+    gettimeofday( &now, 0 );
+    return now.tv_sec + now.tv_usec / 1000000.0;
+#endif
+  }
+
+
+  int processorCount()
+  {
+#ifdef WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    return info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf( _SC_NPROCESSORS_ONLN );
+    return ( count > 0 ) ? (int)count : 1;
+#else
+    return 1;
+#endif
+  }
+
+
+  double pointsPerSecond( long numProcessed, double elapsedTime )
+  {
+    return ( elapsedTime > 0 ) ? numProcessed / elapsedTime : 0;
+  }
+
+
+  std::string outputFileName(
+     const char* inputFileName,
+     const char* outputDirectory )
+  {
+    if( !outputDirectory )
+      return std::string( inputFileName ) + ".out";
+
+    const char* baseName = inputFileName;
+    for( const char* c = inputFileName; *c; c++ )
+    {
+      if( *c == '/' || *c == '\\' )
+        baseName = c + 1;
+    }
+
+    std::string name( outputDirectory );
+    if( !name.empty() && name[name.size() - 1] != '/' &&
+        name[name.size() - 1] != '\\' )
+      name += '/';
+
+    return name + baseName;
+  }
+
+
+  void convertJob( BatchState* state, FileJob& job )
+  {
+    double startTime = wallClock();
+
+    Fiomeths* fiomeths = 0;
+    try
+    {
+      fiomeths = new Fiomeths( job.inputFileName.c_str() );
+      fiomeths->setUseNSEW( true );
+      fiomeths->setUseMinutes( true );
+      fiomeths->setUseSeconds( true );
+      fiomeths->setOutputFilename(
+         job.outputFileName.c_str(),
+         state->targetDatumCode, state->targetParameters );
+      fiomeths->convertFile();
+
+      job.converted = true;
+    }
+    catch( CoordinateConversionException e )
+    {
+      strncpy( job.message, e.getMessage(), sizeof( job.message ) - 1 );
+      job.message[sizeof( job.message ) - 1] = '\0';
+
+      size_t length = strlen( job.message );
+      while( length > 0 && ( job.message[length - 1] == '\n' ||
+                             job.message[length - 1] == '\r' ) )
+        job.message[--length] = '\0';
+    }
+
+    if( fiomeths )
+    {
+      job.numProcessed = fiomeths->getNumProcessed();
+      job.numErrors    = fiomeths->getNumErrors();
+      job.numWarnings  = fiomeths->getNumWarnings();
+      delete fiomeths;
+    }
+
+    job.elapsedTime = wallClock() - startTime;
+
+    if( state->quiet )
+      return;
+
+    CCSThreadLock lock( &state->mutex );
+    if( job.converted )
+    {
+      printf( "%s: %ld points, %ld errors, %ld warnings, "
+              "%.3f s, %.0f points/s\n",
+              job.inputFileName.c_str(), job.numProcessed, job.numErrors,
+              job.numWarnings, job.elapsedTime,
+              pointsPerSecond( job.numProcessed, job.elapsedTime ) );
+    }
+    else
+    {
+      fprintf( stderr, "%s: not converted: %s\n",
+               job.inputFileName.c_str(), job.message );
+    }
+    fflush( stdout );
+  }
+
+
+  void worker( void* argument )
+  {
+    BatchState* state = (BatchState*)argument;
+
+    while( true )
+    {
+      FileJob* job = 0;
+      {
+        CCSThreadLock lock( &state->mutex );
+        if( state->nextJob < state->jobs.size() )
+          job = &state->jobs[state->nextJob++];
+      }
+
+      if( !job )
+        return;
+
+      convertJob( state, *job );
+    }
+  }
+
+
+  void usage()
+  {
+    fprintf( stderr,
+       "Usage: MSPCCS_BatchConverter [-j workers] [-o outputDirectory] [-q]"
+       " targetHeaderFile inputFile [inputFile ...]\n" );
+  }
+}
+
+
+int main( int argc, char* argv[] )
+{
+  int numWorkers = 0;
+  const char* outputDirectory = 0;
+  bool quiet = false;
+
+  int arg = 1;
+  for( ; arg < argc && argv[arg][0] == '-'; arg++ )
+  {
+    if( strcmp( argv[arg], "-j" ) == 0 && arg + 1 < argc )
+    {
+      numWorkers = atoi( argv[++arg] );
+      if( numWorkers < 1 )
+      {
+        usage();
+        return EXIT_USAGE;
+      }
+    }
+    else if( strcmp( argv[arg], "-o" ) == 0 && arg + 1 < argc )
+      outputDirectory = argv[++arg];
+    else if( strcmp( argv[arg], "-q" ) == 0 )
+      quiet = true;
+    else
+    {
+      usage();
+      return EXIT_USAGE;
+    }
+  }
+
+  if( argc - arg < 2 )
+  {
+    usage();
+    return EXIT_USAGE;
+  }
+
+  // The target file is only read for its header
+  Fiomeths* target = 0;
+  try
+  {
+    target = new Fiomeths( argv[arg++] );
+  }
+  catch( CoordinateConversionException e )
+  {
+    fprintf( stderr, "%s: invalid target header: %s\n",
+             argv[arg - 1], e.getMessage() );
+    return EXIT_USAGE;
+  }
+
+  BatchState state;
+  state.quiet = quiet;
+  state.nextJob = 0;
+  state.targetDatumCode = target->getDatumCode();
+  try
+  {
+    state.targetParameters = target->getCoordinateSystemParameters();
+  }
+  catch( CoordinateConversionException e )
+  {
+    fprintf( stderr, "%s: invalid target header: %s\n",
+             argv[arg - 1], e.getMessage() );
+    delete target;
+    return EXIT_USAGE;
+  }
+  target->closeInputFile();
+
+  for( ; arg < argc; arg++ )
+  {
+    FileJob job;
+    job.inputFileName  = argv[arg];
+    job.outputFileName = outputFileName( argv[arg], outputDirectory );
+    job.converted      = false;
+    job.numProcessed   = 0;
+    job.numErrors      = 0;
+    job.numWarnings    = 0;
+    job.elapsedTime    = 0;
+    job.message[0]     = '\0';
+    state.jobs.push_back( job );
+  }
+
+  if( numWorkers == 0 )
+    numWorkers = processorCount();
+  if( numWorkers > (int)state.jobs.size() )
+    numWorkers = state.jobs.size();
+  if( numWorkers > MAX_WORKERS )
+    numWorkers = MAX_WORKERS;
+
+  double startTime = wallClock();
+
+  // Start the pool; the calling thread also takes jobs from the list
+  std::vector<CCSThread*> threads;
+  for( int i = 1; i < numWorkers; i++ )
+  {
+    CCSThread* thread = new CCSThread();
+    if( !thread->start( worker, &state ) )
+    {
+      delete thread;
+      break;
+    }
+    threads.push_back( thread );
+  }
+
+  worker( &state );
+
+  for( unsigned int i = 0; i < threads.size(); i++ )
+  {
+    threads[i]->join();
+    delete threads[i];
+  }
+
+  double elapsedTime = wallClock() - startTime;
+
+  long numFiles = state.jobs.size();
+  long numFailed = 0;
+  long numProcessed = 0;
+  long numErrors = 0;
+  long numWarnings = 0;
+  for( unsigned int i = 0; i < state.jobs.size(); i++ )
+  {
+    if( !state.jobs[i].converted )
+      numFailed++;
+    numProcessed += state.jobs[i].numProcessed;
+    numErrors    += state.jobs[i].numErrors;
+    numWarnings  += state.jobs[i].numWarnings;
+  }
+
+  printf( "Total: %ld files (%ld not converted), %ld points, %ld errors, "
+          "%ld warnings, %.3f s, %.0f points/s, %d workers\n",
+          numFiles, numFailed, numProcessed, numErrors, numWarnings,
+          elapsedTime, pointsPerSecond( numProcessed, elapsedTime ),
+          (int)threads.size() + 1 );
+
+  delete target;
+
+  if( numFailed > 0 )
+    return EXIT_FILE_ERRORS;
+  if( numErrors > 0 )
+    return EXIT_POINT_ERRORS;
+  return EXIT_CONVERTED;
+}
+
+// CLASSIFICATION: UNCLASSIFIED
@@ -68,6 +68,8 @@
  *    03-29-11          S. Gillis, BAEts28564, Fixed Windows memory crash
  *    06-09-11          K. Lam, BAEts28972, Fixed the timer for file processing
  *    11-30-11          K.Lam, BAEts29174, Set output format for file operation
+ *    10-19-26          Timer is local to convertFile so files can be
+ *                      converted on concurrent threads
  */
 
 
@@ -724,7 +726,7 @@ void Fiomeths::convertFile()
 
   long MAX_CONVERSIONS = 100000;
 
-  static clock_t startTime, stopTime;
+  clock_t startTime, stopTime;
   startTime = clock();
 
   while (!feof(inputFile))
@@ -8,6 +8,7 @@
 * DATE      NAME        DR#               DESCRIPTION
 *
 * 03/29/11  S. Gillis   BAEts28564        Fixed Windows memory crash
+* 10/19/26                                Parse DMS strings without strtok
 ******************************************************************************/
 
 #include <string.h>
@@ -26,6 +27,29 @@ char Lat_Long_Sep = ' ';
 Range Long_Range = _180_180;
 Precision::Enum Lat_Long_Prec = Precision::tenthOfSecond;
 
+/*
+ * Next_Token returns the next token of *rest delimited by any of the
+ * characters of delimiters, or NULL if none is left, and advances *rest
+ * past it.  It keeps no state of its own, unlike strtok, so strings can
+ * be parsed on several threads at once.
+ */
+static char* Next_Token(char** rest, const char* delimiters)
+{
+  char* token = *rest + strspn(*rest, delimiters);
+  if (*token == '\0')
+  {
+    *rest = token;
+    return NULL;
+  }
+
+  char* end = token + strcspn(token, delimiters);
+  if (*end != '\0')
+    *end++ = '\0';
+  *rest = end;
+
+  return token;
+}
+
 void Show_Leading_Zeros(int lz)
 {
   leading_zeros = lz;
@@ -723,21 +747,21 @@ SVC_Status String_to_Longitude(const char *str, double *val)
         sign = -1;
       }
 
-      next_Str = strtok(parse_String, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {
         degrees = atof(next_Str);
       }
 
-      next_Str = strtok(NULL, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {
         minutes = atof(next_Str);
       }
 
-      next_Str = strtok(NULL, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {
@@ -1132,21 +1156,21 @@ SVC_Status String_to_Latitude(const char *str, double *val)
         sign = -1;
       }
 
-      next_Str = strtok(parse_String, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {
         degrees = atof(next_Str);
       }
 
-      next_Str = strtok(NULL, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {
         minutes = atof(next_Str);
       }
 
-      next_Str = strtok(NULL, ":/ ");
+      next_Str = Next_Token(&parse_String, ":/ ");
 
       if (next_Str != NULL)
       {